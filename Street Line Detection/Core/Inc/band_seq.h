@@ -0,0 +1,44 @@
+/**
+  ******************************************************************************
+  * @file           : band_seq.h
+  * @brief          : Header for band_seq.c file.
+  *                   Line numbering of the bands streamed by the DCMI DMA.
+  *                   Hardware independent.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __BAND_SEQ_H
+#define __BAND_SEQ_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Band sequencer state. next_line is written from both the DMA and
+  *        the VSYNC interrupts.
+  */
+typedef struct
+{
+  uint32_t lines;               // Captured lines per frame
+  uint32_t band_lines;          // Lines per band, divides lines
+  uint32_t first_line;          // Bands ending above this line are not delivered
+  volatile uint32_t next_line;  // Frame line of the next band
+  volatile uint32_t extra;      // Bands dropped past the end of a frame
+} BandSeq_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+int32_t  BandSeq_Init(BandSeq_t *seq, uint32_t lines, uint32_t band_lines, uint32_t first_line);
+void     BandSeq_FrameStart(BandSeq_t *seq);
+uint32_t BandSeq_BandComplete(BandSeq_t *seq, uint32_t *first_line);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BAND_SEQ_H */
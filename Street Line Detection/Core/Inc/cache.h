@@ -0,0 +1,49 @@
+/**
+  ******************************************************************************
+  * @file           : cache.h
+  * @brief          : Header for cache.c file.
+  *                   Cortex-M7 data cache maintenance around DMA transfers.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __CACHE_H
+#define __CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define CACHE_LINE_BYTES   32U  // Cortex-M7 D-cache line
+
+// Optional DMA scratch area mapped non-cacheable by the MPU layout, so that
+// buffers placed in it need no maintenance. Power of two, 0 to disable.
+#ifndef CACHE_DMA_SCRATCH_BYTES
+#define CACHE_DMA_SCRATCH_BYTES  0U
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+// DMA buffers must own whole cache lines: maintenance by address acts on
+// full lines and would otherwise hit neighbouring variables
+#define CACHE_ALIGNED          __attribute__((aligned(CACHE_LINE_BYTES)))
+#define CACHE_ROUND_UP(bytes)  (((bytes) + CACHE_LINE_BYTES - 1U) & ~(CACHE_LINE_BYTES - 1U))
+#define CACHE_IS_ALIGNED(ptr)  ((((uint32_t)(ptr)) & (CACHE_LINE_BYTES - 1U)) == 0U)
+
+/* Exported variables --------------------------------------------------------*/
+#if (CACHE_DMA_SCRATCH_BYTES > 0U)
+extern uint8_t dma_scratch[CACHE_DMA_SCRATCH_BYTES];
+#endif
+
+/* Exported functions prototypes ---------------------------------------------*/
+void Cache_InvalidateForDma(const void *buffer, uint32_t bytes);
+void Cache_CleanForDma(const void *buffer, uint32_t bytes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CACHE_H */
@@ -0,0 +1,110 @@
+/**
+  ******************************************************************************
+  * @file           : capture.h
+  * @brief          : Header for capture.c file.
+  *                   Continuous DCMI capture into rotating frame buffers.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __CAPTURE_H
+#define __CAPTURE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "frame_ring.h"
+#include "band_seq.h"
+#include "roi.h"
+#include "ov7670.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define CAMERA_WIDTH            320  // Sensor output width (pixels)
+#define CAMERA_HEIGHT           240  // Sensor output height (pixels)
+#define CAMERA_BYTES_PER_PIXEL  2    // YUV422: two bytes per pixel
+
+#define CAMERA_SENSOR_RESOLUTION  OV7670_RES_QVGA    // Must match CAMERA_WIDTH x CAMERA_HEIGHT
+#define CAMERA_SENSOR_FORMAT      OV7670_FMT_YUV422  // Must match CAMERA_BYTES_PER_PIXEL
+#define CAMERA_FRAME_RATE         30                 // Target frames per second
+
+// Captured region: the road area below the horizon
+#define CAPTURE_ROI_X           0
+#define CAPTURE_ROI_Y           (CAMERA_HEIGHT / 2)
+#define CAPTURE_ROI_WIDTH       CAMERA_WIDTH
+#define CAPTURE_ROI_HEIGHT      (CAMERA_HEIGHT - CAPTURE_ROI_Y)
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Capture profiles: DCMI byte/line select applied to YUV422 input.
+  */
+typedef enum
+{
+  CAPTURE_PROFILE_FULL = 0,   // YUV422, every byte and line
+  CAPTURE_PROFILE_Y,          // Luma only: every other byte
+  CAPTURE_PROFILE_Y_HALF,     // Luma only, every other line
+  CAPTURE_PROFILE_Y_QUARTER,  // Luma of every other pixel, every other line
+  CAPTURE_PROFILE_COUNT
+} Capture_Profile_t;
+
+/* Exported macro ------------------------------------------------------------*/
+// Bytes and lines stored for a w x h window under a capture profile
+#define CAPTURE_PROFILE_LINE_BYTES(p, w)  (((p) == CAPTURE_PROFILE_FULL) ? ((w) * CAMERA_BYTES_PER_PIXEL) : \
+                                           ((p) == CAPTURE_PROFILE_Y_QUARTER) ? ((w) / 2) : (w))
+#define CAPTURE_PROFILE_LINES(p, h)       ((((p) == CAPTURE_PROFILE_Y_HALF) || ((p) == CAPTURE_PROFILE_Y_QUARTER)) ? \
+                                           ((h) / 2) : (h))
+
+/* Exported constants --------------------------------------------------------*/
+#define CAPTURE_PROFILE         CAPTURE_PROFILE_Y  // Detector works on luma only
+
+#define CAPTURE_BUFFER_COUNT    2U   // Rotating frame buffers (2 or 3)
+#define CAPTURE_LINE_BYTES      CAPTURE_PROFILE_LINE_BYTES(CAPTURE_PROFILE, CAPTURE_ROI_WIDTH)
+#define CAPTURE_LINES           CAPTURE_PROFILE_LINES(CAPTURE_PROFILE, CAPTURE_ROI_HEIGHT)
+#define CAPTURE_FRAME_BYTES     (CAPTURE_LINE_BYTES * CAPTURE_LINES)
+
+#define CAPTURE_BAND_LINES      8U   // Default lines per streamed band
+
+_Static_assert((CAPTURE_LINES % CAPTURE_BAND_LINES) == 0U, "CAPTURE_BAND_LINES must divide the captured lines");
+
+/**
+  * @brief Band processing callback, called from the DMA interrupt.
+  * @param band: first byte of the band
+  * @param line_bytes: line pitch of the band (bytes)
+  * @param first_line: captured line number of the first line in the band,
+  *        counted from the top of the region of interest
+  * @param lines: number of lines in the band
+  * @note  The DMA overwrites this band after one more band time, so the
+  *        callback must consume or copy it within that budget.
+  */
+typedef void (*Capture_BandCallback_t)(const uint8_t *band, uint32_t line_bytes, uint32_t first_line, uint32_t lines);
+
+/**
+  * @brief Row-band streaming configuration.
+  */
+typedef struct
+{
+  uint8_t *buffer;                  // 2 * band_lines * line bytes, CACHE_ALIGNED
+  uint32_t band_lines;              // Lines per band, must divide the captured height;
+                                    // a band must be a whole number of cache lines
+  uint32_t first_line;              // Bands ending above this line are not delivered
+  Capture_BandCallback_t callback;  // Band consumer
+} Capture_StreamConfig_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+HAL_StatusTypeDef Capture_SetProfile(DCMI_HandleTypeDef *hdcmi, Capture_Profile_t profile);
+HAL_StatusTypeDef Capture_SetRoi(DCMI_HandleTypeDef *hdcmi, const Roi_t *roi);
+const Roi_Crop_t *Capture_GetCrop(void);
+HAL_StatusTypeDef Capture_Start(DCMI_HandleTypeDef *hdcmi, uint8_t *const buffers[], uint32_t count, uint32_t buffer_bytes);
+HAL_StatusTypeDef Capture_StartStreaming(DCMI_HandleTypeDef *hdcmi, const Capture_StreamConfig_t *config);
+HAL_StatusTypeDef Capture_Stop(void);
+uint8_t *Capture_AcquireFrame(uint32_t *sequence);
+void     Capture_ReleaseFrame(void);
+uint32_t Capture_GetDroppedFrames(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CAPTURE_H */
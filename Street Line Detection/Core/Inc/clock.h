@@ -0,0 +1,32 @@
+/**
+  ******************************************************************************
+  * @file           : clock.h
+  * @brief          : Header for clock.c file.
+  *                   Applies clock profiles to the RCC and PWR.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __CLOCK_H
+#define __CLOCK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "clock_plan.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define CLOCK_PROFILE_BOOT   CLOCK_PROFILE_PERFORMANCE  // Applied by SystemClock_Config()
+
+/* Exported functions prototypes ---------------------------------------------*/
+HAL_StatusTypeDef Clock_ApplyProfile(ClockPlan_Profile_t profile);
+const ClockPlan_t *Clock_GetPlan(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CLOCK_H */
@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file           : clock_plan.h
+  * @brief          : Header for clock_plan.c file.
+  *                   System clock profiles, PLL1 solver and flash/bus limits.
+  *                   Hardware independent.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __CLOCK_PLAN_H
+#define __CLOCK_PLAN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+// PLL1 limits (STM32H743 revision V)
+#define CLOCK_PLAN_PLL_M_MAX          63U
+#define CLOCK_PLAN_PLL_N_MIN          4U
+#define CLOCK_PLAN_PLL_N_MAX          512U
+#define CLOCK_PLAN_PLL_P_MAX          128U        // Even values only on PLL1
+#define CLOCK_PLAN_VCI_MIN_HZ         1000000U
+#define CLOCK_PLAN_VCI_MAX_HZ         16000000U
+#define CLOCK_PLAN_VCI_WIDE_MIN_HZ    2000000U    // Wide VCO needs VCI >= 2 MHz
+#define CLOCK_PLAN_VCO_WIDE_MIN_HZ    192000000U
+#define CLOCK_PLAN_VCO_WIDE_MAX_HZ    960000000U
+#define CLOCK_PLAN_VCO_MEDIUM_MIN_HZ  150000000U
+#define CLOCK_PLAN_VCO_MEDIUM_MAX_HZ  420000000U
+
+// DCMI: PIXCLK may not exceed HCLK / 2.5, nor 80 MHz
+#define CLOCK_PLAN_DCMI_PIXCLK_MAX_HZ 80000000U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Clock profiles.
+  */
+typedef enum
+{
+  CLOCK_PROFILE_PERFORMANCE = 0,  // 480 MHz CPU, VOS0 (overdrive)
+  CLOCK_PROFILE_BALANCED,         // 400 MHz CPU, VOS1
+  CLOCK_PROFILE_LOW_POWER,        // 64 MHz CPU straight from HSI, VOS3, PLL off
+  CLOCK_PROFILE_COUNT
+} ClockPlan_Profile_t;
+
+/**
+  * @brief Core voltage scaling, VOS0 being the highest voltage.
+  */
+typedef enum
+{
+  CLOCK_PLAN_VOS0 = 0,
+  CLOCK_PLAN_VOS1,
+  CLOCK_PLAN_VOS2,
+  CLOCK_PLAN_VOS3,
+  CLOCK_PLAN_VOS_COUNT
+} ClockPlan_Vos_t;
+
+/**
+  * @brief PLL1 dividers: out = ref / m * n / p.
+  */
+typedef struct
+{
+  uint32_t m;          // Reference divider (DIVM1)
+  uint32_t n;          // Multiplier (DIVN1)
+  uint32_t p;          // System clock output divider (DIVP1)
+  uint32_t vci_hz;     // PLL input frequency, ref / m
+  uint32_t vco_hz;     // VCO frequency
+  uint32_t out_hz;     // P output frequency
+  uint8_t  vco_wide;   // 1 for the wide VCO, 0 for the medium one
+} ClockPlan_Pll_t;
+
+/**
+  * @brief Complete clock tree for one profile.
+  */
+typedef struct
+{
+  uint8_t  use_pll;             // 0: SYSCLK is the reference oscillator itself
+  ClockPlan_Pll_t pll;          // Valid when use_pll is set
+  ClockPlan_Vos_t vos;
+  uint32_t sysclk_hz;           // CPU clock
+  uint32_t hclk_div;            // SYSCLK / HCLK
+  uint32_t hclk_hz;             // AXI / AHB clock, also clocks the DCMI
+  uint32_t apb_div;             // HCLK / PCLK, all four APB buses
+  uint32_t apb_hz;
+  uint32_t flash_latency;       // Flash wait states
+  uint32_t dcmi_pixclk_max_hz;  // Fastest camera pixel clock the DCMI accepts
+} ClockPlan_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+int32_t ClockPlan_SolvePll(uint32_t ref_hz, uint32_t target_hz, ClockPlan_Pll_t *pll);
+int32_t ClockPlan_FlashLatency(ClockPlan_Vos_t vos, uint32_t hclk_hz);
+int32_t ClockPlan_Build(ClockPlan_Profile_t profile, uint32_t ref_hz, ClockPlan_t *plan);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CLOCK_PLAN_H */
@@ -0,0 +1,54 @@
+/**
+  ******************************************************************************
+  * @file           : frame_ring.h
+  * @brief          : Header for frame_ring.c file.
+  *                   Rotation of capture frame buffers between the DCMI DMA
+  *                   and the processing loop. Hardware independent.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __FRAME_RING_H
+#define __FRAME_RING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define FRAME_RING_MAX_BUFFERS  3U          // Upper bound on rotating buffers
+#define FRAME_RING_NONE         0xFFFFFFFFU // Index value meaning "no buffer"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Frame buffer ring state.
+  *        Exactly one buffer is owned by the DMA (filling), at most one holds
+  *        the newest complete frame (ready) and at most one is held by the
+  *        processing loop (in_use). Any other buffer is free.
+  */
+typedef struct
+{
+  uint8_t *buffer[FRAME_RING_MAX_BUFFERS];
+  uint32_t count;                 // Number of buffers in the ring (2 or 3)
+  volatile uint32_t filling;      // Buffer index the DMA is writing
+  volatile uint32_t ready;        // Newest complete frame, or FRAME_RING_NONE
+  volatile uint32_t in_use;       // Frame held by the consumer, or FRAME_RING_NONE
+  volatile uint32_t sequence;     // Number of frames published as ready
+  volatile uint32_t dropped;      // Frames overwritten before being consumed
+} FrameRing_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+int32_t  FrameRing_Init(FrameRing_t *ring, uint8_t *const buffers[], uint32_t count);
+uint8_t *FrameRing_DmaTarget(const FrameRing_t *ring);
+uint8_t *FrameRing_FrameComplete(FrameRing_t *ring);
+uint8_t *FrameRing_Acquire(FrameRing_t *ring, uint32_t *sequence);
+void     FrameRing_Release(FrameRing_t *ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FRAME_RING_H */
@@ -0,0 +1,31 @@
+/**
+  ******************************************************************************
+  * @file           : ipm_lut.h
+  * @brief          : Header for ipm_lut.c file.
+  *                   Generated by Vision/Tools/ipm_lut_gen.c, do not edit.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __IPM_LUT_H
+#define __IPM_LUT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_ipm.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define IPM_LUT_WIDTH   160U  // Bird's-eye columns
+#define IPM_LUT_HEIGHT  120U  // Bird's-eye rows, far to near
+
+/* Exported variables --------------------------------------------------------*/
+extern const Vision_IpmLut_t ipm_lut;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IPM_LUT_H */
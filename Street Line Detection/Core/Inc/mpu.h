@@ -0,0 +1,28 @@
+/**
+  ******************************************************************************
+  * @file           : mpu.h
+  * @brief          : Header for mpu.c file.
+  *                   MPU region layout of the application memory.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __MPU_H
+#define __MPU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "mpu_map.h"
+
+/* Exported functions prototypes ---------------------------------------------*/
+HAL_StatusTypeDef Mpu_ApplyLayout(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MPU_H */
@@ -0,0 +1,56 @@
+/**
+  ******************************************************************************
+  * @file           : mpu_map.h
+  * @brief          : Header for mpu_map.c file.
+  *                   Encoding of address ranges into Cortex-M7 MPU regions.
+  *                   Hardware independent.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __MPU_MAP_H
+#define __MPU_MAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define MPU_MAP_MIN_SIZE_LOG2     5U   // 32 bytes
+#define MPU_MAP_SUBREGION_LOG2    8U   // Subregions exist from 256-byte regions up
+#define MPU_MAP_SUBREGIONS        8U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Memory attributes used by the layout.
+  */
+typedef enum
+{
+  MPU_MAP_WRITE_BACK = 0,   // Normal, write-back / write-allocate
+  MPU_MAP_WRITE_THROUGH,    // Normal, write-through / no write-allocate
+  MPU_MAP_NON_CACHEABLE,    // Normal, not cacheable
+  MPU_MAP_NO_ACCESS         // Any access faults
+} MpuMap_Attr_t;
+
+/**
+  * @brief One MPU region as programmed into RBAR / RASR.
+  */
+typedef struct
+{
+  uint32_t base;        // Region base, aligned to the region size
+  uint8_t  size_field;  // RASR.SIZE: log2(region size) - 1
+  uint8_t  srd;         // Disabled subregions
+  uint32_t limit;       // First address after the enabled subregions
+} MpuMap_Region_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+int32_t MpuMap_Encode(uint32_t start, uint32_t end, MpuMap_Region_t *region);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MPU_MAP_H */
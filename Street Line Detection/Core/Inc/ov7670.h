@@ -0,0 +1,161 @@
+/**
+  ******************************************************************************
+  * @file           : ov7670.h
+  * @brief          : Header for ov7670.c file.
+  *                   OV7670 register presets and table-driven SCCB loader.
+  *                   Hardware independent: register access goes through an
+  *                   OV7670_Bus_t supplied by the caller.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __OV7670_H
+#define __OV7670_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define OV7670_SCCB_ADDR      0x42U  // 8-bit write address (7-bit 0x21)
+#define OV7670_PID_VALUE      0x76U
+#define OV7670_VER_VALUE      0x73U
+
+/* Return codes */
+#define OV7670_OK             0
+#define OV7670_ERR_PARAM      (-1)
+#define OV7670_ERR_BUS        (-2)
+#define OV7670_ERR_ID         (-3)
+#define OV7670_ERR_VERIFY     (-4)
+
+/* Registers used by the presets */
+#define OV7670_REG_GAIN       0x00U
+#define OV7670_REG_BLUE       0x01U
+#define OV7670_REG_RED        0x02U
+#define OV7670_REG_VREF       0x03U
+#define OV7670_REG_COM1       0x04U
+#define OV7670_REG_PID        0x0AU
+#define OV7670_REG_VER        0x0BU
+#define OV7670_REG_COM3       0x0CU
+#define OV7670_REG_COM4       0x0DU
+#define OV7670_REG_AECH       0x10U
+#define OV7670_REG_CLKRC      0x11U
+#define OV7670_REG_COM7       0x12U
+#define OV7670_REG_COM8       0x13U
+#define OV7670_REG_COM9       0x14U
+#define OV7670_REG_COM10      0x15U
+#define OV7670_REG_HSTART     0x17U
+#define OV7670_REG_HSTOP      0x18U
+#define OV7670_REG_VSTART     0x19U
+#define OV7670_REG_VSTOP      0x1AU
+#define OV7670_REG_AEW        0x24U
+#define OV7670_REG_AEB        0x25U
+#define OV7670_REG_VPT        0x26U
+#define OV7670_REG_HREF       0x32U
+#define OV7670_REG_TSLB       0x3AU
+#define OV7670_REG_COM13      0x3DU
+#define OV7670_REG_COM14      0x3EU
+#define OV7670_REG_COM15      0x40U
+#define OV7670_REG_COM16      0x41U
+#define OV7670_REG_DBLV       0x6BU
+#define OV7670_REG_SCALING_XSC      0x70U
+#define OV7670_REG_SCALING_YSC      0x71U
+#define OV7670_REG_SCALING_DCWCTR   0x72U
+#define OV7670_REG_SCALING_PCLK_DIV 0x73U
+#define OV7670_REG_REG76      0x76U
+#define OV7670_REG_RGB444     0x8CU
+#define OV7670_REG_HAECC1     0x9FU
+#define OV7670_REG_HAECC2     0xA0U
+#define OV7670_REG_SCALING_PCLK_DELAY 0xA2U
+#define OV7670_REG_BD50MAX    0xA5U
+#define OV7670_REG_HAECC3     0xA6U
+#define OV7670_REG_HAECC4     0xA7U
+#define OV7670_REG_HAECC5     0xA8U
+#define OV7670_REG_HAECC6     0xA9U
+#define OV7670_REG_HAECC7     0xAAU
+#define OV7670_REG_BD60MAX    0xABU
+
+#define OV7670_COM7_RESET     0x80U
+#define OV7670_COM1_CCIR656   0x40U  // Embedded sync codes in the data
+#define OV7670_COM10_PCLK_REV 0x10U  // Data valid on the PCLK falling edge
+#define OV7670_COM10_HREF_REV 0x08U  // HREF active low
+#define OV7670_COM10_VS_NEG   0x02U  // VSYNC active low
+
+/*
+ * Sync output the DCMI expects (MX_DCMI_Init): HREF and VSYNC on their own
+ * pins, both active high, data valid on the PCLK rising edge, no CCIR656.
+ */
+#define OV7670_COM10_SYNC     0x00U
+
+/* Sensor clocking */
+#define OV7670_XCLK_MIN_HZ        10000000U
+#define OV7670_XCLK_MAX_HZ        48000000U
+#define OV7670_CLKRC_MAX_DIV      64U        // CLKRC[5:0] + 1
+#define OV7670_CLOCKS_PER_FRAME   (2U * 784U * 510U)  // Internal clocks per VGA-timed frame
+
+/* Table pseudo-registers (not OV7670 addresses) */
+#define OV7670_TABLE_DELAY    0xFEU  // value = delay in ms
+#define OV7670_TABLE_END      0xFFU
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint8_t reg;
+  uint8_t value;
+} OV7670_Reg_t;
+
+typedef enum
+{
+  OV7670_RES_VGA = 0,    // 640x480
+  OV7670_RES_QVGA,       // 320x240
+  OV7670_RES_QQVGA,      // 160x120
+  OV7670_RES_COUNT
+} OV7670_Resolution_t;
+
+typedef enum
+{
+  OV7670_FMT_YUV422 = 0, // Y U Y V
+  OV7670_FMT_RGB565,
+  OV7670_FMT_BAYER_RAW,  // VGA only
+  OV7670_FMT_COUNT
+} OV7670_Format_t;
+
+/**
+  * @brief XCLK timer setting and sensor prescaler for a target frame rate.
+  */
+typedef struct
+{
+  uint32_t timer_period;  // Timer clocks per XCLK period (ARR + 1)
+  uint32_t clkrc_div;     // Sensor internal clock divider, CLKRC[5:0] + 1
+  uint32_t xclk_hz;       // Resulting XCLK frequency
+  uint32_t fps_milli;     // Resulting frame rate (1/1000 fps)
+} OV7670_ClockConfig_t;
+
+/**
+  * @brief Register access used by the loader. Each function returns 0 on
+  *        success; delay_ms may be NULL if no wait is needed (e.g. a mock).
+  */
+typedef struct
+{
+  int32_t (*write)(void *ctx, uint8_t reg, uint8_t value);
+  int32_t (*read)(void *ctx, uint8_t reg, uint8_t *value);
+  void    (*delay_ms)(void *ctx, uint32_t ms);
+  void    *ctx;
+} OV7670_Bus_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+int32_t OV7670_Init(const OV7670_Bus_t *bus, OV7670_Resolution_t resolution, OV7670_Format_t format);
+int32_t OV7670_CheckId(const OV7670_Bus_t *bus);
+int32_t OV7670_SolveClock(uint32_t timer_clock_hz, uint32_t fps, OV7670_ClockConfig_t *config);
+int32_t OV7670_SetClockDivider(const OV7670_Bus_t *bus, uint32_t clkrc_div);
+int32_t OV7670_WriteTable(const OV7670_Bus_t *bus, const OV7670_Reg_t *table);
+int32_t OV7670_VerifyTable(const OV7670_Bus_t *bus, const OV7670_Reg_t *table, uint8_t *failed_reg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __OV7670_H */
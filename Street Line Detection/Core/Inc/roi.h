@@ -0,0 +1,74 @@
+/**
+  ******************************************************************************
+  * @file           : roi.h
+  * @brief          : Header for roi.c file.
+  *                   Region-of-interest to DCMI crop window conversion.
+  *                   Hardware independent.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __ROI_H
+#define __ROI_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define ROI_HOFFCNT_MAX   0x3FFFU  // CWSTRT.HOFFCNT field width
+#define ROI_VST_MAX       0x1FFFU  // CWSTRT.VST field width
+#define ROI_CAPCNT_MAX    0x3FFFU  // CWSIZE.CAPCNT field width
+#define ROI_VLINE_MAX     0x3FFFU  // CWSIZE.VLINE field width
+#define ROI_DMA_MAX_WORDS 0xFFFFU  // Single DMA transfer limit
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Rectangle in sensor pixels.
+  */
+typedef struct
+{
+  uint16_t x;
+  uint16_t y;
+  uint16_t width;
+  uint16_t height;
+} Roi_t;
+
+/**
+  * @brief Pixel format on the DCMI bus and the hardware decimation applied
+  *        after cropping (byte select / line select).
+  */
+typedef struct
+{
+  uint8_t bytes_per_pixel;   // Bytes per pixel on the DCMI bus
+  uint8_t byte_step;         // One byte stored out of byte_step (1, 2 or 4)
+  uint8_t line_step;         // One line stored out of line_step (1 or 2)
+} Roi_Format_t;
+
+/**
+  * @brief DCMI crop register values and the resulting transfer geometry.
+  */
+typedef struct
+{
+  uint32_t x0;           // CWSTRT.HOFFCNT: pixel clocks skipped per line
+  uint32_t y0;           // CWSTRT.VST: lines skipped per frame
+  uint32_t xsize;        // CWSIZE.CAPCNT: pixel clocks captured per line, minus one
+  uint32_t ysize;        // CWSIZE.VLINE: lines captured per frame, minus one
+  uint32_t line_bytes;   // Bytes stored per captured line
+  uint32_t lines;        // Lines stored per frame
+  uint32_t frame_bytes;  // Bytes stored per frame
+  uint32_t dma_words;    // DMA transfer count (32-bit words) per frame
+} Roi_Crop_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+int32_t Roi_ComputeCrop(const Roi_t *roi, uint32_t sensor_width, uint32_t sensor_height,
+                        const Roi_Format_t *format, Roi_Crop_t *crop);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ROI_H */
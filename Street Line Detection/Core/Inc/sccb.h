@@ -0,0 +1,31 @@
+/**
+  ******************************************************************************
+  * @file           : sccb.h
+  * @brief          : Header for sccb.c file.
+  *                   OV7670 register access over SCCB using the HAL I2C driver.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __SCCB_H
+#define __SCCB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "ov7670.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define SCCB_TIMEOUT_MS   10U
+
+/* Exported functions prototypes ---------------------------------------------*/
+void SCCB_InitBus(OV7670_Bus_t *bus, I2C_HandleTypeDef *hi2c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SCCB_H */
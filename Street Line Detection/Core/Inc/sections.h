@@ -0,0 +1,51 @@
+/**
+  ******************************************************************************
+  * @file           : sections.h
+  * @brief          : Placement of hot code and buffers in the TCMs and the
+  *                   domain SRAMs.
+  ******************************************************************************
+  * The output sections are defined in the linker scripts and initialised by
+  * the startup code before main():
+  *
+  *   FAST_CODE    .itcm_text   ITCM, 0 wait states, copied from flash
+  *   FAST_DATA    .dtcm_data   DTCM, 0 wait states, copied from flash
+  *   FAST_BSS     .dtcm_bss    DTCM, zeroed
+  *   LINE_BUFFER  .dtcm_bss    DTCM, zeroed, cache-line aligned rows
+  *   DMA_BUFFER   .dma_buffer  D2 SRAM, zeroed, not cacheable (see mpu.c)
+  *
+  * The TCMs are only reachable by the CPU and the MDMA: DMA1/DMA2 (and so
+  * the DCMI) must write to DMA_BUFFER or AXI SRAM. Kernels copy the rows
+  * they work on into LINE_BUFFER storage.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __SECTIONS_H
+#define __SECTIONS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+#if defined(__GNUC__) && defined(__arm__)
+// ITCM sits 128 MB away from flash: calls from flash need a long branch
+#define FAST_CODE    __attribute__((section(".itcm_text"), long_call, noinline))
+#define FAST_DATA    __attribute__((section(".dtcm_data")))
+#define FAST_BSS     __attribute__((section(".dtcm_bss")))
+#define LINE_BUFFER  __attribute__((section(".dtcm_bss"), aligned(32)))
+#define DMA_BUFFER   __attribute__((section(".dma_buffer"), aligned(32)))
+#else
+// Host builds: ordinary placement
+#define FAST_CODE
+#define FAST_DATA
+#define FAST_BSS
+#define LINE_BUFFER
+#define DMA_BUFFER
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SECTIONS_H */
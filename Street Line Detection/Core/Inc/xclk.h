@@ -0,0 +1,34 @@
+/**
+  ******************************************************************************
+  * @file           : xclk.h
+  * @brief          : Header for xclk.c file.
+  *                   Camera XCLK generation from a timer PWM channel.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __XCLK_H
+#define __XCLK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "ov7670.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define XCLK_TIM_CHANNEL   TIM_CHANNEL_1
+
+/* Exported functions prototypes ---------------------------------------------*/
+uint32_t          Xclk_GetTimerClock(void);
+HAL_StatusTypeDef Xclk_Start(TIM_HandleTypeDef *htim, uint32_t fps, OV7670_ClockConfig_t *applied);
+HAL_StatusTypeDef Xclk_SetFrameRate(TIM_HandleTypeDef *htim, const OV7670_Bus_t *bus, uint32_t fps, OV7670_ClockConfig_t *applied);
+HAL_StatusTypeDef Xclk_Stop(TIM_HandleTypeDef *htim);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __XCLK_H */
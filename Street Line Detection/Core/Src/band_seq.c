@@ -0,0 +1,81 @@
+/**
+  ******************************************************************************
+  * @file           : band_seq.c
+  * @brief          : Line numbering of the bands streamed by the DCMI DMA.
+  ******************************************************************************
+  * This module holds no hardware references so that the band sequencing can
+  * be compiled and exercised on a host. In band mode the capture driver
+  * calls BandSeq_BandComplete() from the DMA half-transfer and
+  * transfer-complete interrupts, and BandSeq_FrameStart() from VSYNC and
+  * whenever it re-arms the DMA.
+  *
+  * The DMA does not know where a frame starts: the line counter simply
+  * advances one band per interrupt and VSYNC sets it back to zero. Bands
+  * that arrive after the last line of a frame but before VSYNC (the sensor
+  * sent more lines than configured) are dropped rather than numbered past
+  * the frame.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "band_seq.h"
+
+#include <stddef.h>
+
+/**
+  * @brief  Initialise the sequencer; the first band is line 0 of a frame.
+  * @param  seq: sequencer to initialise
+  * @param  lines: captured lines per frame
+  * @param  band_lines: lines per band, must divide @p lines
+  * @param  first_line: bands ending above this line are not delivered
+  * @retval 0 on success, -1 on invalid arguments
+  */
+int32_t BandSeq_Init(BandSeq_t *seq, uint32_t lines, uint32_t band_lines, uint32_t first_line)
+{
+  if ((seq == NULL) || (band_lines == 0U) || ((lines % band_lines) != 0U))
+  {
+    return -1;
+  }
+
+  seq->lines = lines;
+  seq->band_lines = band_lines;
+  seq->first_line = first_line;
+  seq->next_line = 0;
+  seq->extra = 0;
+
+  return 0;
+}
+
+/**
+  * @brief  Frame boundary: the next band is the first of a frame.
+  * @param  seq: band sequencer
+  * @retval None
+  */
+void BandSeq_FrameStart(BandSeq_t *seq)
+{
+  seq->next_line = 0;
+}
+
+/**
+  * @brief  Number the band the DMA just completed and decide whether it is
+  *         delivered.
+  * @param  seq: band sequencer
+  * @param  first_line: receives the frame line of the band's first line
+  * @retval 1 if the band goes to the consumer, 0 if it is skipped
+  */
+uint32_t BandSeq_BandComplete(BandSeq_t *seq, uint32_t *first_line)
+{
+  uint32_t line = seq->next_line;
+
+  if (line >= seq->lines)
+  {
+    // Extra band before VSYNC: the frame is longer than configured
+    seq->extra++;
+    return 0U;
+  }
+
+  seq->next_line = line + seq->band_lines;
+  *first_line = line;
+
+  return ((line + seq->band_lines) > seq->first_line) ? 1U : 0U;
+}
@@ -0,0 +1,56 @@
+/**
+  ******************************************************************************
+  * @file           : cache.c
+  * @brief          : Cortex-M7 data cache maintenance around DMA transfers.
+  ******************************************************************************
+  * The DMA does not go through the D-cache. After a DMA write the CPU may
+  * still hold lines it fetched (or speculatively prefetched) while the
+  * transfer was running, so a buffer is invalidated once the transfer is
+  * complete and before it is read. Before a DMA read, lines the CPU wrote
+  * are cleaned to memory.
+  *
+  * Buffers are expected to be CACHE_ALIGNED and a whole number of lines;
+  * the ranges are nevertheless widened to full lines here.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "cache.h"
+
+/**
+  * @brief  Discard cached copies of a buffer the DMA has just written.
+  * @param  buffer: start of the buffer
+  * @param  bytes: length written by the DMA
+  * @retval None
+  */
+void Cache_InvalidateForDma(const void *buffer, uint32_t bytes)
+{
+  uint32_t start = (uint32_t)buffer & ~(CACHE_LINE_BYTES - 1U);
+  uint32_t end = CACHE_ROUND_UP((uint32_t)buffer + bytes);
+
+  if ((SCB->CCR & SCB_CCR_DC_Msk) == 0U)
+  {
+    return;
+  }
+
+  SCB_InvalidateDCache_by_Addr((void *)start, (int32_t)(end - start));
+}
+
+/**
+  * @brief  Write back CPU changes to a buffer the DMA is about to read.
+  * @param  buffer: start of the buffer
+  * @param  bytes: length read by the DMA
+  * @retval None
+  */
+void Cache_CleanForDma(const void *buffer, uint32_t bytes)
+{
+  uint32_t start = (uint32_t)buffer & ~(CACHE_LINE_BYTES - 1U);
+  uint32_t end = CACHE_ROUND_UP((uint32_t)buffer + bytes);
+
+  if ((SCB->CCR & SCB_CCR_DC_Msk) == 0U)
+  {
+    return;
+  }
+
+  SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+}
@@ -0,0 +1,462 @@
+/**
+  ******************************************************************************
+  * @file           : capture.c
+  * @brief          : Continuous DCMI capture into rotating frame buffers.
+  ******************************************************************************
+  * The captured area is a region of interest programmed into the DCMI crop
+  * window (Capture_SetRoi()); transfer lengths and line pitch follow it, so
+  * bus bandwidth and memory scale with the road area, not the sensor. A
+  * capture profile (Capture_SetProfile()) additionally uses DCMI byte and
+  * line select to keep only luma and optionally decimate it, at no CPU cost.
+  *
+  * Buffers must be CACHE_ALIGNED: every frame or band is invalidated from
+  * the D-cache when the DMA completes it, before the consumer sees it.
+  *
+  * Two capture modes are provided:
+  *
+  * - Frame mode: every frame is taken as a DCMI snapshot. The frame-complete
+  *   interrupt hands the filled buffer to the frame ring and re-arms the next
+  *   snapshot on the buffer the ring selects, inside the vertical blanking
+  *   interval, so no frame is skipped while the processing loop works on the
+  *   previous one.
+  *
+  * - Band mode: the DCMI runs in continuous mode and the circular DMA cycles
+  *   over a buffer of two bands of N lines. The half-transfer and
+  *   transfer-complete interrupts each deliver one band to the processing
+  *   callback while the DMA fills the other half, so rows are filtered as
+  *   they arrive and no full frame is ever stored. VSYNC realigns the line
+  *   counter at every frame boundary; the numbering is done by band_seq.c.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "capture.h"
+#include "cache.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef enum
+{
+  CAPTURE_MODE_FRAMES = 0,
+  CAPTURE_MODE_BANDS
+} Capture_Mode_t;
+
+typedef struct
+{
+  Roi_Format_t format;     // Geometry seen by the DMA
+  uint32_t byte_select;    // DCMI_BSM_xxx
+  uint32_t line_select;    // DCMI_LSM_xxx
+} Capture_ProfileDef_t;
+
+/* Private variables ---------------------------------------------------------*/
+// OV7670 YUV422 is sent Y U Y V: odd-byte select keeps Y, one byte out of
+// four keeps the Y of every other pixel
+static const Capture_ProfileDef_t capture_profiles[CAPTURE_PROFILE_COUNT] =
+{
+  [CAPTURE_PROFILE_FULL]      = { { CAMERA_BYTES_PER_PIXEL, 1, 1 }, DCMI_BSM_ALL,         DCMI_LSM_ALL },
+  [CAPTURE_PROFILE_Y]         = { { CAMERA_BYTES_PER_PIXEL, 2, 1 }, DCMI_BSM_OTHER,       DCMI_LSM_ALL },
+  [CAPTURE_PROFILE_Y_HALF]    = { { CAMERA_BYTES_PER_PIXEL, 2, 2 }, DCMI_BSM_OTHER,       DCMI_LSM_ALTERNATE_2 },
+  [CAPTURE_PROFILE_Y_QUARTER] = { { CAMERA_BYTES_PER_PIXEL, 4, 2 }, DCMI_BSM_ALTERNATE_4, DCMI_LSM_ALTERNATE_2 },
+};
+
+static DCMI_HandleTypeDef *capture_dcmi;
+static Capture_Mode_t capture_mode;
+static Capture_Profile_t capture_profile = CAPTURE_PROFILE_FULL;
+static Roi_t capture_roi = { 0, 0, CAMERA_WIDTH, CAMERA_HEIGHT };
+static Roi_Crop_t capture_crop;     // Stored geometry for capture_roi/profile
+static uint8_t capture_crop_valid;
+static FrameRing_t capture_ring;
+static uint32_t capture_words;      // DMA transfer length per arm (words)
+
+static Capture_StreamConfig_t capture_stream;
+static BandSeq_t capture_bands;
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef Capture_Arm(uint8_t *buffer);
+static HAL_StatusTypeDef Capture_ArmStreaming(void);
+static void Capture_BandHalfComplete(DMA_HandleTypeDef *hdma);
+static void Capture_BandComplete(DMA_HandleTypeDef *hdma);
+static void Capture_DeliverBand(uint32_t half);
+static const Roi_Crop_t *Capture_Geometry(void);
+
+/**
+  * @brief  Select the capture profile (byte/line select). The current region
+  *         of interest is kept. Must be called while capture is stopped.
+  * @param  hdcmi: initialised DCMI handle
+  * @param  profile: capture profile
+  * @retval HAL status, HAL_ERROR if the current ROI cannot use this profile
+  */
+HAL_StatusTypeDef Capture_SetProfile(DCMI_HandleTypeDef *hdcmi, Capture_Profile_t profile)
+{
+  Roi_Crop_t crop;
+
+  if (capture_dcmi != NULL)
+  {
+    return HAL_BUSY;
+  }
+  if ((hdcmi == NULL) || (profile >= CAPTURE_PROFILE_COUNT) ||
+      (Roi_ComputeCrop(&capture_roi, CAMERA_WIDTH, CAMERA_HEIGHT, &capture_profiles[profile].format, &crop) != 0))
+  {
+    return HAL_ERROR;
+  }
+
+  hdcmi->Init.ByteSelectMode = capture_profiles[profile].byte_select;
+  hdcmi->Init.ByteSelectStart = DCMI_OEBS_ODD;
+  hdcmi->Init.LineSelectMode = capture_profiles[profile].line_select;
+  hdcmi->Init.LineSelectStart = DCMI_OELS_ODD;
+  if (HAL_DCMI_Init(hdcmi) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  capture_profile = profile;
+  capture_crop = crop;
+  capture_crop_valid = 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Select the region of interest captured by the DCMI crop window.
+  *         Must be called while capture is stopped.
+  * @param  hdcmi: initialised DCMI handle
+  * @param  roi: rectangle in sensor pixels
+  * @retval HAL status, HAL_ERROR if the rectangle cannot be captured
+  */
+HAL_StatusTypeDef Capture_SetRoi(DCMI_HandleTypeDef *hdcmi, const Roi_t *roi)
+{
+  Roi_Crop_t crop;
+
+  if (capture_dcmi != NULL)
+  {
+    return HAL_BUSY;
+  }
+  if ((hdcmi == NULL) ||
+      (Roi_ComputeCrop(roi, CAMERA_WIDTH, CAMERA_HEIGHT, &capture_profiles[capture_profile].format, &crop) != 0))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((roi->width == CAMERA_WIDTH) && (roi->height == CAMERA_HEIGHT))
+  {
+    (void)HAL_DCMI_DisableCrop(hdcmi);
+  }
+  else
+  {
+    (void)HAL_DCMI_ConfigCrop(hdcmi, crop.x0, crop.y0, crop.xsize, crop.ysize);
+    (void)HAL_DCMI_EnableCrop(hdcmi);
+  }
+
+  capture_roi = *roi;
+  capture_crop = crop;
+  capture_crop_valid = 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Geometry of the captured area (line pitch, lines, frame size).
+  * @retval Crop configuration in effect
+  */
+const Roi_Crop_t *Capture_GetCrop(void)
+{
+  return Capture_Geometry();
+}
+
+/**
+  * @brief  Start continuous capture into a ring of frame buffers.
+  * @param  hdcmi: initialised DCMI handle with its DMA linked
+  * @param  buffers: frame buffers, CACHE_ALIGNED
+  * @param  count: number of buffers, 2 to FRAME_RING_MAX_BUFFERS
+  * @param  buffer_bytes: capacity of each buffer, at least one captured frame
+  *         rounded up to whole cache lines
+  * @retval HAL status
+  */
+HAL_StatusTypeDef Capture_Start(DCMI_HandleTypeDef *hdcmi, uint8_t *const buffers[], uint32_t count, uint32_t buffer_bytes)
+{
+  const Roi_Crop_t *crop = Capture_Geometry();
+  uint32_t i;
+
+  if ((hdcmi == NULL) || (buffers == NULL) || (CACHE_ROUND_UP(crop->frame_bytes) > buffer_bytes))
+  {
+    return HAL_ERROR;
+  }
+
+  for (i = 0; i < count; i++)
+  {
+    if (!CACHE_IS_ALIGNED(buffers[i]))
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  if (FrameRing_Init(&capture_ring, buffers, count) != 0)
+  {
+    return HAL_ERROR;
+  }
+
+  capture_dcmi = hdcmi;
+  capture_mode = CAPTURE_MODE_FRAMES;
+  capture_words = crop->dma_words;
+
+  return Capture_Arm(FrameRing_DmaTarget(&capture_ring));
+}
+
+/**
+  * @brief  Start row-band streaming: each band of config->band_lines lines is
+  *         passed to config->callback as soon as the DMA has written it.
+  * @param  hdcmi: initialised DCMI handle with its DMA linked
+  * @param  config: streaming configuration, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef Capture_StartStreaming(DCMI_HandleTypeDef *hdcmi, const Capture_StreamConfig_t *config)
+{
+  const Roi_Crop_t *crop = Capture_Geometry();
+  uint32_t ring_bytes;
+
+  if ((hdcmi == NULL) || (config == NULL) || (config->buffer == NULL) || (config->callback == NULL))
+  {
+    return HAL_ERROR;
+  }
+  if (BandSeq_Init(&capture_bands, crop->lines, config->band_lines, config->first_line) != 0)
+  {
+    return HAL_ERROR;
+  }
+  // Each band is invalidated on its own: it must start on a cache line
+  if (!CACHE_IS_ALIGNED(config->buffer) || !CACHE_IS_ALIGNED(config->band_lines * crop->line_bytes))
+  {
+    return HAL_ERROR;
+  }
+
+  ring_bytes = 2U * config->band_lines * crop->line_bytes;
+  if ((ring_bytes / 4U) > 0xFFFFU)
+  {
+    return HAL_ERROR;
+  }
+
+  capture_dcmi = hdcmi;
+  capture_mode = CAPTURE_MODE_BANDS;
+  capture_stream = *config;
+  capture_words = ring_bytes / 4U;
+
+  return Capture_ArmStreaming();
+}
+
+/**
+  * @brief  Stop the capture. Frames already published stay available.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef Capture_Stop(void)
+{
+  HAL_StatusTypeDef status;
+
+  if (capture_dcmi == NULL)
+  {
+    return HAL_OK;
+  }
+
+  HAL_NVIC_DisableIRQ(DCMI_IRQn);
+  __HAL_DCMI_DISABLE_IT(capture_dcmi, DCMI_IT_VSYNC);
+  status = HAL_DCMI_Stop(capture_dcmi);
+  capture_dcmi->DMA_Handle->XferHalfCpltCallback = NULL;
+  capture_dcmi = NULL;
+  HAL_NVIC_EnableIRQ(DCMI_IRQn);
+
+  return status;
+}
+
+/**
+  * @brief  Take the newest complete frame for processing. The frame is
+  *         read-only: lines dirtied in the cache could later be evicted over
+  *         a frame the DMA is writing.
+  * @param  sequence: if not NULL, receives the frame sequence number
+  * @retval Frame buffer, or NULL if no new frame is available
+  */
+uint8_t *Capture_AcquireFrame(uint32_t *sequence)
+{
+  uint8_t *frame;
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  frame = FrameRing_Acquire(&capture_ring, sequence);
+  __set_PRIMASK(primask);
+
+  return frame;
+}
+
+/**
+  * @brief  Hand the frame obtained with Capture_AcquireFrame() back to the DMA.
+  * @retval None
+  */
+void Capture_ReleaseFrame(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  FrameRing_Release(&capture_ring);
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Number of frames overwritten before the processing loop took them.
+  * @retval Dropped frame count
+  */
+uint32_t Capture_GetDroppedFrames(void)
+{
+  return capture_ring.dropped;
+}
+
+/**
+  * @brief  Frame event callback: publish the frame and re-arm the DMA.
+  * @param  hdcmi: DCMI handle
+  * @retval None
+  */
+void HAL_DCMI_FrameEventCallback(DCMI_HandleTypeDef *hdcmi)
+{
+  if ((capture_dcmi == NULL) || (hdcmi != capture_dcmi) || (capture_mode != CAPTURE_MODE_FRAMES))
+  {
+    return;
+  }
+
+  Cache_InvalidateForDma(FrameRing_DmaTarget(&capture_ring), capture_words * 4U);
+  (void)Capture_Arm(FrameRing_FrameComplete(&capture_ring));
+}
+
+/**
+  * @brief  VSYNC callback: in band mode the next band is the first of a frame.
+  * @param  hdcmi: DCMI handle
+  * @retval None
+  */
+void HAL_DCMI_VsyncEventCallback(DCMI_HandleTypeDef *hdcmi)
+{
+  if ((capture_dcmi == NULL) || (hdcmi != capture_dcmi) || (capture_mode != CAPTURE_MODE_BANDS))
+  {
+    return;
+  }
+
+  BandSeq_FrameStart(&capture_bands);
+}
+
+/**
+  * @brief  Error callback: the partial frame is discarded and capture
+  *         restarts with the next frame.
+  * @param  hdcmi: DCMI handle
+  * @retval None
+  */
+void HAL_DCMI_ErrorCallback(DCMI_HandleTypeDef *hdcmi)
+{
+  if ((capture_dcmi == NULL) || (hdcmi != capture_dcmi))
+  {
+    return;
+  }
+
+  if (capture_mode == CAPTURE_MODE_BANDS)
+  {
+    (void)Capture_ArmStreaming();
+    return;
+  }
+
+  capture_ring.dropped++;
+  (void)Capture_Arm(FrameRing_DmaTarget(&capture_ring));
+}
+
+/**
+  * @brief  Arm a single-frame capture into the given buffer.
+  * @param  buffer: destination buffer
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Capture_Arm(uint8_t *buffer)
+{
+  // Release the DMA stream left busy by the previous (circular) transfer
+  (void)HAL_DCMI_Stop(capture_dcmi);
+  capture_dcmi->DMA_Handle->XferHalfCpltCallback = NULL;
+
+  return HAL_DCMI_Start_DMA(capture_dcmi, DCMI_MODE_SNAPSHOT, (uint32_t)buffer, capture_words);
+}
+
+/**
+  * @brief  Arm continuous capture into the two-band circular buffer.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Capture_ArmStreaming(void)
+{
+  HAL_StatusTypeDef status;
+
+  (void)HAL_DCMI_Stop(capture_dcmi);
+
+  BandSeq_FrameStart(&capture_bands);
+
+  // HAL_DMA_Start_IT only enables the half-transfer interrupt when a
+  // callback is registered beforehand
+  capture_dcmi->DMA_Handle->XferHalfCpltCallback = Capture_BandHalfComplete;
+
+  status = HAL_DCMI_Start_DMA(capture_dcmi, DCMI_MODE_CONTINUOUS, (uint32_t)capture_stream.buffer, capture_words);
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  // Take over transfer-complete from the DCMI driver: it only tracks whole
+  // frames, band boundaries are handled here and frame boundaries by VSYNC
+  capture_dcmi->DMA_Handle->XferCpltCallback = Capture_BandComplete;
+  __HAL_DCMI_ENABLE_IT(capture_dcmi, DCMI_IT_VSYNC);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  DMA half-transfer: the first band of the ring is complete.
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void Capture_BandHalfComplete(DMA_HandleTypeDef *hdma)
+{
+  (void)hdma;
+  Capture_DeliverBand(0);
+}
+
+/**
+  * @brief  DMA transfer-complete: the second band of the ring is complete.
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void Capture_BandComplete(DMA_HandleTypeDef *hdma)
+{
+  (void)hdma;
+  Capture_DeliverBand(1);
+}
+
+/**
+  * @brief  Pass a completed band to the consumer unless the sequencer
+  *         skips it.
+  * @param  half: ring half holding the band (0 or 1)
+  * @retval None
+  */
+static void Capture_DeliverBand(uint32_t half)
+{
+  const Roi_Crop_t *crop = Capture_Geometry();
+  uint32_t lines = capture_stream.band_lines;
+  const uint8_t *band = capture_stream.buffer + (half * lines * crop->line_bytes);
+  uint32_t first_line;
+
+  if (BandSeq_BandComplete(&capture_bands, &first_line) != 0U)
+  {
+    Cache_InvalidateForDma(band, lines * crop->line_bytes);
+    capture_stream.callback(band, crop->line_bytes, first_line, lines);
+  }
+}
+
+/**
+  * @brief  Stored geometry for the configured ROI and profile; the full
+  *         YUV422 sensor image until either is set.
+  * @retval Crop configuration
+  */
+static const Roi_Crop_t *Capture_Geometry(void)
+{
+  if (capture_crop_valid == 0U)
+  {
+    (void)Roi_ComputeCrop(&capture_roi, CAMERA_WIDTH, CAMERA_HEIGHT, &capture_profiles[capture_profile].format, &capture_crop);
+    capture_crop_valid = 1U;
+  }
+
+  return &capture_crop;
+}
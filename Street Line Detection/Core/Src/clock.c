@@ -0,0 +1,206 @@
+/**
+  ******************************************************************************
+  * @file           : clock.c
+  * @brief          : Applies clock profiles to the RCC and PWR.
+  ******************************************************************************
+  * PLL1 is fed from the 64 MHz HSI so the clock tree does not depend on the
+  * board oscillator. A profile switch raises the core voltage first when
+  * going faster and lowers it last when going slower; PLL1 is reprogrammed
+  * while SYSCLK temporarily runs from HSI.
+  *
+  * APB2 timers follow the profile, so a running XCLK must be retuned with
+  * Xclk_SetFrameRate() after a switch. I2C1 has its own HSI kernel clock.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "clock.h"
+
+/* Private variables ---------------------------------------------------------*/
+static const uint32_t clock_vos[CLOCK_PLAN_VOS_COUNT] =
+{
+  PWR_REGULATOR_VOLTAGE_SCALE0, PWR_REGULATOR_VOLTAGE_SCALE1,
+  PWR_REGULATOR_VOLTAGE_SCALE2, PWR_REGULATOR_VOLTAGE_SCALE3
+};
+
+static const uint32_t clock_latency[] =
+{
+  FLASH_LATENCY_0, FLASH_LATENCY_1, FLASH_LATENCY_2, FLASH_LATENCY_3, FLASH_LATENCY_4
+};
+
+static ClockPlan_t clock_plan;
+static ClockPlan_Vos_t clock_vos_current = CLOCK_PLAN_VOS3;  // Reset value
+
+/* Private function prototypes -----------------------------------------------*/
+static void Clock_SetVoltage(ClockPlan_Vos_t vos);
+static HAL_StatusTypeDef Clock_SetBuses(uint32_t source, uint32_t hclk_div, uint32_t apb_div, uint32_t latency);
+static HAL_StatusTypeDef Clock_SetPll(const ClockPlan_t *plan);
+
+/**
+  * @brief  Switch the system to a clock profile.
+  * @param  profile: clock profile
+  * @retval HAL_ERROR if the profile does not resolve within the device
+  *         limits, otherwise the RCC status
+  */
+HAL_StatusTypeDef Clock_ApplyProfile(ClockPlan_Profile_t profile)
+{
+  ClockPlan_t plan;
+  int32_t latency;
+
+  if (ClockPlan_Build(profile, HSI_VALUE, &plan) != 0)
+  {
+    return HAL_ERROR;
+  }
+
+  if (plan.vos < clock_vos_current)
+  {
+    Clock_SetVoltage(plan.vos);
+  }
+
+  // Park on HSI while PLL1 is reprogrammed; HSI / 2 keeps APB within VOS3
+  latency = ClockPlan_FlashLatency(clock_vos_current < plan.vos ? clock_vos_current : plan.vos, HSI_VALUE);
+  if ((latency < 0) || (Clock_SetBuses(RCC_SYSCLKSOURCE_HSI, 1U, 2U, clock_latency[latency]) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  if (Clock_SetPll(&plan) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if (Clock_SetBuses((plan.use_pll != 0U) ? RCC_SYSCLKSOURCE_PLLCLK : RCC_SYSCLKSOURCE_HSI,
+                     plan.hclk_div, plan.apb_div, clock_latency[plan.flash_latency]) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if (plan.vos > clock_vos_current)
+  {
+    Clock_SetVoltage(plan.vos);
+  }
+
+  clock_plan = plan;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Clock tree currently applied.
+  * @retval Plan of the last successful Clock_ApplyProfile()
+  */
+const ClockPlan_t *Clock_GetPlan(void)
+{
+  return &clock_plan;
+}
+
+/**
+  * @brief  Program the core voltage scale and wait until it is reached.
+  * @param  vos: voltage scale
+  * @retval None
+  */
+static void Clock_SetVoltage(ClockPlan_Vos_t vos)
+{
+  __HAL_PWR_VOLTAGESCALING_CONFIG(clock_vos[vos]);
+
+  while(!__HAL_PWR_GET_FLAG(PWR_FLAG_VOSRDY)) {}
+
+  clock_vos_current = vos;
+}
+
+/**
+  * @brief  Select SYSCLK and the bus prescalers.
+  * @param  source: RCC_SYSCLKSOURCE_xxx
+  * @param  hclk_div: SYSCLK / HCLK, 1 or 2
+  * @param  apb_div: HCLK / PCLK for all APB buses, 1, 2 or 4
+  * @param  latency: FLASH_LATENCY_xxx
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Clock_SetBuses(uint32_t source, uint32_t hclk_div, uint32_t apb_div, uint32_t latency)
+{
+  RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
+
+  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
+                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2
+                              |RCC_CLOCKTYPE_D3PCLK1|RCC_CLOCKTYPE_D1PCLK1;
+  RCC_ClkInitStruct.SYSCLKSource = source;
+  RCC_ClkInitStruct.SYSCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.AHBCLKDivider = (hclk_div == 2U) ? RCC_HCLK_DIV2 : RCC_HCLK_DIV1;
+
+  switch (apb_div)
+  {
+    case 1U:
+      RCC_ClkInitStruct.APB3CLKDivider = RCC_APB3_DIV1;
+      RCC_ClkInitStruct.APB1CLKDivider = RCC_APB1_DIV1;
+      RCC_ClkInitStruct.APB2CLKDivider = RCC_APB2_DIV1;
+      RCC_ClkInitStruct.APB4CLKDivider = RCC_APB4_DIV1;
+      break;
+    case 2U:
+      RCC_ClkInitStruct.APB3CLKDivider = RCC_APB3_DIV2;
+      RCC_ClkInitStruct.APB1CLKDivider = RCC_APB1_DIV2;
+      RCC_ClkInitStruct.APB2CLKDivider = RCC_APB2_DIV2;
+      RCC_ClkInitStruct.APB4CLKDivider = RCC_APB4_DIV2;
+      break;
+    case 4U:
+      RCC_ClkInitStruct.APB3CLKDivider = RCC_APB3_DIV4;
+      RCC_ClkInitStruct.APB1CLKDivider = RCC_APB1_DIV4;
+      RCC_ClkInitStruct.APB2CLKDivider = RCC_APB2_DIV4;
+      RCC_ClkInitStruct.APB4CLKDivider = RCC_APB4_DIV4;
+      break;
+    default:
+      return HAL_ERROR;
+  }
+
+  return HAL_RCC_ClockConfig(&RCC_ClkInitStruct, latency);
+}
+
+/**
+  * @brief  Start PLL1 with the planned dividers, or stop it when the plan
+  *         runs from HSI. SYSCLK must not be PLL1 at this point.
+  * @param  plan: clock tree
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Clock_SetPll(const ClockPlan_t *plan)
+{
+  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
+
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSI;
+  RCC_OscInitStruct.HSIState = RCC_HSI_DIV1;
+  RCC_OscInitStruct.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
+
+  if (plan->use_pll == 0U)
+  {
+    RCC_OscInitStruct.PLL.PLLState = RCC_PLL_OFF;
+    return HAL_RCC_OscConfig(&RCC_OscInitStruct);
+  }
+
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSI;
+  RCC_OscInitStruct.PLL.PLLM = plan->pll.m;
+  RCC_OscInitStruct.PLL.PLLN = plan->pll.n;
+  RCC_OscInitStruct.PLL.PLLP = plan->pll.p;
+  // Q and R outputs are unused; keep them no faster than P
+  RCC_OscInitStruct.PLL.PLLQ = plan->pll.p;
+  RCC_OscInitStruct.PLL.PLLR = plan->pll.p;
+  RCC_OscInitStruct.PLL.PLLVCOSEL = (plan->pll.vco_wide != 0U) ? RCC_PLL1VCOWIDE : RCC_PLL1VCOMEDIUM;
+  RCC_OscInitStruct.PLL.PLLFRACN = 0;
+
+  if (plan->pll.vci_hz < 2000000U)
+  {
+    RCC_OscInitStruct.PLL.PLLRGE = RCC_PLL1VCIRANGE_0;
+  }
+  else if (plan->pll.vci_hz < 4000000U)
+  {
+    RCC_OscInitStruct.PLL.PLLRGE = RCC_PLL1VCIRANGE_1;
+  }
+  else if (plan->pll.vci_hz < 8000000U)
+  {
+    RCC_OscInitStruct.PLL.PLLRGE = RCC_PLL1VCIRANGE_2;
+  }
+  else
+  {
+    RCC_OscInitStruct.PLL.PLLRGE = RCC_PLL1VCIRANGE_3;
+  }
+
+  return HAL_RCC_OscConfig(&RCC_OscInitStruct);
+}
@@ -0,0 +1,224 @@
+/**
+  ******************************************************************************
+  * @file           : clock_plan.c
+  * @brief          : System clock profiles, PLL1 solver and flash/bus limits.
+  ******************************************************************************
+  * Everything here is plain arithmetic on the RM0433 / datasheet limits so
+  * that a profile can be checked on a host before it is flashed. clock.c
+  * turns the resulting ClockPlan_t into HAL RCC/PWR calls.
+  *
+  * Limits per voltage scale (revision V):
+  *   VOS0: CPU 480 MHz, HCLK 240 MHz, APB 120 MHz
+  *   VOS1: CPU 400 MHz, HCLK 200 MHz, APB 100 MHz
+  *   VOS2: CPU 300 MHz, HCLK 150 MHz, APB  75 MHz
+  *   VOS3: CPU 200 MHz, HCLK 100 MHz, APB  50 MHz
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "clock_plan.h"
+
+#include <stddef.h>
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint32_t sysclk_max_hz;
+  uint32_t hclk_max_hz;
+  uint32_t apb_max_hz;
+  uint32_t latency_max_hz[5];  // Highest HCLK for 0..4 wait states, 0 = unused
+} ClockPlan_VosLimits_t;
+
+typedef struct
+{
+  uint32_t sysclk_hz;  // 0: run from the reference oscillator
+  uint32_t hclk_div;
+  uint32_t apb_div;
+  ClockPlan_Vos_t vos;
+} ClockPlan_Spec_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const ClockPlan_VosLimits_t clock_plan_vos[CLOCK_PLAN_VOS_COUNT] =
+{
+  [CLOCK_PLAN_VOS0] = { 480000000U, 240000000U, 120000000U, { 70000000U, 140000000U, 185000000U, 210000000U, 240000000U } },
+  [CLOCK_PLAN_VOS1] = { 400000000U, 200000000U, 100000000U, { 70000000U, 140000000U, 185000000U, 210000000U, 225000000U } },
+  [CLOCK_PLAN_VOS2] = { 300000000U, 150000000U,  75000000U, { 55000000U, 110000000U, 165000000U, 225000000U, 0U } },
+  [CLOCK_PLAN_VOS3] = { 200000000U, 100000000U,  50000000U, { 45000000U,  90000000U, 135000000U, 180000000U, 225000000U } },
+};
+
+static const ClockPlan_Spec_t clock_plan_profiles[CLOCK_PROFILE_COUNT] =
+{
+  [CLOCK_PROFILE_PERFORMANCE] = { 480000000U, 2U, 2U, CLOCK_PLAN_VOS0 },
+  [CLOCK_PROFILE_BALANCED]    = { 400000000U, 2U, 2U, CLOCK_PLAN_VOS1 },
+  [CLOCK_PROFILE_LOW_POWER]   = { 0U,         1U, 2U, CLOCK_PLAN_VOS3 },
+};
+
+/**
+  * @brief  Find PLL1 dividers producing @p target_hz from @p ref_hz. An exact
+  *         match is preferred, then the highest PLL input frequency (lowest
+  *         jitter), then the lowest VCO frequency.
+  * @param  ref_hz: PLL reference oscillator frequency
+  * @param  target_hz: wanted P output frequency
+  * @param  pll: receives the dividers
+  * @retval 0 on success, -1 if no divider set is within the PLL limits
+  */
+int32_t ClockPlan_SolvePll(uint32_t ref_hz, uint32_t target_hz, ClockPlan_Pll_t *pll)
+{
+  uint32_t m;
+  uint32_t p;
+  uint32_t vci;
+  uint64_t n;
+  uint64_t vco;
+  uint64_t out;
+  uint64_t error;
+  uint64_t best_error = UINT64_MAX;
+  uint8_t wide;
+
+  if ((pll == NULL) || (ref_hz == 0U) || (target_hz == 0U))
+  {
+    return -1;
+  }
+
+  for (m = 1U; m <= CLOCK_PLAN_PLL_M_MAX; m++)
+  {
+    vci = ref_hz / m;
+    if ((vci < CLOCK_PLAN_VCI_MIN_HZ) || (vci > CLOCK_PLAN_VCI_MAX_HZ))
+    {
+      continue;
+    }
+    wide = (vci >= CLOCK_PLAN_VCI_WIDE_MIN_HZ) ? 1U : 0U;
+
+    for (p = 2U; p <= CLOCK_PLAN_PLL_P_MAX; p += 2U)
+    {
+      // Nearest multiplier for this output divider
+      n = (((uint64_t)target_hz * p * m) + (ref_hz / 2U)) / ref_hz;
+      if ((n < CLOCK_PLAN_PLL_N_MIN) || (n > CLOCK_PLAN_PLL_N_MAX))
+      {
+        continue;
+      }
+
+      vco = ((uint64_t)ref_hz * n) / m;
+      if (wide != 0U)
+      {
+        if ((vco < CLOCK_PLAN_VCO_WIDE_MIN_HZ) || (vco > CLOCK_PLAN_VCO_WIDE_MAX_HZ))
+        {
+          continue;
+        }
+      }
+      else if ((vco < CLOCK_PLAN_VCO_MEDIUM_MIN_HZ) || (vco > CLOCK_PLAN_VCO_MEDIUM_MAX_HZ))
+      {
+        continue;
+      }
+
+      out = vco / p;
+      error = (out > target_hz) ? (out - target_hz) : (target_hz - out);
+      if (error < best_error)
+      {
+        best_error = error;
+        pll->m = m;
+        pll->n = (uint32_t)n;
+        pll->p = p;
+        pll->vci_hz = vci;
+        pll->vco_hz = (uint32_t)vco;
+        pll->out_hz = (uint32_t)out;
+        pll->vco_wide = wide;
+      }
+    }
+
+    if (best_error == 0U)
+    {
+      break;
+    }
+  }
+
+  return (best_error == UINT64_MAX) ? -1 : 0;
+}
+
+/**
+  * @brief  Flash wait states needed at a given AXI clock.
+  * @param  vos: voltage scale
+  * @param  hclk_hz: AXI / HCLK frequency
+  * @retval Number of wait states, or -1 if the clock is too fast for @p vos
+  */
+int32_t ClockPlan_FlashLatency(ClockPlan_Vos_t vos, uint32_t hclk_hz)
+{
+  int32_t ws;
+
+  if ((vos >= CLOCK_PLAN_VOS_COUNT) || (hclk_hz > clock_plan_vos[vos].hclk_max_hz))
+  {
+    return -1;
+  }
+
+  for (ws = 0; ws < 5; ws++)
+  {
+    if (hclk_hz <= clock_plan_vos[vos].latency_max_hz[ws])
+    {
+      return ws;
+    }
+  }
+
+  return -1;
+}
+
+/**
+  * @brief  Resolve a clock profile into a complete, checked clock tree.
+  * @param  profile: clock profile
+  * @param  ref_hz: frequency of the oscillator feeding SYSCLK or PLL1
+  * @param  plan: receives the clock tree
+  * @retval 0 on success, -1 if the profile cannot be met within the limits of
+  *         its voltage scale
+  */
+int32_t ClockPlan_Build(ClockPlan_Profile_t profile, uint32_t ref_hz, ClockPlan_t *plan)
+{
+  const ClockPlan_Spec_t *spec;
+  const ClockPlan_VosLimits_t *limits;
+  int32_t latency;
+  uint32_t pixclk_max;
+
+  if ((plan == NULL) || (profile >= CLOCK_PROFILE_COUNT))
+  {
+    return -1;
+  }
+
+  spec = &clock_plan_profiles[profile];
+  limits = &clock_plan_vos[spec->vos];
+
+  if (spec->sysclk_hz == 0U)
+  {
+    plan->use_pll = 0U;
+    plan->sysclk_hz = ref_hz;
+  }
+  else
+  {
+    if (ClockPlan_SolvePll(ref_hz, spec->sysclk_hz, &plan->pll) != 0)
+    {
+      return -1;
+    }
+    plan->use_pll = 1U;
+    plan->sysclk_hz = plan->pll.out_hz;
+  }
+
+  plan->vos = spec->vos;
+  plan->hclk_div = spec->hclk_div;
+  plan->hclk_hz = plan->sysclk_hz / spec->hclk_div;
+  plan->apb_div = spec->apb_div;
+  plan->apb_hz = plan->hclk_hz / spec->apb_div;
+
+  if ((plan->sysclk_hz > limits->sysclk_max_hz) || (plan->hclk_hz > limits->hclk_max_hz) ||
+      (plan->apb_hz > limits->apb_max_hz))
+  {
+    return -1;
+  }
+
+  latency = ClockPlan_FlashLatency(spec->vos, plan->hclk_hz);
+  if (latency < 0)
+  {
+    return -1;
+  }
+  plan->flash_latency = (uint32_t)latency;
+
+  pixclk_max = (uint32_t)(((uint64_t)plan->hclk_hz * 2U) / 5U);
+  plan->dcmi_pixclk_max_hz = (pixclk_max < CLOCK_PLAN_DCMI_PIXCLK_MAX_HZ) ? pixclk_max : CLOCK_PLAN_DCMI_PIXCLK_MAX_HZ;
+
+  return 0;
+}
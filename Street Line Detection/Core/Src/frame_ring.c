@@ -0,0 +1,168 @@
+/**
+  ******************************************************************************
+  * @file           : frame_ring.c
+  * @brief          : Rotation of capture frame buffers between the DCMI DMA
+  *                   and the processing loop.
+  ******************************************************************************
+  * This module holds no hardware references so that the rotation policy can
+  * be compiled and exercised on a host. The capture driver calls
+  * FrameRing_FrameComplete() from the DCMI frame interrupt and retargets the
+  * DMA to the returned buffer; the processing loop brackets its work with
+  * FrameRing_Acquire() / FrameRing_Release().
+  *
+  * With three buffers the DMA never has to wait: the newest frame replaces a
+  * stale ready frame. With two buffers a frame completed while the consumer
+  * still holds the other buffer is dropped and the same buffer is refilled.
+  *
+  * FrameRing_Acquire() and FrameRing_Release() must run with the frame
+  * interrupt masked when called from thread context.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "frame_ring.h"
+
+#include <stddef.h>
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t FrameRing_FindFree(const FrameRing_t *ring, uint32_t completed);
+
+/**
+  * @brief  Initialise the ring with the given buffers. The first buffer
+  *         becomes the initial DMA target.
+  * @param  ring: ring to initialise
+  * @param  buffers: frame buffers, all of the same size
+  * @param  count: number of buffers, 2 to FRAME_RING_MAX_BUFFERS
+  * @retval 0 on success, -1 on invalid arguments
+  */
+int32_t FrameRing_Init(FrameRing_t *ring, uint8_t *const buffers[], uint32_t count)
+{
+  uint32_t i;
+
+  if ((ring == NULL) || (buffers == NULL) || (count < 2U) || (count > FRAME_RING_MAX_BUFFERS))
+  {
+    return -1;
+  }
+
+  for (i = 0; i < FRAME_RING_MAX_BUFFERS; i++)
+  {
+    ring->buffer[i] = (i < count) ? buffers[i] : NULL;
+    if ((i < count) && (buffers[i] == NULL))
+    {
+      return -1;
+    }
+  }
+
+  ring->count = count;
+  ring->filling = 0;
+  ring->ready = FRAME_RING_NONE;
+  ring->in_use = FRAME_RING_NONE;
+  ring->sequence = 0;
+  ring->dropped = 0;
+
+  return 0;
+}
+
+/**
+  * @brief  Buffer the DMA is currently filling.
+  * @param  ring: frame ring
+  * @retval Destination buffer of the running transfer
+  */
+uint8_t *FrameRing_DmaTarget(const FrameRing_t *ring)
+{
+  return ring->buffer[ring->filling];
+}
+
+/**
+  * @brief  Publish the frame the DMA just completed and select the next
+  *         DMA target. Called from the frame-complete interrupt.
+  * @param  ring: frame ring
+  * @retval Buffer the DMA must fill next
+  */
+uint8_t *FrameRing_FrameComplete(FrameRing_t *ring)
+{
+  uint32_t completed = ring->filling;
+  uint32_t next = FrameRing_FindFree(ring, completed);
+
+  if (next == FRAME_RING_NONE)
+  {
+    // Consumer still holds the only other buffer: refill the same one
+    ring->dropped++;
+    return ring->buffer[completed];
+  }
+
+  if (ring->ready != FRAME_RING_NONE)
+  {
+    // The previous ready frame was never picked up
+    ring->dropped++;
+  }
+
+  ring->ready = completed;
+  ring->sequence++;
+  ring->filling = next;
+
+  return ring->buffer[next];
+}
+
+/**
+  * @brief  Take ownership of the newest complete frame.
+  * @param  ring: frame ring
+  * @param  sequence: if not NULL, receives the frame sequence number
+  * @retval Frame buffer, or NULL when no new frame is ready or a frame is
+  *         already held
+  */
+uint8_t *FrameRing_Acquire(FrameRing_t *ring, uint32_t *sequence)
+{
+  if ((ring->ready == FRAME_RING_NONE) || (ring->in_use != FRAME_RING_NONE))
+  {
+    return NULL;
+  }
+
+  ring->in_use = ring->ready;
+  ring->ready = FRAME_RING_NONE;
+
+  if (sequence != NULL)
+  {
+    *sequence = ring->sequence;
+  }
+
+  return ring->buffer[ring->in_use];
+}
+
+/**
+  * @brief  Return the frame taken with FrameRing_Acquire() to the ring.
+  * @param  ring: frame ring
+  * @retval None
+  */
+void FrameRing_Release(FrameRing_t *ring)
+{
+  ring->in_use = FRAME_RING_NONE;
+}
+
+/**
+  * @brief  Pick the buffer the DMA should fill after @p completed. A stale
+  *         ready frame counts as free since the completed frame supersedes it.
+  * @param  ring: frame ring
+  * @param  completed: index of the buffer that was just filled
+  * @retval Buffer index, or FRAME_RING_NONE if every other buffer is held
+  */
+static uint32_t FrameRing_FindFree(const FrameRing_t *ring, uint32_t completed)
+{
+  uint32_t i;
+  uint32_t fallback = FRAME_RING_NONE;
+
+  for (i = 0; i < ring->count; i++)
+  {
+    if ((i == completed) || (i == ring->in_use))
+    {
+      continue;
+    }
+    if (i != ring->ready)
+    {
+      return i;
+    }
+    fallback = i;
+  }
+
+  return fallback;
+}
@@ -0,0 +1,1629 @@
+/**
+  ******************************************************************************
+  * @file           : ipm_lut.c
+  * @brief          : Bird's-eye remap table for Vision_IpmWarp().
+  *                   Generated by Vision/Tools/ipm_lut_gen.c, do not edit.
+  ******************************************************************************
+  * Camera     : 1200.0 mm high, pitch 10.00 deg, focal 300.0 px, centre (160.0, 120.0)
+  * Source     : 320x120 at (0, 120) on the sensor, stride 320
+  * Ground     : x -2000..2000 mm, z 2000..6000 mm, 160x120 cells
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ipm_lut.h"
+
+/* Private variables ---------------------------------------------------------*/
+static const uint16_t ipm_lut_offsets[19200] =
+{
+  0x08FE, 0x08FF, 0x0900, 0x0901, 0x0903, 0x0904, 0x0905, 0x0906, 0x0908, 0x0909, 0x090A, 0x090B,
+  0x090D, 0x090E, 0x090F, 0x0910, 0x0911, 0x0913, 0x0914, 0x0915, 0x0916, 0x0918, 0x0919, 0x091A,
+  0x091B, 0x091D, 0x091E, 0x091F, 0x0920, 0x0921, 0x0923, 0x0924, 0x0925, 0x0926, 0x0928, 0x0929,
+  0x092A, 0x092B, 0x092C, 0x092E, 0x092F, 0x0930, 0x0931, 0x0933, 0x0934, 0x0935, 0x0936, 0x0938,
+  0x0939, 0x093A, 0x093B, 0x093C, 0x093E, 0x093F, 0x0940, 0x0941, 0x0943, 0x0944, 0x0945, 0x0946,
+  0x0948, 0x0949, 0x094A, 0x094B, 0x094C, 0x094E, 0x094F, 0x0950, 0x0951, 0x0953, 0x0954, 0x0955,
+  0x0956, 0x0958, 0x0959, 0x095A, 0x095B, 0x095C, 0x095E, 0x095F, 0x0960, 0x0961, 0x0963, 0x0964,
+  0x0965, 0x0966, 0x0967, 0x0969, 0x096A, 0x096B, 0x096C, 0x096E, 0x096F, 0x0970, 0x0971, 0x0973,
+  0x0974, 0x0975, 0x0976, 0x0977, 0x0979, 0x097A, 0x097B, 0x097C, 0x097E, 0x097F, 0x0980, 0x0981,
+  0x0983, 0x0984, 0x0985, 0x0986, 0x0987, 0x0989, 0x098A, 0x098B, 0x098C, 0x098E, 0x098F, 0x0990,
+  0x0991, 0x0993, 0x0994, 0x0995, 0x0996, 0x0997, 0x0999, 0x099A, 0x099B, 0x099C, 0x099E, 0x099F,
+  0x09A0, 0x09A1, 0x09A2, 0x09A4, 0x09A5, 0x09A6, 0x09A7, 0x09A9, 0x09AA, 0x09AB, 0x09AC, 0x09AE,
+  0x09AF, 0x09B0, 0x09B1, 0x09B2, 0x09B4, 0x09B5, 0x09B6, 0x09B7, 0x09B9, 0x09BA, 0x09BB, 0x09BC,
+  0x09BE, 0x09BF, 0x09C0, 0x09C1, 0x08FD, 0x08FE, 0x0900, 0x0901, 0x0902, 0x0903, 0x0905, 0x0906,
+  0x0907, 0x0908, 0x090A, 0x090B, 0x090C, 0x090D, 0x090F, 0x0910, 0x0911, 0x0912, 0x0913, 0x0915,
+  0x0916, 0x0917, 0x0918, 0x091A, 0x091B, 0x091C, 0x091D, 0x091F, 0x0920, 0x0921, 0x0922, 0x0924,
+  0x0925, 0x0926, 0x0927, 0x0928, 0x092A, 0x092B, 0x092C, 0x092D, 0x092F, 0x0930, 0x0931, 0x0932,
+  0x0934, 0x0935, 0x0936, 0x0937, 0x0939, 0x093A, 0x093B, 0x093C, 0x093E, 0x093F, 0x0940, 0x0941,
+  0x0942, 0x0944, 0x0945, 0x0946, 0x0947, 0x0949, 0x094A, 0x094B, 0x094C, 0x094E, 0x094F, 0x0950,
+  0x0951, 0x0953, 0x0954, 0x0955, 0x0956, 0x0957, 0x0959, 0x095A, 0x095B, 0x095C, 0x095E, 0x095F,
+  0x0960, 0x0961, 0x0963, 0x0964, 0x0965, 0x0966, 0x0968, 0x0969, 0x096A, 0x096B, 0x096C, 0x096E,
+  0x096F, 0x0970, 0x0971, 0x0973, 0x0974, 0x0975, 0x0976, 0x0978, 0x0979, 0x097A, 0x097B, 0x097D,
+  0x097E, 0x097F, 0x0980, 0x0981, 0x0983, 0x0984, 0x0985, 0x0986, 0x0988, 0x0989, 0x098A, 0x098B,
+  0x098D, 0x098E, 0x098F, 0x0990, 0x0992, 0x0993, 0x0994, 0x0995, 0x0997, 0x0998, 0x0999, 0x099A,
+  0x099B, 0x099D, 0x099E, 0x099F, 0x09A0, 0x09A2, 0x09A3, 0x09A4, 0x09A5, 0x09A7, 0x09A8, 0x09A9,
+  0x09AA, 0x09AC, 0x09AD, 0x09AE, 0x09AF, 0x09B0, 0x09B2, 0x09B3, 0x09B4, 0x09B5, 0x09B7, 0x09B8,
+  0x09B9, 0x09BA, 0x09BC, 0x09BD, 0x09BE, 0x09BF, 0x09C1, 0x09C2, 0x08FD, 0x08FE, 0x08FF, 0x0900,
+  0x0902, 0x0903, 0x0904, 0x0905, 0x0907, 0x0908, 0x0909, 0x090A, 0x090C, 0x090D, 0x090E, 0x090F,
+  0x0911, 0x0912, 0x0913, 0x0914, 0x0916, 0x0917, 0x0918, 0x0919, 0x091B, 0x091C, 0x091D, 0x091E,
+  0x0920, 0x0921, 0x0922, 0x0923, 0x0924, 0x0926, 0x0927, 0x0928, 0x0929, 0x092B, 0x092C, 0x092D,
+  0x092E, 0x0930, 0x0931, 0x0932, 0x0933, 0x0935, 0x0936, 0x0937, 0x0938, 0x093A, 0x093B, 0x093C,
+  0x093D, 0x093F, 0x0940, 0x0941, 0x0942, 0x0944, 0x0945, 0x0946, 0x0947, 0x0949, 0x094A, 0x094B,
+  0x094C, 0x094D, 0x094F, 0x0950, 0x0951, 0x0952, 0x0954, 0x0955, 0x0956, 0x0957, 0x0959, 0x095A,
+  0x095B, 0x095C, 0x095E, 0x095F, 0x0960, 0x0961, 0x0963, 0x0964, 0x0965, 0x0966, 0x0968, 0x0969,
+  0x096A, 0x096B, 0x096D, 0x096E, 0x096F, 0x0970, 0x0972, 0x0973, 0x0974, 0x0975, 0x0976, 0x0978,
+  0x0979, 0x097A, 0x097B, 0x097D, 0x097E, 0x097F, 0x0980, 0x0982, 0x0983, 0x0984, 0x0985, 0x0987,
+  0x0988, 0x0989, 0x098A, 0x098C, 0x098D, 0x098E, 0x098F, 0x0991, 0x0992, 0x0993, 0x0994, 0x0996,
+  0x0997, 0x0998, 0x0999, 0x099B, 0x099C, 0x099D, 0x099E, 0x099F, 0x09A1, 0x09A2, 0x09A3, 0x09A4,
+  0x09A6, 0x09A7, 0x09A8, 0x09A9, 0x09AB, 0x09AC, 0x09AD, 0x09AE, 0x09B0, 0x09B1, 0x09B2, 0x09B3,
+  0x09B5, 0x09B6, 0x09B7, 0x09B8, 0x09BA, 0x09BB, 0x09BC, 0x09BD, 0x09BF, 0x09C0, 0x09C1, 0x09C2,
+  0x0A3C, 0x0A3D, 0x0A3F, 0x0A40, 0x0A41, 0x0A42, 0x0A44, 0x0A45, 0x0A46, 0x0A47, 0x0A49, 0x0A4A,
+  0x0A4B, 0x0A4C, 0x0A4E, 0x0A4F, 0x0A50, 0x0A51, 0x0A53, 0x0A54, 0x0A55, 0x0A56, 0x0A58, 0x0A59,
+  0x0A5A, 0x0A5B, 0x0A5D, 0x0A5E, 0x0A5F, 0x0A60, 0x0A62, 0x0A63, 0x0A64, 0x0A65, 0x0A67, 0x0A68,
+  0x0A69, 0x0A6A, 0x0A6C, 0x0A6D, 0x0A6E, 0x0A6F, 0x0A71, 0x0A72, 0x0A73, 0x0A74, 0x0A76, 0x0A77,
+  0x0A78, 0x0A79, 0x0A7B, 0x0A7C, 0x0A7D, 0x0A7E, 0x0A80, 0x0A81, 0x0A82, 0x0A83, 0x0A85, 0x0A86,
+  0x0A87, 0x0A88, 0x0A8A, 0x0A8B, 0x0A8C, 0x0A8D, 0x0A8F, 0x0A90, 0x0A91, 0x0A92, 0x0A94, 0x0A95,
+  0x0A96, 0x0A97, 0x0A99, 0x0A9A, 0x0A9B, 0x0A9C, 0x0A9E, 0x0A9F, 0x0AA0, 0x0AA1, 0x0AA3, 0x0AA4,
+  0x0AA5, 0x0AA6, 0x0AA8, 0x0AA9, 0x0AAA, 0x0AAB, 0x0AAD, 0x0AAE, 0x0AAF, 0x0AB0, 0x0AB2, 0x0AB3,
+  0x0AB4, 0x0AB5, 0x0AB7, 0x0AB8, 0x0AB9, 0x0ABA, 0x0ABC, 0x0ABD, 0x0ABE, 0x0ABF, 0x0AC1, 0x0AC2,
+  0x0AC3, 0x0AC4, 0x0AC6, 0x0AC7, 0x0AC8, 0x0AC9, 0x0ACB, 0x0ACC, 0x0ACD, 0x0ACE, 0x0AD0, 0x0AD1,
+  0x0AD2, 0x0AD3, 0x0AD5, 0x0AD6, 0x0AD7, 0x0AD8, 0x0ADA, 0x0ADB, 0x0ADC, 0x0ADD, 0x0ADF, 0x0AE0,
+  0x0AE1, 0x0AE2, 0x0AE4, 0x0AE5, 0x0AE6, 0x0AE7, 0x0AE9, 0x0AEA, 0x0AEB, 0x0AEC, 0x0AEE, 0x0AEF,
+  0x0AF0, 0x0AF1, 0x0AF3, 0x0AF4, 0x0AF5, 0x0AF6, 0x0AF8, 0x0AF9, 0x0AFA, 0x0AFB, 0x0AFD, 0x0AFE,
+  0x0AFF, 0x0B00, 0x0B02, 0x0B03, 0x0A3C, 0x0A3D, 0x0A3E, 0x0A3F, 0x0A41, 0x0A42, 0x0A43, 0x0A44,
+  0x0A46, 0x0A47, 0x0A48, 0x0A49, 0x0A4B, 0x0A4C, 0x0A4D, 0x0A4E, 0x0A50, 0x0A51, 0x0A52, 0x0A53,
+  0x0A55, 0x0A56, 0x0A57, 0x0A59, 0x0A5A, 0x0A5B, 0x0A5C, 0x0A5E, 0x0A5F, 0x0A60, 0x0A61, 0x0A63,
+  0x0A64, 0x0A65, 0x0A66, 0x0A68, 0x0A69, 0x0A6A, 0x0A6B, 0x0A6D, 0x0A6E, 0x0A6F, 0x0A70, 0x0A72,
+  0x0A73, 0x0A74, 0x0A75, 0x0A77, 0x0A78, 0x0A79, 0x0A7A, 0x0A7C, 0x0A7D, 0x0A7E, 0x0A7F, 0x0A81,
+  0x0A82, 0x0A83, 0x0A84, 0x0A86, 0x0A87, 0x0A88, 0x0A8A, 0x0A8B, 0x0A8C, 0x0A8D, 0x0A8F, 0x0A90,
+  0x0A91, 0x0A92, 0x0A94, 0x0A95, 0x0A96, 0x0A97, 0x0A99, 0x0A9A, 0x0A9B, 0x0A9C, 0x0A9E, 0x0A9F,
+  0x0AA0, 0x0AA1, 0x0AA3, 0x0AA4, 0x0AA5, 0x0AA6, 0x0AA8, 0x0AA9, 0x0AAA, 0x0AAB, 0x0AAD, 0x0AAE,
+  0x0AAF, 0x0AB0, 0x0AB2, 0x0AB3, 0x0AB4, 0x0AB5, 0x0AB7, 0x0AB8, 0x0AB9, 0x0ABB, 0x0ABC, 0x0ABD,
+  0x0ABE, 0x0AC0, 0x0AC1, 0x0AC2, 0x0AC3, 0x0AC5, 0x0AC6, 0x0AC7, 0x0AC8, 0x0ACA, 0x0ACB, 0x0ACC,
+  0x0ACD, 0x0ACF, 0x0AD0, 0x0AD1, 0x0AD2, 0x0AD4, 0x0AD5, 0x0AD6, 0x0AD7, 0x0AD9, 0x0ADA, 0x0ADB,
+  0x0ADC, 0x0ADE, 0x0ADF, 0x0AE0, 0x0AE1, 0x0AE3, 0x0AE4, 0x0AE5, 0x0AE6, 0x0AE8, 0x0AE9, 0x0AEA,
+  0x0AEC, 0x0AED, 0x0AEE, 0x0AEF, 0x0AF1, 0x0AF2, 0x0AF3, 0x0AF4, 0x0AF6, 0x0AF7, 0x0AF8, 0x0AF9,
+  0x0AFB, 0x0AFC, 0x0AFD, 0x0AFE, 0x0B00, 0x0B01, 0x0B02, 0x0B03, 0x0A3B, 0x0A3C, 0x0A3E, 0x0A3F,
+  0x0A40, 0x0A41, 0x0A43, 0x0A44, 0x0A45, 0x0A46, 0x0A48, 0x0A49, 0x0A4A, 0x0A4B, 0x0A4D, 0x0A4E,
+  0x0A4F, 0x0A51, 0x0A52, 0x0A53, 0x0A54, 0x0A56, 0x0A57, 0x0A58, 0x0A59, 0x0A5B, 0x0A5C, 0x0A5D,
+  0x0A5E, 0x0A60, 0x0A61, 0x0A62, 0x0A63, 0x0A65, 0x0A66, 0x0A67, 0x0A69, 0x0A6A, 0x0A6B, 0x0A6C,
+  0x0A6E, 0x0A6F, 0x0A70, 0x0A71, 0x0A73, 0x0A74, 0x0A75, 0x0A76, 0x0A78, 0x0A79, 0x0A7A, 0x0A7B,
+  0x0A7D, 0x0A7E, 0x0A7F, 0x0A81, 0x0A82, 0x0A83, 0x0A84, 0x0A86, 0x0A87, 0x0A88, 0x0A89, 0x0A8B,
+  0x0A8C, 0x0A8D, 0x0A8E, 0x0A90, 0x0A91, 0x0A92, 0x0A93, 0x0A95, 0x0A96, 0x0A97, 0x0A99, 0x0A9A,
+  0x0A9B, 0x0A9C, 0x0A9E, 0x0A9F, 0x0AA0, 0x0AA1, 0x0AA3, 0x0AA4, 0x0AA5, 0x0AA6, 0x0AA8, 0x0AA9,
+  0x0AAA, 0x0AAC, 0x0AAD, 0x0AAE, 0x0AAF, 0x0AB1, 0x0AB2, 0x0AB3, 0x0AB4, 0x0AB6, 0x0AB7, 0x0AB8,
+  0x0AB9, 0x0ABB, 0x0ABC, 0x0ABD, 0x0ABE, 0x0AC0, 0x0AC1, 0x0AC2, 0x0AC4, 0x0AC5, 0x0AC6, 0x0AC7,
+  0x0AC9, 0x0ACA, 0x0ACB, 0x0ACC, 0x0ACE, 0x0ACF, 0x0AD0, 0x0AD1, 0x0AD3, 0x0AD4, 0x0AD5, 0x0AD6,
+  0x0AD8, 0x0AD9, 0x0ADA, 0x0ADC, 0x0ADD, 0x0ADE, 0x0ADF, 0x0AE1, 0x0AE2, 0x0AE3, 0x0AE4, 0x0AE6,
+  0x0AE7, 0x0AE8, 0x0AE9, 0x0AEB, 0x0AEC, 0x0AED, 0x0AEE, 0x0AF0, 0x0AF1, 0x0AF2, 0x0AF4, 0x0AF5,
+  0x0AF6, 0x0AF7, 0x0AF9, 0x0AFA, 0x0AFB, 0x0AFC, 0x0AFE, 0x0AFF, 0x0B00, 0x0B01, 0x0B03, 0x0B04,
+  0x0B7B, 0x0B7C, 0x0B7D, 0x0B7E, 0x0B80, 0x0B81, 0x0B82, 0x0B83, 0x0B85, 0x0B86, 0x0B87, 0x0B88,
+  0x0B8A, 0x0B8B, 0x0B8C, 0x0B8E, 0x0B8F, 0x0B90, 0x0B91, 0x0B93, 0x0B94, 0x0B95, 0x0B96, 0x0B98,
+  0x0B99, 0x0B9A, 0x0B9C, 0x0B9D, 0x0B9E, 0x0B9F, 0x0BA1, 0x0BA2, 0x0BA3, 0x0BA4, 0x0BA6, 0x0BA7,
+  0x0BA8, 0x0BAA, 0x0BAB, 0x0BAC, 0x0BAD, 0x0BAF, 0x0BB0, 0x0BB1, 0x0BB2, 0x0BB4, 0x0BB5, 0x0BB6,
+  0x0BB7, 0x0BB9, 0x0BBA, 0x0BBB, 0x0BBD, 0x0BBE, 0x0BBF, 0x0BC0, 0x0BC2, 0x0BC3, 0x0BC4, 0x0BC5,
+  0x0BC7, 0x0BC8, 0x0BC9, 0x0BCB, 0x0BCC, 0x0BCD, 0x0BCE, 0x0BD0, 0x0BD1, 0x0BD2, 0x0BD3, 0x0BD5,
+  0x0BD6, 0x0BD7, 0x0BD9, 0x0BDA, 0x0BDB, 0x0BDC, 0x0BDE, 0x0BDF, 0x0BE0, 0x0BE1, 0x0BE3, 0x0BE4,
+  0x0BE5, 0x0BE6, 0x0BE8, 0x0BE9, 0x0BEA, 0x0BEC, 0x0BED, 0x0BEE, 0x0BEF, 0x0BF1, 0x0BF2, 0x0BF3,
+  0x0BF4, 0x0BF6, 0x0BF7, 0x0BF8, 0x0BFA, 0x0BFB, 0x0BFC, 0x0BFD, 0x0BFF, 0x0C00, 0x0C01, 0x0C02,
+  0x0C04, 0x0C05, 0x0C06, 0x0C08, 0x0C09, 0x0C0A, 0x0C0B, 0x0C0D, 0x0C0E, 0x0C0F, 0x0C10, 0x0C12,
+  0x0C13, 0x0C14, 0x0C15, 0x0C17, 0x0C18, 0x0C19, 0x0C1B, 0x0C1C, 0x0C1D, 0x0C1E, 0x0C20, 0x0C21,
+  0x0C22, 0x0C23, 0x0C25, 0x0C26, 0x0C27, 0x0C29, 0x0C2A, 0x0C2B, 0x0C2C, 0x0C2E, 0x0C2F, 0x0C30,
+  0x0C31, 0x0C33, 0x0C34, 0x0C35, 0x0C37, 0x0C38, 0x0C39, 0x0C3A, 0x0C3C, 0x0C3D, 0x0C3E, 0x0C3F,
+  0x0C41, 0x0C42, 0x0C43, 0x0C44, 0x0B7A, 0x0B7B, 0x0B7C, 0x0B7E, 0x0B7F, 0x0B80, 0x0B82, 0x0B83,
+  0x0B84, 0x0B85, 0x0B87, 0x0B88, 0x0B89, 0x0B8B, 0x0B8C, 0x0B8D, 0x0B8E, 0x0B90, 0x0B91, 0x0B92,
+  0x0B93, 0x0B95, 0x0B96, 0x0B97, 0x0B99, 0x0B9A, 0x0B9B, 0x0B9C, 0x0B9E, 0x0B9F, 0x0BA0, 0x0BA2,
+  0x0BA3, 0x0BA4, 0x0BA5, 0x0BA7, 0x0BA8, 0x0BA9, 0x0BAA, 0x0BAC, 0x0BAD, 0x0BAE, 0x0BB0, 0x0BB1,
+  0x0BB2, 0x0BB3, 0x0BB5, 0x0BB6, 0x0BB7, 0x0BB9, 0x0BBA, 0x0BBB, 0x0BBC, 0x0BBE, 0x0BBF, 0x0BC0,
+  0x0BC1, 0x0BC3, 0x0BC4, 0x0BC5, 0x0BC7, 0x0BC8, 0x0BC9, 0x0BCA, 0x0BCC, 0x0BCD, 0x0BCE, 0x0BD0,
+  0x0BD1, 0x0BD2, 0x0BD3, 0x0BD5, 0x0BD6, 0x0BD7, 0x0BD8, 0x0BDA, 0x0BDB, 0x0BDC, 0x0BDE, 0x0BDF,
+  0x0BE0, 0x0BE1, 0x0BE3, 0x0BE4, 0x0BE5, 0x0BE7, 0x0BE8, 0x0BE9, 0x0BEA, 0x0BEC, 0x0BED, 0x0BEE,
+  0x0BEF, 0x0BF1, 0x0BF2, 0x0BF3, 0x0BF5, 0x0BF6, 0x0BF7, 0x0BF8, 0x0BFA, 0x0BFB, 0x0BFC, 0x0BFE,
+  0x0BFF, 0x0C00, 0x0C01, 0x0C03, 0x0C04, 0x0C05, 0x0C06, 0x0C08, 0x0C09, 0x0C0A, 0x0C0C, 0x0C0D,
+  0x0C0E, 0x0C0F, 0x0C11, 0x0C12, 0x0C13, 0x0C15, 0x0C16, 0x0C17, 0x0C18, 0x0C1A, 0x0C1B, 0x0C1C,
+  0x0C1D, 0x0C1F, 0x0C20, 0x0C21, 0x0C23, 0x0C24, 0x0C25, 0x0C26, 0x0C28, 0x0C29, 0x0C2A, 0x0C2C,
+  0x0C2D, 0x0C2E, 0x0C2F, 0x0C31, 0x0C32, 0x0C33, 0x0C34, 0x0C36, 0x0C37, 0x0C38, 0x0C3A, 0x0C3B,
+  0x0C3C, 0x0C3D, 0x0C3F, 0x0C40, 0x0C41, 0x0C43, 0x0C44, 0x0C45, 0x0B79, 0x0B7B, 0x0B7C, 0x0B7D,
+  0x0B7F, 0x0B80, 0x0B81, 0x0B82, 0x0B84, 0x0B85, 0x0B86, 0x0B88, 0x0B89, 0x0B8A, 0x0B8B, 0x0B8D,
+  0x0B8E, 0x0B8F, 0x0B90, 0x0B92, 0x0B93, 0x0B94, 0x0B96, 0x0B97, 0x0B98, 0x0B99, 0x0B9B, 0x0B9C,
+  0x0B9D, 0x0B9F, 0x0BA0, 0x0BA1, 0x0BA2, 0x0BA4, 0x0BA5, 0x0BA6, 0x0BA8, 0x0BA9, 0x0BAA, 0x0BAB,
+  0x0BAD, 0x0BAE, 0x0BAF, 0x0BB1, 0x0BB2, 0x0BB3, 0x0BB4, 0x0BB6, 0x0BB7, 0x0BB8, 0x0BBA, 0x0BBB,
+  0x0BBC, 0x0BBD, 0x0BBF, 0x0BC0, 0x0BC1, 0x0BC3, 0x0BC4, 0x0BC5, 0x0BC6, 0x0BC8, 0x0BC9, 0x0BCA,
+  0x0BCC, 0x0BCD, 0x0BCE, 0x0BCF, 0x0BD1, 0x0BD2, 0x0BD3, 0x0BD5, 0x0BD6, 0x0BD7, 0x0BD8, 0x0BDA,
+  0x0BDB, 0x0BDC, 0x0BDE, 0x0BDF, 0x0BE0, 0x0BE1, 0x0BE3, 0x0BE4, 0x0BE5, 0x0BE7, 0x0BE8, 0x0BE9,
+  0x0BEA, 0x0BEC, 0x0BED, 0x0BEE, 0x0BF0, 0x0BF1, 0x0BF2, 0x0BF3, 0x0BF5, 0x0BF6, 0x0BF7, 0x0BF9,
+  0x0BFA, 0x0BFB, 0x0BFC, 0x0BFE, 0x0BFF, 0x0C00, 0x0C02, 0x0C03, 0x0C04, 0x0C05, 0x0C07, 0x0C08,
+  0x0C09, 0x0C0B, 0x0C0C, 0x0C0D, 0x0C0E, 0x0C10, 0x0C11, 0x0C12, 0x0C14, 0x0C15, 0x0C16, 0x0C17,
+  0x0C19, 0x0C1A, 0x0C1B, 0x0C1D, 0x0C1E, 0x0C1F, 0x0C20, 0x0C22, 0x0C23, 0x0C24, 0x0C26, 0x0C27,
+  0x0C28, 0x0C29, 0x0C2B, 0x0C2C, 0x0C2D, 0x0C2F, 0x0C30, 0x0C31, 0x0C32, 0x0C34, 0x0C35, 0x0C36,
+  0x0C37, 0x0C39, 0x0C3A, 0x0C3B, 0x0C3D, 0x0C3E, 0x0C3F, 0x0C40, 0x0C42, 0x0C43, 0x0C44, 0x0C46,
+  0x0CB9, 0x0CBA, 0x0CBB, 0x0CBD, 0x0CBE, 0x0CBF, 0x0CC1, 0x0CC2, 0x0CC3, 0x0CC4, 0x0CC6, 0x0CC7,
+  0x0CC8, 0x0CCA, 0x0CCB, 0x0CCC, 0x0CCD, 0x0CCF, 0x0CD0, 0x0CD1, 0x0CD3, 0x0CD4, 0x0CD5, 0x0CD7,
+  0x0CD8, 0x0CD9, 0x0CDA, 0x0CDC, 0x0CDD, 0x0CDE, 0x0CE0, 0x0CE1, 0x0CE2, 0x0CE3, 0x0CE5, 0x0CE6,
+  0x0CE7, 0x0CE9, 0x0CEA, 0x0CEB, 0x0CEC, 0x0CEE, 0x0CEF, 0x0CF0, 0x0CF2, 0x0CF3, 0x0CF4, 0x0CF6,
+  0x0CF7, 0x0CF8, 0x0CF9, 0x0CFB, 0x0CFC, 0x0CFD, 0x0CFF, 0x0D00, 0x0D01, 0x0D02, 0x0D04, 0x0D05,
+  0x0D06, 0x0D08, 0x0D09, 0x0D0A, 0x0D0B, 0x0D0D, 0x0D0E, 0x0D0F, 0x0D11, 0x0D12, 0x0D13, 0x0D15,
+  0x0D16, 0x0D17, 0x0D18, 0x0D1A, 0x0D1B, 0x0D1C, 0x0D1E, 0x0D1F, 0x0D20, 0x0D21, 0x0D23, 0x0D24,
+  0x0D25, 0x0D27, 0x0D28, 0x0D29, 0x0D2A, 0x0D2C, 0x0D2D, 0x0D2E, 0x0D30, 0x0D31, 0x0D32, 0x0D34,
+  0x0D35, 0x0D36, 0x0D37, 0x0D39, 0x0D3A, 0x0D3B, 0x0D3D, 0x0D3E, 0x0D3F, 0x0D40, 0x0D42, 0x0D43,
+  0x0D44, 0x0D46, 0x0D47, 0x0D48, 0x0D49, 0x0D4B, 0x0D4C, 0x0D4D, 0x0D4F, 0x0D50, 0x0D51, 0x0D53,
+  0x0D54, 0x0D55, 0x0D56, 0x0D58, 0x0D59, 0x0D5A, 0x0D5C, 0x0D5D, 0x0D5E, 0x0D5F, 0x0D61, 0x0D62,
+  0x0D63, 0x0D65, 0x0D66, 0x0D67, 0x0D68, 0x0D6A, 0x0D6B, 0x0D6C, 0x0D6E, 0x0D6F, 0x0D70, 0x0D72,
+  0x0D73, 0x0D74, 0x0D75, 0x0D77, 0x0D78, 0x0D79, 0x0D7B, 0x0D7C, 0x0D7D, 0x0D7E, 0x0D80, 0x0D81,
+  0x0D82, 0x0D84, 0x0D85, 0x0D86, 0x0CB8, 0x0CBA, 0x0CBB, 0x0CBC, 0x0CBD, 0x0CBF, 0x0CC0, 0x0CC1,
+  0x0CC3, 0x0CC4, 0x0CC5, 0x0CC7, 0x0CC8, 0x0CC9, 0x0CCA, 0x0CCC, 0x0CCD, 0x0CCE, 0x0CD0, 0x0CD1,
+  0x0CD2, 0x0CD3, 0x0CD5, 0x0CD6, 0x0CD7, 0x0CD9, 0x0CDA, 0x0CDB, 0x0CDD, 0x0CDE, 0x0CDF, 0x0CE0,
+  0x0CE2, 0x0CE3, 0x0CE4, 0x0CE6, 0x0CE7, 0x0CE8, 0x0CEA, 0x0CEB, 0x0CEC, 0x0CED, 0x0CEF, 0x0CF0,
+  0x0CF1, 0x0CF3, 0x0CF4, 0x0CF5, 0x0CF7, 0x0CF8, 0x0CF9, 0x0CFA, 0x0CFC, 0x0CFD, 0x0CFE, 0x0D00,
+  0x0D01, 0x0D02, 0x0D04, 0x0D05, 0x0D06, 0x0D07, 0x0D09, 0x0D0A, 0x0D0B, 0x0D0D, 0x0D0E, 0x0D0F,
+  0x0D11, 0x0D12, 0x0D13, 0x0D14, 0x0D16, 0x0D17, 0x0D18, 0x0D1A, 0x0D1B, 0x0D1C, 0x0D1E, 0x0D1F,
+  0x0D20, 0x0D21, 0x0D23, 0x0D24, 0x0D25, 0x0D27, 0x0D28, 0x0D29, 0x0D2B, 0x0D2C, 0x0D2D, 0x0D2E,
+  0x0D30, 0x0D31, 0x0D32, 0x0D34, 0x0D35, 0x0D36, 0x0D38, 0x0D39, 0x0D3A, 0x0D3B, 0x0D3D, 0x0D3E,
+  0x0D3F, 0x0D41, 0x0D42, 0x0D43, 0x0D45, 0x0D46, 0x0D47, 0x0D48, 0x0D4A, 0x0D4B, 0x0D4C, 0x0D4E,
+  0x0D4F, 0x0D50, 0x0D52, 0x0D53, 0x0D54, 0x0D55, 0x0D57, 0x0D58, 0x0D59, 0x0D5B, 0x0D5C, 0x0D5D,
+  0x0D5F, 0x0D60, 0x0D61, 0x0D62, 0x0D64, 0x0D65, 0x0D66, 0x0D68, 0x0D69, 0x0D6A, 0x0D6C, 0x0D6D,
+  0x0D6E, 0x0D6F, 0x0D71, 0x0D72, 0x0D73, 0x0D75, 0x0D76, 0x0D77, 0x0D78, 0x0D7A, 0x0D7B, 0x0D7C,
+  0x0D7E, 0x0D7F, 0x0D80, 0x0D82, 0x0D83, 0x0D84, 0x0D85, 0x0D87, 0x0CB8, 0x0CB9, 0x0CBA, 0x0CBC,
+  0x0CBD, 0x0CBE, 0x0CBF, 0x0CC1, 0x0CC2, 0x0CC3, 0x0CC5, 0x0CC6, 0x0CC7, 0x0CC9, 0x0CCA, 0x0CCB,
+  0x0CCD, 0x0CCE, 0x0CCF, 0x0CD0, 0x0CD2, 0x0CD3, 0x0CD4, 0x0CD6, 0x0CD7, 0x0CD8, 0x0CDA, 0x0CDB,
+  0x0CDC, 0x0CDE, 0x0CDF, 0x0CE0, 0x0CE1, 0x0CE3, 0x0CE4, 0x0CE5, 0x0CE7, 0x0CE8, 0x0CE9, 0x0CEB,
+  0x0CEC, 0x0CED, 0x0CEE, 0x0CF0, 0x0CF1, 0x0CF2, 0x0CF4, 0x0CF5, 0x0CF6, 0x0CF8, 0x0CF9, 0x0CFA,
+  0x0CFC, 0x0CFD, 0x0CFE, 0x0CFF, 0x0D01, 0x0D02, 0x0D03, 0x0D05, 0x0D06, 0x0D07, 0x0D09, 0x0D0A,
+  0x0D0B, 0x0D0D, 0x0D0E, 0x0D0F, 0x0D10, 0x0D12, 0x0D13, 0x0D14, 0x0D16, 0x0D17, 0x0D18, 0x0D1A,
+  0x0D1B, 0x0D1C, 0x0D1E, 0x0D1F, 0x0D20, 0x0D21, 0x0D23, 0x0D24, 0x0D25, 0x0D27, 0x0D28, 0x0D29,
+  0x0D2B, 0x0D2C, 0x0D2D, 0x0D2F, 0x0D30, 0x0D31, 0x0D32, 0x0D34, 0x0D35, 0x0D36, 0x0D38, 0x0D39,
+  0x0D3A, 0x0D3C, 0x0D3D, 0x0D3E, 0x0D40, 0x0D41, 0x0D42, 0x0D43, 0x0D45, 0x0D46, 0x0D47, 0x0D49,
+  0x0D4A, 0x0D4B, 0x0D4D, 0x0D4E, 0x0D4F, 0x0D51, 0x0D52, 0x0D53, 0x0D54, 0x0D56, 0x0D57, 0x0D58,
+  0x0D5A, 0x0D5B, 0x0D5C, 0x0D5E, 0x0D5F, 0x0D60, 0x0D61, 0x0D63, 0x0D64, 0x0D65, 0x0D67, 0x0D68,
+  0x0D69, 0x0D6B, 0x0D6C, 0x0D6D, 0x0D6F, 0x0D70, 0x0D71, 0x0D72, 0x0D74, 0x0D75, 0x0D76, 0x0D78,
+  0x0D79, 0x0D7A, 0x0D7C, 0x0D7D, 0x0D7E, 0x0D80, 0x0D81, 0x0D82, 0x0D83, 0x0D85, 0x0D86, 0x0D87,
+  0x0DF7, 0x0DF8, 0x0DFA, 0x0DFB, 0x0DFC, 0x0DFE, 0x0DFF, 0x0E00, 0x0E02, 0x0E03, 0x0E04, 0x0E05,
+  0x0E07, 0x0E08, 0x0E09, 0x0E0B, 0x0E0C, 0x0E0D, 0x0E0F, 0x0E10, 0x0E11, 0x0E13, 0x0E14, 0x0E15,
+  0x0E17, 0x0E18, 0x0E19, 0x0E1B, 0x0E1C, 0x0E1D, 0x0E1E, 0x0E20, 0x0E21, 0x0E22, 0x0E24, 0x0E25,
+  0x0E26, 0x0E28, 0x0E29, 0x0E2A, 0x0E2C, 0x0E2D, 0x0E2E, 0x0E30, 0x0E31, 0x0E32, 0x0E33, 0x0E35,
+  0x0E36, 0x0E37, 0x0E39, 0x0E3A, 0x0E3B, 0x0E3D, 0x0E3E, 0x0E3F, 0x0E41, 0x0E42, 0x0E43, 0x0E45,
+  0x0E46, 0x0E47, 0x0E49, 0x0E4A, 0x0E4B, 0x0E4C, 0x0E4E, 0x0E4F, 0x0E50, 0x0E52, 0x0E53, 0x0E54,
+  0x0E56, 0x0E57, 0x0E58, 0x0E5A, 0x0E5B, 0x0E5C, 0x0E5E, 0x0E5F, 0x0E60, 0x0E61, 0x0E63, 0x0E64,
+  0x0E65, 0x0E67, 0x0E68, 0x0E69, 0x0E6B, 0x0E6C, 0x0E6D, 0x0E6F, 0x0E70, 0x0E71, 0x0E73, 0x0E74,
+  0x0E75, 0x0E76, 0x0E78, 0x0E79, 0x0E7A, 0x0E7C, 0x0E7D, 0x0E7E, 0x0E80, 0x0E81, 0x0E82, 0x0E84,
+  0x0E85, 0x0E86, 0x0E88, 0x0E89, 0x0E8A, 0x0E8C, 0x0E8D, 0x0E8E, 0x0E8F, 0x0E91, 0x0E92, 0x0E93,
+  0x0E95, 0x0E96, 0x0E97, 0x0E99, 0x0E9A, 0x0E9B, 0x0E9D, 0x0E9E, 0x0E9F, 0x0EA1, 0x0EA2, 0x0EA3,
+  0x0EA4, 0x0EA6, 0x0EA7, 0x0EA8, 0x0EAA, 0x0EAB, 0x0EAC, 0x0EAE, 0x0EAF, 0x0EB0, 0x0EB2, 0x0EB3,
+  0x0EB4, 0x0EB6, 0x0EB7, 0x0EB8, 0x0EBA, 0x0EBB, 0x0EBC, 0x0EBD, 0x0EBF, 0x0EC0, 0x0EC1, 0x0EC3,
+  0x0EC4, 0x0EC5, 0x0EC7, 0x0EC8, 0x0DF6, 0x0DF8, 0x0DF9, 0x0DFA, 0x0DFC, 0x0DFD, 0x0DFE, 0x0E00,
+  0x0E01, 0x0E02, 0x0E04, 0x0E05, 0x0E06, 0x0E08, 0x0E09, 0x0E0A, 0x0E0C, 0x0E0D, 0x0E0E, 0x0E10,
+  0x0E11, 0x0E12, 0x0E13, 0x0E15, 0x0E16, 0x0E17, 0x0E19, 0x0E1A, 0x0E1B, 0x0E1D, 0x0E1E, 0x0E1F,
+  0x0E21, 0x0E22, 0x0E23, 0x0E25, 0x0E26, 0x0E27, 0x0E29, 0x0E2A, 0x0E2B, 0x0E2D, 0x0E2E, 0x0E2F,
+  0x0E31, 0x0E32, 0x0E33, 0x0E35, 0x0E36, 0x0E37, 0x0E39, 0x0E3A, 0x0E3B, 0x0E3C, 0x0E3E, 0x0E3F,
+  0x0E40, 0x0E42, 0x0E43, 0x0E44, 0x0E46, 0x0E47, 0x0E48, 0x0E4A, 0x0E4B, 0x0E4C, 0x0E4E, 0x0E4F,
+  0x0E50, 0x0E52, 0x0E53, 0x0E54, 0x0E56, 0x0E57, 0x0E58, 0x0E5A, 0x0E5B, 0x0E5C, 0x0E5E, 0x0E5F,
+  0x0E60, 0x0E61, 0x0E63, 0x0E64, 0x0E65, 0x0E67, 0x0E68, 0x0E69, 0x0E6B, 0x0E6C, 0x0E6D, 0x0E6F,
+  0x0E70, 0x0E71, 0x0E73, 0x0E74, 0x0E75, 0x0E77, 0x0E78, 0x0E79, 0x0E7B, 0x0E7C, 0x0E7D, 0x0E7F,
+  0x0E80, 0x0E81, 0x0E83, 0x0E84, 0x0E85, 0x0E86, 0x0E88, 0x0E89, 0x0E8A, 0x0E8C, 0x0E8D, 0x0E8E,
+  0x0E90, 0x0E91, 0x0E92, 0x0E94, 0x0E95, 0x0E96, 0x0E98, 0x0E99, 0x0E9A, 0x0E9C, 0x0E9D, 0x0E9E,
+  0x0EA0, 0x0EA1, 0x0EA2, 0x0EA4, 0x0EA5, 0x0EA6, 0x0EA8, 0x0EA9, 0x0EAA, 0x0EAC, 0x0EAD, 0x0EAE,
+  0x0EAF, 0x0EB1, 0x0EB2, 0x0EB3, 0x0EB5, 0x0EB6, 0x0EB7, 0x0EB9, 0x0EBA, 0x0EBB, 0x0EBD, 0x0EBE,
+  0x0EBF, 0x0EC1, 0x0EC2, 0x0EC3, 0x0EC5, 0x0EC6, 0x0EC7, 0x0EC9, 0x0DF6, 0x0DF7, 0x0DF8, 0x0DFA,
+  0x0DFB, 0x0DFC, 0x0DFE, 0x0DFF, 0x0E00, 0x0E02, 0x0E03, 0x0E04, 0x0E06, 0x0E07, 0x0E08, 0x0E0A,
+  0x0E0B, 0x0E0C, 0x0E0E, 0x0E0F, 0x0E10, 0x0E12, 0x0E13, 0x0E14, 0x0E16, 0x0E17, 0x0E18, 0x0E1A,
+  0x0E1B, 0x0E1C, 0x0E1E, 0x0E1F, 0x0E20, 0x0E22, 0x0E23, 0x0E24, 0x0E26, 0x0E27, 0x0E28, 0x0E2A,
+  0x0E2B, 0x0E2C, 0x0E2E, 0x0E2F, 0x0E30, 0x0E32, 0x0E33, 0x0E34, 0x0E36, 0x0E37, 0x0E38, 0x0E3A,
+  0x0E3B, 0x0E3C, 0x0E3E, 0x0E3F, 0x0E40, 0x0E42, 0x0E43, 0x0E44, 0x0E46, 0x0E47, 0x0E48, 0x0E4A,
+  0x0E4B, 0x0E4C, 0x0E4E, 0x0E4F, 0x0E50, 0x0E52, 0x0E53, 0x0E54, 0x0E56, 0x0E57, 0x0E58, 0x0E5A,
+  0x0E5B, 0x0E5C, 0x0E5E, 0x0E5F, 0x0E60, 0x0E61, 0x0E63, 0x0E64, 0x0E65, 0x0E67, 0x0E68, 0x0E69,
+  0x0E6B, 0x0E6C, 0x0E6D, 0x0E6F, 0x0E70, 0x0E71, 0x0E73, 0x0E74, 0x0E75, 0x0E77, 0x0E78, 0x0E79,
+  0x0E7B, 0x0E7C, 0x0E7D, 0x0E7F, 0x0E80, 0x0E81, 0x0E83, 0x0E84, 0x0E85, 0x0E87, 0x0E88, 0x0E89,
+  0x0E8B, 0x0E8C, 0x0E8D, 0x0E8F, 0x0E90, 0x0E91, 0x0E93, 0x0E94, 0x0E95, 0x0E97, 0x0E98, 0x0E99,
+  0x0E9B, 0x0E9C, 0x0E9D, 0x0E9F, 0x0EA0, 0x0EA1, 0x0EA3, 0x0EA4, 0x0EA5, 0x0EA7, 0x0EA8, 0x0EA9,
+  0x0EAB, 0x0EAC, 0x0EAD, 0x0EAF, 0x0EB0, 0x0EB1, 0x0EB3, 0x0EB4, 0x0EB5, 0x0EB7, 0x0EB8, 0x0EB9,
+  0x0EBB, 0x0EBC, 0x0EBD, 0x0EBF, 0x0EC0, 0x0EC1, 0x0EC3, 0x0EC4, 0x0EC5, 0x0EC7, 0x0EC8, 0x0EC9,
+  0x0F35, 0x0F37, 0x0F38, 0x0F39, 0x0F3B, 0x0F3C, 0x0F3D, 0x0F3F, 0x0F40, 0x0F41, 0x0F43, 0x0F44,
+  0x0F45, 0x0F47, 0x0F48, 0x0F49, 0x0F4B, 0x0F4C, 0x0F4D, 0x0F4F, 0x0F50, 0x0F51, 0x0F53, 0x0F54,
+  0x0F55, 0x0F57, 0x0F58, 0x0F59, 0x0F5B, 0x0F5C, 0x0F5D, 0x0F5F, 0x0F60, 0x0F61, 0x0F63, 0x0F64,
+  0x0F65, 0x0F67, 0x0F68, 0x0F69, 0x0F6B, 0x0F6C, 0x0F6D, 0x0F6F, 0x0F70, 0x0F71, 0x0F73, 0x0F74,
+  0x0F75, 0x0F77, 0x0F78, 0x0F79, 0x0F7B, 0x0F7C, 0x0F7D, 0x0F7F, 0x0F80, 0x0F81, 0x0F83, 0x0F84,
+  0x0F85, 0x0F87, 0x0F88, 0x0F89, 0x0F8B, 0x0F8C, 0x0F8D, 0x0F8F, 0x0F90, 0x0F91, 0x0F93, 0x0F94,
+  0x0F95, 0x0F97, 0x0F98, 0x0F99, 0x0F9B, 0x0F9C, 0x0F9D, 0x0F9F, 0x0FA0, 0x0FA2, 0x0FA3, 0x0FA4,
+  0x0FA6, 0x0FA7, 0x0FA8, 0x0FAA, 0x0FAB, 0x0FAC, 0x0FAE, 0x0FAF, 0x0FB0, 0x0FB2, 0x0FB3, 0x0FB4,
+  0x0FB6, 0x0FB7, 0x0FB8, 0x0FBA, 0x0FBB, 0x0FBC, 0x0FBE, 0x0FBF, 0x0FC0, 0x0FC2, 0x0FC3, 0x0FC4,
+  0x0FC6, 0x0FC7, 0x0FC8, 0x0FCA, 0x0FCB, 0x0FCC, 0x0FCE, 0x0FCF, 0x0FD0, 0x0FD2, 0x0FD3, 0x0FD4,
+  0x0FD6, 0x0FD7, 0x0FD8, 0x0FDA, 0x0FDB, 0x0FDC, 0x0FDE, 0x0FDF, 0x0FE0, 0x0FE2, 0x0FE3, 0x0FE4,
+  0x0FE6, 0x0FE7, 0x0FE8, 0x0FEA, 0x0FEB, 0x0FEC, 0x0FEE, 0x0FEF, 0x0FF0, 0x0FF2, 0x0FF3, 0x0FF4,
+  0x0FF6, 0x0FF7, 0x0FF8, 0x0FFA, 0x0FFB, 0x0FFC, 0x0FFE, 0x0FFF, 0x1000, 0x1002, 0x1003, 0x1004,
+  0x1006, 0x1007, 0x1008, 0x100A, 0x0F35, 0x0F36, 0x0F37, 0x0F39, 0x0F3A, 0x0F3B, 0x0F3D, 0x0F3E,
+  0x0F3F, 0x0F41, 0x0F42, 0x0F43, 0x0F45, 0x0F46, 0x0F47, 0x0F49, 0x0F4A, 0x0F4B, 0x0F4D, 0x0F4E,
+  0x0F4F, 0x0F51, 0x0F52, 0x0F53, 0x0F55, 0x0F56, 0x0F58, 0x0F59, 0x0F5A, 0x0F5C, 0x0F5D, 0x0F5E,
+  0x0F60, 0x0F61, 0x0F62, 0x0F64, 0x0F65, 0x0F66, 0x0F68, 0x0F69, 0x0F6A, 0x0F6C, 0x0F6D, 0x0F6E,
+  0x0F70, 0x0F71, 0x0F72, 0x0F74, 0x0F75, 0x0F76, 0x0F78, 0x0F79, 0x0F7B, 0x0F7C, 0x0F7D, 0x0F7F,
+  0x0F80, 0x0F81, 0x0F83, 0x0F84, 0x0F85, 0x0F87, 0x0F88, 0x0F89, 0x0F8B, 0x0F8C, 0x0F8D, 0x0F8F,
+  0x0F90, 0x0F91, 0x0F93, 0x0F94, 0x0F95, 0x0F97, 0x0F98, 0x0F99, 0x0F9B, 0x0F9C, 0x0F9D, 0x0F9F,
+  0x0FA0, 0x0FA2, 0x0FA3, 0x0FA4, 0x0FA6, 0x0FA7, 0x0FA8, 0x0FAA, 0x0FAB, 0x0FAC, 0x0FAE, 0x0FAF,
+  0x0FB0, 0x0FB2, 0x0FB3, 0x0FB4, 0x0FB6, 0x0FB7, 0x0FB8, 0x0FBA, 0x0FBB, 0x0FBC, 0x0FBE, 0x0FBF,
+  0x0FC0, 0x0FC2, 0x0FC3, 0x0FC4, 0x0FC6, 0x0FC7, 0x0FC9, 0x0FCA, 0x0FCB, 0x0FCD, 0x0FCE, 0x0FCF,
+  0x0FD1, 0x0FD2, 0x0FD3, 0x0FD5, 0x0FD6, 0x0FD7, 0x0FD9, 0x0FDA, 0x0FDB, 0x0FDD, 0x0FDE, 0x0FDF,
+  0x0FE1, 0x0FE2, 0x0FE3, 0x0FE5, 0x0FE6, 0x0FE7, 0x0FE9, 0x0FEA, 0x0FEC, 0x0FED, 0x0FEE, 0x0FF0,
+  0x0FF1, 0x0FF2, 0x0FF4, 0x0FF5, 0x0FF6, 0x0FF8, 0x0FF9, 0x0FFA, 0x0FFC, 0x0FFD, 0x0FFE, 0x1000,
+  0x1001, 0x1002, 0x1004, 0x1005, 0x1006, 0x1008, 0x1009, 0x100A, 0x1074, 0x1075, 0x1077, 0x1078,
+  0x1079, 0x107B, 0x107C, 0x107D, 0x107F, 0x1080, 0x1081, 0x1083, 0x1084, 0x1086, 0x1087, 0x1088,
+  0x108A, 0x108B, 0x108C, 0x108E, 0x108F, 0x1090, 0x1092, 0x1093, 0x1094, 0x1096, 0x1097, 0x1098,
+  0x109A, 0x109B, 0x109D, 0x109E, 0x109F, 0x10A1, 0x10A2, 0x10A3, 0x10A5, 0x10A6, 0x10A7, 0x10A9,
+  0x10AA, 0x10AB, 0x10AD, 0x10AE, 0x10AF, 0x10B1, 0x10B2, 0x10B4, 0x10B5, 0x10B6, 0x10B8, 0x10B9,
+  0x10BA, 0x10BC, 0x10BD, 0x10BE, 0x10C0, 0x10C1, 0x10C2, 0x10C4, 0x10C5, 0x10C6, 0x10C8, 0x10C9,
+  0x10CB, 0x10CC, 0x10CD, 0x10CF, 0x10D0, 0x10D1, 0x10D3, 0x10D4, 0x10D5, 0x10D7, 0x10D8, 0x10D9,
+  0x10DB, 0x10DC, 0x10DD, 0x10DF, 0x10E0, 0x10E2, 0x10E3, 0x10E4, 0x10E6, 0x10E7, 0x10E8, 0x10EA,
+  0x10EB, 0x10EC, 0x10EE, 0x10EF, 0x10F0, 0x10F2, 0x10F3, 0x10F4, 0x10F6, 0x10F7, 0x10F9, 0x10FA,
+  0x10FB, 0x10FD, 0x10FE, 0x10FF, 0x1101, 0x1102, 0x1103, 0x1105, 0x1106, 0x1107, 0x1109, 0x110A,
+  0x110B, 0x110D, 0x110E, 0x1110, 0x1111, 0x1112, 0x1114, 0x1115, 0x1116, 0x1118, 0x1119, 0x111A,
+  0x111C, 0x111D, 0x111E, 0x1120, 0x1121, 0x1122, 0x1124, 0x1125, 0x1127, 0x1128, 0x1129, 0x112B,
+  0x112C, 0x112D, 0x112F, 0x1130, 0x1131, 0x1133, 0x1134, 0x1135, 0x1137, 0x1138, 0x1139, 0x113B,
+  0x113C, 0x113E, 0x113F, 0x1140, 0x1142, 0x1143, 0x1144, 0x1146, 0x1147, 0x1148, 0x114A, 0x114B,
+  0x1073, 0x1075, 0x1076, 0x1077, 0x1079, 0x107A, 0x107B, 0x107D, 0x107E, 0x1080, 0x1081, 0x1082,
+  0x1084, 0x1085, 0x1086, 0x1088, 0x1089, 0x108A, 0x108C, 0x108D, 0x108F, 0x1090, 0x1091, 0x1093,
+  0x1094, 0x1095, 0x1097, 0x1098, 0x1099, 0x109B, 0x109C, 0x109D, 0x109F, 0x10A0, 0x10A2, 0x10A3,
+  0x10A4, 0x10A6, 0x10A7, 0x10A8, 0x10AA, 0x10AB, 0x10AC, 0x10AE, 0x10AF, 0x10B1, 0x10B2, 0x10B3,
+  0x10B5, 0x10B6, 0x10B7, 0x10B9, 0x10BA, 0x10BB, 0x10BD, 0x10BE, 0x10C0, 0x10C1, 0x10C2, 0x10C4,
+  0x10C5, 0x10C6, 0x10C8, 0x10C9, 0x10CA, 0x10CC, 0x10CD, 0x10CE, 0x10D0, 0x10D1, 0x10D3, 0x10D4,
+  0x10D5, 0x10D7, 0x10D8, 0x10D9, 0x10DB, 0x10DC, 0x10DD, 0x10DF, 0x10E0, 0x10E2, 0x10E3, 0x10E4,
+  0x10E6, 0x10E7, 0x10E8, 0x10EA, 0x10EB, 0x10EC, 0x10EE, 0x10EF, 0x10F1, 0x10F2, 0x10F3, 0x10F5,
+  0x10F6, 0x10F7, 0x10F9, 0x10FA, 0x10FB, 0x10FD, 0x10FE, 0x10FF, 0x1101, 0x1102, 0x1104, 0x1105,
+  0x1106, 0x1108, 0x1109, 0x110A, 0x110C, 0x110D, 0x110E, 0x1110, 0x1111, 0x1113, 0x1114, 0x1115,
+  0x1117, 0x1118, 0x1119, 0x111B, 0x111C, 0x111D, 0x111F, 0x1120, 0x1122, 0x1123, 0x1124, 0x1126,
+  0x1127, 0x1128, 0x112A, 0x112B, 0x112C, 0x112E, 0x112F, 0x1130, 0x1132, 0x1133, 0x1135, 0x1136,
+  0x1137, 0x1139, 0x113A, 0x113B, 0x113D, 0x113E, 0x113F, 0x1141, 0x1142, 0x1144, 0x1145, 0x1146,
+  0x1148, 0x1149, 0x114A, 0x114C, 0x1073, 0x1074, 0x1075, 0x1077, 0x1078, 0x1079, 0x107B, 0x107C,
+  0x107E, 0x107F, 0x1080, 0x1082, 0x1083, 0x1084, 0x1086, 0x1087, 0x1089, 0x108A, 0x108B, 0x108D,
+  0x108E, 0x108F, 0x1091, 0x1092, 0x1094, 0x1095, 0x1096, 0x1098, 0x1099, 0x109A, 0x109C, 0x109D,
+  0x109E, 0x10A0, 0x10A1, 0x10A3, 0x10A4, 0x10A5, 0x10A7, 0x10A8, 0x10A9, 0x10AB, 0x10AC, 0x10AE,
+  0x10AF, 0x10B0, 0x10B2, 0x10B3, 0x10B4, 0x10B6, 0x10B7, 0x10B8, 0x10BA, 0x10BB, 0x10BD, 0x10BE,
+  0x10BF, 0x10C1, 0x10C2, 0x10C3, 0x10C5, 0x10C6, 0x10C8, 0x10C9, 0x10CA, 0x10CC, 0x10CD, 0x10CE,
+  0x10D0, 0x10D1, 0x10D2, 0x10D4, 0x10D5, 0x10D7, 0x10D8, 0x10D9, 0x10DB, 0x10DC, 0x10DD, 0x10DF,
+  0x10E0, 0x10E2, 0x10E3, 0x10E4, 0x10E6, 0x10E7, 0x10E8, 0x10EA, 0x10EB, 0x10ED, 0x10EE, 0x10EF,
+  0x10F1, 0x10F2, 0x10F3, 0x10F5, 0x10F6, 0x10F7, 0x10F9, 0x10FA, 0x10FC, 0x10FD, 0x10FE, 0x1100,
+  0x1101, 0x1102, 0x1104, 0x1105, 0x1107, 0x1108, 0x1109, 0x110B, 0x110C, 0x110D, 0x110F, 0x1110,
+  0x1111, 0x1113, 0x1114, 0x1116, 0x1117, 0x1118, 0x111A, 0x111B, 0x111C, 0x111E, 0x111F, 0x1121,
+  0x1122, 0x1123, 0x1125, 0x1126, 0x1127, 0x1129, 0x112A, 0x112B, 0x112D, 0x112E, 0x1130, 0x1131,
+  0x1132, 0x1134, 0x1135, 0x1136, 0x1138, 0x1139, 0x113B, 0x113C, 0x113D, 0x113F, 0x1140, 0x1141,
+  0x1143, 0x1144, 0x1146, 0x1147, 0x1148, 0x114A, 0x114B, 0x114C, 0x11B2, 0x11B3, 0x11B5, 0x11B6,
+  0x11B7, 0x11B9, 0x11BA, 0x11BC, 0x11BD, 0x11BE, 0x11C0, 0x11C1, 0x11C3, 0x11C4, 0x11C5, 0x11C7,
+  0x11C8, 0x11C9, 0x11CB, 0x11CC, 0x11CE, 0x11CF, 0x11D0, 0x11D2, 0x11D3, 0x11D4, 0x11D6, 0x11D7,
+  0x11D9, 0x11DA, 0x11DB, 0x11DD, 0x11DE, 0x11DF, 0x11E1, 0x11E2, 0x11E4, 0x11E5, 0x11E6, 0x11E8,
+  0x11E9, 0x11EA, 0x11EC, 0x11ED, 0x11EF, 0x11F0, 0x11F1, 0x11F3, 0x11F4, 0x11F5, 0x11F7, 0x11F8,
+  0x11FA, 0x11FB, 0x11FC, 0x11FE, 0x11FF, 0x1201, 0x1202, 0x1203, 0x1205, 0x1206, 0x1207, 0x1209,
+  0x120A, 0x120C, 0x120D, 0x120E, 0x1210, 0x1211, 0x1212, 0x1214, 0x1215, 0x1217, 0x1218, 0x1219,
+  0x121B, 0x121C, 0x121D, 0x121F, 0x1220, 0x1222, 0x1223, 0x1224, 0x1226, 0x1227, 0x1228, 0x122A,
+  0x122B, 0x122D, 0x122E, 0x122F, 0x1231, 0x1232, 0x1233, 0x1235, 0x1236, 0x1238, 0x1239, 0x123A,
+  0x123C, 0x123D, 0x123E, 0x1240, 0x1241, 0x1243, 0x1244, 0x1245, 0x1247, 0x1248, 0x124A, 0x124B,
+  0x124C, 0x124E, 0x124F, 0x1250, 0x1252, 0x1253, 0x1255, 0x1256, 0x1257, 0x1259, 0x125A, 0x125B,
+  0x125D, 0x125E, 0x1260, 0x1261, 0x1262, 0x1264, 0x1265, 0x1266, 0x1268, 0x1269, 0x126B, 0x126C,
+  0x126D, 0x126F, 0x1270, 0x1271, 0x1273, 0x1274, 0x1276, 0x1277, 0x1278, 0x127A, 0x127B, 0x127C,
+  0x127E, 0x127F, 0x1281, 0x1282, 0x1283, 0x1285, 0x1286, 0x1288, 0x1289, 0x128A, 0x128C, 0x128D,
+  0x11B1, 0x11B3, 0x11B4, 0x11B5, 0x11B7, 0x11B8, 0x11BA, 0x11BB, 0x11BC, 0x11BE, 0x11BF, 0x11C1,
+  0x11C2, 0x11C3, 0x11C5, 0x11C6, 0x11C7, 0x11C9, 0x11CA, 0x11CC, 0x11CD, 0x11CE, 0x11D0, 0x11D1,
+  0x11D3, 0x11D4, 0x11D5, 0x11D7, 0x11D8, 0x11DA, 0x11DB, 0x11DC, 0x11DE, 0x11DF, 0x11E0, 0x11E2,
+  0x11E3, 0x11E5, 0x11E6, 0x11E7, 0x11E9, 0x11EA, 0x11EC, 0x11ED, 0x11EE, 0x11F0, 0x11F1, 0x11F2,
+  0x11F4, 0x11F5, 0x11F7, 0x11F8, 0x11F9, 0x11FB, 0x11FC, 0x11FE, 0x11FF, 0x1200, 0x1202, 0x1203,
+  0x1204, 0x1206, 0x1207, 0x1209, 0x120A, 0x120B, 0x120D, 0x120E, 0x1210, 0x1211, 0x1212, 0x1214,
+  0x1215, 0x1216, 0x1218, 0x1219, 0x121B, 0x121C, 0x121D, 0x121F, 0x1220, 0x1222, 0x1223, 0x1224,
+  0x1226, 0x1227, 0x1229, 0x122A, 0x122B, 0x122D, 0x122E, 0x122F, 0x1231, 0x1232, 0x1234, 0x1235,
+  0x1236, 0x1238, 0x1239, 0x123B, 0x123C, 0x123D, 0x123F, 0x1240, 0x1241, 0x1243, 0x1244, 0x1246,
+  0x1247, 0x1248, 0x124A, 0x124B, 0x124D, 0x124E, 0x124F, 0x1251, 0x1252, 0x1253, 0x1255, 0x1256,
+  0x1258, 0x1259, 0x125A, 0x125C, 0x125D, 0x125F, 0x1260, 0x1261, 0x1263, 0x1264, 0x1265, 0x1267,
+  0x1268, 0x126A, 0x126B, 0x126C, 0x126E, 0x126F, 0x1271, 0x1272, 0x1273, 0x1275, 0x1276, 0x1278,
+  0x1279, 0x127A, 0x127C, 0x127D, 0x127E, 0x1280, 0x1281, 0x1283, 0x1284, 0x1285, 0x1287, 0x1288,
+  0x128A, 0x128B, 0x128C, 0x128E, 0x12F1, 0x12F2, 0x12F3, 0x12F5, 0x12F6, 0x12F8, 0x12F9, 0x12FA,
+  0x12FC, 0x12FD, 0x12FF, 0x1300, 0x1301, 0x1303, 0x1304, 0x1306, 0x1307, 0x1308, 0x130A, 0x130B,
+  0x130D, 0x130E, 0x130F, 0x1311, 0x1312, 0x1314, 0x1315, 0x1316, 0x1318, 0x1319, 0x131A, 0x131C,
+  0x131D, 0x131F, 0x1320, 0x1321, 0x1323, 0x1324, 0x1326, 0x1327, 0x1328, 0x132A, 0x132B, 0x132D,
+  0x132E, 0x132F, 0x1331, 0x1332, 0x1334, 0x1335, 0x1336, 0x1338, 0x1339, 0x133B, 0x133C, 0x133D,
+  0x133F, 0x1340, 0x1342, 0x1343, 0x1344, 0x1346, 0x1347, 0x1348, 0x134A, 0x134B, 0x134D, 0x134E,
+  0x134F, 0x1351, 0x1352, 0x1354, 0x1355, 0x1356, 0x1358, 0x1359, 0x135B, 0x135C, 0x135D, 0x135F,
+  0x1360, 0x1362, 0x1363, 0x1364, 0x1366, 0x1367, 0x1369, 0x136A, 0x136B, 0x136D, 0x136E, 0x1370,
+  0x1371, 0x1372, 0x1374, 0x1375, 0x1377, 0x1378, 0x1379, 0x137B, 0x137C, 0x137D, 0x137F, 0x1380,
+  0x1382, 0x1383, 0x1384, 0x1386, 0x1387, 0x1389, 0x138A, 0x138B, 0x138D, 0x138E, 0x1390, 0x1391,
+  0x1392, 0x1394, 0x1395, 0x1397, 0x1398, 0x1399, 0x139B, 0x139C, 0x139E, 0x139F, 0x13A0, 0x13A2,
+  0x13A3, 0x13A5, 0x13A6, 0x13A7, 0x13A9, 0x13AA, 0x13AB, 0x13AD, 0x13AE, 0x13B0, 0x13B1, 0x13B2,
+  0x13B4, 0x13B5, 0x13B7, 0x13B8, 0x13B9, 0x13BB, 0x13BC, 0x13BE, 0x13BF, 0x13C0, 0x13C2, 0x13C3,
+  0x13C5, 0x13C6, 0x13C7, 0x13C9, 0x13CA, 0x13CC, 0x13CD, 0x13CE, 0x12F0, 0x12F1, 0x12F3, 0x12F4,
+  0x12F6, 0x12F7, 0x12F8, 0x12FA, 0x12FB, 0x12FD, 0x12FE, 0x12FF, 0x1301, 0x1302, 0x1304, 0x1305,
+  0x1306, 0x1308, 0x1309, 0x130B, 0x130C, 0x130D, 0x130F, 0x1310, 0x1312, 0x1313, 0x1314, 0x1316,
+  0x1317, 0x1319, 0x131A, 0x131B, 0x131D, 0x131E, 0x1320, 0x1321, 0x1322, 0x1324, 0x1325, 0x1327,
+  0x1328, 0x1329, 0x132B, 0x132C, 0x132E, 0x132F, 0x1331, 0x1332, 0x1333, 0x1335, 0x1336, 0x1338,
+  0x1339, 0x133A, 0x133C, 0x133D, 0x133F, 0x1340, 0x1341, 0x1343, 0x1344, 0x1346, 0x1347, 0x1348,
+  0x134A, 0x134B, 0x134D, 0x134E, 0x134F, 0x1351, 0x1352, 0x1354, 0x1355, 0x1356, 0x1358, 0x1359,
+  0x135B, 0x135C, 0x135D, 0x135F, 0x1360, 0x1362, 0x1363, 0x1364, 0x1366, 0x1367, 0x1369, 0x136A,
+  0x136B, 0x136D, 0x136E, 0x1370, 0x1371, 0x1372, 0x1374, 0x1375, 0x1377, 0x1378, 0x1379, 0x137B,
+  0x137C, 0x137E, 0x137F, 0x1380, 0x1382, 0x1383, 0x1385, 0x1386, 0x1387, 0x1389, 0x138A, 0x138C,
+  0x138D, 0x138E, 0x1390, 0x1391, 0x1393, 0x1394, 0x1396, 0x1397, 0x1398, 0x139A, 0x139B, 0x139D,
+  0x139E, 0x139F, 0x13A1, 0x13A2, 0x13A4, 0x13A5, 0x13A6, 0x13A8, 0x13A9, 0x13AB, 0x13AC, 0x13AD,
+  0x13AF, 0x13B0, 0x13B2, 0x13B3, 0x13B4, 0x13B6, 0x13B7, 0x13B9, 0x13BA, 0x13BB, 0x13BD, 0x13BE,
+  0x13C0, 0x13C1, 0x13C2, 0x13C4, 0x13C5, 0x13C7, 0x13C8, 0x13C9, 0x13CB, 0x13CC, 0x13CE, 0x13CF,
+  0x12EF, 0x12F1, 0x12F2, 0x12F4, 0x12F5, 0x12F6, 0x12F8, 0x12F9, 0x12FB, 0x12FC, 0x12FD, 0x12FF,
+  0x1300, 0x1302, 0x1303, 0x1304, 0x1306, 0x1307, 0x1309, 0x130A, 0x130C, 0x130D, 0x130E, 0x1310,
+  0x1311, 0x1313, 0x1314, 0x1315, 0x1317, 0x1318, 0x131A, 0x131B, 0x131C, 0x131E, 0x131F, 0x1321,
+  0x1322, 0x1324, 0x1325, 0x1326, 0x1328, 0x1329, 0x132B, 0x132C, 0x132D, 0x132F, 0x1330, 0x1332,
+  0x1333, 0x1334, 0x1336, 0x1337, 0x1339, 0x133A, 0x133C, 0x133D, 0x133E, 0x1340, 0x1341, 0x1343,
+  0x1344, 0x1345, 0x1347, 0x1348, 0x134A, 0x134B, 0x134C, 0x134E, 0x134F, 0x1351, 0x1352, 0x1354,
+  0x1355, 0x1356, 0x1358, 0x1359, 0x135B, 0x135C, 0x135D, 0x135F, 0x1360, 0x1362, 0x1363, 0x1364,
+  0x1366, 0x1367, 0x1369, 0x136A, 0x136B, 0x136D, 0x136E, 0x1370, 0x1371, 0x1373, 0x1374, 0x1375,
+  0x1377, 0x1378, 0x137A, 0x137B, 0x137C, 0x137E, 0x137F, 0x1381, 0x1382, 0x1383, 0x1385, 0x1386,
+  0x1388, 0x1389, 0x138B, 0x138C, 0x138D, 0x138F, 0x1390, 0x1392, 0x1393, 0x1394, 0x1396, 0x1397,
+  0x1399, 0x139A, 0x139B, 0x139D, 0x139E, 0x13A0, 0x13A1, 0x13A3, 0x13A4, 0x13A5, 0x13A7, 0x13A8,
+  0x13AA, 0x13AB, 0x13AC, 0x13AE, 0x13AF, 0x13B1, 0x13B2, 0x13B3, 0x13B5, 0x13B6, 0x13B8, 0x13B9,
+  0x13BB, 0x13BC, 0x13BD, 0x13BF, 0x13C0, 0x13C2, 0x13C3, 0x13C4, 0x13C6, 0x13C7, 0x13C9, 0x13CA,
+  0x13CB, 0x13CD, 0x13CE, 0x13D0, 0x142F, 0x1430, 0x1431, 0x1433, 0x1434, 0x1436, 0x1437, 0x1439,
+  0x143A, 0x143B, 0x143D, 0x143E, 0x1440, 0x1441, 0x1442, 0x1444, 0x1445, 0x1447, 0x1448, 0x144A,
+  0x144B, 0x144C, 0x144E, 0x144F, 0x1451, 0x1452, 0x1454, 0x1455, 0x1456, 0x1458, 0x1459, 0x145B,
+  0x145C, 0x145D, 0x145F, 0x1460, 0x1462, 0x1463, 0x1465, 0x1466, 0x1467, 0x1469, 0x146A, 0x146C,
+  0x146D, 0x146E, 0x1470, 0x1471, 0x1473, 0x1474, 0x1476, 0x1477, 0x1478, 0x147A, 0x147B, 0x147D,
+  0x147E, 0x1480, 0x1481, 0x1482, 0x1484, 0x1485, 0x1487, 0x1488, 0x1489, 0x148B, 0x148C, 0x148E,
+  0x148F, 0x1491, 0x1492, 0x1493, 0x1495, 0x1496, 0x1498, 0x1499, 0x149B, 0x149C, 0x149D, 0x149F,
+  0x14A0, 0x14A2, 0x14A3, 0x14A4, 0x14A6, 0x14A7, 0x14A9, 0x14AA, 0x14AC, 0x14AD, 0x14AE, 0x14B0,
+  0x14B1, 0x14B3, 0x14B4, 0x14B6, 0x14B7, 0x14B8, 0x14BA, 0x14BB, 0x14BD, 0x14BE, 0x14BF, 0x14C1,
+  0x14C2, 0x14C4, 0x14C5, 0x14C7, 0x14C8, 0x14C9, 0x14CB, 0x14CC, 0x14CE, 0x14CF, 0x14D1, 0x14D2,
+  0x14D3, 0x14D5, 0x14D6, 0x14D8, 0x14D9, 0x14DA, 0x14DC, 0x14DD, 0x14DF, 0x14E0, 0x14E2, 0x14E3,
+  0x14E4, 0x14E6, 0x14E7, 0x14E9, 0x14EA, 0x14EB, 0x14ED, 0x14EE, 0x14F0, 0x14F1, 0x14F3, 0x14F4,
+  0x14F5, 0x14F7, 0x14F8, 0x14FA, 0x14FB, 0x14FD, 0x14FE, 0x14FF, 0x1501, 0x1502, 0x1504, 0x1505,
+  0x1506, 0x1508, 0x1509, 0x150B, 0x150C, 0x150E, 0x150F, 0x1510, 0x142E, 0x142F, 0x1431, 0x1432,
+  0x1434, 0x1435, 0x1436, 0x1438, 0x1439, 0x143B, 0x143C, 0x143E, 0x143F, 0x1440, 0x1442, 0x1443,
+  0x1445, 0x1446, 0x1448, 0x1449, 0x144A, 0x144C, 0x144D, 0x144F, 0x1450, 0x1452, 0x1453, 0x1454,
+  0x1456, 0x1457, 0x1459, 0x145A, 0x145C, 0x145D, 0x145E, 0x1460, 0x1461, 0x1463, 0x1464, 0x1466,
+  0x1467, 0x1468, 0x146A, 0x146B, 0x146D, 0x146E, 0x1470, 0x1471, 0x1472, 0x1474, 0x1475, 0x1477,
+  0x1478, 0x147A, 0x147B, 0x147C, 0x147E, 0x147F, 0x1481, 0x1482, 0x1484, 0x1485, 0x1486, 0x1488,
+  0x1489, 0x148B, 0x148C, 0x148E, 0x148F, 0x1490, 0x1492, 0x1493, 0x1495, 0x1496, 0x1498, 0x1499,
+  0x149A, 0x149C, 0x149D, 0x149F, 0x14A0, 0x14A2, 0x14A3, 0x14A5, 0x14A6, 0x14A7, 0x14A9, 0x14AA,
+  0x14AC, 0x14AD, 0x14AF, 0x14B0, 0x14B1, 0x14B3, 0x14B4, 0x14B6, 0x14B7, 0x14B9, 0x14BA, 0x14BB,
+  0x14BD, 0x14BE, 0x14C0, 0x14C1, 0x14C3, 0x14C4, 0x14C5, 0x14C7, 0x14C8, 0x14CA, 0x14CB, 0x14CD,
+  0x14CE, 0x14CF, 0x14D1, 0x14D2, 0x14D4, 0x14D5, 0x14D7, 0x14D8, 0x14D9, 0x14DB, 0x14DC, 0x14DE,
+  0x14DF, 0x14E1, 0x14E2, 0x14E3, 0x14E5, 0x14E6, 0x14E8, 0x14E9, 0x14EB, 0x14EC, 0x14ED, 0x14EF,
+  0x14F0, 0x14F2, 0x14F3, 0x14F5, 0x14F6, 0x14F7, 0x14F9, 0x14FA, 0x14FC, 0x14FD, 0x14FF, 0x1500,
+  0x1501, 0x1503, 0x1504, 0x1506, 0x1507, 0x1509, 0x150A, 0x150B, 0x150D, 0x150E, 0x1510, 0x1511,
+  0x156D, 0x156F, 0x1570, 0x1571, 0x1573, 0x1574, 0x1576, 0x1577, 0x1579, 0x157A, 0x157C, 0x157D,
+  0x157E, 0x1580, 0x1581, 0x1583, 0x1584, 0x1586, 0x1587, 0x1588, 0x158A, 0x158B, 0x158D, 0x158E,
+  0x1590, 0x1591, 0x1593, 0x1594, 0x1595, 0x1597, 0x1598, 0x159A, 0x159B, 0x159D, 0x159E, 0x159F,
+  0x15A1, 0x15A2, 0x15A4, 0x15A5, 0x15A7, 0x15A8, 0x15AA, 0x15AB, 0x15AC, 0x15AE, 0x15AF, 0x15B1,
+  0x15B2, 0x15B4, 0x15B5, 0x15B7, 0x15B8, 0x15B9, 0x15BB, 0x15BC, 0x15BE, 0x15BF, 0x15C1, 0x15C2,
+  0x15C3, 0x15C5, 0x15C6, 0x15C8, 0x15C9, 0x15CB, 0x15CC, 0x15CE, 0x15CF, 0x15D0, 0x15D2, 0x15D3,
+  0x15D5, 0x15D6, 0x15D8, 0x15D9, 0x15DA, 0x15DC, 0x15DD, 0x15DF, 0x15E0, 0x15E2, 0x15E3, 0x15E5,
+  0x15E6, 0x15E7, 0x15E9, 0x15EA, 0x15EC, 0x15ED, 0x15EF, 0x15F0, 0x15F1, 0x15F3, 0x15F4, 0x15F6,
+  0x15F7, 0x15F9, 0x15FA, 0x15FC, 0x15FD, 0x15FE, 0x1600, 0x1601, 0x1603, 0x1604, 0x1606, 0x1607,
+  0x1608, 0x160A, 0x160B, 0x160D, 0x160E, 0x1610, 0x1611, 0x1613, 0x1614, 0x1615, 0x1617, 0x1618,
+  0x161A, 0x161B, 0x161D, 0x161E, 0x1620, 0x1621, 0x1622, 0x1624, 0x1625, 0x1627, 0x1628, 0x162A,
+  0x162B, 0x162C, 0x162E, 0x162F, 0x1631, 0x1632, 0x1634, 0x1635, 0x1637, 0x1638, 0x1639, 0x163B,
+  0x163C, 0x163E, 0x163F, 0x1641, 0x1642, 0x1643, 0x1645, 0x1646, 0x1648, 0x1649, 0x164B, 0x164C,
+  0x164E, 0x164F, 0x1650, 0x1652, 0x156C, 0x156E, 0x156F, 0x1571, 0x1572, 0x1574, 0x1575, 0x1577,
+  0x1578, 0x1579, 0x157B, 0x157C, 0x157E, 0x157F, 0x1581, 0x1582, 0x1584, 0x1585, 0x1586, 0x1588,
+  0x1589, 0x158B, 0x158C, 0x158E, 0x158F, 0x1591, 0x1592, 0x1594, 0x1595, 0x1596, 0x1598, 0x1599,
+  0x159B, 0x159C, 0x159E, 0x159F, 0x15A1, 0x15A2, 0x15A3, 0x15A5, 0x15A6, 0x15A8, 0x15A9, 0x15AB,
+  0x15AC, 0x15AE, 0x15AF, 0x15B0, 0x15B2, 0x15B3, 0x15B5, 0x15B6, 0x15B8, 0x15B9, 0x15BB, 0x15BC,
+  0x15BD, 0x15BF, 0x15C0, 0x15C2, 0x15C3, 0x15C5, 0x15C6, 0x15C8, 0x15C9, 0x15CB, 0x15CC, 0x15CD,
+  0x15CF, 0x15D0, 0x15D2, 0x15D3, 0x15D5, 0x15D6, 0x15D8, 0x15D9, 0x15DA, 0x15DC, 0x15DD, 0x15DF,
+  0x15E0, 0x15E2, 0x15E3, 0x15E5, 0x15E6, 0x15E7, 0x15E9, 0x15EA, 0x15EC, 0x15ED, 0x15EF, 0x15F0,
+  0x15F2, 0x15F3, 0x15F4, 0x15F6, 0x15F7, 0x15F9, 0x15FA, 0x15FC, 0x15FD, 0x15FF, 0x1600, 0x1602,
+  0x1603, 0x1604, 0x1606, 0x1607, 0x1609, 0x160A, 0x160C, 0x160D, 0x160F, 0x1610, 0x1611, 0x1613,
+  0x1614, 0x1616, 0x1617, 0x1619, 0x161A, 0x161C, 0x161D, 0x161E, 0x1620, 0x1621, 0x1623, 0x1624,
+  0x1626, 0x1627, 0x1629, 0x162A, 0x162B, 0x162D, 0x162E, 0x1630, 0x1631, 0x1633, 0x1634, 0x1636,
+  0x1637, 0x1639, 0x163A, 0x163B, 0x163D, 0x163E, 0x1640, 0x1641, 0x1643, 0x1644, 0x1646, 0x1647,
+  0x1648, 0x164A, 0x164B, 0x164D, 0x164E, 0x1650, 0x1651, 0x1653, 0x16AC, 0x16AD, 0x16AF, 0x16B0,
+  0x16B2, 0x16B3, 0x16B4, 0x16B6, 0x16B7, 0x16B9, 0x16BA, 0x16BC, 0x16BD, 0x16BF, 0x16C0, 0x16C2,
+  0x16C3, 0x16C4, 0x16C6, 0x16C7, 0x16C9, 0x16CA, 0x16CC, 0x16CD, 0x16CF, 0x16D0, 0x16D2, 0x16D3,
+  0x16D4, 0x16D6, 0x16D7, 0x16D9, 0x16DA, 0x16DC, 0x16DD, 0x16DF, 0x16E0, 0x16E2, 0x16E3, 0x16E5,
+  0x16E6, 0x16E7, 0x16E9, 0x16EA, 0x16EC, 0x16ED, 0x16EF, 0x16F0, 0x16F2, 0x16F3, 0x16F5, 0x16F6,
+  0x16F7, 0x16F9, 0x16FA, 0x16FC, 0x16FD, 0x16FF, 0x1700, 0x1702, 0x1703, 0x1705, 0x1706, 0x1707,
+  0x1709, 0x170A, 0x170C, 0x170D, 0x170F, 0x1710, 0x1712, 0x1713, 0x1715, 0x1716, 0x1717, 0x1719,
+  0x171A, 0x171C, 0x171D, 0x171F, 0x1720, 0x1722, 0x1723, 0x1725, 0x1726, 0x1728, 0x1729, 0x172A,
+  0x172C, 0x172D, 0x172F, 0x1730, 0x1732, 0x1733, 0x1735, 0x1736, 0x1738, 0x1739, 0x173A, 0x173C,
+  0x173D, 0x173F, 0x1740, 0x1742, 0x1743, 0x1745, 0x1746, 0x1748, 0x1749, 0x174A, 0x174C, 0x174D,
+  0x174F, 0x1750, 0x1752, 0x1753, 0x1755, 0x1756, 0x1758, 0x1759, 0x175A, 0x175C, 0x175D, 0x175F,
+  0x1760, 0x1762, 0x1763, 0x1765, 0x1766, 0x1768, 0x1769, 0x176B, 0x176C, 0x176D, 0x176F, 0x1770,
+  0x1772, 0x1773, 0x1775, 0x1776, 0x1778, 0x1779, 0x177B, 0x177C, 0x177D, 0x177F, 0x1780, 0x1782,
+  0x1783, 0x1785, 0x1786, 0x1788, 0x1789, 0x178B, 0x178C, 0x178D, 0x178F, 0x1790, 0x1792, 0x1793,
+  0x16AB, 0x16AC, 0x16AE, 0x16AF, 0x16B1, 0x16B2, 0x16B4, 0x16B5, 0x16B7, 0x16B8, 0x16BA, 0x16BB,
+  0x16BD, 0x16BE, 0x16BF, 0x16C1, 0x16C2, 0x16C4, 0x16C5, 0x16C7, 0x16C8, 0x16CA, 0x16CB, 0x16CD,
+  0x16CE, 0x16D0, 0x16D1, 0x16D3, 0x16D4, 0x16D5, 0x16D7, 0x16D8, 0x16DA, 0x16DB, 0x16DD, 0x16DE,
+  0x16E0, 0x16E1, 0x16E3, 0x16E4, 0x16E6, 0x16E7, 0x16E9, 0x16EA, 0x16EB, 0x16ED, 0x16EE, 0x16F0,
+  0x16F1, 0x16F3, 0x16F4, 0x16F6, 0x16F7, 0x16F9, 0x16FA, 0x16FC, 0x16FD, 0x16FF, 0x1700, 0x1701,
+  0x1703, 0x1704, 0x1706, 0x1707, 0x1709, 0x170A, 0x170C, 0x170D, 0x170F, 0x1710, 0x1712, 0x1713,
+  0x1715, 0x1716, 0x1717, 0x1719, 0x171A, 0x171C, 0x171D, 0x171F, 0x1720, 0x1722, 0x1723, 0x1725,
+  0x1726, 0x1728, 0x1729, 0x172A, 0x172C, 0x172D, 0x172F, 0x1730, 0x1732, 0x1733, 0x1735, 0x1736,
+  0x1738, 0x1739, 0x173B, 0x173C, 0x173E, 0x173F, 0x1740, 0x1742, 0x1743, 0x1745, 0x1746, 0x1748,
+  0x1749, 0x174B, 0x174C, 0x174E, 0x174F, 0x1751, 0x1752, 0x1754, 0x1755, 0x1756, 0x1758, 0x1759,
+  0x175B, 0x175C, 0x175E, 0x175F, 0x1761, 0x1762, 0x1764, 0x1765, 0x1767, 0x1768, 0x176A, 0x176B,
+  0x176C, 0x176E, 0x176F, 0x1771, 0x1772, 0x1774, 0x1775, 0x1777, 0x1778, 0x177A, 0x177B, 0x177D,
+  0x177E, 0x1780, 0x1781, 0x1782, 0x1784, 0x1785, 0x1787, 0x1788, 0x178A, 0x178B, 0x178D, 0x178E,
+  0x1790, 0x1791, 0x1793, 0x1794, 0x17EA, 0x17EC, 0x17ED, 0x17EF, 0x17F0, 0x17F2, 0x17F3, 0x17F5,
+  0x17F6, 0x17F7, 0x17F9, 0x17FA, 0x17FC, 0x17FD, 0x17FF, 0x1800, 0x1802, 0x1803, 0x1805, 0x1806,
+  0x1808, 0x1809, 0x180B, 0x180C, 0x180E, 0x180F, 0x1811, 0x1812, 0x1814, 0x1815, 0x1816, 0x1818,
+  0x1819, 0x181B, 0x181C, 0x181E, 0x181F, 0x1821, 0x1822, 0x1824, 0x1825, 0x1827, 0x1828, 0x182A,
+  0x182B, 0x182D, 0x182E, 0x1830, 0x1831, 0x1832, 0x1834, 0x1835, 0x1837, 0x1838, 0x183A, 0x183B,
+  0x183D, 0x183E, 0x1840, 0x1841, 0x1843, 0x1844, 0x1846, 0x1847, 0x1849, 0x184A, 0x184C, 0x184D,
+  0x184F, 0x1850, 0x1851, 0x1853, 0x1854, 0x1856, 0x1857, 0x1859, 0x185A, 0x185C, 0x185D, 0x185F,
+  0x1860, 0x1862, 0x1863, 0x1865, 0x1866, 0x1868, 0x1869, 0x186B, 0x186C, 0x186E, 0x186F, 0x1870,
+  0x1872, 0x1873, 0x1875, 0x1876, 0x1878, 0x1879, 0x187B, 0x187C, 0x187E, 0x187F, 0x1881, 0x1882,
+  0x1884, 0x1885, 0x1887, 0x1888, 0x188A, 0x188B, 0x188D, 0x188E, 0x188F, 0x1891, 0x1892, 0x1894,
+  0x1895, 0x1897, 0x1898, 0x189A, 0x189B, 0x189D, 0x189E, 0x18A0, 0x18A1, 0x18A3, 0x18A4, 0x18A6,
+  0x18A7, 0x18A9, 0x18AA, 0x18AB, 0x18AD, 0x18AE, 0x18B0, 0x18B1, 0x18B3, 0x18B4, 0x18B6, 0x18B7,
+  0x18B9, 0x18BA, 0x18BC, 0x18BD, 0x18BF, 0x18C0, 0x18C2, 0x18C3, 0x18C5, 0x18C6, 0x18C8, 0x18C9,
+  0x18CA, 0x18CC, 0x18CD, 0x18CF, 0x18D0, 0x18D2, 0x18D3, 0x18D5, 0x17E9, 0x17EB, 0x17EC, 0x17EE,
+  0x17EF, 0x17F1, 0x17F2, 0x17F4, 0x17F5, 0x17F7, 0x17F8, 0x17FA, 0x17FB, 0x17FD, 0x17FE, 0x1800,
+  0x1801, 0x1803, 0x1804, 0x1806, 0x1807, 0x1809, 0x180A, 0x180C, 0x180D, 0x180F, 0x1810, 0x1812,
+  0x1813, 0x1815, 0x1816, 0x1817, 0x1819, 0x181A, 0x181C, 0x181D, 0x181F, 0x1820, 0x1822, 0x1823,
+  0x1825, 0x1826, 0x1828, 0x1829, 0x182B, 0x182C, 0x182E, 0x182F, 0x1831, 0x1832, 0x1834, 0x1835,
+  0x1837, 0x1838, 0x183A, 0x183B, 0x183D, 0x183E, 0x1840, 0x1841, 0x1843, 0x1844, 0x1846, 0x1847,
+  0x1848, 0x184A, 0x184B, 0x184D, 0x184E, 0x1850, 0x1851, 0x1853, 0x1854, 0x1856, 0x1857, 0x1859,
+  0x185A, 0x185C, 0x185D, 0x185F, 0x1860, 0x1862, 0x1863, 0x1865, 0x1866, 0x1868, 0x1869, 0x186B,
+  0x186C, 0x186E, 0x186F, 0x1871, 0x1872, 0x1874, 0x1875, 0x1877, 0x1878, 0x1879, 0x187B, 0x187C,
+  0x187E, 0x187F, 0x1881, 0x1882, 0x1884, 0x1885, 0x1887, 0x1888, 0x188A, 0x188B, 0x188D, 0x188E,
+  0x1890, 0x1891, 0x1893, 0x1894, 0x1896, 0x1897, 0x1899, 0x189A, 0x189C, 0x189D, 0x189F, 0x18A0,
+  0x18A2, 0x18A3, 0x18A5, 0x18A6, 0x18A8, 0x18A9, 0x18AA, 0x18AC, 0x18AD, 0x18AF, 0x18B0, 0x18B2,
+  0x18B3, 0x18B5, 0x18B6, 0x18B8, 0x18B9, 0x18BB, 0x18BC, 0x18BE, 0x18BF, 0x18C1, 0x18C2, 0x18C4,
+  0x18C5, 0x18C7, 0x18C8, 0x18CA, 0x18CB, 0x18CD, 0x18CE, 0x18D0, 0x18D1, 0x18D3, 0x18D4, 0x18D6,
+  0x17E9, 0x17EA, 0x17EC, 0x17ED, 0x17EF, 0x17F0, 0x17F2, 0x17F3, 0x17F5, 0x17F6, 0x17F8, 0x17F9,
+  0x17FB, 0x17FC, 0x17FE, 0x17FF, 0x1801, 0x1802, 0x1804, 0x1805, 0x1807, 0x1808, 0x180A, 0x180B,
+  0x180D, 0x180E, 0x1810, 0x1811, 0x1813, 0x1814, 0x1816, 0x1817, 0x1818, 0x181A, 0x181B, 0x181D,
+  0x181E, 0x1820, 0x1821, 0x1823, 0x1824, 0x1826, 0x1827, 0x1829, 0x182A, 0x182C, 0x182D, 0x182F,
+  0x1830, 0x1832, 0x1833, 0x1835, 0x1836, 0x1838, 0x1839, 0x183B, 0x183C, 0x183E, 0x183F, 0x1841,
+  0x1842, 0x1844, 0x1845, 0x1847, 0x1848, 0x184A, 0x184B, 0x184D, 0x184E, 0x1850, 0x1851, 0x1853,
+  0x1854, 0x1856, 0x1857, 0x1859, 0x185A, 0x185C, 0x185D, 0x185F, 0x1860, 0x1862, 0x1863, 0x1865,
+  0x1866, 0x1868, 0x1869, 0x186B, 0x186C, 0x186E, 0x186F, 0x1871, 0x1872, 0x1874, 0x1875, 0x1877,
+  0x1878, 0x187A, 0x187B, 0x187D, 0x187E, 0x1880, 0x1881, 0x1883, 0x1884, 0x1886, 0x1887, 0x1889,
+  0x188A, 0x188C, 0x188D, 0x188F, 0x1890, 0x1892, 0x1893, 0x1895, 0x1896, 0x1898, 0x1899, 0x189B,
+  0x189C, 0x189E, 0x189F, 0x18A1, 0x18A2, 0x18A4, 0x18A5, 0x18A7, 0x18A8, 0x18A9, 0x18AB, 0x18AC,
+  0x18AE, 0x18AF, 0x18B1, 0x18B2, 0x18B4, 0x18B5, 0x18B7, 0x18B8, 0x18BA, 0x18BB, 0x18BD, 0x18BE,
+  0x18C0, 0x18C1, 0x18C3, 0x18C4, 0x18C6, 0x18C7, 0x18C9, 0x18CA, 0x18CC, 0x18CD, 0x18CF, 0x18D0,
+  0x18D2, 0x18D3, 0x18D5, 0x18D6, 0x1928, 0x1929, 0x192B, 0x192C, 0x192E, 0x192F, 0x1931, 0x1932,
+  0x1934, 0x1935, 0x1937, 0x1938, 0x193A, 0x193B, 0x193D, 0x193E, 0x1940, 0x1941, 0x1943, 0x1944,
+  0x1946, 0x1947, 0x1949, 0x194A, 0x194C, 0x194D, 0x194F, 0x1951, 0x1952, 0x1954, 0x1955, 0x1957,
+  0x1958, 0x195A, 0x195B, 0x195D, 0x195E, 0x1960, 0x1961, 0x1963, 0x1964, 0x1966, 0x1967, 0x1969,
+  0x196A, 0x196C, 0x196D, 0x196F, 0x1970, 0x1972, 0x1973, 0x1975, 0x1976, 0x1978, 0x1979, 0x197B,
+  0x197C, 0x197E, 0x197F, 0x1981, 0x1982, 0x1984, 0x1985, 0x1987, 0x1988, 0x198A, 0x198B, 0x198D,
+  0x198E, 0x1990, 0x1991, 0x1993, 0x1994, 0x1996, 0x1997, 0x1999, 0x199A, 0x199C, 0x199D, 0x199F,
+  0x19A0, 0x19A2, 0x19A3, 0x19A5, 0x19A6, 0x19A8, 0x19A9, 0x19AB, 0x19AC, 0x19AE, 0x19AF, 0x19B1,
+  0x19B2, 0x19B4, 0x19B5, 0x19B7, 0x19B8, 0x19BA, 0x19BB, 0x19BD, 0x19BE, 0x19C0, 0x19C1, 0x19C3,
+  0x19C4, 0x19C6, 0x19C7, 0x19C9, 0x19CA, 0x19CC, 0x19CD, 0x19CF, 0x19D0, 0x19D2, 0x19D3, 0x19D5,
+  0x19D6, 0x19D8, 0x19D9, 0x19DB, 0x19DC, 0x19DE, 0x19DF, 0x19E1, 0x19E2, 0x19E4, 0x19E5, 0x19E7,
+  0x19E8, 0x19EA, 0x19EB, 0x19ED, 0x19EE, 0x19F0, 0x19F2, 0x19F3, 0x19F5, 0x19F6, 0x19F8, 0x19F9,
+  0x19FB, 0x19FC, 0x19FE, 0x19FF, 0x1A01, 0x1A02, 0x1A04, 0x1A05, 0x1A07, 0x1A08, 0x1A0A, 0x1A0B,
+  0x1A0D, 0x1A0E, 0x1A10, 0x1A11, 0x1A13, 0x1A14, 0x1A16, 0x1A17, 0x1927, 0x1929, 0x192A, 0x192C,
+  0x192D, 0x192F, 0x1930, 0x1932, 0x1933, 0x1935, 0x1936, 0x1938, 0x1939, 0x193B, 0x193C, 0x193E,
+  0x193F, 0x1941, 0x1942, 0x1944, 0x1945, 0x1947, 0x1948, 0x194A, 0x194B, 0x194D, 0x194E, 0x1950,
+  0x1951, 0x1953, 0x1955, 0x1956, 0x1958, 0x1959, 0x195B, 0x195C, 0x195E, 0x195F, 0x1961, 0x1962,
+  0x1964, 0x1965, 0x1967, 0x1968, 0x196A, 0x196B, 0x196D, 0x196E, 0x1970, 0x1971, 0x1973, 0x1974,
+  0x1976, 0x1977, 0x1979, 0x197A, 0x197C, 0x197D, 0x197F, 0x1980, 0x1982, 0x1983, 0x1985, 0x1987,
+  0x1988, 0x198A, 0x198B, 0x198D, 0x198E, 0x1990, 0x1991, 0x1993, 0x1994, 0x1996, 0x1997, 0x1999,
+  0x199A, 0x199C, 0x199D, 0x199F, 0x19A0, 0x19A2, 0x19A3, 0x19A5, 0x19A6, 0x19A8, 0x19A9, 0x19AB,
+  0x19AC, 0x19AE, 0x19AF, 0x19B1, 0x19B2, 0x19B4, 0x19B5, 0x19B7, 0x19B8, 0x19BA, 0x19BC, 0x19BD,
+  0x19BF, 0x19C0, 0x19C2, 0x19C3, 0x19C5, 0x19C6, 0x19C8, 0x19C9, 0x19CB, 0x19CC, 0x19CE, 0x19CF,
+  0x19D1, 0x19D2, 0x19D4, 0x19D5, 0x19D7, 0x19D8, 0x19DA, 0x19DB, 0x19DD, 0x19DE, 0x19E0, 0x19E1,
+  0x19E3, 0x19E4, 0x19E6, 0x19E7, 0x19E9, 0x19EA, 0x19EC, 0x19EE, 0x19EF, 0x19F1, 0x19F2, 0x19F4,
+  0x19F5, 0x19F7, 0x19F8, 0x19FA, 0x19FB, 0x19FD, 0x19FE, 0x1A00, 0x1A01, 0x1A03, 0x1A04, 0x1A06,
+  0x1A07, 0x1A09, 0x1A0A, 0x1A0C, 0x1A0D, 0x1A0F, 0x1A10, 0x1A12, 0x1A13, 0x1A15, 0x1A16, 0x1A18,
+  0x1A66, 0x1A68, 0x1A69, 0x1A6B, 0x1A6C, 0x1A6E, 0x1A6F, 0x1A71, 0x1A72, 0x1A74, 0x1A76, 0x1A77,
+  0x1A79, 0x1A7A, 0x1A7C, 0x1A7D, 0x1A7F, 0x1A80, 0x1A82, 0x1A83, 0x1A85, 0x1A86, 0x1A88, 0x1A89,
+  0x1A8B, 0x1A8C, 0x1A8E, 0x1A8F, 0x1A91, 0x1A93, 0x1A94, 0x1A96, 0x1A97, 0x1A99, 0x1A9A, 0x1A9C,
+  0x1A9D, 0x1A9F, 0x1AA0, 0x1AA2, 0x1AA3, 0x1AA5, 0x1AA6, 0x1AA8, 0x1AA9, 0x1AAB, 0x1AAC, 0x1AAE,
+  0x1AAF, 0x1AB1, 0x1AB3, 0x1AB4, 0x1AB6, 0x1AB7, 0x1AB9, 0x1ABA, 0x1ABC, 0x1ABD, 0x1ABF, 0x1AC0,
+  0x1AC2, 0x1AC3, 0x1AC5, 0x1AC6, 0x1AC8, 0x1AC9, 0x1ACB, 0x1ACC, 0x1ACE, 0x1ACF, 0x1AD1, 0x1AD3,
+  0x1AD4, 0x1AD6, 0x1AD7, 0x1AD9, 0x1ADA, 0x1ADC, 0x1ADD, 0x1ADF, 0x1AE0, 0x1AE2, 0x1AE3, 0x1AE5,
+  0x1AE6, 0x1AE8, 0x1AE9, 0x1AEB, 0x1AEC, 0x1AEE, 0x1AF0, 0x1AF1, 0x1AF3, 0x1AF4, 0x1AF6, 0x1AF7,
+  0x1AF9, 0x1AFA, 0x1AFC, 0x1AFD, 0x1AFF, 0x1B00, 0x1B02, 0x1B03, 0x1B05, 0x1B06, 0x1B08, 0x1B09,
+  0x1B0B, 0x1B0C, 0x1B0E, 0x1B10, 0x1B11, 0x1B13, 0x1B14, 0x1B16, 0x1B17, 0x1B19, 0x1B1A, 0x1B1C,
+  0x1B1D, 0x1B1F, 0x1B20, 0x1B22, 0x1B23, 0x1B25, 0x1B26, 0x1B28, 0x1B29, 0x1B2B, 0x1B2C, 0x1B2E,
+  0x1B30, 0x1B31, 0x1B33, 0x1B34, 0x1B36, 0x1B37, 0x1B39, 0x1B3A, 0x1B3C, 0x1B3D, 0x1B3F, 0x1B40,
+  0x1B42, 0x1B43, 0x1B45, 0x1B46, 0x1B48, 0x1B49, 0x1B4B, 0x1B4D, 0x1B4E, 0x1B50, 0x1B51, 0x1B53,
+  0x1B54, 0x1B56, 0x1B57, 0x1B59, 0x1A65, 0x1A67, 0x1A69, 0x1A6A, 0x1A6C, 0x1A6D, 0x1A6F, 0x1A70,
+  0x1A72, 0x1A73, 0x1A75, 0x1A76, 0x1A78, 0x1A79, 0x1A7B, 0x1A7C, 0x1A7E, 0x1A80, 0x1A81, 0x1A83,
+  0x1A84, 0x1A86, 0x1A87, 0x1A89, 0x1A8A, 0x1A8C, 0x1A8D, 0x1A8F, 0x1A90, 0x1A92, 0x1A94, 0x1A95,
+  0x1A97, 0x1A98, 0x1A9A, 0x1A9B, 0x1A9D, 0x1A9E, 0x1AA0, 0x1AA1, 0x1AA3, 0x1AA4, 0x1AA6, 0x1AA7,
+  0x1AA9, 0x1AAB, 0x1AAC, 0x1AAE, 0x1AAF, 0x1AB1, 0x1AB2, 0x1AB4, 0x1AB5, 0x1AB7, 0x1AB8, 0x1ABA,
+  0x1ABB, 0x1ABD, 0x1ABE, 0x1AC0, 0x1AC2, 0x1AC3, 0x1AC5, 0x1AC6, 0x1AC8, 0x1AC9, 0x1ACB, 0x1ACC,
+  0x1ACE, 0x1ACF, 0x1AD1, 0x1AD2, 0x1AD4, 0x1AD6, 0x1AD7, 0x1AD9, 0x1ADA, 0x1ADC, 0x1ADD, 0x1ADF,
+  0x1AE0, 0x1AE2, 0x1AE3, 0x1AE5, 0x1AE6, 0x1AE8, 0x1AE9, 0x1AEB, 0x1AED, 0x1AEE, 0x1AF0, 0x1AF1,
+  0x1AF3, 0x1AF4, 0x1AF6, 0x1AF7, 0x1AF9, 0x1AFA, 0x1AFC, 0x1AFD, 0x1AFF, 0x1B01, 0x1B02, 0x1B04,
+  0x1B05, 0x1B07, 0x1B08, 0x1B0A, 0x1B0B, 0x1B0D, 0x1B0E, 0x1B10, 0x1B11, 0x1B13, 0x1B14, 0x1B16,
+  0x1B18, 0x1B19, 0x1B1B, 0x1B1C, 0x1B1E, 0x1B1F, 0x1B21, 0x1B22, 0x1B24, 0x1B25, 0x1B27, 0x1B28,
+  0x1B2A, 0x1B2B, 0x1B2D, 0x1B2F, 0x1B30, 0x1B32, 0x1B33, 0x1B35, 0x1B36, 0x1B38, 0x1B39, 0x1B3B,
+  0x1B3C, 0x1B3E, 0x1B3F, 0x1B41, 0x1B43, 0x1B44, 0x1B46, 0x1B47, 0x1B49, 0x1B4A, 0x1B4C, 0x1B4D,
+  0x1B4F, 0x1B50, 0x1B52, 0x1B53, 0x1B55, 0x1B56, 0x1B58, 0x1B5A, 0x1BA5, 0x1BA6, 0x1BA8, 0x1BA9,
+  0x1BAB, 0x1BAC, 0x1BAE, 0x1BAF, 0x1BB1, 0x1BB3, 0x1BB4, 0x1BB6, 0x1BB7, 0x1BB9, 0x1BBA, 0x1BBC,
+  0x1BBD, 0x1BBF, 0x1BC0, 0x1BC2, 0x1BC4, 0x1BC5, 0x1BC7, 0x1BC8, 0x1BCA, 0x1BCB, 0x1BCD, 0x1BCE,
+  0x1BD0, 0x1BD1, 0x1BD3, 0x1BD5, 0x1BD6, 0x1BD8, 0x1BD9, 0x1BDB, 0x1BDC, 0x1BDE, 0x1BDF, 0x1BE1,
+  0x1BE2, 0x1BE4, 0x1BE6, 0x1BE7, 0x1BE9, 0x1BEA, 0x1BEC, 0x1BED, 0x1BEF, 0x1BF0, 0x1BF2, 0x1BF3,
+  0x1BF5, 0x1BF7, 0x1BF8, 0x1BFA, 0x1BFB, 0x1BFD, 0x1BFE, 0x1C00, 0x1C01, 0x1C03, 0x1C04, 0x1C06,
+  0x1C08, 0x1C09, 0x1C0B, 0x1C0C, 0x1C0E, 0x1C0F, 0x1C11, 0x1C12, 0x1C14, 0x1C15, 0x1C17, 0x1C19,
+  0x1C1A, 0x1C1C, 0x1C1D, 0x1C1F, 0x1C20, 0x1C22, 0x1C23, 0x1C25, 0x1C26, 0x1C28, 0x1C2A, 0x1C2B,
+  0x1C2D, 0x1C2E, 0x1C30, 0x1C31, 0x1C33, 0x1C34, 0x1C36, 0x1C37, 0x1C39, 0x1C3B, 0x1C3C, 0x1C3E,
+  0x1C3F, 0x1C41, 0x1C42, 0x1C44, 0x1C45, 0x1C47, 0x1C48, 0x1C4A, 0x1C4C, 0x1C4D, 0x1C4F, 0x1C50,
+  0x1C52, 0x1C53, 0x1C55, 0x1C56, 0x1C58, 0x1C59, 0x1C5B, 0x1C5D, 0x1C5E, 0x1C60, 0x1C61, 0x1C63,
+  0x1C64, 0x1C66, 0x1C67, 0x1C69, 0x1C6A, 0x1C6C, 0x1C6E, 0x1C6F, 0x1C71, 0x1C72, 0x1C74, 0x1C75,
+  0x1C77, 0x1C78, 0x1C7A, 0x1C7B, 0x1C7D, 0x1C7F, 0x1C80, 0x1C82, 0x1C83, 0x1C85, 0x1C86, 0x1C88,
+  0x1C89, 0x1C8B, 0x1C8C, 0x1C8E, 0x1C90, 0x1C91, 0x1C93, 0x1C94, 0x1C96, 0x1C97, 0x1C99, 0x1C9A,
+  0x1BA4, 0x1BA5, 0x1BA7, 0x1BA8, 0x1BAA, 0x1BAC, 0x1BAD, 0x1BAF, 0x1BB0, 0x1BB2, 0x1BB3, 0x1BB5,
+  0x1BB6, 0x1BB8, 0x1BBA, 0x1BBB, 0x1BBD, 0x1BBE, 0x1BC0, 0x1BC1, 0x1BC3, 0x1BC4, 0x1BC6, 0x1BC8,
+  0x1BC9, 0x1BCB, 0x1BCC, 0x1BCE, 0x1BCF, 0x1BD1, 0x1BD2, 0x1BD4, 0x1BD6, 0x1BD7, 0x1BD9, 0x1BDA,
+  0x1BDC, 0x1BDD, 0x1BDF, 0x1BE0, 0x1BE2, 0x1BE4, 0x1BE5, 0x1BE7, 0x1BE8, 0x1BEA, 0x1BEB, 0x1BED,
+  0x1BEE, 0x1BF0, 0x1BF2, 0x1BF3, 0x1BF5, 0x1BF6, 0x1BF8, 0x1BF9, 0x1BFB, 0x1BFC, 0x1BFE, 0x1C00,
+  0x1C01, 0x1C03, 0x1C04, 0x1C06, 0x1C07, 0x1C09, 0x1C0A, 0x1C0C, 0x1C0E, 0x1C0F, 0x1C11, 0x1C12,
+  0x1C14, 0x1C15, 0x1C17, 0x1C18, 0x1C1A, 0x1C1C, 0x1C1D, 0x1C1F, 0x1C20, 0x1C22, 0x1C23, 0x1C25,
+  0x1C27, 0x1C28, 0x1C2A, 0x1C2B, 0x1C2D, 0x1C2E, 0x1C30, 0x1C31, 0x1C33, 0x1C35, 0x1C36, 0x1C38,
+  0x1C39, 0x1C3B, 0x1C3C, 0x1C3E, 0x1C3F, 0x1C41, 0x1C43, 0x1C44, 0x1C46, 0x1C47, 0x1C49, 0x1C4A,
+  0x1C4C, 0x1C4D, 0x1C4F, 0x1C51, 0x1C52, 0x1C54, 0x1C55, 0x1C57, 0x1C58, 0x1C5A, 0x1C5B, 0x1C5D,
+  0x1C5F, 0x1C60, 0x1C62, 0x1C63, 0x1C65, 0x1C66, 0x1C68, 0x1C69, 0x1C6B, 0x1C6D, 0x1C6E, 0x1C70,
+  0x1C71, 0x1C73, 0x1C74, 0x1C76, 0x1C77, 0x1C79, 0x1C7B, 0x1C7C, 0x1C7E, 0x1C7F, 0x1C81, 0x1C82,
+  0x1C84, 0x1C85, 0x1C87, 0x1C89, 0x1C8A, 0x1C8C, 0x1C8D, 0x1C8F, 0x1C90, 0x1C92, 0x1C93, 0x1C95,
+  0x1C97, 0x1C98, 0x1C9A, 0x1C9B, 0x1CE3, 0x1CE5, 0x1CE6, 0x1CE8, 0x1CE9, 0x1CEB, 0x1CEC, 0x1CEE,
+  0x1CEF, 0x1CF1, 0x1CF3, 0x1CF4, 0x1CF6, 0x1CF7, 0x1CF9, 0x1CFA, 0x1CFC, 0x1CFE, 0x1CFF, 0x1D01,
+  0x1D02, 0x1D04, 0x1D05, 0x1D07, 0x1D09, 0x1D0A, 0x1D0C, 0x1D0D, 0x1D0F, 0x1D10, 0x1D12, 0x1D14,
+  0x1D15, 0x1D17, 0x1D18, 0x1D1A, 0x1D1B, 0x1D1D, 0x1D1E, 0x1D20, 0x1D22, 0x1D23, 0x1D25, 0x1D26,
+  0x1D28, 0x1D29, 0x1D2B, 0x1D2D, 0x1D2E, 0x1D30, 0x1D31, 0x1D33, 0x1D34, 0x1D36, 0x1D38, 0x1D39,
+  0x1D3B, 0x1D3C, 0x1D3E, 0x1D3F, 0x1D41, 0x1D43, 0x1D44, 0x1D46, 0x1D47, 0x1D49, 0x1D4A, 0x1D4C,
+  0x1D4D, 0x1D4F, 0x1D51, 0x1D52, 0x1D54, 0x1D55, 0x1D57, 0x1D58, 0x1D5A, 0x1D5C, 0x1D5D, 0x1D5F,
+  0x1D60, 0x1D62, 0x1D63, 0x1D65, 0x1D67, 0x1D68, 0x1D6A, 0x1D6B, 0x1D6D, 0x1D6E, 0x1D70, 0x1D72,
+  0x1D73, 0x1D75, 0x1D76, 0x1D78, 0x1D79, 0x1D7B, 0x1D7C, 0x1D7E, 0x1D80, 0x1D81, 0x1D83, 0x1D84,
+  0x1D86, 0x1D87, 0x1D89, 0x1D8B, 0x1D8C, 0x1D8E, 0x1D8F, 0x1D91, 0x1D92, 0x1D94, 0x1D96, 0x1D97,
+  0x1D99, 0x1D9A, 0x1D9C, 0x1D9D, 0x1D9F, 0x1DA1, 0x1DA2, 0x1DA4, 0x1DA5, 0x1DA7, 0x1DA8, 0x1DAA,
+  0x1DAB, 0x1DAD, 0x1DAF, 0x1DB0, 0x1DB2, 0x1DB3, 0x1DB5, 0x1DB6, 0x1DB8, 0x1DBA, 0x1DBB, 0x1DBD,
+  0x1DBE, 0x1DC0, 0x1DC1, 0x1DC3, 0x1DC5, 0x1DC6, 0x1DC8, 0x1DC9, 0x1DCB, 0x1DCC, 0x1DCE, 0x1DD0,
+  0x1DD1, 0x1DD3, 0x1DD4, 0x1DD6, 0x1DD7, 0x1DD9, 0x1DDA, 0x1DDC, 0x1CE2, 0x1CE4, 0x1CE5, 0x1CE7,
+  0x1CE8, 0x1CEA, 0x1CEC, 0x1CED, 0x1CEF, 0x1CF0, 0x1CF2, 0x1CF3, 0x1CF5, 0x1CF7, 0x1CF8, 0x1CFA,
+  0x1CFB, 0x1CFD, 0x1CFE, 0x1D00, 0x1D02, 0x1D03, 0x1D05, 0x1D06, 0x1D08, 0x1D0A, 0x1D0B, 0x1D0D,
+  0x1D0E, 0x1D10, 0x1D11, 0x1D13, 0x1D15, 0x1D16, 0x1D18, 0x1D19, 0x1D1B, 0x1D1C, 0x1D1E, 0x1D20,
+  0x1D21, 0x1D23, 0x1D24, 0x1D26, 0x1D28, 0x1D29, 0x1D2B, 0x1D2C, 0x1D2E, 0x1D2F, 0x1D31, 0x1D33,
+  0x1D34, 0x1D36, 0x1D37, 0x1D39, 0x1D3A, 0x1D3C, 0x1D3E, 0x1D3F, 0x1D41, 0x1D42, 0x1D44, 0x1D45,
+  0x1D47, 0x1D49, 0x1D4A, 0x1D4C, 0x1D4D, 0x1D4F, 0x1D51, 0x1D52, 0x1D54, 0x1D55, 0x1D57, 0x1D58,
+  0x1D5A, 0x1D5C, 0x1D5D, 0x1D5F, 0x1D60, 0x1D62, 0x1D63, 0x1D65, 0x1D67, 0x1D68, 0x1D6A, 0x1D6B,
+  0x1D6D, 0x1D6E, 0x1D70, 0x1D72, 0x1D73, 0x1D75, 0x1D76, 0x1D78, 0x1D7A, 0x1D7B, 0x1D7D, 0x1D7E,
+  0x1D80, 0x1D81, 0x1D83, 0x1D85, 0x1D86, 0x1D88, 0x1D89, 0x1D8B, 0x1D8C, 0x1D8E, 0x1D90, 0x1D91,
+  0x1D93, 0x1D94, 0x1D96, 0x1D97, 0x1D99, 0x1D9B, 0x1D9C, 0x1D9E, 0x1D9F, 0x1DA1, 0x1DA3, 0x1DA4,
+  0x1DA6, 0x1DA7, 0x1DA9, 0x1DAA, 0x1DAC, 0x1DAE, 0x1DAF, 0x1DB1, 0x1DB2, 0x1DB4, 0x1DB5, 0x1DB7,
+  0x1DB9, 0x1DBA, 0x1DBC, 0x1DBD, 0x1DBF, 0x1DC1, 0x1DC2, 0x1DC4, 0x1DC5, 0x1DC7, 0x1DC8, 0x1DCA,
+  0x1DCC, 0x1DCD, 0x1DCF, 0x1DD0, 0x1DD2, 0x1DD3, 0x1DD5, 0x1DD7, 0x1DD8, 0x1DDA, 0x1DDB, 0x1DDD,
+  0x1E21, 0x1E23, 0x1E24, 0x1E26, 0x1E28, 0x1E29, 0x1E2B, 0x1E2C, 0x1E2E, 0x1E30, 0x1E31, 0x1E33,
+  0x1E34, 0x1E36, 0x1E37, 0x1E39, 0x1E3B, 0x1E3C, 0x1E3E, 0x1E3F, 0x1E41, 0x1E43, 0x1E44, 0x1E46,
+  0x1E47, 0x1E49, 0x1E4B, 0x1E4C, 0x1E4E, 0x1E4F, 0x1E51, 0x1E52, 0x1E54, 0x1E56, 0x1E57, 0x1E59,
+  0x1E5A, 0x1E5C, 0x1E5E, 0x1E5F, 0x1E61, 0x1E62, 0x1E64, 0x1E66, 0x1E67, 0x1E69, 0x1E6A, 0x1E6C,
+  0x1E6D, 0x1E6F, 0x1E71, 0x1E72, 0x1E74, 0x1E75, 0x1E77, 0x1E79, 0x1E7A, 0x1E7C, 0x1E7D, 0x1E7F,
+  0x1E81, 0x1E82, 0x1E84, 0x1E85, 0x1E87, 0x1E88, 0x1E8A, 0x1E8C, 0x1E8D, 0x1E8F, 0x1E90, 0x1E92,
+  0x1E94, 0x1E95, 0x1E97, 0x1E98, 0x1E9A, 0x1E9C, 0x1E9D, 0x1E9F, 0x1EA0, 0x1EA2, 0x1EA3, 0x1EA5,
+  0x1EA7, 0x1EA8, 0x1EAA, 0x1EAB, 0x1EAD, 0x1EAF, 0x1EB0, 0x1EB2, 0x1EB3, 0x1EB5, 0x1EB7, 0x1EB8,
+  0x1EBA, 0x1EBB, 0x1EBD, 0x1EBE, 0x1EC0, 0x1EC2, 0x1EC3, 0x1EC5, 0x1EC6, 0x1EC8, 0x1ECA, 0x1ECB,
+  0x1ECD, 0x1ECE, 0x1ED0, 0x1ED2, 0x1ED3, 0x1ED5, 0x1ED6, 0x1ED8, 0x1ED9, 0x1EDB, 0x1EDD, 0x1EDE,
+  0x1EE0, 0x1EE1, 0x1EE3, 0x1EE5, 0x1EE6, 0x1EE8, 0x1EE9, 0x1EEB, 0x1EED, 0x1EEE, 0x1EF0, 0x1EF1,
+  0x1EF3, 0x1EF4, 0x1EF6, 0x1EF8, 0x1EF9, 0x1EFB, 0x1EFC, 0x1EFE, 0x1F00, 0x1F01, 0x1F03, 0x1F04,
+  0x1F06, 0x1F08, 0x1F09, 0x1F0B, 0x1F0C, 0x1F0E, 0x1F0F, 0x1F11, 0x1F13, 0x1F14, 0x1F16, 0x1F17,
+  0x1F19, 0x1F1B, 0x1F1C, 0x1F1E, 0x1F60, 0x1F62, 0x1F64, 0x1F65, 0x1F67, 0x1F68, 0x1F6A, 0x1F6C,
+  0x1F6D, 0x1F6F, 0x1F70, 0x1F72, 0x1F74, 0x1F75, 0x1F77, 0x1F78, 0x1F7A, 0x1F7C, 0x1F7D, 0x1F7F,
+  0x1F80, 0x1F82, 0x1F84, 0x1F85, 0x1F87, 0x1F88, 0x1F8A, 0x1F8C, 0x1F8D, 0x1F8F, 0x1F90, 0x1F92,
+  0x1F94, 0x1F95, 0x1F97, 0x1F98, 0x1F9A, 0x1F9C, 0x1F9D, 0x1F9F, 0x1FA0, 0x1FA2, 0x1FA4, 0x1FA5,
+  0x1FA7, 0x1FA8, 0x1FAA, 0x1FAC, 0x1FAD, 0x1FAF, 0x1FB0, 0x1FB2, 0x1FB4, 0x1FB5, 0x1FB7, 0x1FB8,
+  0x1FBA, 0x1FBC, 0x1FBD, 0x1FBF, 0x1FC0, 0x1FC2, 0x1FC4, 0x1FC5, 0x1FC7, 0x1FC8, 0x1FCA, 0x1FCC,
+  0x1FCD, 0x1FCF, 0x1FD0, 0x1FD2, 0x1FD4, 0x1FD5, 0x1FD7, 0x1FD8, 0x1FDA, 0x1FDC, 0x1FDD, 0x1FDF,
+  0x1FE0, 0x1FE2, 0x1FE3, 0x1FE5, 0x1FE7, 0x1FE8, 0x1FEA, 0x1FEB, 0x1FED, 0x1FEF, 0x1FF0, 0x1FF2,
+  0x1FF3, 0x1FF5, 0x1FF7, 0x1FF8, 0x1FFA, 0x1FFB, 0x1FFD, 0x1FFF, 0x2000, 0x2002, 0x2003, 0x2005,
+  0x2007, 0x2008, 0x200A, 0x200B, 0x200D, 0x200F, 0x2010, 0x2012, 0x2013, 0x2015, 0x2017, 0x2018,
+  0x201A, 0x201B, 0x201D, 0x201F, 0x2020, 0x2022, 0x2023, 0x2025, 0x2027, 0x2028, 0x202A, 0x202B,
+  0x202D, 0x202F, 0x2030, 0x2032, 0x2033, 0x2035, 0x2037, 0x2038, 0x203A, 0x203B, 0x203D, 0x203F,
+  0x2040, 0x2042, 0x2043, 0x2045, 0x2047, 0x2048, 0x204A, 0x204B, 0x204D, 0x204F, 0x2050, 0x2052,
+  0x2053, 0x2055, 0x2057, 0x2058, 0x205A, 0x205B, 0x205D, 0x205F, 0x1F5F, 0x1F61, 0x1F63, 0x1F64,
+  0x1F66, 0x1F68, 0x1F69, 0x1F6B, 0x1F6C, 0x1F6E, 0x1F70, 0x1F71, 0x1F73, 0x1F74, 0x1F76, 0x1F78,
+  0x1F79, 0x1F7B, 0x1F7C, 0x1F7E, 0x1F80, 0x1F81, 0x1F83, 0x1F84, 0x1F86, 0x1F88, 0x1F89, 0x1F8B,
+  0x1F8D, 0x1F8E, 0x1F90, 0x1F91, 0x1F93, 0x1F95, 0x1F96, 0x1F98, 0x1F99, 0x1F9B, 0x1F9D, 0x1F9E,
+  0x1FA0, 0x1FA1, 0x1FA3, 0x1FA5, 0x1FA6, 0x1FA8, 0x1FAA, 0x1FAB, 0x1FAD, 0x1FAE, 0x1FB0, 0x1FB2,
+  0x1FB3, 0x1FB5, 0x1FB6, 0x1FB8, 0x1FBA, 0x1FBB, 0x1FBD, 0x1FBE, 0x1FC0, 0x1FC2, 0x1FC3, 0x1FC5,
+  0x1FC7, 0x1FC8, 0x1FCA, 0x1FCB, 0x1FCD, 0x1FCF, 0x1FD0, 0x1FD2, 0x1FD3, 0x1FD5, 0x1FD7, 0x1FD8,
+  0x1FDA, 0x1FDB, 0x1FDD, 0x1FDF, 0x1FE0, 0x1FE2, 0x1FE4, 0x1FE5, 0x1FE7, 0x1FE8, 0x1FEA, 0x1FEC,
+  0x1FED, 0x1FEF, 0x1FF0, 0x1FF2, 0x1FF4, 0x1FF5, 0x1FF7, 0x1FF8, 0x1FFA, 0x1FFC, 0x1FFD, 0x1FFF,
+  0x2001, 0x2002, 0x2004, 0x2005, 0x2007, 0x2009, 0x200A, 0x200C, 0x200D, 0x200F, 0x2011, 0x2012,
+  0x2014, 0x2015, 0x2017, 0x2019, 0x201A, 0x201C, 0x201E, 0x201F, 0x2021, 0x2022, 0x2024, 0x2026,
+  0x2027, 0x2029, 0x202A, 0x202C, 0x202E, 0x202F, 0x2031, 0x2032, 0x2034, 0x2036, 0x2037, 0x2039,
+  0x203B, 0x203C, 0x203E, 0x203F, 0x2041, 0x2043, 0x2044, 0x2046, 0x2047, 0x2049, 0x204B, 0x204C,
+  0x204E, 0x204F, 0x2051, 0x2053, 0x2054, 0x2056, 0x2057, 0x2059, 0x205B, 0x205C, 0x205E, 0x2060,
+  0x209F, 0x20A0, 0x20A2, 0x20A3, 0x20A5, 0x20A7, 0x20A8, 0x20AA, 0x20AC, 0x20AD, 0x20AF, 0x20B0,
+  0x20B2, 0x20B4, 0x20B5, 0x20B7, 0x20B8, 0x20BA, 0x20BC, 0x20BD, 0x20BF, 0x20C1, 0x20C2, 0x20C4,
+  0x20C5, 0x20C7, 0x20C9, 0x20CA, 0x20CC, 0x20CE, 0x20CF, 0x20D1, 0x20D2, 0x20D4, 0x20D6, 0x20D7,
+  0x20D9, 0x20DB, 0x20DC, 0x20DE, 0x20DF, 0x20E1, 0x20E3, 0x20E4, 0x20E6, 0x20E8, 0x20E9, 0x20EB,
+  0x20EC, 0x20EE, 0x20F0, 0x20F1, 0x20F3, 0x20F5, 0x20F6, 0x20F8, 0x20F9, 0x20FB, 0x20FD, 0x20FE,
+  0x2100, 0x2101, 0x2103, 0x2105, 0x2106, 0x2108, 0x210A, 0x210B, 0x210D, 0x210E, 0x2110, 0x2112,
+  0x2113, 0x2115, 0x2117, 0x2118, 0x211A, 0x211B, 0x211D, 0x211F, 0x2120, 0x2122, 0x2124, 0x2125,
+  0x2127, 0x2128, 0x212A, 0x212C, 0x212D, 0x212F, 0x2131, 0x2132, 0x2134, 0x2135, 0x2137, 0x2139,
+  0x213A, 0x213C, 0x213E, 0x213F, 0x2141, 0x2142, 0x2144, 0x2146, 0x2147, 0x2149, 0x214A, 0x214C,
+  0x214E, 0x214F, 0x2151, 0x2153, 0x2154, 0x2156, 0x2157, 0x2159, 0x215B, 0x215C, 0x215E, 0x2160,
+  0x2161, 0x2163, 0x2164, 0x2166, 0x2168, 0x2169, 0x216B, 0x216D, 0x216E, 0x2170, 0x2171, 0x2173,
+  0x2175, 0x2176, 0x2178, 0x217A, 0x217B, 0x217D, 0x217E, 0x2180, 0x2182, 0x2183, 0x2185, 0x2187,
+  0x2188, 0x218A, 0x218B, 0x218D, 0x218F, 0x2190, 0x2192, 0x2193, 0x2195, 0x2197, 0x2198, 0x219A,
+  0x219C, 0x219D, 0x219F, 0x21A0, 0x209E, 0x209F, 0x20A1, 0x20A3, 0x20A4, 0x20A6, 0x20A7, 0x20A9,
+  0x20AB, 0x20AC, 0x20AE, 0x20B0, 0x20B1, 0x20B3, 0x20B4, 0x20B6, 0x20B8, 0x20B9, 0x20BB, 0x20BD,
+  0x20BE, 0x20C0, 0x20C2, 0x20C3, 0x20C5, 0x20C6, 0x20C8, 0x20CA, 0x20CB, 0x20CD, 0x20CF, 0x20D0,
+  0x20D2, 0x20D4, 0x20D5, 0x20D7, 0x20D8, 0x20DA, 0x20DC, 0x20DD, 0x20DF, 0x20E1, 0x20E2, 0x20E4,
+  0x20E6, 0x20E7, 0x20E9, 0x20EA, 0x20EC, 0x20EE, 0x20EF, 0x20F1, 0x20F3, 0x20F4, 0x20F6, 0x20F7,
+  0x20F9, 0x20FB, 0x20FC, 0x20FE, 0x2100, 0x2101, 0x2103, 0x2105, 0x2106, 0x2108, 0x2109, 0x210B,
+  0x210D, 0x210E, 0x2110, 0x2112, 0x2113, 0x2115, 0x2117, 0x2118, 0x211A, 0x211B, 0x211D, 0x211F,
+  0x2120, 0x2122, 0x2124, 0x2125, 0x2127, 0x2128, 0x212A, 0x212C, 0x212D, 0x212F, 0x2131, 0x2132,
+  0x2134, 0x2136, 0x2137, 0x2139, 0x213A, 0x213C, 0x213E, 0x213F, 0x2141, 0x2143, 0x2144, 0x2146,
+  0x2148, 0x2149, 0x214B, 0x214C, 0x214E, 0x2150, 0x2151, 0x2153, 0x2155, 0x2156, 0x2158, 0x2159,
+  0x215B, 0x215D, 0x215E, 0x2160, 0x2162, 0x2163, 0x2165, 0x2167, 0x2168, 0x216A, 0x216B, 0x216D,
+  0x216F, 0x2170, 0x2172, 0x2174, 0x2175, 0x2177, 0x2179, 0x217A, 0x217C, 0x217D, 0x217F, 0x2181,
+  0x2182, 0x2184, 0x2186, 0x2187, 0x2189, 0x218B, 0x218C, 0x218E, 0x218F, 0x2191, 0x2193, 0x2194,
+  0x2196, 0x2198, 0x2199, 0x219B, 0x219C, 0x219E, 0x21A0, 0x21A1, 0x21DD, 0x21DE, 0x21E0, 0x21E2,
+  0x21E3, 0x21E5, 0x21E7, 0x21E8, 0x21EA, 0x21EB, 0x21ED, 0x21EF, 0x21F0, 0x21F2, 0x21F4, 0x21F5,
+  0x21F7, 0x21F9, 0x21FA, 0x21FC, 0x21FE, 0x21FF, 0x2201, 0x2203, 0x2204, 0x2206, 0x2207, 0x2209,
+  0x220B, 0x220C, 0x220E, 0x2210, 0x2211, 0x2213, 0x2215, 0x2216, 0x2218, 0x221A, 0x221B, 0x221D,
+  0x221F, 0x2220, 0x2222, 0x2223, 0x2225, 0x2227, 0x2228, 0x222A, 0x222C, 0x222D, 0x222F, 0x2231,
+  0x2232, 0x2234, 0x2236, 0x2237, 0x2239, 0x223A, 0x223C, 0x223E, 0x223F, 0x2241, 0x2243, 0x2244,
+  0x2246, 0x2248, 0x2249, 0x224B, 0x224D, 0x224E, 0x2250, 0x2252, 0x2253, 0x2255, 0x2256, 0x2258,
+  0x225A, 0x225B, 0x225D, 0x225F, 0x2260, 0x2262, 0x2264, 0x2265, 0x2267, 0x2269, 0x226A, 0x226C,
+  0x226D, 0x226F, 0x2271, 0x2272, 0x2274, 0x2276, 0x2277, 0x2279, 0x227B, 0x227C, 0x227E, 0x2280,
+  0x2281, 0x2283, 0x2285, 0x2286, 0x2288, 0x2289, 0x228B, 0x228D, 0x228E, 0x2290, 0x2292, 0x2293,
+  0x2295, 0x2297, 0x2298, 0x229A, 0x229C, 0x229D, 0x229F, 0x22A0, 0x22A2, 0x22A4, 0x22A5, 0x22A7,
+  0x22A9, 0x22AA, 0x22AC, 0x22AE, 0x22AF, 0x22B1, 0x22B3, 0x22B4, 0x22B6, 0x22B8, 0x22B9, 0x22BB,
+  0x22BC, 0x22BE, 0x22C0, 0x22C1, 0x22C3, 0x22C5, 0x22C6, 0x22C8, 0x22CA, 0x22CB, 0x22CD, 0x22CF,
+  0x22D0, 0x22D2, 0x22D4, 0x22D5, 0x22D7, 0x22D8, 0x22DA, 0x22DC, 0x22DD, 0x22DF, 0x22E1, 0x22E2,
+  0x21DC, 0x21DD, 0x21DF, 0x21E1, 0x21E2, 0x21E4, 0x21E6, 0x21E7, 0x21E9, 0x21EB, 0x21EC, 0x21EE,
+  0x21F0, 0x21F1, 0x21F3, 0x21F5, 0x21F6, 0x21F8, 0x21FA, 0x21FB, 0x21FD, 0x21FF, 0x2200, 0x2202,
+  0x2204, 0x2205, 0x2207, 0x2208, 0x220A, 0x220C, 0x220D, 0x220F, 0x2211, 0x2212, 0x2214, 0x2216,
+  0x2217, 0x2219, 0x221B, 0x221C, 0x221E, 0x2220, 0x2221, 0x2223, 0x2225, 0x2226, 0x2228, 0x222A,
+  0x222B, 0x222D, 0x222F, 0x2230, 0x2232, 0x2234, 0x2235, 0x2237, 0x2239, 0x223A, 0x223C, 0x223E,
+  0x223F, 0x2241, 0x2242, 0x2244, 0x2246, 0x2247, 0x2249, 0x224B, 0x224C, 0x224E, 0x2250, 0x2251,
+  0x2253, 0x2255, 0x2256, 0x2258, 0x225A, 0x225B, 0x225D, 0x225F, 0x2260, 0x2262, 0x2264, 0x2265,
+  0x2267, 0x2269, 0x226A, 0x226C, 0x226E, 0x226F, 0x2271, 0x2273, 0x2274, 0x2276, 0x2278, 0x2279,
+  0x227B, 0x227D, 0x227E, 0x2280, 0x2281, 0x2283, 0x2285, 0x2286, 0x2288, 0x228A, 0x228B, 0x228D,
+  0x228F, 0x2290, 0x2292, 0x2294, 0x2295, 0x2297, 0x2299, 0x229A, 0x229C, 0x229E, 0x229F, 0x22A1,
+  0x22A3, 0x22A4, 0x22A6, 0x22A8, 0x22A9, 0x22AB, 0x22AD, 0x22AE, 0x22B0, 0x22B2, 0x22B3, 0x22B5,
+  0x22B7, 0x22B8, 0x22BA, 0x22BB, 0x22BD, 0x22BF, 0x22C0, 0x22C2, 0x22C4, 0x22C5, 0x22C7, 0x22C9,
+  0x22CA, 0x22CC, 0x22CE, 0x22CF, 0x22D1, 0x22D3, 0x22D4, 0x22D6, 0x22D8, 0x22D9, 0x22DB, 0x22DD,
+  0x22DE, 0x22E0, 0x22E2, 0x22E3, 0x231B, 0x231C, 0x231E, 0x2320, 0x2321, 0x2323, 0x2325, 0x2326,
+  0x2328, 0x232A, 0x232B, 0x232D, 0x232F, 0x2330, 0x2332, 0x2334, 0x2335, 0x2337, 0x2339, 0x233A,
+  0x233C, 0x233E, 0x2340, 0x2341, 0x2343, 0x2345, 0x2346, 0x2348, 0x234A, 0x234B, 0x234D, 0x234F,
+  0x2350, 0x2352, 0x2354, 0x2355, 0x2357, 0x2359, 0x235A, 0x235C, 0x235E, 0x235F, 0x2361, 0x2363,
+  0x2364, 0x2366, 0x2368, 0x2369, 0x236B, 0x236D, 0x236E, 0x2370, 0x2372, 0x2373, 0x2375, 0x2377,
+  0x2378, 0x237A, 0x237C, 0x237D, 0x237F, 0x2381, 0x2382, 0x2384, 0x2386, 0x2387, 0x2389, 0x238B,
+  0x238C, 0x238E, 0x2390, 0x2391, 0x2393, 0x2395, 0x2396, 0x2398, 0x239A, 0x239B, 0x239D, 0x239F,
+  0x23A0, 0x23A2, 0x23A4, 0x23A5, 0x23A7, 0x23A9, 0x23AA, 0x23AC, 0x23AE, 0x23AF, 0x23B1, 0x23B3,
+  0x23B4, 0x23B6, 0x23B8, 0x23B9, 0x23BB, 0x23BD, 0x23BE, 0x23C0, 0x23C2, 0x23C3, 0x23C5, 0x23C7,
+  0x23C8, 0x23CA, 0x23CC, 0x23CD, 0x23CF, 0x23D1, 0x23D2, 0x23D4, 0x23D6, 0x23D7, 0x23D9, 0x23DB,
+  0x23DC, 0x23DE, 0x23E0, 0x23E1, 0x23E3, 0x23E5, 0x23E6, 0x23E8, 0x23EA, 0x23EB, 0x23ED, 0x23EF,
+  0x23F0, 0x23F2, 0x23F4, 0x23F5, 0x23F7, 0x23F9, 0x23FA, 0x23FC, 0x23FE, 0x23FF, 0x2401, 0x2403,
+  0x2405, 0x2406, 0x2408, 0x240A, 0x240B, 0x240D, 0x240F, 0x2410, 0x2412, 0x2414, 0x2415, 0x2417,
+  0x2419, 0x241A, 0x241C, 0x241E, 0x241F, 0x2421, 0x2423, 0x2424, 0x245A, 0x245B, 0x245D, 0x245F,
+  0x2461, 0x2462, 0x2464, 0x2466, 0x2467, 0x2469, 0x246B, 0x246C, 0x246E, 0x2470, 0x2471, 0x2473,
+  0x2475, 0x2476, 0x2478, 0x247A, 0x247B, 0x247D, 0x247F, 0x2480, 0x2482, 0x2484, 0x2486, 0x2487,
+  0x2489, 0x248B, 0x248C, 0x248E, 0x2490, 0x2491, 0x2493, 0x2495, 0x2496, 0x2498, 0x249A, 0x249B,
+  0x249D, 0x249F, 0x24A0, 0x24A2, 0x24A4, 0x24A5, 0x24A7, 0x24A9, 0x24AB, 0x24AC, 0x24AE, 0x24B0,
+  0x24B1, 0x24B3, 0x24B5, 0x24B6, 0x24B8, 0x24BA, 0x24BB, 0x24BD, 0x24BF, 0x24C0, 0x24C2, 0x24C4,
+  0x24C5, 0x24C7, 0x24C9, 0x24CA, 0x24CC, 0x24CE, 0x24D0, 0x24D1, 0x24D3, 0x24D5, 0x24D6, 0x24D8,
+  0x24DA, 0x24DB, 0x24DD, 0x24DF, 0x24E0, 0x24E2, 0x24E4, 0x24E5, 0x24E7, 0x24E9, 0x24EA, 0x24EC,
+  0x24EE, 0x24EF, 0x24F1, 0x24F3, 0x24F5, 0x24F6, 0x24F8, 0x24FA, 0x24FB, 0x24FD, 0x24FF, 0x2500,
+  0x2502, 0x2504, 0x2505, 0x2507, 0x2509, 0x250A, 0x250C, 0x250E, 0x250F, 0x2511, 0x2513, 0x2514,
+  0x2516, 0x2518, 0x251A, 0x251B, 0x251D, 0x251F, 0x2520, 0x2522, 0x2524, 0x2525, 0x2527, 0x2529,
+  0x252A, 0x252C, 0x252E, 0x252F, 0x2531, 0x2533, 0x2534, 0x2536, 0x2538, 0x2539, 0x253B, 0x253D,
+  0x253F, 0x2540, 0x2542, 0x2544, 0x2545, 0x2547, 0x2549, 0x254A, 0x254C, 0x254E, 0x254F, 0x2551,
+  0x2553, 0x2554, 0x2556, 0x2558, 0x2559, 0x255B, 0x255D, 0x255E, 0x2560, 0x2562, 0x2564, 0x2565,
+  0x2459, 0x245A, 0x245C, 0x245E, 0x2460, 0x2461, 0x2463, 0x2465, 0x2466, 0x2468, 0x246A, 0x246B,
+  0x246D, 0x246F, 0x2471, 0x2472, 0x2474, 0x2476, 0x2477, 0x2479, 0x247B, 0x247C, 0x247E, 0x2480,
+  0x2481, 0x2483, 0x2485, 0x2487, 0x2488, 0x248A, 0x248C, 0x248D, 0x248F, 0x2491, 0x2492, 0x2494,
+  0x2496, 0x2497, 0x2499, 0x249B, 0x249D, 0x249E, 0x24A0, 0x24A2, 0x24A3, 0x24A5, 0x24A7, 0x24A8,
+  0x24AA, 0x24AC, 0x24AE, 0x24AF, 0x24B1, 0x24B3, 0x24B4, 0x24B6, 0x24B8, 0x24B9, 0x24BB, 0x24BD,
+  0x24BE, 0x24C0, 0x24C2, 0x24C4, 0x24C5, 0x24C7, 0x24C9, 0x24CA, 0x24CC, 0x24CE, 0x24CF, 0x24D1,
+  0x24D3, 0x24D4, 0x24D6, 0x24D8, 0x24DA, 0x24DB, 0x24DD, 0x24DF, 0x24E0, 0x24E2, 0x24E4, 0x24E5,
+  0x24E7, 0x24E9, 0x24EB, 0x24EC, 0x24EE, 0x24F0, 0x24F1, 0x24F3, 0x24F5, 0x24F6, 0x24F8, 0x24FA,
+  0x24FB, 0x24FD, 0x24FF, 0x2501, 0x2502, 0x2504, 0x2506, 0x2507, 0x2509, 0x250B, 0x250C, 0x250E,
+  0x2510, 0x2511, 0x2513, 0x2515, 0x2517, 0x2518, 0x251A, 0x251C, 0x251D, 0x251F, 0x2521, 0x2522,
+  0x2524, 0x2526, 0x2528, 0x2529, 0x252B, 0x252D, 0x252E, 0x2530, 0x2532, 0x2533, 0x2535, 0x2537,
+  0x2538, 0x253A, 0x253C, 0x253E, 0x253F, 0x2541, 0x2543, 0x2544, 0x2546, 0x2548, 0x2549, 0x254B,
+  0x254D, 0x254E, 0x2550, 0x2552, 0x2554, 0x2555, 0x2557, 0x2559, 0x255A, 0x255C, 0x255E, 0x255F,
+  0x2561, 0x2563, 0x2565, 0x2566, 0x2598, 0x259A, 0x259B, 0x259D, 0x259F, 0x25A0, 0x25A2, 0x25A4,
+  0x25A5, 0x25A7, 0x25A9, 0x25AB, 0x25AC, 0x25AE, 0x25B0, 0x25B1, 0x25B3, 0x25B5, 0x25B7, 0x25B8,
+  0x25BA, 0x25BC, 0x25BD, 0x25BF, 0x25C1, 0x25C2, 0x25C4, 0x25C6, 0x25C8, 0x25C9, 0x25CB, 0x25CD,
+  0x25CE, 0x25D0, 0x25D2, 0x25D4, 0x25D5, 0x25D7, 0x25D9, 0x25DA, 0x25DC, 0x25DE, 0x25DF, 0x25E1,
+  0x25E3, 0x25E5, 0x25E6, 0x25E8, 0x25EA, 0x25EB, 0x25ED, 0x25EF, 0x25F1, 0x25F2, 0x25F4, 0x25F6,
+  0x25F7, 0x25F9, 0x25FB, 0x25FD, 0x25FE, 0x2600, 0x2602, 0x2603, 0x2605, 0x2607, 0x2608, 0x260A,
+  0x260C, 0x260E, 0x260F, 0x2611, 0x2613, 0x2614, 0x2616, 0x2618, 0x261A, 0x261B, 0x261D, 0x261F,
+  0x2620, 0x2622, 0x2624, 0x2625, 0x2627, 0x2629, 0x262B, 0x262C, 0x262E, 0x2630, 0x2631, 0x2633,
+  0x2635, 0x2637, 0x2638, 0x263A, 0x263C, 0x263D, 0x263F, 0x2641, 0x2642, 0x2644, 0x2646, 0x2648,
+  0x2649, 0x264B, 0x264D, 0x264E, 0x2650, 0x2652, 0x2654, 0x2655, 0x2657, 0x2659, 0x265A, 0x265C,
+  0x265E, 0x2660, 0x2661, 0x2663, 0x2665, 0x2666, 0x2668, 0x266A, 0x266B, 0x266D, 0x266F, 0x2671,
+  0x2672, 0x2674, 0x2676, 0x2677, 0x2679, 0x267B, 0x267D, 0x267E, 0x2680, 0x2682, 0x2683, 0x2685,
+  0x2687, 0x2688, 0x268A, 0x268C, 0x268E, 0x268F, 0x2691, 0x2693, 0x2694, 0x2696, 0x2698, 0x269A,
+  0x269B, 0x269D, 0x269F, 0x26A0, 0x26A2, 0x26A4, 0x26A5, 0x26A7, 0x2597, 0x2598, 0x259A, 0x259C,
+  0x259E, 0x259F, 0x25A1, 0x25A3, 0x25A5, 0x25A6, 0x25A8, 0x25AA, 0x25AB, 0x25AD, 0x25AF, 0x25B1,
+  0x25B2, 0x25B4, 0x25B6, 0x25B7, 0x25B9, 0x25BB, 0x25BD, 0x25BE, 0x25C0, 0x25C2, 0x25C3, 0x25C5,
+  0x25C7, 0x25C9, 0x25CA, 0x25CC, 0x25CE, 0x25D0, 0x25D1, 0x25D3, 0x25D5, 0x25D6, 0x25D8, 0x25DA,
+  0x25DC, 0x25DD, 0x25DF, 0x25E1, 0x25E2, 0x25E4, 0x25E6, 0x25E8, 0x25E9, 0x25EB, 0x25ED, 0x25EE,
+  0x25F0, 0x25F2, 0x25F4, 0x25F5, 0x25F7, 0x25F9, 0x25FB, 0x25FC, 0x25FE, 0x2600, 0x2601, 0x2603,
+  0x2605, 0x2607, 0x2608, 0x260A, 0x260C, 0x260D, 0x260F, 0x2611, 0x2613, 0x2614, 0x2616, 0x2618,
+  0x2619, 0x261B, 0x261D, 0x261F, 0x2620, 0x2622, 0x2624, 0x2626, 0x2627, 0x2629, 0x262B, 0x262C,
+  0x262E, 0x2630, 0x2632, 0x2633, 0x2635, 0x2637, 0x2638, 0x263A, 0x263C, 0x263E, 0x263F, 0x2641,
+  0x2643, 0x2644, 0x2646, 0x2648, 0x264A, 0x264B, 0x264D, 0x264F, 0x2651, 0x2652, 0x2654, 0x2656,
+  0x2657, 0x2659, 0x265B, 0x265D, 0x265E, 0x2660, 0x2662, 0x2663, 0x2665, 0x2667, 0x2669, 0x266A,
+  0x266C, 0x266E, 0x266F, 0x2671, 0x2673, 0x2675, 0x2676, 0x2678, 0x267A, 0x267C, 0x267D, 0x267F,
+  0x2681, 0x2682, 0x2684, 0x2686, 0x2688, 0x2689, 0x268B, 0x268D, 0x268E, 0x2690, 0x2692, 0x2694,
+  0x2695, 0x2697, 0x2699, 0x269A, 0x269C, 0x269E, 0x26A0, 0x26A1, 0x26A3, 0x26A5, 0x26A7, 0x26A8,
+  0x26D6, 0x26D7, 0x26D9, 0x26DB, 0x26DD, 0x26DE, 0x26E0, 0x26E2, 0x26E4, 0x26E5, 0x26E7, 0x26E9,
+  0x26EB, 0x26EC, 0x26EE, 0x26F0, 0x26F1, 0x26F3, 0x26F5, 0x26F7, 0x26F8, 0x26FA, 0x26FC, 0x26FE,
+  0x26FF, 0x2701, 0x2703, 0x2705, 0x2706, 0x2708, 0x270A, 0x270B, 0x270D, 0x270F, 0x2711, 0x2712,
+  0x2714, 0x2716, 0x2718, 0x2719, 0x271B, 0x271D, 0x271F, 0x2720, 0x2722, 0x2724, 0x2725, 0x2727,
+  0x2729, 0x272B, 0x272C, 0x272E, 0x2730, 0x2732, 0x2733, 0x2735, 0x2737, 0x2739, 0x273A, 0x273C,
+  0x273E, 0x273F, 0x2741, 0x2743, 0x2745, 0x2746, 0x2748, 0x274A, 0x274C, 0x274D, 0x274F, 0x2751,
+  0x2753, 0x2754, 0x2756, 0x2758, 0x2759, 0x275B, 0x275D, 0x275F, 0x2760, 0x2762, 0x2764, 0x2766,
+  0x2767, 0x2769, 0x276B, 0x276C, 0x276E, 0x2770, 0x2772, 0x2773, 0x2775, 0x2777, 0x2779, 0x277A,
+  0x277C, 0x277E, 0x2780, 0x2781, 0x2783, 0x2785, 0x2786, 0x2788, 0x278A, 0x278C, 0x278D, 0x278F,
+  0x2791, 0x2793, 0x2794, 0x2796, 0x2798, 0x279A, 0x279B, 0x279D, 0x279F, 0x27A0, 0x27A2, 0x27A4,
+  0x27A6, 0x27A7, 0x27A9, 0x27AB, 0x27AD, 0x27AE, 0x27B0, 0x27B2, 0x27B4, 0x27B5, 0x27B7, 0x27B9,
+  0x27BA, 0x27BC, 0x27BE, 0x27C0, 0x27C1, 0x27C3, 0x27C5, 0x27C7, 0x27C8, 0x27CA, 0x27CC, 0x27CE,
+  0x27CF, 0x27D1, 0x27D3, 0x27D4, 0x27D6, 0x27D8, 0x27DA, 0x27DB, 0x27DD, 0x27DF, 0x27E1, 0x27E2,
+  0x27E4, 0x27E6, 0x27E8, 0x27E9, 0x2815, 0x2816, 0x2818, 0x281A, 0x281C, 0x281D, 0x281F, 0x2821,
+  0x2823, 0x2824, 0x2826, 0x2828, 0x282A, 0x282B, 0x282D, 0x282F, 0x2831, 0x2832, 0x2834, 0x2836,
+  0x2838, 0x2839, 0x283B, 0x283D, 0x283F, 0x2840, 0x2842, 0x2844, 0x2846, 0x2847, 0x2849, 0x284B,
+  0x284D, 0x284E, 0x2850, 0x2852, 0x2854, 0x2855, 0x2857, 0x2859, 0x285B, 0x285C, 0x285E, 0x2860,
+  0x2862, 0x2863, 0x2865, 0x2867, 0x2868, 0x286A, 0x286C, 0x286E, 0x286F, 0x2871, 0x2873, 0x2875,
+  0x2876, 0x2878, 0x287A, 0x287C, 0x287D, 0x287F, 0x2881, 0x2883, 0x2884, 0x2886, 0x2888, 0x288A,
+  0x288B, 0x288D, 0x288F, 0x2891, 0x2892, 0x2894, 0x2896, 0x2898, 0x2899, 0x289B, 0x289D, 0x289F,
+  0x28A0, 0x28A2, 0x28A4, 0x28A6, 0x28A7, 0x28A9, 0x28AB, 0x28AD, 0x28AE, 0x28B0, 0x28B2, 0x28B4,
+  0x28B5, 0x28B7, 0x28B9, 0x28BB, 0x28BC, 0x28BE, 0x28C0, 0x28C2, 0x28C3, 0x28C5, 0x28C7, 0x28C9,
+  0x28CA, 0x28CC, 0x28CE, 0x28D0, 0x28D1, 0x28D3, 0x28D5, 0x28D7, 0x28D8, 0x28DA, 0x28DC, 0x28DD,
+  0x28DF, 0x28E1, 0x28E3, 0x28E4, 0x28E6, 0x28E8, 0x28EA, 0x28EB, 0x28ED, 0x28EF, 0x28F1, 0x28F2,
+  0x28F4, 0x28F6, 0x28F8, 0x28F9, 0x28FB, 0x28FD, 0x28FF, 0x2900, 0x2902, 0x2904, 0x2906, 0x2907,
+  0x2909, 0x290B, 0x290D, 0x290E, 0x2910, 0x2912, 0x2914, 0x2915, 0x2917, 0x2919, 0x291B, 0x291C,
+  0x291E, 0x2920, 0x2922, 0x2923, 0x2925, 0x2927, 0x2929, 0x292A, 0x2814, 0x2815, 0x2817, 0x2819,
+  0x281B, 0x281C, 0x281E, 0x2820, 0x2822, 0x2823, 0x2825, 0x2827, 0x2829, 0x282A, 0x282C, 0x282E,
+  0x2830, 0x2832, 0x2833, 0x2835, 0x2837, 0x2839, 0x283A, 0x283C, 0x283E, 0x2840, 0x2841, 0x2843,
+  0x2845, 0x2847, 0x2848, 0x284A, 0x284C, 0x284E, 0x284F, 0x2851, 0x2853, 0x2855, 0x2856, 0x2858,
+  0x285A, 0x285C, 0x285E, 0x285F, 0x2861, 0x2863, 0x2865, 0x2866, 0x2868, 0x286A, 0x286C, 0x286D,
+  0x286F, 0x2871, 0x2873, 0x2874, 0x2876, 0x2878, 0x287A, 0x287B, 0x287D, 0x287F, 0x2881, 0x2882,
+  0x2884, 0x2886, 0x2888, 0x288A, 0x288B, 0x288D, 0x288F, 0x2891, 0x2892, 0x2894, 0x2896, 0x2898,
+  0x2899, 0x289B, 0x289D, 0x289F, 0x28A0, 0x28A2, 0x28A4, 0x28A6, 0x28A7, 0x28A9, 0x28AB, 0x28AD,
+  0x28AE, 0x28B0, 0x28B2, 0x28B4, 0x28B5, 0x28B7, 0x28B9, 0x28BB, 0x28BD, 0x28BE, 0x28C0, 0x28C2,
+  0x28C4, 0x28C5, 0x28C7, 0x28C9, 0x28CB, 0x28CC, 0x28CE, 0x28D0, 0x28D2, 0x28D3, 0x28D5, 0x28D7,
+  0x28D9, 0x28DA, 0x28DC, 0x28DE, 0x28E0, 0x28E1, 0x28E3, 0x28E5, 0x28E7, 0x28E9, 0x28EA, 0x28EC,
+  0x28EE, 0x28F0, 0x28F1, 0x28F3, 0x28F5, 0x28F7, 0x28F8, 0x28FA, 0x28FC, 0x28FE, 0x28FF, 0x2901,
+  0x2903, 0x2905, 0x2906, 0x2908, 0x290A, 0x290C, 0x290D, 0x290F, 0x2911, 0x2913, 0x2915, 0x2916,
+  0x2918, 0x291A, 0x291C, 0x291D, 0x291F, 0x2921, 0x2923, 0x2924, 0x2926, 0x2928, 0x292A, 0x292B,
+  0x2953, 0x2954, 0x2956, 0x2958, 0x295A, 0x295B, 0x295D, 0x295F, 0x2961, 0x2962, 0x2964, 0x2966,
+  0x2968, 0x296A, 0x296B, 0x296D, 0x296F, 0x2971, 0x2972, 0x2974, 0x2976, 0x2978, 0x297A, 0x297B,
+  0x297D, 0x297F, 0x2981, 0x2982, 0x2984, 0x2986, 0x2988, 0x298A, 0x298B, 0x298D, 0x298F, 0x2991,
+  0x2992, 0x2994, 0x2996, 0x2998, 0x2999, 0x299B, 0x299D, 0x299F, 0x29A1, 0x29A2, 0x29A4, 0x29A6,
+  0x29A8, 0x29A9, 0x29AB, 0x29AD, 0x29AF, 0x29B1, 0x29B2, 0x29B4, 0x29B6, 0x29B8, 0x29B9, 0x29BB,
+  0x29BD, 0x29BF, 0x29C0, 0x29C2, 0x29C4, 0x29C6, 0x29C8, 0x29C9, 0x29CB, 0x29CD, 0x29CF, 0x29D0,
+  0x29D2, 0x29D4, 0x29D6, 0x29D8, 0x29D9, 0x29DB, 0x29DD, 0x29DF, 0x29E0, 0x29E2, 0x29E4, 0x29E6,
+  0x29E7, 0x29E9, 0x29EB, 0x29ED, 0x29EF, 0x29F0, 0x29F2, 0x29F4, 0x29F6, 0x29F7, 0x29F9, 0x29FB,
+  0x29FD, 0x29FF, 0x2A00, 0x2A02, 0x2A04, 0x2A06, 0x2A07, 0x2A09, 0x2A0B, 0x2A0D, 0x2A0E, 0x2A10,
+  0x2A12, 0x2A14, 0x2A16, 0x2A17, 0x2A19, 0x2A1B, 0x2A1D, 0x2A1E, 0x2A20, 0x2A22, 0x2A24, 0x2A26,
+  0x2A27, 0x2A29, 0x2A2B, 0x2A2D, 0x2A2E, 0x2A30, 0x2A32, 0x2A34, 0x2A35, 0x2A37, 0x2A39, 0x2A3B,
+  0x2A3D, 0x2A3E, 0x2A40, 0x2A42, 0x2A44, 0x2A45, 0x2A47, 0x2A49, 0x2A4B, 0x2A4D, 0x2A4E, 0x2A50,
+  0x2A52, 0x2A54, 0x2A55, 0x2A57, 0x2A59, 0x2A5B, 0x2A5D, 0x2A5E, 0x2A60, 0x2A62, 0x2A64, 0x2A65,
+  0x2A67, 0x2A69, 0x2A6B, 0x2A6C, 0x2A91, 0x2A93, 0x2A95, 0x2A97, 0x2A99, 0x2A9A, 0x2A9C, 0x2A9E,
+  0x2AA0, 0x2AA2, 0x2AA3, 0x2AA5, 0x2AA7, 0x2AA9, 0x2AAA, 0x2AAC, 0x2AAE, 0x2AB0, 0x2AB2, 0x2AB3,
+  0x2AB5, 0x2AB7, 0x2AB9, 0x2ABB, 0x2ABC, 0x2ABE, 0x2AC0, 0x2AC2, 0x2AC3, 0x2AC5, 0x2AC7, 0x2AC9,
+  0x2ACB, 0x2ACC, 0x2ACE, 0x2AD0, 0x2AD2, 0x2AD4, 0x2AD5, 0x2AD7, 0x2AD9, 0x2ADB, 0x2ADC, 0x2ADE,
+  0x2AE0, 0x2AE2, 0x2AE4, 0x2AE5, 0x2AE7, 0x2AE9, 0x2AEB, 0x2AED, 0x2AEE, 0x2AF0, 0x2AF2, 0x2AF4,
+  0x2AF6, 0x2AF7, 0x2AF9, 0x2AFB, 0x2AFD, 0x2AFE, 0x2B00, 0x2B02, 0x2B04, 0x2B06, 0x2B07, 0x2B09,
+  0x2B0B, 0x2B0D, 0x2B0F, 0x2B10, 0x2B12, 0x2B14, 0x2B16, 0x2B17, 0x2B19, 0x2B1B, 0x2B1D, 0x2B1F,
+  0x2B20, 0x2B22, 0x2B24, 0x2B26, 0x2B28, 0x2B29, 0x2B2B, 0x2B2D, 0x2B2F, 0x2B30, 0x2B32, 0x2B34,
+  0x2B36, 0x2B38, 0x2B39, 0x2B3B, 0x2B3D, 0x2B3F, 0x2B41, 0x2B42, 0x2B44, 0x2B46, 0x2B48, 0x2B49,
+  0x2B4B, 0x2B4D, 0x2B4F, 0x2B51, 0x2B52, 0x2B54, 0x2B56, 0x2B58, 0x2B5A, 0x2B5B, 0x2B5D, 0x2B5F,
+  0x2B61, 0x2B63, 0x2B64, 0x2B66, 0x2B68, 0x2B6A, 0x2B6B, 0x2B6D, 0x2B6F, 0x2B71, 0x2B73, 0x2B74,
+  0x2B76, 0x2B78, 0x2B7A, 0x2B7C, 0x2B7D, 0x2B7F, 0x2B81, 0x2B83, 0x2B84, 0x2B86, 0x2B88, 0x2B8A,
+  0x2B8C, 0x2B8D, 0x2B8F, 0x2B91, 0x2B93, 0x2B95, 0x2B96, 0x2B98, 0x2B9A, 0x2B9C, 0x2B9D, 0x2B9F,
+  0x2BA1, 0x2BA3, 0x2BA5, 0x2BA6, 0x2BA8, 0x2BAA, 0x2BAC, 0x2BAE, 0x2A90, 0x2A92, 0x2A94, 0x2A96,
+  0x2A98, 0x2A99, 0x2A9B, 0x2A9D, 0x2A9F, 0x2AA1, 0x2AA2, 0x2AA4, 0x2AA6, 0x2AA8, 0x2AAA, 0x2AAB,
+  0x2AAD, 0x2AAF, 0x2AB1, 0x2AB3, 0x2AB4, 0x2AB6, 0x2AB8, 0x2ABA, 0x2ABC, 0x2ABD, 0x2ABF, 0x2AC1,
+  0x2AC3, 0x2AC5, 0x2AC6, 0x2AC8, 0x2ACA, 0x2ACC, 0x2ACE, 0x2ACF, 0x2AD1, 0x2AD3, 0x2AD5, 0x2AD7,
+  0x2AD8, 0x2ADA, 0x2ADC, 0x2ADE, 0x2AE0, 0x2AE1, 0x2AE3, 0x2AE5, 0x2AE7, 0x2AE9, 0x2AEA, 0x2AEC,
+  0x2AEE, 0x2AF0, 0x2AF2, 0x2AF3, 0x2AF5, 0x2AF7, 0x2AF9, 0x2AFB, 0x2AFC, 0x2AFE, 0x2B00, 0x2B02,
+  0x2B04, 0x2B05, 0x2B07, 0x2B09, 0x2B0B, 0x2B0D, 0x2B0E, 0x2B10, 0x2B12, 0x2B14, 0x2B16, 0x2B17,
+  0x2B19, 0x2B1B, 0x2B1D, 0x2B1F, 0x2B20, 0x2B22, 0x2B24, 0x2B26, 0x2B28, 0x2B29, 0x2B2B, 0x2B2D,
+  0x2B2F, 0x2B31, 0x2B32, 0x2B34, 0x2B36, 0x2B38, 0x2B3A, 0x2B3B, 0x2B3D, 0x2B3F, 0x2B41, 0x2B43,
+  0x2B44, 0x2B46, 0x2B48, 0x2B4A, 0x2B4C, 0x2B4D, 0x2B4F, 0x2B51, 0x2B53, 0x2B55, 0x2B56, 0x2B58,
+  0x2B5A, 0x2B5C, 0x2B5E, 0x2B5F, 0x2B61, 0x2B63, 0x2B65, 0x2B67, 0x2B68, 0x2B6A, 0x2B6C, 0x2B6E,
+  0x2B70, 0x2B71, 0x2B73, 0x2B75, 0x2B77, 0x2B79, 0x2B7A, 0x2B7C, 0x2B7E, 0x2B80, 0x2B82, 0x2B83,
+  0x2B85, 0x2B87, 0x2B89, 0x2B8B, 0x2B8C, 0x2B8E, 0x2B90, 0x2B92, 0x2B94, 0x2B95, 0x2B97, 0x2B99,
+  0x2B9B, 0x2B9D, 0x2B9E, 0x2BA0, 0x2BA2, 0x2BA4, 0x2BA6, 0x2BA7, 0x2BA9, 0x2BAB, 0x2BAD, 0x2BAF,
+  0x2BCF, 0x2BD1, 0x2BD3, 0x2BD5, 0x2BD6, 0x2BD8, 0x2BDA, 0x2BDC, 0x2BDE, 0x2BE0, 0x2BE1, 0x2BE3,
+  0x2BE5, 0x2BE7, 0x2BE9, 0x2BEA, 0x2BEC, 0x2BEE, 0x2BF0, 0x2BF2, 0x2BF3, 0x2BF5, 0x2BF7, 0x2BF9,
+  0x2BFB, 0x2BFD, 0x2BFE, 0x2C00, 0x2C02, 0x2C04, 0x2C06, 0x2C07, 0x2C09, 0x2C0B, 0x2C0D, 0x2C0F,
+  0x2C11, 0x2C12, 0x2C14, 0x2C16, 0x2C18, 0x2C1A, 0x2C1B, 0x2C1D, 0x2C1F, 0x2C21, 0x2C23, 0x2C24,
+  0x2C26, 0x2C28, 0x2C2A, 0x2C2C, 0x2C2E, 0x2C2F, 0x2C31, 0x2C33, 0x2C35, 0x2C37, 0x2C38, 0x2C3A,
+  0x2C3C, 0x2C3E, 0x2C40, 0x2C42, 0x2C43, 0x2C45, 0x2C47, 0x2C49, 0x2C4B, 0x2C4C, 0x2C4E, 0x2C50,
+  0x2C52, 0x2C54, 0x2C56, 0x2C57, 0x2C59, 0x2C5B, 0x2C5D, 0x2C5F, 0x2C60, 0x2C62, 0x2C64, 0x2C66,
+  0x2C68, 0x2C69, 0x2C6B, 0x2C6D, 0x2C6F, 0x2C71, 0x2C73, 0x2C74, 0x2C76, 0x2C78, 0x2C7A, 0x2C7C,
+  0x2C7D, 0x2C7F, 0x2C81, 0x2C83, 0x2C85, 0x2C87, 0x2C88, 0x2C8A, 0x2C8C, 0x2C8E, 0x2C90, 0x2C91,
+  0x2C93, 0x2C95, 0x2C97, 0x2C99, 0x2C9B, 0x2C9C, 0x2C9E, 0x2CA0, 0x2CA2, 0x2CA4, 0x2CA5, 0x2CA7,
+  0x2CA9, 0x2CAB, 0x2CAD, 0x2CAE, 0x2CB0, 0x2CB2, 0x2CB4, 0x2CB6, 0x2CB8, 0x2CB9, 0x2CBB, 0x2CBD,
+  0x2CBF, 0x2CC1, 0x2CC2, 0x2CC4, 0x2CC6, 0x2CC8, 0x2CCA, 0x2CCC, 0x2CCD, 0x2CCF, 0x2CD1, 0x2CD3,
+  0x2CD5, 0x2CD6, 0x2CD8, 0x2CDA, 0x2CDC, 0x2CDE, 0x2CDF, 0x2CE1, 0x2CE3, 0x2CE5, 0x2CE7, 0x2CE9,
+  0x2CEA, 0x2CEC, 0x2CEE, 0x2CF0, 0x2D0E, 0x2D10, 0x2D12, 0x2D14, 0x2D15, 0x2D17, 0x2D19, 0x2D1B,
+  0x2D1D, 0x2D1E, 0x2D20, 0x2D22, 0x2D24, 0x2D26, 0x2D28, 0x2D29, 0x2D2B, 0x2D2D, 0x2D2F, 0x2D31,
+  0x2D33, 0x2D34, 0x2D36, 0x2D38, 0x2D3A, 0x2D3C, 0x2D3E, 0x2D3F, 0x2D41, 0x2D43, 0x2D45, 0x2D47,
+  0x2D49, 0x2D4A, 0x2D4C, 0x2D4E, 0x2D50, 0x2D52, 0x2D54, 0x2D55, 0x2D57, 0x2D59, 0x2D5B, 0x2D5D,
+  0x2D5F, 0x2D60, 0x2D62, 0x2D64, 0x2D66, 0x2D68, 0x2D6A, 0x2D6B, 0x2D6D, 0x2D6F, 0x2D71, 0x2D73,
+  0x2D74, 0x2D76, 0x2D78, 0x2D7A, 0x2D7C, 0x2D7E, 0x2D7F, 0x2D81, 0x2D83, 0x2D85, 0x2D87, 0x2D89,
+  0x2D8A, 0x2D8C, 0x2D8E, 0x2D90, 0x2D92, 0x2D94, 0x2D95, 0x2D97, 0x2D99, 0x2D9B, 0x2D9D, 0x2D9F,
+  0x2DA0, 0x2DA2, 0x2DA4, 0x2DA6, 0x2DA8, 0x2DAA, 0x2DAB, 0x2DAD, 0x2DAF, 0x2DB1, 0x2DB3, 0x2DB5,
+  0x2DB6, 0x2DB8, 0x2DBA, 0x2DBC, 0x2DBE, 0x2DC0, 0x2DC1, 0x2DC3, 0x2DC5, 0x2DC7, 0x2DC9, 0x2DCB,
+  0x2DCC, 0x2DCE, 0x2DD0, 0x2DD2, 0x2DD4, 0x2DD5, 0x2DD7, 0x2DD9, 0x2DDB, 0x2DDD, 0x2DDF, 0x2DE0,
+  0x2DE2, 0x2DE4, 0x2DE6, 0x2DE8, 0x2DEA, 0x2DEB, 0x2DED, 0x2DEF, 0x2DF1, 0x2DF3, 0x2DF5, 0x2DF6,
+  0x2DF8, 0x2DFA, 0x2DFC, 0x2DFE, 0x2E00, 0x2E01, 0x2E03, 0x2E05, 0x2E07, 0x2E09, 0x2E0B, 0x2E0C,
+  0x2E0E, 0x2E10, 0x2E12, 0x2E14, 0x2E16, 0x2E17, 0x2E19, 0x2E1B, 0x2E1D, 0x2E1F, 0x2E21, 0x2E22,
+  0x2E24, 0x2E26, 0x2E28, 0x2E2A, 0x2E2B, 0x2E2D, 0x2E2F, 0x2E31, 0x2E4D, 0x2E4F, 0x2E51, 0x2E52,
+  0x2E54, 0x2E56, 0x2E58, 0x2E5A, 0x2E5C, 0x2E5D, 0x2E5F, 0x2E61, 0x2E63, 0x2E65, 0x2E67, 0x2E69,
+  0x2E6A, 0x2E6C, 0x2E6E, 0x2E70, 0x2E72, 0x2E74, 0x2E75, 0x2E77, 0x2E79, 0x2E7B, 0x2E7D, 0x2E7F,
+  0x2E80, 0x2E82, 0x2E84, 0x2E86, 0x2E88, 0x2E8A, 0x2E8C, 0x2E8D, 0x2E8F, 0x2E91, 0x2E93, 0x2E95,
+  0x2E97, 0x2E98, 0x2E9A, 0x2E9C, 0x2E9E, 0x2EA0, 0x2EA2, 0x2EA4, 0x2EA5, 0x2EA7, 0x2EA9, 0x2EAB,
+  0x2EAD, 0x2EAF, 0x2EB0, 0x2EB2, 0x2EB4, 0x2EB6, 0x2EB8, 0x2EBA, 0x2EBC, 0x2EBD, 0x2EBF, 0x2EC1,
+  0x2EC3, 0x2EC5, 0x2EC7, 0x2EC8, 0x2ECA, 0x2ECC, 0x2ECE, 0x2ED0, 0x2ED2, 0x2ED4, 0x2ED5, 0x2ED7,
+  0x2ED9, 0x2EDB, 0x2EDD, 0x2EDF, 0x2EE0, 0x2EE2, 0x2EE4, 0x2EE6, 0x2EE8, 0x2EEA, 0x2EEB, 0x2EED,
+  0x2EEF, 0x2EF1, 0x2EF3, 0x2EF5, 0x2EF7, 0x2EF8, 0x2EFA, 0x2EFC, 0x2EFE, 0x2F00, 0x2F02, 0x2F03,
+  0x2F05, 0x2F07, 0x2F09, 0x2F0B, 0x2F0D, 0x2F0F, 0x2F10, 0x2F12, 0x2F14, 0x2F16, 0x2F18, 0x2F1A,
+  0x2F1B, 0x2F1D, 0x2F1F, 0x2F21, 0x2F23, 0x2F25, 0x2F27, 0x2F28, 0x2F2A, 0x2F2C, 0x2F2E, 0x2F30,
+  0x2F32, 0x2F33, 0x2F35, 0x2F37, 0x2F39, 0x2F3B, 0x2F3D, 0x2F3F, 0x2F40, 0x2F42, 0x2F44, 0x2F46,
+  0x2F48, 0x2F4A, 0x2F4B, 0x2F4D, 0x2F4F, 0x2F51, 0x2F53, 0x2F55, 0x2F56, 0x2F58, 0x2F5A, 0x2F5C,
+  0x2F5E, 0x2F60, 0x2F62, 0x2F63, 0x2F65, 0x2F67, 0x2F69, 0x2F6B, 0x2F6D, 0x2F6E, 0x2F70, 0x2F72,
+  0x2E4C, 0x2E4E, 0x2E4F, 0x2E51, 0x2E53, 0x2E55, 0x2E57, 0x2E59, 0x2E5B, 0x2E5C, 0x2E5E, 0x2E60,
+  0x2E62, 0x2E64, 0x2E66, 0x2E68, 0x2E69, 0x2E6B, 0x2E6D, 0x2E6F, 0x2E71, 0x2E73, 0x2E75, 0x2E76,
+  0x2E78, 0x2E7A, 0x2E7C, 0x2E7E, 0x2E80, 0x2E82, 0x2E83, 0x2E85, 0x2E87, 0x2E89, 0x2E8B, 0x2E8D,
+  0x2E8F, 0x2E90, 0x2E92, 0x2E94, 0x2E96, 0x2E98, 0x2E9A, 0x2E9C, 0x2E9D, 0x2E9F, 0x2EA1, 0x2EA3,
+  0x2EA5, 0x2EA7, 0x2EA9, 0x2EAA, 0x2EAC, 0x2EAE, 0x2EB0, 0x2EB2, 0x2EB4, 0x2EB6, 0x2EB8, 0x2EB9,
+  0x2EBB, 0x2EBD, 0x2EBF, 0x2EC1, 0x2EC3, 0x2EC5, 0x2EC6, 0x2EC8, 0x2ECA, 0x2ECC, 0x2ECE, 0x2ED0,
+  0x2ED2, 0x2ED3, 0x2ED5, 0x2ED7, 0x2ED9, 0x2EDB, 0x2EDD, 0x2EDF, 0x2EE0, 0x2EE2, 0x2EE4, 0x2EE6,
+  0x2EE8, 0x2EEA, 0x2EEC, 0x2EED, 0x2EEF, 0x2EF1, 0x2EF3, 0x2EF5, 0x2EF7, 0x2EF9, 0x2EFA, 0x2EFC,
+  0x2EFE, 0x2F00, 0x2F02, 0x2F04, 0x2F06, 0x2F07, 0x2F09, 0x2F0B, 0x2F0D, 0x2F0F, 0x2F11, 0x2F13,
+  0x2F15, 0x2F16, 0x2F18, 0x2F1A, 0x2F1C, 0x2F1E, 0x2F20, 0x2F22, 0x2F23, 0x2F25, 0x2F27, 0x2F29,
+  0x2F2B, 0x2F2D, 0x2F2F, 0x2F30, 0x2F32, 0x2F34, 0x2F36, 0x2F38, 0x2F3A, 0x2F3C, 0x2F3D, 0x2F3F,
+  0x2F41, 0x2F43, 0x2F45, 0x2F47, 0x2F49, 0x2F4A, 0x2F4C, 0x2F4E, 0x2F50, 0x2F52, 0x2F54, 0x2F56,
+  0x2F57, 0x2F59, 0x2F5B, 0x2F5D, 0x2F5F, 0x2F61, 0x2F63, 0x2F64, 0x2F66, 0x2F68, 0x2F6A, 0x2F6C,
+  0x2F6E, 0x2F70, 0x2F71, 0x2F73, 0x2F8A, 0x2F8C, 0x2F8E, 0x2F90, 0x2F92, 0x2F94, 0x2F96, 0x2F98,
+  0x2F99, 0x2F9B, 0x2F9D, 0x2F9F, 0x2FA1, 0x2FA3, 0x2FA5, 0x2FA7, 0x2FA8, 0x2FAA, 0x2FAC, 0x2FAE,
+  0x2FB0, 0x2FB2, 0x2FB4, 0x2FB6, 0x2FB7, 0x2FB9, 0x2FBB, 0x2FBD, 0x2FBF, 0x2FC1, 0x2FC3, 0x2FC5,
+  0x2FC6, 0x2FC8, 0x2FCA, 0x2FCC, 0x2FCE, 0x2FD0, 0x2FD2, 0x2FD4, 0x2FD5, 0x2FD7, 0x2FD9, 0x2FDB,
+  0x2FDD, 0x2FDF, 0x2FE1, 0x2FE3, 0x2FE4, 0x2FE6, 0x2FE8, 0x2FEA, 0x2FEC, 0x2FEE, 0x2FF0, 0x2FF2,
+  0x2FF3, 0x2FF5, 0x2FF7, 0x2FF9, 0x2FFB, 0x2FFD, 0x2FFF, 0x3001, 0x3002, 0x3004, 0x3006, 0x3008,
+  0x300A, 0x300C, 0x300E, 0x3010, 0x3011, 0x3013, 0x3015, 0x3017, 0x3019, 0x301B, 0x301D, 0x301F,
+  0x3020, 0x3022, 0x3024, 0x3026, 0x3028, 0x302A, 0x302C, 0x302E, 0x302F, 0x3031, 0x3033, 0x3035,
+  0x3037, 0x3039, 0x303B, 0x303D, 0x303E, 0x3040, 0x3042, 0x3044, 0x3046, 0x3048, 0x304A, 0x304C,
+  0x304D, 0x304F, 0x3051, 0x3053, 0x3055, 0x3057, 0x3059, 0x305B, 0x305C, 0x305E, 0x3060, 0x3062,
+  0x3064, 0x3066, 0x3068, 0x306A, 0x306B, 0x306D, 0x306F, 0x3071, 0x3073, 0x3075, 0x3077, 0x3079,
+  0x307A, 0x307C, 0x307E, 0x3080, 0x3082, 0x3084, 0x3086, 0x3088, 0x3089, 0x308B, 0x308D, 0x308F,
+  0x3091, 0x3093, 0x3095, 0x3097, 0x3098, 0x309A, 0x309C, 0x309E, 0x30A0, 0x30A2, 0x30A4, 0x30A6,
+  0x30A7, 0x30A9, 0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3, 0x30B5, 0x30C9, 0x30CB, 0x30CD, 0x30CF,
+  0x30D1, 0x30D3, 0x30D5, 0x30D6, 0x30D8, 0x30DA, 0x30DC, 0x30DE, 0x30E0, 0x30E2, 0x30E4, 0x30E6,
+  0x30E7, 0x30E9, 0x30EB, 0x30ED, 0x30EF, 0x30F1, 0x30F3, 0x30F5, 0x30F7, 0x30F8, 0x30FA, 0x30FC,
+  0x30FE, 0x3100, 0x3102, 0x3104, 0x3106, 0x3108, 0x3109, 0x310B, 0x310D, 0x310F, 0x3111, 0x3113,
+  0x3115, 0x3117, 0x3119, 0x311A, 0x311C, 0x311E, 0x3120, 0x3122, 0x3124, 0x3126, 0x3128, 0x312A,
+  0x312C, 0x312D, 0x312F, 0x3131, 0x3133, 0x3135, 0x3137, 0x3139, 0x313B, 0x313D, 0x313E, 0x3140,
+  0x3142, 0x3144, 0x3146, 0x3148, 0x314A, 0x314C, 0x314E, 0x314F, 0x3151, 0x3153, 0x3155, 0x3157,
+  0x3159, 0x315B, 0x315D, 0x315F, 0x3160, 0x3162, 0x3164, 0x3166, 0x3168, 0x316A, 0x316C, 0x316E,
+  0x3170, 0x3171, 0x3173, 0x3175, 0x3177, 0x3179, 0x317B, 0x317D, 0x317F, 0x3181, 0x3182, 0x3184,
+  0x3186, 0x3188, 0x318A, 0x318C, 0x318E, 0x3190, 0x3192, 0x3193, 0x3195, 0x3197, 0x3199, 0x319B,
+  0x319D, 0x319F, 0x31A1, 0x31A3, 0x31A5, 0x31A6, 0x31A8, 0x31AA, 0x31AC, 0x31AE, 0x31B0, 0x31B2,
+  0x31B4, 0x31B6, 0x31B7, 0x31B9, 0x31BB, 0x31BD, 0x31BF, 0x31C1, 0x31C3, 0x31C5, 0x31C7, 0x31C8,
+  0x31CA, 0x31CC, 0x31CE, 0x31D0, 0x31D2, 0x31D4, 0x31D6, 0x31D8, 0x31D9, 0x31DB, 0x31DD, 0x31DF,
+  0x31E1, 0x31E3, 0x31E5, 0x31E7, 0x31E9, 0x31EA, 0x31EC, 0x31EE, 0x31F0, 0x31F2, 0x31F4, 0x31F6,
+  0x3208, 0x320A, 0x320C, 0x320E, 0x3210, 0x3211, 0x3213, 0x3215, 0x3217, 0x3219, 0x321B, 0x321D,
+  0x321F, 0x3221, 0x3223, 0x3225, 0x3226, 0x3228, 0x322A, 0x322C, 0x322E, 0x3230, 0x3232, 0x3234,
+  0x3236, 0x3238, 0x323A, 0x323B, 0x323D, 0x323F, 0x3241, 0x3243, 0x3245, 0x3247, 0x3249, 0x324B,
+  0x324D, 0x324E, 0x3250, 0x3252, 0x3254, 0x3256, 0x3258, 0x325A, 0x325C, 0x325E, 0x3260, 0x3262,
+  0x3263, 0x3265, 0x3267, 0x3269, 0x326B, 0x326D, 0x326F, 0x3271, 0x3273, 0x3275, 0x3277, 0x3278,
+  0x327A, 0x327C, 0x327E, 0x3280, 0x3282, 0x3284, 0x3286, 0x3288, 0x328A, 0x328B, 0x328D, 0x328F,
+  0x3291, 0x3293, 0x3295, 0x3297, 0x3299, 0x329B, 0x329D, 0x329F, 0x32A0, 0x32A2, 0x32A4, 0x32A6,
+  0x32A8, 0x32AA, 0x32AC, 0x32AE, 0x32B0, 0x32B2, 0x32B4, 0x32B5, 0x32B7, 0x32B9, 0x32BB, 0x32BD,
+  0x32BF, 0x32C1, 0x32C3, 0x32C5, 0x32C7, 0x32C8, 0x32CA, 0x32CC, 0x32CE, 0x32D0, 0x32D2, 0x32D4,
+  0x32D6, 0x32D8, 0x32DA, 0x32DC, 0x32DD, 0x32DF, 0x32E1, 0x32E3, 0x32E5, 0x32E7, 0x32E9, 0x32EB,
+  0x32ED, 0x32EF, 0x32F1, 0x32F2, 0x32F4, 0x32F6, 0x32F8, 0x32FA, 0x32FC, 0x32FE, 0x3300, 0x3302,
+  0x3304, 0x3305, 0x3307, 0x3309, 0x330B, 0x330D, 0x330F, 0x3311, 0x3313, 0x3315, 0x3317, 0x3319,
+  0x331A, 0x331C, 0x331E, 0x3320, 0x3322, 0x3324, 0x3326, 0x3328, 0x332A, 0x332C, 0x332E, 0x332F,
+  0x3331, 0x3333, 0x3335, 0x3337, 0x3207, 0x3209, 0x320B, 0x320C, 0x320E, 0x3210, 0x3212, 0x3214,
+  0x3216, 0x3218, 0x321A, 0x321C, 0x321E, 0x3220, 0x3222, 0x3224, 0x3225, 0x3227, 0x3229, 0x322B,
+  0x322D, 0x322F, 0x3231, 0x3233, 0x3235, 0x3237, 0x3239, 0x323B, 0x323C, 0x323E, 0x3240, 0x3242,
+  0x3244, 0x3246, 0x3248, 0x324A, 0x324C, 0x324E, 0x3250, 0x3252, 0x3254, 0x3255, 0x3257, 0x3259,
+  0x325B, 0x325D, 0x325F, 0x3261, 0x3263, 0x3265, 0x3267, 0x3269, 0x326B, 0x326D, 0x326E, 0x3270,
+  0x3272, 0x3274, 0x3276, 0x3278, 0x327A, 0x327C, 0x327E, 0x3280, 0x3282, 0x3284, 0x3286, 0x3287,
+  0x3289, 0x328B, 0x328D, 0x328F, 0x3291, 0x3293, 0x3295, 0x3297, 0x3299, 0x329B, 0x329D, 0x329F,
+  0x32A0, 0x32A2, 0x32A4, 0x32A6, 0x32A8, 0x32AA, 0x32AC, 0x32AE, 0x32B0, 0x32B2, 0x32B4, 0x32B6,
+  0x32B8, 0x32B9, 0x32BB, 0x32BD, 0x32BF, 0x32C1, 0x32C3, 0x32C5, 0x32C7, 0x32C9, 0x32CB, 0x32CD,
+  0x32CF, 0x32D1, 0x32D2, 0x32D4, 0x32D6, 0x32D8, 0x32DA, 0x32DC, 0x32DE, 0x32E0, 0x32E2, 0x32E4,
+  0x32E6, 0x32E8, 0x32EA, 0x32EB, 0x32ED, 0x32EF, 0x32F1, 0x32F3, 0x32F5, 0x32F7, 0x32F9, 0x32FB,
+  0x32FD, 0x32FF, 0x3301, 0x3303, 0x3304, 0x3306, 0x3308, 0x330A, 0x330C, 0x330E, 0x3310, 0x3312,
+  0x3314, 0x3316, 0x3318, 0x331A, 0x331B, 0x331D, 0x331F, 0x3321, 0x3323, 0x3325, 0x3327, 0x3329,
+  0x332B, 0x332D, 0x332F, 0x3331, 0x3333, 0x3334, 0x3336, 0x3338, 0x3345, 0x3347, 0x3349, 0x334B,
+  0x334D, 0x334F, 0x3351, 0x3353, 0x3355, 0x3357, 0x3359, 0x335B, 0x335D, 0x335F, 0x3361, 0x3362,
+  0x3364, 0x3366, 0x3368, 0x336A, 0x336C, 0x336E, 0x3370, 0x3372, 0x3374, 0x3376, 0x3378, 0x337A,
+  0x337C, 0x337E, 0x3380, 0x3381, 0x3383, 0x3385, 0x3387, 0x3389, 0x338B, 0x338D, 0x338F, 0x3391,
+  0x3393, 0x3395, 0x3397, 0x3399, 0x339B, 0x339D, 0x339F, 0x33A0, 0x33A2, 0x33A4, 0x33A6, 0x33A8,
+  0x33AA, 0x33AC, 0x33AE, 0x33B0, 0x33B2, 0x33B4, 0x33B6, 0x33B8, 0x33BA, 0x33BC, 0x33BE, 0x33C0,
+  0x33C1, 0x33C3, 0x33C5, 0x33C7, 0x33C9, 0x33CB, 0x33CD, 0x33CF, 0x33D1, 0x33D3, 0x33D5, 0x33D7,
+  0x33D9, 0x33DB, 0x33DD, 0x33DF, 0x33E0, 0x33E2, 0x33E4, 0x33E6, 0x33E8, 0x33EA, 0x33EC, 0x33EE,
+  0x33F0, 0x33F2, 0x33F4, 0x33F6, 0x33F8, 0x33FA, 0x33FC, 0x33FE, 0x33FF, 0x3401, 0x3403, 0x3405,
+  0x3407, 0x3409, 0x340B, 0x340D, 0x340F, 0x3411, 0x3413, 0x3415, 0x3417, 0x3419, 0x341B, 0x341D,
+  0x341F, 0x3420, 0x3422, 0x3424, 0x3426, 0x3428, 0x342A, 0x342C, 0x342E, 0x3430, 0x3432, 0x3434,
+  0x3436, 0x3438, 0x343A, 0x343C, 0x343E, 0x343F, 0x3441, 0x3443, 0x3445, 0x3447, 0x3449, 0x344B,
+  0x344D, 0x344F, 0x3451, 0x3453, 0x3455, 0x3457, 0x3459, 0x345B, 0x345D, 0x345E, 0x3460, 0x3462,
+  0x3464, 0x3466, 0x3468, 0x346A, 0x346C, 0x346E, 0x3470, 0x3472, 0x3474, 0x3476, 0x3478, 0x347A,
+  0x3484, 0x3486, 0x3488, 0x348A, 0x348C, 0x348E, 0x3490, 0x3492, 0x3494, 0x3496, 0x3498, 0x349A,
+  0x349C, 0x349D, 0x349F, 0x34A1, 0x34A3, 0x34A5, 0x34A7, 0x34A9, 0x34AB, 0x34AD, 0x34AF, 0x34B1,
+  0x34B3, 0x34B5, 0x34B7, 0x34B9, 0x34BB, 0x34BD, 0x34BF, 0x34C1, 0x34C3, 0x34C5, 0x34C7, 0x34C8,
+  0x34CA, 0x34CC, 0x34CE, 0x34D0, 0x34D2, 0x34D4, 0x34D6, 0x34D8, 0x34DA, 0x34DC, 0x34DE, 0x34E0,
+  0x34E2, 0x34E4, 0x34E6, 0x34E8, 0x34EA, 0x34EC, 0x34EE, 0x34F0, 0x34F2, 0x34F4, 0x34F5, 0x34F7,
+  0x34F9, 0x34FB, 0x34FD, 0x34FF, 0x3501, 0x3503, 0x3505, 0x3507, 0x3509, 0x350B, 0x350D, 0x350F,
+  0x3511, 0x3513, 0x3515, 0x3517, 0x3519, 0x351B, 0x351D, 0x351F, 0x3520, 0x3522, 0x3524, 0x3526,
+  0x3528, 0x352A, 0x352C, 0x352E, 0x3530, 0x3532, 0x3534, 0x3536, 0x3538, 0x353A, 0x353C, 0x353E,
+  0x3540, 0x3542, 0x3544, 0x3546, 0x3548, 0x354A, 0x354B, 0x354D, 0x354F, 0x3551, 0x3553, 0x3555,
+  0x3557, 0x3559, 0x355B, 0x355D, 0x355F, 0x3561, 0x3563, 0x3565, 0x3567, 0x3569, 0x356B, 0x356D,
+  0x356F, 0x3571, 0x3573, 0x3575, 0x3577, 0x3578, 0x357A, 0x357C, 0x357E, 0x3580, 0x3582, 0x3584,
+  0x3586, 0x3588, 0x358A, 0x358C, 0x358E, 0x3590, 0x3592, 0x3594, 0x3596, 0x3598, 0x359A, 0x359C,
+  0x359E, 0x35A0, 0x35A2, 0x35A3, 0x35A5, 0x35A7, 0x35A9, 0x35AB, 0x35AD, 0x35AF, 0x35B1, 0x35B3,
+  0x35B5, 0x35B7, 0x35B9, 0x35BB, 0x35C3, 0x35C5, 0x35C7, 0x35C9, 0x35CB, 0x35CD, 0x35CF, 0x35D1,
+  0x35D2, 0x35D4, 0x35D6, 0x35D8, 0x35DA, 0x35DC, 0x35DE, 0x35E0, 0x35E2, 0x35E4, 0x35E6, 0x35E8,
+  0x35EA, 0x35EC, 0x35EE, 0x35F0, 0x35F2, 0x35F4, 0x35F6, 0x35F8, 0x35FA, 0x35FC, 0x35FE, 0x3600,
+  0x3602, 0x3604, 0x3606, 0x3608, 0x360A, 0x360C, 0x360E, 0x3610, 0x3612, 0x3614, 0x3616, 0x3618,
+  0x3619, 0x361B, 0x361D, 0x361F, 0x3621, 0x3623, 0x3625, 0x3627, 0x3629, 0x362B, 0x362D, 0x362F,
+  0x3631, 0x3633, 0x3635, 0x3637, 0x3639, 0x363B, 0x363D, 0x363F, 0x3641, 0x3643, 0x3645, 0x3647,
+  0x3649, 0x364B, 0x364D, 0x364F, 0x3651, 0x3653, 0x3655, 0x3657, 0x3659, 0x365B, 0x365D, 0x365F,
+  0x3660, 0x3662, 0x3664, 0x3666, 0x3668, 0x366A, 0x366C, 0x366E, 0x3670, 0x3672, 0x3674, 0x3676,
+  0x3678, 0x367A, 0x367C, 0x367E, 0x3680, 0x3682, 0x3684, 0x3686, 0x3688, 0x368A, 0x368C, 0x368E,
+  0x3690, 0x3692, 0x3694, 0x3696, 0x3698, 0x369A, 0x369C, 0x369E, 0x36A0, 0x36A2, 0x36A4, 0x36A6,
+  0x36A7, 0x36A9, 0x36AB, 0x36AD, 0x36AF, 0x36B1, 0x36B3, 0x36B5, 0x36B7, 0x36B9, 0x36BB, 0x36BD,
+  0x36BF, 0x36C1, 0x36C3, 0x36C5, 0x36C7, 0x36C9, 0x36CB, 0x36CD, 0x36CF, 0x36D1, 0x36D3, 0x36D5,
+  0x36D7, 0x36D9, 0x36DB, 0x36DD, 0x36DF, 0x36E1, 0x36E3, 0x36E5, 0x36E7, 0x36E9, 0x36EB, 0x36ED,
+  0x36EE, 0x36F0, 0x36F2, 0x36F4, 0x36F6, 0x36F8, 0x36FA, 0x36FC, 0x3701, 0x3703, 0x3705, 0x3707,
+  0x3709, 0x370B, 0x370D, 0x370F, 0x3711, 0x3713, 0x3715, 0x3717, 0x3719, 0x371B, 0x371D, 0x371F,
+  0x3721, 0x3723, 0x3725, 0x3727, 0x3729, 0x372B, 0x372D, 0x372F, 0x3731, 0x3733, 0x3735, 0x3737,
+  0x3739, 0x373B, 0x373D, 0x373F, 0x3741, 0x3743, 0x3745, 0x3747, 0x3749, 0x374B, 0x374D, 0x374F,
+  0x3751, 0x3753, 0x3755, 0x3757, 0x3759, 0x375B, 0x375D, 0x375F, 0x3761, 0x3763, 0x3765, 0x3767,
+  0x3769, 0x376B, 0x376D, 0x376F, 0x3771, 0x3773, 0x3775, 0x3777, 0x3779, 0x377B, 0x377D, 0x377F,
+  0x3781, 0x3783, 0x3785, 0x3787, 0x3789, 0x378B, 0x378D, 0x378F, 0x3791, 0x3793, 0x3795, 0x3797,
+  0x3799, 0x379B, 0x379D, 0x379F, 0x37A0, 0x37A2, 0x37A4, 0x37A6, 0x37A8, 0x37AA, 0x37AC, 0x37AE,
+  0x37B0, 0x37B2, 0x37B4, 0x37B6, 0x37B8, 0x37BA, 0x37BC, 0x37BE, 0x37C0, 0x37C2, 0x37C4, 0x37C6,
+  0x37C8, 0x37CA, 0x37CC, 0x37CE, 0x37D0, 0x37D2, 0x37D4, 0x37D6, 0x37D8, 0x37DA, 0x37DC, 0x37DE,
+  0x37E0, 0x37E2, 0x37E4, 0x37E6, 0x37E8, 0x37EA, 0x37EC, 0x37EE, 0x37F0, 0x37F2, 0x37F4, 0x37F6,
+  0x37F8, 0x37FA, 0x37FC, 0x37FE, 0x3800, 0x3802, 0x3804, 0x3806, 0x3808, 0x380A, 0x380C, 0x380E,
+  0x3810, 0x3812, 0x3814, 0x3816, 0x3818, 0x381A, 0x381C, 0x381E, 0x3820, 0x3822, 0x3824, 0x3826,
+  0x3828, 0x382A, 0x382C, 0x382E, 0x3830, 0x3832, 0x3834, 0x3836, 0x3838, 0x383A, 0x383C, 0x383E,
+  0x3700, 0x3702, 0x3704, 0x3706, 0x3708, 0x370A, 0x370C, 0x370E, 0x3710, 0x3712, 0x3714, 0x3716,
+  0x3718, 0x371A, 0x371C, 0x371E, 0x3720, 0x3722, 0x3724, 0x3726, 0x3728, 0x372A, 0x372C, 0x372E,
+  0x3730, 0x3732, 0x3734, 0x3736, 0x3738, 0x373A, 0x373C, 0x373E, 0x3740, 0x3742, 0x3744, 0x3746,
+  0x3748, 0x374A, 0x374C, 0x374E, 0x3750, 0x3752, 0x3754, 0x3756, 0x3758, 0x375A, 0x375C, 0x375E,
+  0x3760, 0x3762, 0x3764, 0x3766, 0x3768, 0x376A, 0x376C, 0x376E, 0x3770, 0x3772, 0x3774, 0x3776,
+  0x3778, 0x377A, 0x377C, 0x377E, 0x3780, 0x3782, 0x3784, 0x3786, 0x3788, 0x378A, 0x378C, 0x378E,
+  0x3790, 0x3792, 0x3794, 0x3796, 0x3798, 0x379A, 0x379C, 0x379E, 0x37A1, 0x37A3, 0x37A5, 0x37A7,
+  0x37A9, 0x37AB, 0x37AD, 0x37AF, 0x37B1, 0x37B3, 0x37B5, 0x37B7, 0x37B9, 0x37BB, 0x37BD, 0x37BF,
+  0x37C1, 0x37C3, 0x37C5, 0x37C7, 0x37C9, 0x37CB, 0x37CD, 0x37CF, 0x37D1, 0x37D3, 0x37D5, 0x37D7,
+  0x37D9, 0x37DB, 0x37DD, 0x37DF, 0x37E1, 0x37E3, 0x37E5, 0x37E7, 0x37E9, 0x37EB, 0x37ED, 0x37EF,
+  0x37F1, 0x37F3, 0x37F5, 0x37F7, 0x37F9, 0x37FB, 0x37FD, 0x37FF, 0x3801, 0x3803, 0x3805, 0x3807,
+  0x3809, 0x380B, 0x380D, 0x380F, 0x3811, 0x3813, 0x3815, 0x3817, 0x3819, 0x381B, 0x381D, 0x381F,
+  0x3821, 0x3823, 0x3825, 0x3827, 0x3829, 0x382B, 0x382D, 0x382F, 0x3831, 0x3833, 0x3835, 0x3837,
+  0x3839, 0x383B, 0x383D, 0x383F, 0xFFFF, 0x3841, 0x3843, 0x3845, 0x3847, 0x3849, 0x384B, 0x384D,
+  0x384F, 0x3851, 0x3853, 0x3855, 0x3857, 0x3859, 0x385B, 0x385D, 0x385F, 0x3861, 0x3863, 0x3865,
+  0x3867, 0x3869, 0x386B, 0x386D, 0x386F, 0x3871, 0x3873, 0x3875, 0x3877, 0x3879, 0x387B, 0x387D,
+  0x387F, 0x3881, 0x3883, 0x3885, 0x3887, 0x3889, 0x388B, 0x388E, 0x3890, 0x3892, 0x3894, 0x3896,
+  0x3898, 0x389A, 0x389C, 0x389E, 0x38A0, 0x38A2, 0x38A4, 0x38A6, 0x38A8, 0x38AA, 0x38AC, 0x38AE,
+  0x38B0, 0x38B2, 0x38B4, 0x38B6, 0x38B8, 0x38BA, 0x38BC, 0x38BE, 0x38C0, 0x38C2, 0x38C4, 0x38C6,
+  0x38C8, 0x38CA, 0x38CC, 0x38CE, 0x38D0, 0x38D2, 0x38D4, 0x38D6, 0x38D8, 0x38DA, 0x38DC, 0x38DE,
+  0x38E1, 0x38E3, 0x38E5, 0x38E7, 0x38E9, 0x38EB, 0x38ED, 0x38EF, 0x38F1, 0x38F3, 0x38F5, 0x38F7,
+  0x38F9, 0x38FB, 0x38FD, 0x38FF, 0x3901, 0x3903, 0x3905, 0x3907, 0x3909, 0x390B, 0x390D, 0x390F,
+  0x3911, 0x3913, 0x3915, 0x3917, 0x3919, 0x391B, 0x391D, 0x391F, 0x3921, 0x3923, 0x3925, 0x3927,
+  0x3929, 0x392B, 0x392D, 0x392F, 0x3931, 0x3934, 0x3936, 0x3938, 0x393A, 0x393C, 0x393E, 0x3940,
+  0x3942, 0x3944, 0x3946, 0x3948, 0x394A, 0x394C, 0x394E, 0x3950, 0x3952, 0x3954, 0x3956, 0x3958,
+  0x395A, 0x395C, 0x395E, 0x3960, 0x3962, 0x3964, 0x3966, 0x3968, 0x396A, 0x396C, 0x396E, 0x3970,
+  0x3972, 0x3974, 0x3976, 0x3978, 0x397A, 0x397C, 0x397E, 0xFFFF, 0xFFFF, 0xFFFF, 0x3981, 0x3983,
+  0x3985, 0x3987, 0x3989, 0x398B, 0x398D, 0x398F, 0x3992, 0x3994, 0x3996, 0x3998, 0x399A, 0x399C,
+  0x399E, 0x39A0, 0x39A2, 0x39A4, 0x39A6, 0x39A8, 0x39AA, 0x39AC, 0x39AE, 0x39B0, 0x39B2, 0x39B4,
+  0x39B6, 0x39B8, 0x39BA, 0x39BC, 0x39BE, 0x39C1, 0x39C3, 0x39C5, 0x39C7, 0x39C9, 0x39CB, 0x39CD,
+  0x39CF, 0x39D1, 0x39D3, 0x39D5, 0x39D7, 0x39D9, 0x39DB, 0x39DD, 0x39DF, 0x39E1, 0x39E3, 0x39E5,
+  0x39E7, 0x39E9, 0x39EB, 0x39ED, 0x39EF, 0x39F2, 0x39F4, 0x39F6, 0x39F8, 0x39FA, 0x39FC, 0x39FE,
+  0x3A00, 0x3A02, 0x3A04, 0x3A06, 0x3A08, 0x3A0A, 0x3A0C, 0x3A0E, 0x3A10, 0x3A12, 0x3A14, 0x3A16,
+  0x3A18, 0x3A1A, 0x3A1C, 0x3A1E, 0x3A21, 0x3A23, 0x3A25, 0x3A27, 0x3A29, 0x3A2B, 0x3A2D, 0x3A2F,
+  0x3A31, 0x3A33, 0x3A35, 0x3A37, 0x3A39, 0x3A3B, 0x3A3D, 0x3A3F, 0x3A41, 0x3A43, 0x3A45, 0x3A47,
+  0x3A49, 0x3A4B, 0x3A4D, 0x3A50, 0x3A52, 0x3A54, 0x3A56, 0x3A58, 0x3A5A, 0x3A5C, 0x3A5E, 0x3A60,
+  0x3A62, 0x3A64, 0x3A66, 0x3A68, 0x3A6A, 0x3A6C, 0x3A6E, 0x3A70, 0x3A72, 0x3A74, 0x3A76, 0x3A78,
+  0x3A7A, 0x3A7C, 0x3A7E, 0x3A81, 0x3A83, 0x3A85, 0x3A87, 0x3A89, 0x3A8B, 0x3A8D, 0x3A8F, 0x3A91,
+  0x3A93, 0x3A95, 0x3A97, 0x3A99, 0x3A9B, 0x3A9D, 0x3A9F, 0x3AA1, 0x3AA3, 0x3AA5, 0x3AA7, 0x3AA9,
+  0x3AAB, 0x3AAD, 0x3AB0, 0x3AB2, 0x3AB4, 0x3AB6, 0x3AB8, 0x3ABA, 0x3ABC, 0x3ABE, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x3AC0, 0x3AC2, 0x3AC4, 0x3AC6, 0x3AC8, 0x3ACA, 0x3ACC, 0x3ACE, 0x3AD0, 0x3AD2,
+  0x3AD4, 0x3AD6, 0x3AD8, 0x3ADB, 0x3ADD, 0x3ADF, 0x3AE1, 0x3AE3, 0x3AE5, 0x3AE7, 0x3AE9, 0x3AEB,
+  0x3AED, 0x3AEF, 0x3AF1, 0x3AF3, 0x3AF5, 0x3AF7, 0x3AF9, 0x3AFC, 0x3AFE, 0x3B00, 0x3B02, 0x3B04,
+  0x3B06, 0x3B08, 0x3B0A, 0x3B0C, 0x3B0E, 0x3B10, 0x3B12, 0x3B14, 0x3B16, 0x3B18, 0x3B1A, 0x3B1D,
+  0x3B1F, 0x3B21, 0x3B23, 0x3B25, 0x3B27, 0x3B29, 0x3B2B, 0x3B2D, 0x3B2F, 0x3B31, 0x3B33, 0x3B35,
+  0x3B37, 0x3B39, 0x3B3B, 0x3B3D, 0x3B40, 0x3B42, 0x3B44, 0x3B46, 0x3B48, 0x3B4A, 0x3B4C, 0x3B4E,
+  0x3B50, 0x3B52, 0x3B54, 0x3B56, 0x3B58, 0x3B5A, 0x3B5C, 0x3B5E, 0x3B61, 0x3B63, 0x3B65, 0x3B67,
+  0x3B69, 0x3B6B, 0x3B6D, 0x3B6F, 0x3B71, 0x3B73, 0x3B75, 0x3B77, 0x3B79, 0x3B7B, 0x3B7D, 0x3B7F,
+  0x3B82, 0x3B84, 0x3B86, 0x3B88, 0x3B8A, 0x3B8C, 0x3B8E, 0x3B90, 0x3B92, 0x3B94, 0x3B96, 0x3B98,
+  0x3B9A, 0x3B9C, 0x3B9E, 0x3BA0, 0x3BA2, 0x3BA5, 0x3BA7, 0x3BA9, 0x3BAB, 0x3BAD, 0x3BAF, 0x3BB1,
+  0x3BB3, 0x3BB5, 0x3BB7, 0x3BB9, 0x3BBB, 0x3BBD, 0x3BBF, 0x3BC1, 0x3BC3, 0x3BC6, 0x3BC8, 0x3BCA,
+  0x3BCC, 0x3BCE, 0x3BD0, 0x3BD2, 0x3BD4, 0x3BD6, 0x3BD8, 0x3BDA, 0x3BDC, 0x3BDE, 0x3BE0, 0x3BE2,
+  0x3BE4, 0x3BE7, 0x3BE9, 0x3BEB, 0x3BED, 0x3BEF, 0x3BF1, 0x3BF3, 0x3BF5, 0x3BF7, 0x3BF9, 0x3BFB,
+  0x3BFD, 0x3BFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3C00, 0x3C02, 0x3C05, 0x3C07, 0x3C09,
+  0x3C0B, 0x3C0D, 0x3C0F, 0x3C11, 0x3C13, 0x3C15, 0x3C17, 0x3C19, 0x3C1B, 0x3C1E, 0x3C20, 0x3C22,
+  0x3C24, 0x3C26, 0x3C28, 0x3C2A, 0x3C2C, 0x3C2E, 0x3C30, 0x3C32, 0x3C34, 0x3C36, 0x3C39, 0x3C3B,
+  0x3C3D, 0x3C3F, 0x3C41, 0x3C43, 0x3C45, 0x3C47, 0x3C49, 0x3C4B, 0x3C4D, 0x3C4F, 0x3C52, 0x3C54,
+  0x3C56, 0x3C58, 0x3C5A, 0x3C5C, 0x3C5E, 0x3C60, 0x3C62, 0x3C64, 0x3C66, 0x3C68, 0x3C6A, 0x3C6D,
+  0x3C6F, 0x3C71, 0x3C73, 0x3C75, 0x3C77, 0x3C79, 0x3C7B, 0x3C7D, 0x3C7F, 0x3C81, 0x3C83, 0x3C86,
+  0x3C88, 0x3C8A, 0x3C8C, 0x3C8E, 0x3C90, 0x3C92, 0x3C94, 0x3C96, 0x3C98, 0x3C9A, 0x3C9C, 0x3C9E,
+  0x3CA1, 0x3CA3, 0x3CA5, 0x3CA7, 0x3CA9, 0x3CAB, 0x3CAD, 0x3CAF, 0x3CB1, 0x3CB3, 0x3CB5, 0x3CB7,
+  0x3CB9, 0x3CBC, 0x3CBE, 0x3CC0, 0x3CC2, 0x3CC4, 0x3CC6, 0x3CC8, 0x3CCA, 0x3CCC, 0x3CCE, 0x3CD0,
+  0x3CD2, 0x3CD5, 0x3CD7, 0x3CD9, 0x3CDB, 0x3CDD, 0x3CDF, 0x3CE1, 0x3CE3, 0x3CE5, 0x3CE7, 0x3CE9,
+  0x3CEB, 0x3CED, 0x3CF0, 0x3CF2, 0x3CF4, 0x3CF6, 0x3CF8, 0x3CFA, 0x3CFC, 0x3CFE, 0x3D00, 0x3D02,
+  0x3D04, 0x3D06, 0x3D09, 0x3D0B, 0x3D0D, 0x3D0F, 0x3D11, 0x3D13, 0x3D15, 0x3D17, 0x3D19, 0x3D1B,
+  0x3D1D, 0x3D1F, 0x3D21, 0x3D24, 0x3D26, 0x3D28, 0x3D2A, 0x3D2C, 0x3D2E, 0x3D30, 0x3D32, 0x3D34,
+  0x3D36, 0x3D38, 0x3D3A, 0x3D3D, 0x3D3F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x3D41, 0x3D43, 0x3D45, 0x3D47, 0x3D49, 0x3D4C, 0x3D4E, 0x3D50, 0x3D52, 0x3D54, 0x3D56, 0x3D58,
+  0x3D5A, 0x3D5C, 0x3D5E, 0x3D61, 0x3D63, 0x3D65, 0x3D67, 0x3D69, 0x3D6B, 0x3D6D, 0x3D6F, 0x3D71,
+  0x3D73, 0x3D76, 0x3D78, 0x3D7A, 0x3D7C, 0x3D7E, 0x3D80, 0x3D82, 0x3D84, 0x3D86, 0x3D88, 0x3D8A,
+  0x3D8D, 0x3D8F, 0x3D91, 0x3D93, 0x3D95, 0x3D97, 0x3D99, 0x3D9B, 0x3D9D, 0x3D9F, 0x3DA2, 0x3DA4,
+  0x3DA6, 0x3DA8, 0x3DAA, 0x3DAC, 0x3DAE, 0x3DB0, 0x3DB2, 0x3DB4, 0x3DB7, 0x3DB9, 0x3DBB, 0x3DBD,
+  0x3DBF, 0x3DC1, 0x3DC3, 0x3DC5, 0x3DC7, 0x3DC9, 0x3DCC, 0x3DCE, 0x3DD0, 0x3DD2, 0x3DD4, 0x3DD6,
+  0x3DD8, 0x3DDA, 0x3DDC, 0x3DDE, 0x3DE1, 0x3DE3, 0x3DE5, 0x3DE7, 0x3DE9, 0x3DEB, 0x3DED, 0x3DEF,
+  0x3DF1, 0x3DF3, 0x3DF6, 0x3DF8, 0x3DFA, 0x3DFC, 0x3DFE, 0x3E00, 0x3E02, 0x3E04, 0x3E06, 0x3E08,
+  0x3E0B, 0x3E0D, 0x3E0F, 0x3E11, 0x3E13, 0x3E15, 0x3E17, 0x3E19, 0x3E1B, 0x3E1D, 0x3E20, 0x3E22,
+  0x3E24, 0x3E26, 0x3E28, 0x3E2A, 0x3E2C, 0x3E2E, 0x3E30, 0x3E32, 0x3E35, 0x3E37, 0x3E39, 0x3E3B,
+  0x3E3D, 0x3E3F, 0x3E41, 0x3E43, 0x3E45, 0x3E47, 0x3E49, 0x3E4C, 0x3E4E, 0x3E50, 0x3E52, 0x3E54,
+  0x3E56, 0x3E58, 0x3E5A, 0x3E5C, 0x3E5E, 0x3E61, 0x3E63, 0x3E65, 0x3E67, 0x3E69, 0x3E6B, 0x3E6D,
+  0x3E6F, 0x3E71, 0x3E73, 0x3E76, 0x3E78, 0x3E7A, 0x3E7C, 0x3E7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3E80, 0x3E82, 0x3E84, 0x3E86, 0x3E88, 0x3E8A, 0x3E8C, 0x3E8E,
+  0x3E91, 0x3E93, 0x3E95, 0x3E97, 0x3E99, 0x3E9B, 0x3E9D, 0x3E9F, 0x3EA1, 0x3EA4, 0x3EA6, 0x3EA8,
+  0x3EAA, 0x3EAC, 0x3EAE, 0x3EB0, 0x3EB2, 0x3EB5, 0x3EB7, 0x3EB9, 0x3EBB, 0x3EBD, 0x3EBF, 0x3EC1,
+  0x3EC3, 0x3EC5, 0x3EC8, 0x3ECA, 0x3ECC, 0x3ECE, 0x3ED0, 0x3ED2, 0x3ED4, 0x3ED6, 0x3ED9, 0x3EDB,
+  0x3EDD, 0x3EDF, 0x3EE1, 0x3EE3, 0x3EE5, 0x3EE7, 0x3EE9, 0x3EEC, 0x3EEE, 0x3EF0, 0x3EF2, 0x3EF4,
+  0x3EF6, 0x3EF8, 0x3EFA, 0x3EFD, 0x3EFF, 0x3F01, 0x3F03, 0x3F05, 0x3F07, 0x3F09, 0x3F0B, 0x3F0D,
+  0x3F10, 0x3F12, 0x3F14, 0x3F16, 0x3F18, 0x3F1A, 0x3F1C, 0x3F1E, 0x3F21, 0x3F23, 0x3F25, 0x3F27,
+  0x3F29, 0x3F2B, 0x3F2D, 0x3F2F, 0x3F32, 0x3F34, 0x3F36, 0x3F38, 0x3F3A, 0x3F3C, 0x3F3E, 0x3F40,
+  0x3F42, 0x3F45, 0x3F47, 0x3F49, 0x3F4B, 0x3F4D, 0x3F4F, 0x3F51, 0x3F53, 0x3F56, 0x3F58, 0x3F5A,
+  0x3F5C, 0x3F5E, 0x3F60, 0x3F62, 0x3F64, 0x3F66, 0x3F69, 0x3F6B, 0x3F6D, 0x3F6F, 0x3F71, 0x3F73,
+  0x3F75, 0x3F77, 0x3F7A, 0x3F7C, 0x3F7E, 0x3F80, 0x3F82, 0x3F84, 0x3F86, 0x3F88, 0x3F8A, 0x3F8D,
+  0x3F8F, 0x3F91, 0x3F93, 0x3F95, 0x3F97, 0x3F99, 0x3F9B, 0x3F9E, 0x3FA0, 0x3FA2, 0x3FA4, 0x3FA6,
+  0x3FA8, 0x3FAA, 0x3FAC, 0x3FAE, 0x3FB1, 0x3FB3, 0x3FB5, 0x3FB7, 0x3FB9, 0x3FBB, 0x3FBD, 0x3FBF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3FC0, 0x3FC2, 0x3FC4,
+  0x3FC7, 0x3FC9, 0x3FCB, 0x3FCD, 0x3FCF, 0x3FD1, 0x3FD3, 0x3FD6, 0x3FD8, 0x3FDA, 0x3FDC, 0x3FDE,
+  0x3FE0, 0x3FE2, 0x3FE5, 0x3FE7, 0x3FE9, 0x3FEB, 0x3FED, 0x3FEF, 0x3FF1, 0x3FF4, 0x3FF6, 0x3FF8,
+  0x3FFA, 0x3FFC, 0x3FFE, 0x4000, 0x4002, 0x4005, 0x4007, 0x4009, 0x400B, 0x400D, 0x400F, 0x4011,
+  0x4014, 0x4016, 0x4018, 0x401A, 0x401C, 0x401E, 0x4020, 0x4023, 0x4025, 0x4027, 0x4029, 0x402B,
+  0x402D, 0x402F, 0x4032, 0x4034, 0x4036, 0x4038, 0x403A, 0x403C, 0x403E, 0x4040, 0x4043, 0x4045,
+  0x4047, 0x4049, 0x404B, 0x404D, 0x404F, 0x4052, 0x4054, 0x4056, 0x4058, 0x405A, 0x405C, 0x405E,
+  0x4061, 0x4063, 0x4065, 0x4067, 0x4069, 0x406B, 0x406D, 0x4070, 0x4072, 0x4074, 0x4076, 0x4078,
+  0x407A, 0x407C, 0x407F, 0x4081, 0x4083, 0x4085, 0x4087, 0x4089, 0x408B, 0x408D, 0x4090, 0x4092,
+  0x4094, 0x4096, 0x4098, 0x409A, 0x409C, 0x409F, 0x40A1, 0x40A3, 0x40A5, 0x40A7, 0x40A9, 0x40AB,
+  0x40AE, 0x40B0, 0x40B2, 0x40B4, 0x40B6, 0x40B8, 0x40BA, 0x40BD, 0x40BF, 0x40C1, 0x40C3, 0x40C5,
+  0x40C7, 0x40C9, 0x40CB, 0x40CE, 0x40D0, 0x40D2, 0x40D4, 0x40D6, 0x40D8, 0x40DA, 0x40DD, 0x40DF,
+  0x40E1, 0x40E3, 0x40E5, 0x40E7, 0x40E9, 0x40EC, 0x40EE, 0x40F0, 0x40F2, 0x40F4, 0x40F6, 0x40F8,
+  0x40FB, 0x40FD, 0x40FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x4101, 0x4103, 0x4105, 0x4107, 0x4109, 0x410C, 0x410E, 0x4110, 0x4112, 0x4114,
+  0x4116, 0x4119, 0x411B, 0x411D, 0x411F, 0x4121, 0x4123, 0x4126, 0x4128, 0x412A, 0x412C, 0x412E,
+  0x4130, 0x4132, 0x4135, 0x4137, 0x4139, 0x413B, 0x413D, 0x413F, 0x4142, 0x4144, 0x4146, 0x4148,
+  0x414A, 0x414C, 0x414F, 0x4151, 0x4153, 0x4155, 0x4157, 0x4159, 0x415C, 0x415E, 0x4160, 0x4162,
+  0x4164, 0x4166, 0x4168, 0x416B, 0x416D, 0x416F, 0x4171, 0x4173, 0x4175, 0x4178, 0x417A, 0x417C,
+  0x417E, 0x4180, 0x4182, 0x4185, 0x4187, 0x4189, 0x418B, 0x418D, 0x418F, 0x4191, 0x4194, 0x4196,
+  0x4198, 0x419A, 0x419C, 0x419E, 0x41A1, 0x41A3, 0x41A5, 0x41A7, 0x41A9, 0x41AB, 0x41AE, 0x41B0,
+  0x41B2, 0x41B4, 0x41B6, 0x41B8, 0x41BA, 0x41BD, 0x41BF, 0x41C1, 0x41C3, 0x41C5, 0x41C7, 0x41CA,
+  0x41CC, 0x41CE, 0x41D0, 0x41D2, 0x41D4, 0x41D7, 0x41D9, 0x41DB, 0x41DD, 0x41DF, 0x41E1, 0x41E3,
+  0x41E6, 0x41E8, 0x41EA, 0x41EC, 0x41EE, 0x41F0, 0x41F3, 0x41F5, 0x41F7, 0x41F9, 0x41FB, 0x41FD,
+  0x4200, 0x4202, 0x4204, 0x4206, 0x4208, 0x420A, 0x420D, 0x420F, 0x4211, 0x4213, 0x4215, 0x4217,
+  0x4219, 0x421C, 0x421E, 0x4220, 0x4222, 0x4224, 0x4226, 0x4229, 0x422B, 0x422D, 0x422F, 0x4231,
+  0x4233, 0x4236, 0x4238, 0x423A, 0x423C, 0x423E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4242, 0x4244, 0x4246, 0x4248, 0x424A,
+  0x424C, 0x424F, 0x4251, 0x4253, 0x4255, 0x4257, 0x4259, 0x425C, 0x425E, 0x4260, 0x4262, 0x4264,
+  0x4267, 0x4269, 0x426B, 0x426D, 0x426F, 0x4271, 0x4274, 0x4276, 0x4278, 0x427A, 0x427C, 0x427F,
+  0x4281, 0x4283, 0x4285, 0x4287, 0x4289, 0x428C, 0x428E, 0x4290, 0x4292, 0x4294, 0x4297, 0x4299,
+  0x429B, 0x429D, 0x429F, 0x42A1, 0x42A4, 0x42A6, 0x42A8, 0x42AA, 0x42AC, 0x42AE, 0x42B1, 0x42B3,
+  0x42B5, 0x42B7, 0x42B9, 0x42BC, 0x42BE, 0x42C0, 0x42C2, 0x42C4, 0x42C6, 0x42C9, 0x42CB, 0x42CD,
+  0x42CF, 0x42D1, 0x42D4, 0x42D6, 0x42D8, 0x42DA, 0x42DC, 0x42DE, 0x42E1, 0x42E3, 0x42E5, 0x42E7,
+  0x42E9, 0x42EB, 0x42EE, 0x42F0, 0x42F2, 0x42F4, 0x42F6, 0x42F9, 0x42FB, 0x42FD, 0x42FF, 0x4301,
+  0x4303, 0x4306, 0x4308, 0x430A, 0x430C, 0x430E, 0x4311, 0x4313, 0x4315, 0x4317, 0x4319, 0x431B,
+  0x431E, 0x4320, 0x4322, 0x4324, 0x4326, 0x4328, 0x432B, 0x432D, 0x432F, 0x4331, 0x4333, 0x4336,
+  0x4338, 0x433A, 0x433C, 0x433E, 0x4340, 0x4343, 0x4345, 0x4347, 0x4349, 0x434B, 0x434E, 0x4350,
+  0x4352, 0x4354, 0x4356, 0x4358, 0x435B, 0x435D, 0x435F, 0x4361, 0x4363, 0x4366, 0x4368, 0x436A,
+  0x436C, 0x436E, 0x4370, 0x4373, 0x4375, 0x4377, 0x4379, 0x437B, 0x437D, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4380,
+  0x4382, 0x4384, 0x4387, 0x4389, 0x438B, 0x438D, 0x438F, 0x4392, 0x4394, 0x4396, 0x4398, 0x439A,
+  0x439D, 0x439F, 0x43A1, 0x43A3, 0x43A5, 0x43A8, 0x43AA, 0x43AC, 0x43AE, 0x43B0, 0x43B3, 0x43B5,
+  0x43B7, 0x43B9, 0x43BB, 0x43BE, 0x43C0, 0x43C2, 0x43C4, 0x43C6, 0x43C9, 0x43CB, 0x43CD, 0x43CF,
+  0x43D1, 0x43D4, 0x43D6, 0x43D8, 0x43DA, 0x43DC, 0x43DF, 0x43E1, 0x43E3, 0x43E5, 0x43E7, 0x43EA,
+  0x43EC, 0x43EE, 0x43F0, 0x43F2, 0x43F5, 0x43F7, 0x43F9, 0x43FB, 0x43FD, 0x4400, 0x4402, 0x4404,
+  0x4406, 0x4408, 0x440B, 0x440D, 0x440F, 0x4411, 0x4413, 0x4416, 0x4418, 0x441A, 0x441C, 0x441E,
+  0x4421, 0x4423, 0x4425, 0x4427, 0x4429, 0x442C, 0x442E, 0x4430, 0x4432, 0x4434, 0x4437, 0x4439,
+  0x443B, 0x443D, 0x443F, 0x4442, 0x4444, 0x4446, 0x4448, 0x444A, 0x444D, 0x444F, 0x4451, 0x4453,
+  0x4455, 0x4458, 0x445A, 0x445C, 0x445E, 0x4460, 0x4463, 0x4465, 0x4467, 0x4469, 0x446B, 0x446E,
+  0x4470, 0x4472, 0x4474, 0x4476, 0x4479, 0x447B, 0x447D, 0x447F, 0x4481, 0x4484, 0x4486, 0x4488,
+  0x448A, 0x448C, 0x448F, 0x4491, 0x4493, 0x4495, 0x4497, 0x449A, 0x449C, 0x449E, 0x44A0, 0x44A2,
+  0x44A5, 0x44A7, 0x44A9, 0x44AB, 0x44AD, 0x44B0, 0x44B2, 0x44B4, 0x44B6, 0x44B8, 0x44BB, 0x44BD,
+  0x44BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x44C1, 0x44C3, 0x44C5, 0x44C7, 0x44CA, 0x44CC, 0x44CE, 0x44D0,
+  0x44D2, 0x44D5, 0x44D7, 0x44D9, 0x44DB, 0x44DE, 0x44E0, 0x44E2, 0x44E4, 0x44E6, 0x44E9, 0x44EB,
+  0x44ED, 0x44EF, 0x44F2, 0x44F4, 0x44F6, 0x44F8, 0x44FA, 0x44FD, 0x44FF, 0x4501, 0x4503, 0x4506,
+  0x4508, 0x450A, 0x450C, 0x450E, 0x4511, 0x4513, 0x4515, 0x4517, 0x451A, 0x451C, 0x451E, 0x4520,
+  0x4522, 0x4525, 0x4527, 0x4529, 0x452B, 0x452E, 0x4530, 0x4532, 0x4534, 0x4536, 0x4539, 0x453B,
+  0x453D, 0x453F, 0x4542, 0x4544, 0x4546, 0x4548, 0x454A, 0x454D, 0x454F, 0x4551, 0x4553, 0x4556,
+  0x4558, 0x455A, 0x455C, 0x455E, 0x4561, 0x4563, 0x4565, 0x4567, 0x4569, 0x456C, 0x456E, 0x4570,
+  0x4572, 0x4575, 0x4577, 0x4579, 0x457B, 0x457D, 0x4580, 0x4582, 0x4584, 0x4586, 0x4589, 0x458B,
+  0x458D, 0x458F, 0x4591, 0x4594, 0x4596, 0x4598, 0x459A, 0x459D, 0x459F, 0x45A1, 0x45A3, 0x45A5,
+  0x45A8, 0x45AA, 0x45AC, 0x45AE, 0x45B1, 0x45B3, 0x45B5, 0x45B7, 0x45B9, 0x45BC, 0x45BE, 0x45C0,
+  0x45C2, 0x45C5, 0x45C7, 0x45C9, 0x45CB, 0x45CD, 0x45D0, 0x45D2, 0x45D4, 0x45D6, 0x45D9, 0x45DB,
+  0x45DD, 0x45DF, 0x45E1, 0x45E4, 0x45E6, 0x45E8, 0x45EA, 0x45ED, 0x45EF, 0x45F1, 0x45F3, 0x45F5,
+  0x45F8, 0x45FA, 0x45FC, 0x45FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4601, 0x4604, 0x4606,
+  0x4608, 0x460A, 0x460D, 0x460F, 0x4611, 0x4613, 0x4616, 0x4618, 0x461A, 0x461C, 0x461F, 0x4621,
+  0x4623, 0x4625, 0x4627, 0x462A, 0x462C, 0x462E, 0x4630, 0x4633, 0x4635, 0x4637, 0x4639, 0x463C,
+  0x463E, 0x4640, 0x4642, 0x4645, 0x4647, 0x4649, 0x464B, 0x464E, 0x4650, 0x4652, 0x4654, 0x4657,
+  0x4659, 0x465B, 0x465D, 0x4660, 0x4662, 0x4664, 0x4666, 0x4669, 0x466B, 0x466D, 0x466F, 0x4672,
+  0x4674, 0x4676, 0x4678, 0x467A, 0x467D, 0x467F, 0x4681, 0x4683, 0x4686, 0x4688, 0x468A, 0x468C,
+  0x468F, 0x4691, 0x4693, 0x4695, 0x4698, 0x469A, 0x469C, 0x469E, 0x46A1, 0x46A3, 0x46A5, 0x46A7,
+  0x46AA, 0x46AC, 0x46AE, 0x46B0, 0x46B3, 0x46B5, 0x46B7, 0x46B9, 0x46BC, 0x46BE, 0x46C0, 0x46C2,
+  0x46C5, 0x46C7, 0x46C9, 0x46CB, 0x46CD, 0x46D0, 0x46D2, 0x46D4, 0x46D6, 0x46D9, 0x46DB, 0x46DD,
+  0x46DF, 0x46E2, 0x46E4, 0x46E6, 0x46E8, 0x46EB, 0x46ED, 0x46EF, 0x46F1, 0x46F4, 0x46F6, 0x46F8,
+  0x46FA, 0x46FD, 0x46FF, 0x4701, 0x4703, 0x4706, 0x4708, 0x470A, 0x470C, 0x470F, 0x4711, 0x4713,
+  0x4715, 0x4718, 0x471A, 0x471C, 0x471E, 0x4720, 0x4723, 0x4725, 0x4727, 0x4729, 0x472C, 0x472E,
+  0x4730, 0x4732, 0x4735, 0x4737, 0x4739, 0x473B, 0x473E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x4740, 0x4742, 0x4744, 0x4747, 0x4749, 0x474B, 0x474D, 0x4750, 0x4752, 0x4754, 0x4756,
+  0x4759, 0x475B, 0x475D, 0x475F, 0x4762, 0x4764, 0x4766, 0x4769, 0x476B, 0x476D, 0x476F, 0x4772,
+  0x4774, 0x4776, 0x4778, 0x477B, 0x477D, 0x477F, 0x4781, 0x4784, 0x4786, 0x4788, 0x478B, 0x478D,
+  0x478F, 0x4791, 0x4794, 0x4796, 0x4798, 0x479A, 0x479D, 0x479F, 0x47A1, 0x47A3, 0x47A6, 0x47A8,
+  0x47AA, 0x47AD, 0x47AF, 0x47B1, 0x47B3, 0x47B6, 0x47B8, 0x47BA, 0x47BC, 0x47BF, 0x47C1, 0x47C3,
+  0x47C5, 0x47C8, 0x47CA, 0x47CC, 0x47CF, 0x47D1, 0x47D3, 0x47D5, 0x47D8, 0x47DA, 0x47DC, 0x47DE,
+  0x47E1, 0x47E3, 0x47E5, 0x47E7, 0x47EA, 0x47EC, 0x47EE, 0x47F0, 0x47F3, 0x47F5, 0x47F7, 0x47FA,
+  0x47FC, 0x47FE, 0x4800, 0x4803, 0x4805, 0x4807, 0x4809, 0x480C, 0x480E, 0x4810, 0x4812, 0x4815,
+  0x4817, 0x4819, 0x481C, 0x481E, 0x4820, 0x4822, 0x4825, 0x4827, 0x4829, 0x482B, 0x482E, 0x4830,
+  0x4832, 0x4834, 0x4837, 0x4839, 0x483B, 0x483E, 0x4840, 0x4842, 0x4844, 0x4847, 0x4849, 0x484B,
+  0x484D, 0x4850, 0x4852, 0x4854, 0x4856, 0x4859, 0x485B, 0x485D, 0x4860, 0x4862, 0x4864, 0x4866,
+  0x4869, 0x486B, 0x486D, 0x486F, 0x4872, 0x4874, 0x4876, 0x4878, 0x487B, 0x487D, 0x487F, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4880, 0x4883, 0x4885, 0x4887, 0x488A, 0x488C,
+  0x488E, 0x4890, 0x4893, 0x4895, 0x4897, 0x489A, 0x489C, 0x489E, 0x48A1, 0x48A3, 0x48A5, 0x48A7,
+  0x48AA, 0x48AC, 0x48AE, 0x48B1, 0x48B3, 0x48B5, 0x48B7, 0x48BA, 0x48BC, 0x48BE, 0x48C1, 0x48C3,
+  0x48C5, 0x48C7, 0x48CA, 0x48CC, 0x48CE, 0x48D1, 0x48D3, 0x48D5, 0x48D7, 0x48DA, 0x48DC, 0x48DE,
+  0x48E1, 0x48E3, 0x48E5, 0x48E7, 0x48EA, 0x48EC, 0x48EE, 0x48F1, 0x48F3, 0x48F5, 0x48F7, 0x48FA,
+  0x48FC, 0x48FE, 0x4901, 0x4903, 0x4905, 0x4907, 0x490A, 0x490C, 0x490E, 0x4911, 0x4913, 0x4915,
+  0x4917, 0x491A, 0x491C, 0x491E, 0x4921, 0x4923, 0x4925, 0x4928, 0x492A, 0x492C, 0x492E, 0x4931,
+  0x4933, 0x4935, 0x4938, 0x493A, 0x493C, 0x493E, 0x4941, 0x4943, 0x4945, 0x4948, 0x494A, 0x494C,
+  0x494E, 0x4951, 0x4953, 0x4955, 0x4958, 0x495A, 0x495C, 0x495E, 0x4961, 0x4963, 0x4965, 0x4968,
+  0x496A, 0x496C, 0x496E, 0x4971, 0x4973, 0x4975, 0x4978, 0x497A, 0x497C, 0x497E, 0x4981, 0x4983,
+  0x4985, 0x4988, 0x498A, 0x498C, 0x498E, 0x4991, 0x4993, 0x4995, 0x4998, 0x499A, 0x499C, 0x499E,
+  0x49A1, 0x49A3, 0x49A5, 0x49A8, 0x49AA, 0x49AC, 0x49AF, 0x49B1, 0x49B3, 0x49B5, 0x49B8, 0x49BA,
+  0x49BC, 0x49BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49C1,
+  0x49C3, 0x49C6, 0x49C8, 0x49CA, 0x49CD, 0x49CF, 0x49D1, 0x49D4, 0x49D6, 0x49D8, 0x49DB, 0x49DD,
+  0x49DF, 0x49E2, 0x49E4, 0x49E6, 0x49E8, 0x49EB, 0x49ED, 0x49EF, 0x49F2, 0x49F4, 0x49F6, 0x49F9,
+  0x49FB, 0x49FD, 0x4A00, 0x4A02, 0x4A04, 0x4A07, 0x4A09, 0x4A0B, 0x4A0D, 0x4A10, 0x4A12, 0x4A14,
+  0x4A17, 0x4A19, 0x4A1B, 0x4A1E, 0x4A20, 0x4A22, 0x4A25, 0x4A27, 0x4A29, 0x4A2B, 0x4A2E, 0x4A30,
+  0x4A32, 0x4A35, 0x4A37, 0x4A39, 0x4A3C, 0x4A3E, 0x4A40, 0x4A43, 0x4A45, 0x4A47, 0x4A4A, 0x4A4C,
+  0x4A4E, 0x4A50, 0x4A53, 0x4A55, 0x4A57, 0x4A5A, 0x4A5C, 0x4A5E, 0x4A61, 0x4A63, 0x4A65, 0x4A68,
+  0x4A6A, 0x4A6C, 0x4A6F, 0x4A71, 0x4A73, 0x4A75, 0x4A78, 0x4A7A, 0x4A7C, 0x4A7F, 0x4A81, 0x4A83,
+  0x4A86, 0x4A88, 0x4A8A, 0x4A8D, 0x4A8F, 0x4A91, 0x4A94, 0x4A96, 0x4A98, 0x4A9A, 0x4A9D, 0x4A9F,
+  0x4AA1, 0x4AA4, 0x4AA6, 0x4AA8, 0x4AAB, 0x4AAD, 0x4AAF, 0x4AB2, 0x4AB4, 0x4AB6, 0x4AB8, 0x4ABB,
+  0x4ABD, 0x4ABF, 0x4AC2, 0x4AC4, 0x4AC6, 0x4AC9, 0x4ACB, 0x4ACD, 0x4AD0, 0x4AD2, 0x4AD4, 0x4AD7,
+  0x4AD9, 0x4ADB, 0x4ADD, 0x4AE0, 0x4AE2, 0x4AE4, 0x4AE7, 0x4AE9, 0x4AEB, 0x4AEE, 0x4AF0, 0x4AF2,
+  0x4AF5, 0x4AF7, 0x4AF9, 0x4AFC, 0x4AFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x4B00, 0x4B02, 0x4B04, 0x4B07, 0x4B09, 0x4B0B, 0x4B0E, 0x4B10, 0x4B12,
+  0x4B15, 0x4B17, 0x4B19, 0x4B1C, 0x4B1E, 0x4B20, 0x4B23, 0x4B25, 0x4B27, 0x4B2A, 0x4B2C, 0x4B2E,
+  0x4B31, 0x4B33, 0x4B35, 0x4B38, 0x4B3A, 0x4B3C, 0x4B3F, 0x4B41, 0x4B43, 0x4B46, 0x4B48, 0x4B4A,
+  0x4B4D, 0x4B4F, 0x4B51, 0x4B54, 0x4B56, 0x4B58, 0x4B5B, 0x4B5D, 0x4B5F, 0x4B62, 0x4B64, 0x4B66,
+  0x4B69, 0x4B6B, 0x4B6D, 0x4B70, 0x4B72, 0x4B74, 0x4B77, 0x4B79, 0x4B7B, 0x4B7E, 0x4B80, 0x4B82,
+  0x4B85, 0x4B87, 0x4B89, 0x4B8C, 0x4B8E, 0x4B90, 0x4B93, 0x4B95, 0x4B97, 0x4B9A, 0x4B9C, 0x4B9E,
+  0x4BA1, 0x4BA3, 0x4BA5, 0x4BA8, 0x4BAA, 0x4BAC, 0x4BAF, 0x4BB1, 0x4BB3, 0x4BB6, 0x4BB8, 0x4BBA,
+  0x4BBD, 0x4BBF, 0x4BC1, 0x4BC4, 0x4BC6, 0x4BC8, 0x4BCB, 0x4BCD, 0x4BCF, 0x4BD2, 0x4BD4, 0x4BD6,
+  0x4BD9, 0x4BDB, 0x4BDD, 0x4BE0, 0x4BE2, 0x4BE4, 0x4BE7, 0x4BE9, 0x4BEB, 0x4BEE, 0x4BF0, 0x4BF2,
+  0x4BF5, 0x4BF7, 0x4BF9, 0x4BFC, 0x4BFE, 0x4C00, 0x4C03, 0x4C05, 0x4C07, 0x4C0A, 0x4C0C, 0x4C0E,
+  0x4C11, 0x4C13, 0x4C15, 0x4C18, 0x4C1A, 0x4C1C, 0x4C1F, 0x4C21, 0x4C23, 0x4C26, 0x4C28, 0x4C2A,
+  0x4C2D, 0x4C2F, 0x4C31, 0x4C34, 0x4C36, 0x4C38, 0x4C3B, 0x4C3D, 0x4C3F, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D80, 0x4D83, 0x4D85, 0x4D87,
+  0x4D8A, 0x4D8C, 0x4D8E, 0x4D91, 0x4D93, 0x4D95, 0x4D98, 0x4D9A, 0x4D9D, 0x4D9F, 0x4DA1, 0x4DA4,
+  0x4DA6, 0x4DA8, 0x4DAB, 0x4DAD, 0x4DAF, 0x4DB2, 0x4DB4, 0x4DB7, 0x4DB9, 0x4DBB, 0x4DBE, 0x4DC0,
+  0x4DC2, 0x4DC5, 0x4DC7, 0x4DC9, 0x4DCC, 0x4DCE, 0x4DD0, 0x4DD3, 0x4DD5, 0x4DD8, 0x4DDA, 0x4DDC,
+  0x4DDF, 0x4DE1, 0x4DE3, 0x4DE6, 0x4DE8, 0x4DEA, 0x4DED, 0x4DEF, 0x4DF1, 0x4DF4, 0x4DF6, 0x4DF9,
+  0x4DFB, 0x4DFD, 0x4E00, 0x4E02, 0x4E04, 0x4E07, 0x4E09, 0x4E0B, 0x4E0E, 0x4E10, 0x4E13, 0x4E15,
+  0x4E17, 0x4E1A, 0x4E1C, 0x4E1E, 0x4E21, 0x4E23, 0x4E25, 0x4E28, 0x4E2A, 0x4E2C, 0x4E2F, 0x4E31,
+  0x4E34, 0x4E36, 0x4E38, 0x4E3B, 0x4E3D, 0x4E3F, 0x4E42, 0x4E44, 0x4E46, 0x4E49, 0x4E4B, 0x4E4E,
+  0x4E50, 0x4E52, 0x4E55, 0x4E57, 0x4E59, 0x4E5C, 0x4E5E, 0x4E60, 0x4E63, 0x4E65, 0x4E67, 0x4E6A,
+  0x4E6C, 0x4E6F, 0x4E71, 0x4E73, 0x4E76, 0x4E78, 0x4E7A, 0x4E7D, 0x4E7F, 0x4E81, 0x4E84, 0x4E86,
+  0x4E88, 0x4E8B, 0x4E8D, 0x4E90, 0x4E92, 0x4E94, 0x4E97, 0x4E99, 0x4E9B, 0x4E9E, 0x4EA0, 0x4EA2,
+  0x4EA5, 0x4EA7, 0x4EAA, 0x4EAC, 0x4EAE, 0x4EB1, 0x4EB3, 0x4EB5, 0x4EB8, 0x4EBA, 0x4EBC, 0x4EBF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x4EC1, 0x4EC3, 0x4EC6, 0x4EC8, 0x4ECB, 0x4ECD, 0x4ECF, 0x4ED2, 0x4ED4, 0x4ED6, 0x4ED9,
+  0x4EDB, 0x4EDE, 0x4EE0, 0x4EE2, 0x4EE5, 0x4EE7, 0x4EEA, 0x4EEC, 0x4EEE, 0x4EF1, 0x4EF3, 0x4EF5,
+  0x4EF8, 0x4EFA, 0x4EFD, 0x4EFF, 0x4F01, 0x4F04, 0x4F06, 0x4F08, 0x4F0B, 0x4F0D, 0x4F10, 0x4F12,
+  0x4F14, 0x4F17, 0x4F19, 0x4F1C, 0x4F1E, 0x4F20, 0x4F23, 0x4F25, 0x4F27, 0x4F2A, 0x4F2C, 0x4F2F,
+  0x4F31, 0x4F33, 0x4F36, 0x4F38, 0x4F3B, 0x4F3D, 0x4F3F, 0x4F42, 0x4F44, 0x4F46, 0x4F49, 0x4F4B,
+  0x4F4E, 0x4F50, 0x4F52, 0x4F55, 0x4F57, 0x4F5A, 0x4F5C, 0x4F5E, 0x4F61, 0x4F63, 0x4F65, 0x4F68,
+  0x4F6A, 0x4F6D, 0x4F6F, 0x4F71, 0x4F74, 0x4F76, 0x4F79, 0x4F7B, 0x4F7D, 0x4F80, 0x4F82, 0x4F84,
+  0x4F87, 0x4F89, 0x4F8C, 0x4F8E, 0x4F90, 0x4F93, 0x4F95, 0x4F98, 0x4F9A, 0x4F9C, 0x4F9F, 0x4FA1,
+  0x4FA3, 0x4FA6, 0x4FA8, 0x4FAB, 0x4FAD, 0x4FAF, 0x4FB2, 0x4FB4, 0x4FB7, 0x4FB9, 0x4FBB, 0x4FBE,
+  0x4FC0, 0x4FC2, 0x4FC5, 0x4FC7, 0x4FCA, 0x4FCC, 0x4FCE, 0x4FD1, 0x4FD3, 0x4FD5, 0x4FD8, 0x4FDA,
+  0x4FDD, 0x4FDF, 0x4FE1, 0x4FE4, 0x4FE6, 0x4FE9, 0x4FEB, 0x4FED, 0x4FF0, 0x4FF2, 0x4FF4, 0x4FF7,
+  0x4FF9, 0x4FFC, 0x4FFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5002, 0x5004, 0x5007, 0x5009, 0x500B, 0x500E,
+  0x5010, 0x5013, 0x5015, 0x5017, 0x501A, 0x501C, 0x501F, 0x5021, 0x5023, 0x5026, 0x5028, 0x502B,
+  0x502D, 0x502F, 0x5032, 0x5034, 0x5037, 0x5039, 0x503C, 0x503E, 0x5040, 0x5043, 0x5045, 0x5048,
+  0x504A, 0x504C, 0x504F, 0x5051, 0x5054, 0x5056, 0x5058, 0x505B, 0x505D, 0x5060, 0x5062, 0x5064,
+  0x5067, 0x5069, 0x506C, 0x506E, 0x5071, 0x5073, 0x5075, 0x5078, 0x507A, 0x507D, 0x507F, 0x5081,
+  0x5084, 0x5086, 0x5089, 0x508B, 0x508D, 0x5090, 0x5092, 0x5095, 0x5097, 0x5099, 0x509C, 0x509E,
+  0x50A1, 0x50A3, 0x50A6, 0x50A8, 0x50AA, 0x50AD, 0x50AF, 0x50B2, 0x50B4, 0x50B6, 0x50B9, 0x50BB,
+  0x50BE, 0x50C0, 0x50C2, 0x50C5, 0x50C7, 0x50CA, 0x50CC, 0x50CE, 0x50D1, 0x50D3, 0x50D6, 0x50D8,
+  0x50DB, 0x50DD, 0x50DF, 0x50E2, 0x50E4, 0x50E7, 0x50E9, 0x50EB, 0x50EE, 0x50F0, 0x50F3, 0x50F5,
+  0x50F7, 0x50FA, 0x50FC, 0x50FF, 0x5101, 0x5103, 0x5106, 0x5108, 0x510B, 0x510D, 0x5110, 0x5112,
+  0x5114, 0x5117, 0x5119, 0x511C, 0x511E, 0x5120, 0x5123, 0x5125, 0x5128, 0x512A, 0x512C, 0x512F,
+  0x5131, 0x5134, 0x5136, 0x5138, 0x513B, 0x513D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5140, 0x5142,
+  0x5145, 0x5147, 0x514A, 0x514C, 0x514F, 0x5151, 0x5154, 0x5156, 0x5158, 0x515B, 0x515D, 0x5160,
+  0x5162, 0x5165, 0x5167, 0x5169, 0x516C, 0x516E, 0x5171, 0x5173, 0x5176, 0x5178, 0x517A, 0x517D,
+  0x517F, 0x5182, 0x5184, 0x5187, 0x5189, 0x518C, 0x518E, 0x5190, 0x5193, 0x5195, 0x5198, 0x519A,
+  0x519D, 0x519F, 0x51A1, 0x51A4, 0x51A6, 0x51A9, 0x51AB, 0x51AE, 0x51B0, 0x51B2, 0x51B5, 0x51B7,
+  0x51BA, 0x51BC, 0x51BF, 0x51C1, 0x51C4, 0x51C6, 0x51C8, 0x51CB, 0x51CD, 0x51D0, 0x51D2, 0x51D5,
+  0x51D7, 0x51D9, 0x51DC, 0x51DE, 0x51E1, 0x51E3, 0x51E6, 0x51E8, 0x51EA, 0x51ED, 0x51EF, 0x51F2,
+  0x51F4, 0x51F7, 0x51F9, 0x51FB, 0x51FE, 0x5200, 0x5203, 0x5205, 0x5208, 0x520A, 0x520D, 0x520F,
+  0x5211, 0x5214, 0x5216, 0x5219, 0x521B, 0x521E, 0x5220, 0x5222, 0x5225, 0x5227, 0x522A, 0x522C,
+  0x522F, 0x5231, 0x5233, 0x5236, 0x5238, 0x523B, 0x523D, 0x5240, 0x5242, 0x5245, 0x5247, 0x5249,
+  0x524C, 0x524E, 0x5251, 0x5253, 0x5256, 0x5258, 0x525A, 0x525D, 0x525F, 0x5262, 0x5264, 0x5267,
+  0x5269, 0x526B, 0x526E, 0x5270, 0x5273, 0x5275, 0x5278, 0x527A, 0x527D, 0x527F, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x53C1, 0x53C3, 0x53C6, 0x53C8, 0x53CB, 0x53CD, 0x53D0, 0x53D2, 0x53D4,
+  0x53D7, 0x53D9, 0x53DC, 0x53DE, 0x53E1, 0x53E3, 0x53E6, 0x53E8, 0x53EB, 0x53ED, 0x53F0, 0x53F2,
+  0x53F4, 0x53F7, 0x53F9, 0x53FC, 0x53FE, 0x5401, 0x5403, 0x5406, 0x5408, 0x540B, 0x540D, 0x5410,
+  0x5412, 0x5414, 0x5417, 0x5419, 0x541C, 0x541E, 0x5421, 0x5423, 0x5426, 0x5428, 0x542B, 0x542D,
+  0x5430, 0x5432, 0x5434, 0x5437, 0x5439, 0x543C, 0x543E, 0x5441, 0x5443, 0x5446, 0x5448, 0x544B,
+  0x544D, 0x5450, 0x5452, 0x5454, 0x5457, 0x5459, 0x545C, 0x545E, 0x5461, 0x5463, 0x5466, 0x5468,
+  0x546B, 0x546D, 0x546F, 0x5472, 0x5474, 0x5477, 0x5479, 0x547C, 0x547E, 0x5481, 0x5483, 0x5486,
+  0x5488, 0x548B, 0x548D, 0x548F, 0x5492, 0x5494, 0x5497, 0x5499, 0x549C, 0x549E, 0x54A1, 0x54A3,
+  0x54A6, 0x54A8, 0x54AB, 0x54AD, 0x54AF, 0x54B2, 0x54B4, 0x54B7, 0x54B9, 0x54BC, 0x54BE, 0x54C1,
+  0x54C3, 0x54C6, 0x54C8, 0x54CB, 0x54CD, 0x54CF, 0x54D2, 0x54D4, 0x54D7, 0x54D9, 0x54DC, 0x54DE,
+  0x54E1, 0x54E3, 0x54E6, 0x54E8, 0x54EB, 0x54ED, 0x54EF, 0x54F2, 0x54F4, 0x54F7, 0x54F9, 0x54FC,
+  0x54FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5502, 0x5504, 0x5507, 0x5509,
+  0x550B, 0x550E, 0x5510, 0x5513, 0x5515, 0x5518, 0x551A, 0x551D, 0x551F, 0x5522, 0x5524, 0x5527,
+  0x5529, 0x552C, 0x552E, 0x5531, 0x5533, 0x5536, 0x5538, 0x553B, 0x553D, 0x5540, 0x5542, 0x5545,
+  0x5547, 0x554A, 0x554C, 0x554F, 0x5551, 0x5554, 0x5556, 0x5559, 0x555B, 0x555E, 0x5560, 0x5563,
+  0x5565, 0x5568, 0x556A, 0x556D, 0x556F, 0x5571, 0x5574, 0x5576, 0x5579, 0x557B, 0x557E, 0x5580,
+  0x5583, 0x5585, 0x5588, 0x558A, 0x558D, 0x558F, 0x5592, 0x5594, 0x5597, 0x5599, 0x559C, 0x559E,
+  0x55A1, 0x55A3, 0x55A6, 0x55A8, 0x55AB, 0x55AD, 0x55B0, 0x55B2, 0x55B5, 0x55B7, 0x55BA, 0x55BC,
+  0x55BF, 0x55C1, 0x55C4, 0x55C6, 0x55C9, 0x55CB, 0x55CE, 0x55D0, 0x55D2, 0x55D5, 0x55D7, 0x55DA,
+  0x55DC, 0x55DF, 0x55E1, 0x55E4, 0x55E6, 0x55E9, 0x55EB, 0x55EE, 0x55F0, 0x55F3, 0x55F5, 0x55F8,
+  0x55FA, 0x55FD, 0x55FF, 0x5602, 0x5604, 0x5607, 0x5609, 0x560C, 0x560E, 0x5611, 0x5613, 0x5616,
+  0x5618, 0x561B, 0x561D, 0x5620, 0x5622, 0x5625, 0x5627, 0x562A, 0x562C, 0x562F, 0x5631, 0x5634,
+  0x5636, 0x5638, 0x563B, 0x563D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x5640, 0x5642, 0x5645, 0x5647, 0x564A, 0x564C, 0x564F, 0x5651, 0x5654, 0x5656, 0x5659, 0x565B,
+  0x565E, 0x5660, 0x5663, 0x5666, 0x5668, 0x566B, 0x566D, 0x5670, 0x5672, 0x5675, 0x5677, 0x567A,
+  0x567C, 0x567F, 0x5681, 0x5684, 0x5686, 0x5689, 0x568B, 0x568E, 0x5690, 0x5693, 0x5695, 0x5698,
+  0x569A, 0x569D, 0x569F, 0x56A2, 0x56A4, 0x56A7, 0x56A9, 0x56AC, 0x56AE, 0x56B1, 0x56B3, 0x56B6,
+  0x56B9, 0x56BB, 0x56BE, 0x56C0, 0x56C3, 0x56C5, 0x56C8, 0x56CA, 0x56CD, 0x56CF, 0x56D2, 0x56D4,
+  0x56D7, 0x56D9, 0x56DC, 0x56DE, 0x56E1, 0x56E3, 0x56E6, 0x56E8, 0x56EB, 0x56ED, 0x56F0, 0x56F2,
+  0x56F5, 0x56F7, 0x56FA, 0x56FC, 0x56FF, 0x5701, 0x5704, 0x5706, 0x5709, 0x570C, 0x570E, 0x5711,
+  0x5713, 0x5716, 0x5718, 0x571B, 0x571D, 0x5720, 0x5722, 0x5725, 0x5727, 0x572A, 0x572C, 0x572F,
+  0x5731, 0x5734, 0x5736, 0x5739, 0x573B, 0x573E, 0x5740, 0x5743, 0x5745, 0x5748, 0x574A, 0x574D,
+  0x574F, 0x5752, 0x5754, 0x5757, 0x5759, 0x575C, 0x575F, 0x5761, 0x5764, 0x5766, 0x5769, 0x576B,
+  0x576E, 0x5770, 0x5773, 0x5775, 0x5778, 0x577A, 0x577D, 0x577F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58C1, 0x58C3, 0x58C6, 0x58C8, 0x58CB, 0x58CD, 0x58D0,
+  0x58D2, 0x58D5, 0x58D7, 0x58DA, 0x58DD, 0x58DF, 0x58E2, 0x58E4, 0x58E7, 0x58E9, 0x58EC, 0x58EE,
+  0x58F1, 0x58F3, 0x58F6, 0x58F9, 0x58FB, 0x58FE, 0x5900, 0x5903, 0x5905, 0x5908, 0x590A, 0x590D,
+  0x590F, 0x5912, 0x5914, 0x5917, 0x591A, 0x591C, 0x591F, 0x5921, 0x5924, 0x5926, 0x5929, 0x592B,
+  0x592E, 0x5930, 0x5933, 0x5936, 0x5938, 0x593B, 0x593D, 0x5940, 0x5942, 0x5945, 0x5947, 0x594A,
+  0x594C, 0x594F, 0x5952, 0x5954, 0x5957, 0x5959, 0x595C, 0x595E, 0x5961, 0x5963, 0x5966, 0x5968,
+  0x596B, 0x596D, 0x5970, 0x5973, 0x5975, 0x5978, 0x597A, 0x597D, 0x597F, 0x5982, 0x5984, 0x5987,
+  0x5989, 0x598C, 0x598F, 0x5991, 0x5994, 0x5996, 0x5999, 0x599B, 0x599E, 0x59A0, 0x59A3, 0x59A5,
+  0x59A8, 0x59AB, 0x59AD, 0x59B0, 0x59B2, 0x59B5, 0x59B7, 0x59BA, 0x59BC, 0x59BF, 0x59C1, 0x59C4,
+  0x59C6, 0x59C9, 0x59CC, 0x59CE, 0x59D1, 0x59D3, 0x59D6, 0x59D8, 0x59DB, 0x59DD, 0x59E0, 0x59E2,
+  0x59E5, 0x59E8, 0x59EA, 0x59ED, 0x59EF, 0x59F2, 0x59F4, 0x59F7, 0x59F9, 0x59FC, 0x59FE, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A01, 0x5A04,
+  0x5A06, 0x5A09, 0x5A0C, 0x5A0E, 0x5A11, 0x5A13, 0x5A16, 0x5A18, 0x5A1B, 0x5A1E, 0x5A20, 0x5A23,
+  0x5A25, 0x5A28, 0x5A2A, 0x5A2D, 0x5A30, 0x5A32, 0x5A35, 0x5A37, 0x5A3A, 0x5A3C, 0x5A3F, 0x5A42,
+  0x5A44, 0x5A47, 0x5A49, 0x5A4C, 0x5A4E, 0x5A51, 0x5A54, 0x5A56, 0x5A59, 0x5A5B, 0x5A5E, 0x5A60,
+  0x5A63, 0x5A66, 0x5A68, 0x5A6B, 0x5A6D, 0x5A70, 0x5A72, 0x5A75, 0x5A78, 0x5A7A, 0x5A7D, 0x5A7F,
+  0x5A82, 0x5A84, 0x5A87, 0x5A8A, 0x5A8C, 0x5A8F, 0x5A91, 0x5A94, 0x5A96, 0x5A99, 0x5A9C, 0x5A9E,
+  0x5AA1, 0x5AA3, 0x5AA6, 0x5AA9, 0x5AAB, 0x5AAE, 0x5AB0, 0x5AB3, 0x5AB5, 0x5AB8, 0x5ABB, 0x5ABD,
+  0x5AC0, 0x5AC2, 0x5AC5, 0x5AC7, 0x5ACA, 0x5ACD, 0x5ACF, 0x5AD2, 0x5AD4, 0x5AD7, 0x5AD9, 0x5ADC,
+  0x5ADF, 0x5AE1, 0x5AE4, 0x5AE6, 0x5AE9, 0x5AEB, 0x5AEE, 0x5AF1, 0x5AF3, 0x5AF6, 0x5AF8, 0x5AFB,
+  0x5AFD, 0x5B00, 0x5B03, 0x5B05, 0x5B08, 0x5B0A, 0x5B0D, 0x5B0F, 0x5B12, 0x5B15, 0x5B17, 0x5B1A,
+  0x5B1C, 0x5B1F, 0x5B21, 0x5B24, 0x5B27, 0x5B29, 0x5B2C, 0x5B2E, 0x5B31, 0x5B33, 0x5B36, 0x5B39,
+  0x5B3B, 0x5B3E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x5B40, 0x5B42, 0x5B45, 0x5B47, 0x5B4A, 0x5B4D, 0x5B4F, 0x5B52, 0x5B54, 0x5B57,
+  0x5B5A, 0x5B5C, 0x5B5F, 0x5B61, 0x5B64, 0x5B67, 0x5B69, 0x5B6C, 0x5B6E, 0x5B71, 0x5B74, 0x5B76,
+  0x5B79, 0x5B7B, 0x5B7E, 0x5B81, 0x5B83, 0x5B86, 0x5B88, 0x5B8B, 0x5B8E, 0x5B90, 0x5B93, 0x5B95,
+  0x5B98, 0x5B9B, 0x5B9D, 0x5BA0, 0x5BA2, 0x5BA5, 0x5BA8, 0x5BAA, 0x5BAD, 0x5BAF, 0x5BB2, 0x5BB5,
+  0x5BB7, 0x5BBA, 0x5BBC, 0x5BBF, 0x5BC2, 0x5BC4, 0x5BC7, 0x5BC9, 0x5BCC, 0x5BCF, 0x5BD1, 0x5BD4,
+  0x5BD6, 0x5BD9, 0x5BDC, 0x5BDE, 0x5BE1, 0x5BE3, 0x5BE6, 0x5BE9, 0x5BEB, 0x5BEE, 0x5BF0, 0x5BF3,
+  0x5BF6, 0x5BF8, 0x5BFB, 0x5BFD, 0x5C00, 0x5C03, 0x5C05, 0x5C08, 0x5C0A, 0x5C0D, 0x5C10, 0x5C12,
+  0x5C15, 0x5C17, 0x5C1A, 0x5C1D, 0x5C1F, 0x5C22, 0x5C24, 0x5C27, 0x5C2A, 0x5C2C, 0x5C2F, 0x5C31,
+  0x5C34, 0x5C37, 0x5C39, 0x5C3C, 0x5C3E, 0x5C41, 0x5C44, 0x5C46, 0x5C49, 0x5C4B, 0x5C4E, 0x5C51,
+  0x5C53, 0x5C56, 0x5C58, 0x5C5B, 0x5C5E, 0x5C60, 0x5C63, 0x5C65, 0x5C68, 0x5C6B, 0x5C6D, 0x5C70,
+  0x5C72, 0x5C75, 0x5C78, 0x5C7A, 0x5C7D, 0x5C7F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DC0, 0x5DC3, 0x5DC6, 0x5DC8, 0x5DCB,
+  0x5DCD, 0x5DD0, 0x5DD3, 0x5DD5, 0x5DD8, 0x5DDB, 0x5DDD, 0x5DE0, 0x5DE3, 0x5DE5, 0x5DE8, 0x5DEA,
+  0x5DED, 0x5DF0, 0x5DF2, 0x5DF5, 0x5DF8, 0x5DFA, 0x5DFD, 0x5DFF, 0x5E02, 0x5E05, 0x5E07, 0x5E0A,
+  0x5E0D, 0x5E0F, 0x5E12, 0x5E15, 0x5E17, 0x5E1A, 0x5E1C, 0x5E1F, 0x5E22, 0x5E24, 0x5E27, 0x5E2A,
+  0x5E2C, 0x5E2F, 0x5E31, 0x5E34, 0x5E37, 0x5E39, 0x5E3C, 0x5E3F, 0x5E41, 0x5E44, 0x5E47, 0x5E49,
+  0x5E4C, 0x5E4E, 0x5E51, 0x5E54, 0x5E56, 0x5E59, 0x5E5C, 0x5E5E, 0x5E61, 0x5E63, 0x5E66, 0x5E69,
+  0x5E6B, 0x5E6E, 0x5E71, 0x5E73, 0x5E76, 0x5E78, 0x5E7B, 0x5E7E, 0x5E80, 0x5E83, 0x5E86, 0x5E88,
+  0x5E8B, 0x5E8E, 0x5E90, 0x5E93, 0x5E95, 0x5E98, 0x5E9B, 0x5E9D, 0x5EA0, 0x5EA3, 0x5EA5, 0x5EA8,
+  0x5EAA, 0x5EAD, 0x5EB0, 0x5EB2, 0x5EB5, 0x5EB8, 0x5EBA, 0x5EBD, 0x5EC0, 0x5EC2, 0x5EC5, 0x5EC7,
+  0x5ECA, 0x5ECD, 0x5ECF, 0x5ED2, 0x5ED5, 0x5ED7, 0x5EDA, 0x5EDC, 0x5EDF, 0x5EE2, 0x5EE4, 0x5EE7,
+  0x5EEA, 0x5EEC, 0x5EEF, 0x5EF2, 0x5EF4, 0x5EF7, 0x5EF9, 0x5EFC, 0x5EFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x5F01, 0x5F04, 0x5F06, 0x5F09, 0x5F0C, 0x5F0E, 0x5F11, 0x5F14, 0x5F16, 0x5F19, 0x5F1C, 0x5F1E,
+  0x5F21, 0x5F24, 0x5F26, 0x5F29, 0x5F2C, 0x5F2E, 0x5F31, 0x5F34, 0x5F36, 0x5F39, 0x5F3C, 0x5F3E,
+  0x5F41, 0x5F44, 0x5F46, 0x5F49, 0x5F4C, 0x5F4E, 0x5F51, 0x5F54, 0x5F56, 0x5F59, 0x5F5C, 0x5F5E,
+  0x5F61, 0x5F64, 0x5F66, 0x5F69, 0x5F6C, 0x5F6E, 0x5F71, 0x5F74, 0x5F76, 0x5F79, 0x5F7C, 0x5F7E,
+  0x5F81, 0x5F84, 0x5F86, 0x5F89, 0x5F8C, 0x5F8E, 0x5F91, 0x5F94, 0x5F96, 0x5F99, 0x5F9C, 0x5F9E,
+  0x5FA1, 0x5FA3, 0x5FA6, 0x5FA9, 0x5FAB, 0x5FAE, 0x5FB1, 0x5FB3, 0x5FB6, 0x5FB9, 0x5FBB, 0x5FBE,
+  0x5FC1, 0x5FC3, 0x5FC6, 0x5FC9, 0x5FCB, 0x5FCE, 0x5FD1, 0x5FD3, 0x5FD6, 0x5FD9, 0x5FDB, 0x5FDE,
+  0x5FE1, 0x5FE3, 0x5FE6, 0x5FE9, 0x5FEB, 0x5FEE, 0x5FF1, 0x5FF3, 0x5FF6, 0x5FF9, 0x5FFB, 0x5FFE,
+  0x6001, 0x6003, 0x6006, 0x6009, 0x600B, 0x600E, 0x6011, 0x6013, 0x6016, 0x6019, 0x601B, 0x601E,
+  0x6021, 0x6023, 0x6026, 0x6029, 0x602B, 0x602E, 0x6031, 0x6033, 0x6036, 0x6039, 0x603B, 0x603E,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6182, 0x6185, 0x6187, 0x618A, 0x618D, 0x618F, 0x6192,
+  0x6195, 0x6198, 0x619A, 0x619D, 0x61A0, 0x61A2, 0x61A5, 0x61A8, 0x61AA, 0x61AD, 0x61B0, 0x61B2,
+  0x61B5, 0x61B8, 0x61BB, 0x61BD, 0x61C0, 0x61C3, 0x61C5, 0x61C8, 0x61CB, 0x61CD, 0x61D0, 0x61D3,
+  0x61D5, 0x61D8, 0x61DB, 0x61DE, 0x61E0, 0x61E3, 0x61E6, 0x61E8, 0x61EB, 0x61EE, 0x61F0, 0x61F3,
+  0x61F6, 0x61F8, 0x61FB, 0x61FE, 0x6201, 0x6203, 0x6206, 0x6209, 0x620B, 0x620E, 0x6211, 0x6213,
+  0x6216, 0x6219, 0x621B, 0x621E, 0x6221, 0x6224, 0x6226, 0x6229, 0x622C, 0x622E, 0x6231, 0x6234,
+  0x6236, 0x6239, 0x623C, 0x623E, 0x6241, 0x6244, 0x6247, 0x6249, 0x624C, 0x624F, 0x6251, 0x6254,
+  0x6257, 0x6259, 0x625C, 0x625F, 0x6261, 0x6264, 0x6267, 0x626A, 0x626C, 0x626F, 0x6272, 0x6274,
+  0x6277, 0x627A, 0x627C, 0x627F, 0x6282, 0x6284, 0x6287, 0x628A, 0x628D, 0x628F, 0x6292, 0x6295,
+  0x6297, 0x629A, 0x629D, 0x629F, 0x62A2, 0x62A5, 0x62A7, 0x62AA, 0x62AD, 0x62B0, 0x62B2, 0x62B5,
+  0x62B8, 0x62BA, 0x62BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62C0, 0x62C3, 0x62C6,
+  0x62C8, 0x62CB, 0x62CE, 0x62D0, 0x62D3, 0x62D6, 0x62D9, 0x62DB, 0x62DE, 0x62E1, 0x62E4, 0x62E6,
+  0x62E9, 0x62EC, 0x62EE, 0x62F1, 0x62F4, 0x62F7, 0x62F9, 0x62FC, 0x62FF, 0x6301, 0x6304, 0x6307,
+  0x630A, 0x630C, 0x630F, 0x6312, 0x6315, 0x6317, 0x631A, 0x631D, 0x631F, 0x6322, 0x6325, 0x6328,
+  0x632A, 0x632D, 0x6330, 0x6333, 0x6335, 0x6338, 0x633B, 0x633D, 0x6340, 0x6343, 0x6346, 0x6348,
+  0x634B, 0x634E, 0x6351, 0x6353, 0x6356, 0x6359, 0x635B, 0x635E, 0x6361, 0x6364, 0x6366, 0x6369,
+  0x636C, 0x636E, 0x6371, 0x6374, 0x6377, 0x6379, 0x637C, 0x637F, 0x6382, 0x6384, 0x6387, 0x638A,
+  0x638C, 0x638F, 0x6392, 0x6395, 0x6397, 0x639A, 0x639D, 0x63A0, 0x63A2, 0x63A5, 0x63A8, 0x63AA,
+  0x63AD, 0x63B0, 0x63B3, 0x63B5, 0x63B8, 0x63BB, 0x63BE, 0x63C0, 0x63C3, 0x63C6, 0x63C8, 0x63CB,
+  0x63CE, 0x63D1, 0x63D3, 0x63D6, 0x63D9, 0x63DB, 0x63DE, 0x63E1, 0x63E4, 0x63E6, 0x63E9, 0x63EC,
+  0x63EF, 0x63F1, 0x63F4, 0x63F7, 0x63F9, 0x63FC, 0x63FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x6541, 0x6544, 0x6546, 0x6549, 0x654C, 0x654F, 0x6551, 0x6554, 0x6557, 0x655A,
+  0x655D, 0x655F, 0x6562, 0x6565, 0x6568, 0x656A, 0x656D, 0x6570, 0x6573, 0x6575, 0x6578, 0x657B,
+  0x657E, 0x6580, 0x6583, 0x6586, 0x6589, 0x658B, 0x658E, 0x6591, 0x6594, 0x6596, 0x6599, 0x659C,
+  0x659F, 0x65A1, 0x65A4, 0x65A7, 0x65AA, 0x65AC, 0x65AF, 0x65B2, 0x65B5, 0x65B8, 0x65BA, 0x65BD,
+  0x65C0, 0x65C3, 0x65C5, 0x65C8, 0x65CB, 0x65CE, 0x65D0, 0x65D3, 0x65D6, 0x65D9, 0x65DB, 0x65DE,
+  0x65E1, 0x65E4, 0x65E6, 0x65E9, 0x65EC, 0x65EF, 0x65F1, 0x65F4, 0x65F7, 0x65FA, 0x65FC, 0x65FF,
+  0x6602, 0x6605, 0x6607, 0x660A, 0x660D, 0x6610, 0x6613, 0x6615, 0x6618, 0x661B, 0x661E, 0x6620,
+  0x6623, 0x6626, 0x6629, 0x662B, 0x662E, 0x6631, 0x6634, 0x6636, 0x6639, 0x663C, 0x663F, 0x6641,
+  0x6644, 0x6647, 0x664A, 0x664C, 0x664F, 0x6652, 0x6655, 0x6657, 0x665A, 0x665D, 0x6660, 0x6662,
+  0x6665, 0x6668, 0x666B, 0x666E, 0x6670, 0x6673, 0x6676, 0x6679, 0x667B, 0x667E, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67C2, 0x67C5, 0x67C7, 0x67CA, 0x67CD,
+  0x67D0, 0x67D3, 0x67D5, 0x67D8, 0x67DB, 0x67DE, 0x67E0, 0x67E3, 0x67E6, 0x67E9, 0x67EC, 0x67EE,
+  0x67F1, 0x67F4, 0x67F7, 0x67FA, 0x67FC, 0x67FF, 0x6802, 0x6805, 0x6808, 0x680A, 0x680D, 0x6810,
+  0x6813, 0x6816, 0x6818, 0x681B, 0x681E, 0x6821, 0x6823, 0x6826, 0x6829, 0x682C, 0x682F, 0x6831,
+  0x6834, 0x6837, 0x683A, 0x683D, 0x683F, 0x6842, 0x6845, 0x6848, 0x684B, 0x684D, 0x6850, 0x6853,
+  0x6856, 0x6859, 0x685B, 0x685E, 0x6861, 0x6864, 0x6866, 0x6869, 0x686C, 0x686F, 0x6872, 0x6874,
+  0x6877, 0x687A, 0x687D, 0x6880, 0x6882, 0x6885, 0x6888, 0x688B, 0x688E, 0x6890, 0x6893, 0x6896,
+  0x6899, 0x689C, 0x689E, 0x68A1, 0x68A4, 0x68A7, 0x68A9, 0x68AC, 0x68AF, 0x68B2, 0x68B5, 0x68B7,
+  0x68BA, 0x68BD, 0x68C0, 0x68C3, 0x68C5, 0x68C8, 0x68CB, 0x68CE, 0x68D1, 0x68D3, 0x68D6, 0x68D9,
+  0x68DC, 0x68DF, 0x68E1, 0x68E4, 0x68E7, 0x68EA, 0x68EC, 0x68EF, 0x68F2, 0x68F5, 0x68F8, 0x68FA,
+  0x68FD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6900,
+  0x6903, 0x6905, 0x6908, 0x690B, 0x690E, 0x6911, 0x6914, 0x6916, 0x6919, 0x691C, 0x691F, 0x6922,
+  0x6925, 0x6927, 0x692A, 0x692D, 0x6930, 0x6933, 0x6936, 0x6938, 0x693B, 0x693E, 0x6941, 0x6944,
+  0x6946, 0x6949, 0x694C, 0x694F, 0x6952, 0x6955, 0x6957, 0x695A, 0x695D, 0x6960, 0x6963, 0x6966,
+  0x6968, 0x696B, 0x696E, 0x6971, 0x6974, 0x6977, 0x6979, 0x697C, 0x697F, 0x6982, 0x6985, 0x6987,
+  0x698A, 0x698D, 0x6990, 0x6993, 0x6996, 0x6998, 0x699B, 0x699E, 0x69A1, 0x69A4, 0x69A7, 0x69A9,
+  0x69AC, 0x69AF, 0x69B2, 0x69B5, 0x69B8, 0x69BA, 0x69BD, 0x69C0, 0x69C3, 0x69C6, 0x69C8, 0x69CB,
+  0x69CE, 0x69D1, 0x69D4, 0x69D7, 0x69D9, 0x69DC, 0x69DF, 0x69E2, 0x69E5, 0x69E8, 0x69EA, 0x69ED,
+  0x69F0, 0x69F3, 0x69F6, 0x69F9, 0x69FB, 0x69FE, 0x6A01, 0x6A04, 0x6A07, 0x6A09, 0x6A0C, 0x6A0F,
+  0x6A12, 0x6A15, 0x6A18, 0x6A1A, 0x6A1D, 0x6A20, 0x6A23, 0x6A26, 0x6A29, 0x6A2B, 0x6A2E, 0x6A31,
+  0x6A34, 0x6A37, 0x6A3A, 0x6A3C, 0x6A3F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B81, 0x6B84, 0x6B86, 0x6B89, 0x6B8C, 0x6B8F, 0x6B92, 0x6B95,
+  0x6B98, 0x6B9A, 0x6B9D, 0x6BA0, 0x6BA3, 0x6BA6, 0x6BA9, 0x6BAC, 0x6BAE, 0x6BB1, 0x6BB4, 0x6BB7,
+  0x6BBA, 0x6BBD, 0x6BC0, 0x6BC3, 0x6BC5, 0x6BC8, 0x6BCB, 0x6BCE, 0x6BD1, 0x6BD4, 0x6BD7, 0x6BD9,
+  0x6BDC, 0x6BDF, 0x6BE2, 0x6BE5, 0x6BE8, 0x6BEB, 0x6BED, 0x6BF0, 0x6BF3, 0x6BF6, 0x6BF9, 0x6BFC,
+  0x6BFF, 0x6C01, 0x6C04, 0x6C07, 0x6C0A, 0x6C0D, 0x6C10, 0x6C13, 0x6C15, 0x6C18, 0x6C1B, 0x6C1E,
+  0x6C21, 0x6C24, 0x6C27, 0x6C2A, 0x6C2C, 0x6C2F, 0x6C32, 0x6C35, 0x6C38, 0x6C3B, 0x6C3E, 0x6C40,
+  0x6C43, 0x6C46, 0x6C49, 0x6C4C, 0x6C4F, 0x6C52, 0x6C54, 0x6C57, 0x6C5A, 0x6C5D, 0x6C60, 0x6C63,
+  0x6C66, 0x6C68, 0x6C6B, 0x6C6E, 0x6C71, 0x6C74, 0x6C77, 0x6C7A, 0x6C7C, 0x6C7F, 0x6C82, 0x6C85,
+  0x6C88, 0x6C8B, 0x6C8E, 0x6C91, 0x6C93, 0x6C96, 0x6C99, 0x6C9C, 0x6C9F, 0x6CA2, 0x6CA5, 0x6CA7,
+  0x6CAA, 0x6CAD, 0x6CB0, 0x6CB3, 0x6CB6, 0x6CB9, 0x6CBB, 0x6CBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6E02, 0x6E04, 0x6E07,
+  0x6E0A, 0x6E0D, 0x6E10, 0x6E13, 0x6E16, 0x6E19, 0x6E1C, 0x6E1F, 0x6E21, 0x6E24, 0x6E27, 0x6E2A,
+  0x6E2D, 0x6E30, 0x6E33, 0x6E36, 0x6E39, 0x6E3C, 0x6E3E, 0x6E41, 0x6E44, 0x6E47, 0x6E4A, 0x6E4D,
+  0x6E50, 0x6E53, 0x6E56, 0x6E59, 0x6E5B, 0x6E5E, 0x6E61, 0x6E64, 0x6E67, 0x6E6A, 0x6E6D, 0x6E70,
+  0x6E73, 0x6E75, 0x6E78, 0x6E7B, 0x6E7E, 0x6E81, 0x6E84, 0x6E87, 0x6E8A, 0x6E8D, 0x6E90, 0x6E92,
+  0x6E95, 0x6E98, 0x6E9B, 0x6E9E, 0x6EA1, 0x6EA4, 0x6EA7, 0x6EAA, 0x6EAD, 0x6EAF, 0x6EB2, 0x6EB5,
+  0x6EB8, 0x6EBB, 0x6EBE, 0x6EC1, 0x6EC4, 0x6EC7, 0x6ECA, 0x6ECC, 0x6ECF, 0x6ED2, 0x6ED5, 0x6ED8,
+  0x6EDB, 0x6EDE, 0x6EE1, 0x6EE4, 0x6EE6, 0x6EE9, 0x6EEC, 0x6EEF, 0x6EF2, 0x6EF5, 0x6EF8, 0x6EFB,
+  0x6EFE, 0x6F01, 0x6F03, 0x6F06, 0x6F09, 0x6F0C, 0x6F0F, 0x6F12, 0x6F15, 0x6F18, 0x6F1B, 0x6F1E,
+  0x6F20, 0x6F23, 0x6F26, 0x6F29, 0x6F2C, 0x6F2F, 0x6F32, 0x6F35, 0x6F38, 0x6F3B, 0x6F3D, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x7080, 0x7082, 0x7085, 0x7088, 0x708B, 0x708E, 0x7091, 0x7094, 0x7097, 0x709A, 0x709D,
+  0x70A0, 0x70A3, 0x70A6, 0x70A9, 0x70AC, 0x70AF, 0x70B1, 0x70B4, 0x70B7, 0x70BA, 0x70BD, 0x70C0,
+  0x70C3, 0x70C6, 0x70C9, 0x70CC, 0x70CF, 0x70D2, 0x70D5, 0x70D8, 0x70DB, 0x70DD, 0x70E0, 0x70E3,
+  0x70E6, 0x70E9, 0x70EC, 0x70EF, 0x70F2, 0x70F5, 0x70F8, 0x70FB, 0x70FE, 0x7101, 0x7104, 0x7107,
+  0x7109, 0x710C, 0x710F, 0x7112, 0x7115, 0x7118, 0x711B, 0x711E, 0x7121, 0x7124, 0x7127, 0x712A,
+  0x712D, 0x7130, 0x7133, 0x7136, 0x7138, 0x713B, 0x713E, 0x7141, 0x7144, 0x7147, 0x714A, 0x714D,
+  0x7150, 0x7153, 0x7156, 0x7159, 0x715C, 0x715F, 0x7162, 0x7164, 0x7167, 0x716A, 0x716D, 0x7170,
+  0x7173, 0x7176, 0x7179, 0x717C, 0x717F, 0x7182, 0x7185, 0x7188, 0x718B, 0x718E, 0x7190, 0x7193,
+  0x7196, 0x7199, 0x719C, 0x719F, 0x71A2, 0x71A5, 0x71A8, 0x71AB, 0x71AE, 0x71B1, 0x71B4, 0x71B7,
+  0x71BA, 0x71BD, 0x71BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7300, 0x7303, 0x7306, 0x7309, 0x730C, 0x730F,
+  0x7312, 0x7315, 0x7318, 0x731B, 0x731E, 0x7321, 0x7324, 0x7327, 0x732A, 0x732D, 0x7330, 0x7333,
+  0x7336, 0x7339, 0x733C, 0x733F, 0x7342, 0x7345, 0x7348, 0x734B, 0x734E, 0x7351, 0x7354, 0x7357,
+  0x735A, 0x735D, 0x7360, 0x7363, 0x7366, 0x7368, 0x736B, 0x736E, 0x7371, 0x7374, 0x7377, 0x737A,
+  0x737D, 0x7380, 0x7383, 0x7386, 0x7389, 0x738C, 0x738F, 0x7392, 0x7395, 0x7398, 0x739B, 0x739E,
+  0x73A1, 0x73A4, 0x73A7, 0x73AA, 0x73AD, 0x73B0, 0x73B3, 0x73B6, 0x73B9, 0x73BC, 0x73BF, 0x73C2,
+  0x73C5, 0x73C8, 0x73CB, 0x73CE, 0x73D1, 0x73D4, 0x73D7, 0x73D9, 0x73DC, 0x73DF, 0x73E2, 0x73E5,
+  0x73E8, 0x73EB, 0x73EE, 0x73F1, 0x73F4, 0x73F7, 0x73FA, 0x73FD, 0x7400, 0x7403, 0x7406, 0x7409,
+  0x740C, 0x740F, 0x7412, 0x7415, 0x7418, 0x741B, 0x741E, 0x7421, 0x7424, 0x7427, 0x742A, 0x742D,
+  0x7430, 0x7433, 0x7436, 0x7439, 0x743C, 0x743F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7441,
+  0x7444, 0x7447, 0x744A, 0x744D, 0x7450, 0x7453, 0x7456, 0x7459, 0x745C, 0x745F, 0x7462, 0x7466,
+  0x7469, 0x746C, 0x746F, 0x7472, 0x7475, 0x7478, 0x747B, 0x747E, 0x7481, 0x7484, 0x7487, 0x748A,
+  0x748D, 0x7490, 0x7493, 0x7496, 0x7499, 0x749C, 0x749F, 0x74A2, 0x74A5, 0x74A8, 0x74AB, 0x74AE,
+  0x74B1, 0x74B4, 0x74B7, 0x74BA, 0x74BD, 0x74C0, 0x74C3, 0x74C6, 0x74C9, 0x74CC, 0x74CF, 0x74D2,
+  0x74D5, 0x74D8, 0x74DB, 0x74DE, 0x74E1, 0x74E4, 0x74E7, 0x74EA, 0x74ED, 0x74F0, 0x74F3, 0x74F6,
+  0x74F9, 0x74FC, 0x74FF, 0x7502, 0x7505, 0x7508, 0x750B, 0x750E, 0x7511, 0x7514, 0x7517, 0x751A,
+  0x751D, 0x7520, 0x7523, 0x7526, 0x7529, 0x752C, 0x752F, 0x7532, 0x7535, 0x7538, 0x753B, 0x753E,
+  0x7541, 0x7544, 0x7547, 0x754A, 0x754D, 0x7550, 0x7553, 0x7556, 0x7559, 0x755D, 0x7560, 0x7563,
+  0x7566, 0x7569, 0x756C, 0x756F, 0x7572, 0x7575, 0x7578, 0x757B, 0x757E, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x76C2, 0x76C5, 0x76C8, 0x76CB, 0x76CF, 0x76D2, 0x76D5, 0x76D8,
+  0x76DB, 0x76DE, 0x76E1, 0x76E4, 0x76E7, 0x76EA, 0x76ED, 0x76F0, 0x76F3, 0x76F6, 0x76F9, 0x76FC,
+  0x76FF, 0x7702, 0x7705, 0x7709, 0x770C, 0x770F, 0x7712, 0x7715, 0x7718, 0x771B, 0x771E, 0x7721,
+  0x7724, 0x7727, 0x772A, 0x772D, 0x7730, 0x7733, 0x7736, 0x7739, 0x773C, 0x773F, 0x7743, 0x7746,
+  0x7749, 0x774C, 0x774F, 0x7752, 0x7755, 0x7758, 0x775B, 0x775E, 0x7761, 0x7764, 0x7767, 0x776A,
+  0x776D, 0x7770, 0x7773, 0x7776, 0x7779, 0x777C, 0x7780, 0x7783, 0x7786, 0x7789, 0x778C, 0x778F,
+  0x7792, 0x7795, 0x7798, 0x779B, 0x779E, 0x77A1, 0x77A4, 0x77A7, 0x77AA, 0x77AD, 0x77B0, 0x77B3,
+  0x77B6, 0x77BA, 0x77BD, 0x77C0, 0x77C3, 0x77C6, 0x77C9, 0x77CC, 0x77CF, 0x77D2, 0x77D5, 0x77D8,
+  0x77DB, 0x77DE, 0x77E1, 0x77E4, 0x77E7, 0x77EA, 0x77ED, 0x77F0, 0x77F4, 0x77F7, 0x77FA, 0x77FD,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7940, 0x7943, 0x7946, 0x7949,
+  0x794D, 0x7950, 0x7953, 0x7956, 0x7959, 0x795C, 0x795F, 0x7962, 0x7965, 0x7968, 0x796B, 0x796F,
+  0x7972, 0x7975, 0x7978, 0x797B, 0x797E, 0x7981, 0x7984, 0x7987, 0x798A, 0x798E, 0x7991, 0x7994,
+  0x7997, 0x799A, 0x799D, 0x79A0, 0x79A3, 0x79A6, 0x79A9, 0x79AC, 0x79B0, 0x79B3, 0x79B6, 0x79B9,
+  0x79BC, 0x79BF, 0x79C2, 0x79C5, 0x79C8, 0x79CB, 0x79CE, 0x79D2, 0x79D5, 0x79D8, 0x79DB, 0x79DE,
+  0x79E1, 0x79E4, 0x79E7, 0x79EA, 0x79ED, 0x79F1, 0x79F4, 0x79F7, 0x79FA, 0x79FD, 0x7A00, 0x7A03,
+  0x7A06, 0x7A09, 0x7A0C, 0x7A0F, 0x7A13, 0x7A16, 0x7A19, 0x7A1C, 0x7A1F, 0x7A22, 0x7A25, 0x7A28,
+  0x7A2B, 0x7A2E, 0x7A31, 0x7A35, 0x7A38, 0x7A3B, 0x7A3E, 0x7A41, 0x7A44, 0x7A47, 0x7A4A, 0x7A4D,
+  0x7A50, 0x7A54, 0x7A57, 0x7A5A, 0x7A5D, 0x7A60, 0x7A63, 0x7A66, 0x7A69, 0x7A6C, 0x7A6F, 0x7A72,
+  0x7A76, 0x7A79, 0x7A7C, 0x7A7F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x7BC1, 0x7BC4, 0x7BC7, 0x7BCB, 0x7BCE, 0x7BD1, 0x7BD4, 0x7BD7, 0x7BDA, 0x7BDD, 0x7BE0,
+  0x7BE4, 0x7BE7, 0x7BEA, 0x7BED, 0x7BF0, 0x7BF3, 0x7BF6, 0x7BFA, 0x7BFD, 0x7C00, 0x7C03, 0x7C06,
+  0x7C09, 0x7C0C, 0x7C10, 0x7C13, 0x7C16, 0x7C19, 0x7C1C, 0x7C1F, 0x7C22, 0x7C25, 0x7C29, 0x7C2C,
+  0x7C2F, 0x7C32, 0x7C35, 0x7C38, 0x7C3B, 0x7C3F, 0x7C42, 0x7C45, 0x7C48, 0x7C4B, 0x7C4E, 0x7C51,
+  0x7C55, 0x7C58, 0x7C5B, 0x7C5E, 0x7C61, 0x7C64, 0x7C67, 0x7C6A, 0x7C6E, 0x7C71, 0x7C74, 0x7C77,
+  0x7C7A, 0x7C7D, 0x7C80, 0x7C84, 0x7C87, 0x7C8A, 0x7C8D, 0x7C90, 0x7C93, 0x7C96, 0x7C9A, 0x7C9D,
+  0x7CA0, 0x7CA3, 0x7CA6, 0x7CA9, 0x7CAC, 0x7CAF, 0x7CB3, 0x7CB6, 0x7CB9, 0x7CBC, 0x7CBF, 0x7CC2,
+  0x7CC5, 0x7CC9, 0x7CCC, 0x7CCF, 0x7CD2, 0x7CD5, 0x7CD8, 0x7CDB, 0x7CDF, 0x7CE2, 0x7CE5, 0x7CE8,
+  0x7CEB, 0x7CEE, 0x7CF1, 0x7CF4, 0x7CF8, 0x7CFB, 0x7CFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7F82, 0x7F85, 0x7F88, 0x7F8C, 0x7F8F, 0x7F92,
+  0x7F95, 0x7F98, 0x7F9C, 0x7F9F, 0x7FA2, 0x7FA5, 0x7FA8, 0x7FAB, 0x7FAF, 0x7FB2, 0x7FB5, 0x7FB8,
+  0x7FBB, 0x7FBF, 0x7FC2, 0x7FC5, 0x7FC8, 0x7FCB, 0x7FCE, 0x7FD2, 0x7FD5, 0x7FD8, 0x7FDB, 0x7FDE,
+  0x7FE1, 0x7FE5, 0x7FE8, 0x7FEB, 0x7FEE, 0x7FF1, 0x7FF5, 0x7FF8, 0x7FFB, 0x7FFE, 0x8001, 0x8004,
+  0x8008, 0x800B, 0x800E, 0x8011, 0x8014, 0x8018, 0x801B, 0x801E, 0x8021, 0x8024, 0x8027, 0x802B,
+  0x802E, 0x8031, 0x8034, 0x8037, 0x803B, 0x803E, 0x8041, 0x8044, 0x8047, 0x804A, 0x804E, 0x8051,
+  0x8054, 0x8057, 0x805A, 0x805E, 0x8061, 0x8064, 0x8067, 0x806A, 0x806D, 0x8071, 0x8074, 0x8077,
+  0x807A, 0x807D, 0x8080, 0x8084, 0x8087, 0x808A, 0x808D, 0x8090, 0x8094, 0x8097, 0x809A, 0x809D,
+  0x80A0, 0x80A3, 0x80A7, 0x80AA, 0x80AD, 0x80B0, 0x80B3, 0x80B7, 0x80BA, 0x80BD, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8200, 0x8203,
+  0x8206, 0x820A, 0x820D, 0x8210, 0x8213, 0x8216, 0x821A, 0x821D, 0x8220, 0x8223, 0x8227, 0x822A,
+  0x822D, 0x8230, 0x8233, 0x8237, 0x823A, 0x823D, 0x8240, 0x8244, 0x8247, 0x824A, 0x824D, 0x8250,
+  0x8254, 0x8257, 0x825A, 0x825D, 0x8261, 0x8264, 0x8267, 0x826A, 0x826E, 0x8271, 0x8274, 0x8277,
+  0x827A, 0x827E, 0x8281, 0x8284, 0x8287, 0x828B, 0x828E, 0x8291, 0x8294, 0x8297, 0x829B, 0x829E,
+  0x82A1, 0x82A4, 0x82A8, 0x82AB, 0x82AE, 0x82B1, 0x82B4, 0x82B8, 0x82BB, 0x82BE, 0x82C1, 0x82C5,
+  0x82C8, 0x82CB, 0x82CE, 0x82D1, 0x82D5, 0x82D8, 0x82DB, 0x82DE, 0x82E2, 0x82E5, 0x82E8, 0x82EB,
+  0x82EF, 0x82F2, 0x82F5, 0x82F8, 0x82FB, 0x82FF, 0x8302, 0x8305, 0x8308, 0x830C, 0x830F, 0x8312,
+  0x8315, 0x8318, 0x831C, 0x831F, 0x8322, 0x8325, 0x8329, 0x832C, 0x832F, 0x8332, 0x8335, 0x8339,
+  0x833C, 0x833F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x8481, 0x8484, 0x8487, 0x848B, 0x848E, 0x8491, 0x8494, 0x8498, 0x849B,
+  0x849E, 0x84A2, 0x84A5, 0x84A8, 0x84AB, 0x84AF, 0x84B2, 0x84B5, 0x84B8, 0x84BC, 0x84BF, 0x84C2,
+  0x84C6, 0x84C9, 0x84CC, 0x84CF, 0x84D3, 0x84D6, 0x84D9, 0x84DC, 0x84E0, 0x84E3, 0x84E6, 0x84EA,
+  0x84ED, 0x84F0, 0x84F3, 0x84F7, 0x84FA, 0x84FD, 0x8500, 0x8504, 0x8507, 0x850A, 0x850E, 0x8511,
+  0x8514, 0x8517, 0x851B, 0x851E, 0x8521, 0x8524, 0x8528, 0x852B, 0x852E, 0x8531, 0x8535, 0x8538,
+  0x853B, 0x853F, 0x8542, 0x8545, 0x8548, 0x854C, 0x854F, 0x8552, 0x8555, 0x8559, 0x855C, 0x855F,
+  0x8563, 0x8566, 0x8569, 0x856C, 0x8570, 0x8573, 0x8576, 0x8579, 0x857D, 0x8580, 0x8583, 0x8587,
+  0x858A, 0x858D, 0x8590, 0x8594, 0x8597, 0x859A, 0x859D, 0x85A1, 0x85A4, 0x85A7, 0x85AB, 0x85AE,
+  0x85B1, 0x85B4, 0x85B8, 0x85BB, 0x85BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8702, 0x8705, 0x8709, 0x870C,
+  0x870F, 0x8712, 0x8716, 0x8719, 0x871C, 0x8720, 0x8723, 0x8726, 0x872A, 0x872D, 0x8730, 0x8734,
+  0x8737, 0x873A, 0x873E, 0x8741, 0x8744, 0x8748, 0x874B, 0x874E, 0x8752, 0x8755, 0x8758, 0x875B,
+  0x875F, 0x8762, 0x8765, 0x8769, 0x876C, 0x876F, 0x8773, 0x8776, 0x8779, 0x877D, 0x8780, 0x8783,
+  0x8787, 0x878A, 0x878D, 0x8791, 0x8794, 0x8797, 0x879B, 0x879E, 0x87A1, 0x87A4, 0x87A8, 0x87AB,
+  0x87AE, 0x87B2, 0x87B5, 0x87B8, 0x87BC, 0x87BF, 0x87C2, 0x87C6, 0x87C9, 0x87CC, 0x87D0, 0x87D3,
+  0x87D6, 0x87DA, 0x87DD, 0x87E0, 0x87E4, 0x87E7, 0x87EA, 0x87ED, 0x87F1, 0x87F4, 0x87F7, 0x87FB,
+  0x87FE, 0x8801, 0x8805, 0x8808, 0x880B, 0x880F, 0x8812, 0x8815, 0x8819, 0x881C, 0x881F, 0x8823,
+  0x8826, 0x8829, 0x882D, 0x8830, 0x8833, 0x8836, 0x883A, 0x883D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x8AC0, 0x8AC3, 0x8AC6, 0x8ACA, 0x8ACD, 0x8AD0, 0x8AD4, 0x8AD7, 0x8ADA, 0x8ADE, 0x8AE1, 0x8AE5,
+  0x8AE8, 0x8AEB, 0x8AEF, 0x8AF2, 0x8AF5, 0x8AF9, 0x8AFC, 0x8B00, 0x8B03, 0x8B06, 0x8B0A, 0x8B0D,
+  0x8B10, 0x8B14, 0x8B17, 0x8B1A, 0x8B1E, 0x8B21, 0x8B25, 0x8B28, 0x8B2B, 0x8B2F, 0x8B32, 0x8B35,
+  0x8B39, 0x8B3C, 0x8B40, 0x8B43, 0x8B46, 0x8B4A, 0x8B4D, 0x8B50, 0x8B54, 0x8B57, 0x8B5A, 0x8B5E,
+  0x8B61, 0x8B65, 0x8B68, 0x8B6B, 0x8B6F, 0x8B72, 0x8B75, 0x8B79, 0x8B7C, 0x8B7F, 0x8B83, 0x8B86,
+  0x8B8A, 0x8B8D, 0x8B90, 0x8B94, 0x8B97, 0x8B9A, 0x8B9E, 0x8BA1, 0x8BA5, 0x8BA8, 0x8BAB, 0x8BAF,
+  0x8BB2, 0x8BB5, 0x8BB9, 0x8BBC, 0x8BBF, 0x8BC3, 0x8BC6, 0x8BCA, 0x8BCD, 0x8BD0, 0x8BD4, 0x8BD7,
+  0x8BDA, 0x8BDE, 0x8BE1, 0x8BE5, 0x8BE8, 0x8BEB, 0x8BEF, 0x8BF2, 0x8BF5, 0x8BF9, 0x8BFC, 0x8BFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8D41, 0x8D44, 0x8D47, 0x8D4B, 0x8D4E, 0x8D52, 0x8D55,
+  0x8D58, 0x8D5C, 0x8D5F, 0x8D63, 0x8D66, 0x8D6A, 0x8D6D, 0x8D70, 0x8D74, 0x8D77, 0x8D7B, 0x8D7E,
+  0x8D82, 0x8D85, 0x8D88, 0x8D8C, 0x8D8F, 0x8D93, 0x8D96, 0x8D99, 0x8D9D, 0x8DA0, 0x8DA4, 0x8DA7,
+  0x8DAB, 0x8DAE, 0x8DB1, 0x8DB5, 0x8DB8, 0x8DBC, 0x8DBF, 0x8DC2, 0x8DC6, 0x8DC9, 0x8DCD, 0x8DD0,
+  0x8DD4, 0x8DD7, 0x8DDA, 0x8DDE, 0x8DE1, 0x8DE5, 0x8DE8, 0x8DEB, 0x8DEF, 0x8DF2, 0x8DF6, 0x8DF9,
+  0x8DFD, 0x8E00, 0x8E03, 0x8E07, 0x8E0A, 0x8E0E, 0x8E11, 0x8E14, 0x8E18, 0x8E1B, 0x8E1F, 0x8E22,
+  0x8E26, 0x8E29, 0x8E2C, 0x8E30, 0x8E33, 0x8E37, 0x8E3A, 0x8E3D, 0x8E41, 0x8E44, 0x8E48, 0x8E4B,
+  0x8E4F, 0x8E52, 0x8E55, 0x8E59, 0x8E5C, 0x8E60, 0x8E63, 0x8E67, 0x8E6A, 0x8E6D, 0x8E71, 0x8E74,
+  0x8E78, 0x8E7B, 0x8E7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+};
+
+/* Exported variables --------------------------------------------------------*/
+const Vision_IpmLut_t ipm_lut =
+{
+  ipm_lut_offsets,
+  160U, 120U,           // width, height
+  320U, 120U, 320U,     // src_width, src_height, src_stride
+  -1988, 5983,          // x_min_mm, z_far_mm (cell centres)
+  25000U, 33333U        // x_step_um, z_step_um
+};
@@ -21,6 +21,15 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "capture.h"
+#include "clock.h"
+#include "cache.h"
+#include "ipm_lut.h"
+#include "mpu.h"
+#include "sccb.h"
+#include "sections.h"
+#include "xclk.h"
+#include "vision.h"
 
 /* USER CODE END Includes */
 
@@ -31,8 +40,32 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
-#define CAMERA_WIDTH  640  // Camera image width (pixels)
-#define CAMERA_HEIGHT 480  // Camera image height (pixels)
+#define EDGE_GAUSS_RADIUS   VISION_GAUSS_5X5            // Smoothing ahead of Sobel
+#define EDGE_SOBEL_SHIFT    VISION_SOBEL_SHIFT_DEFAULT  // Gradient magnitude scale
+#define CANNY_STACK_DEPTH   1024U                       // Edge following stack (4 KB of DTCM)
+#define HOUGH_THETA_MIN     VISION_HOUGH_LANE_THETA_MIN // Lane angles voted (degrees)
+#define HOUGH_THETA_MAX     VISION_HOUGH_LANE_THETA_MAX
+#define HOUGH_THETA_STEP    1U
+#define HOUGH_THETAS        VISION_HOUGH_THETAS(HOUGH_THETA_MIN, HOUGH_THETA_MAX, HOUGH_THETA_STEP)
+#define HOUGH_MIN_VOTES     (CAPTURE_LINES / 4U)        // Shortest accepted line (pixels)
+#define LANE_MAX_LINES      4U                          // Strongest lines reported per frame
+#define PPHT_THRESHOLD      (CAPTURE_LINES / 8U)        // Votes confirming a segment
+#define PPHT_MIN_LENGTH     8U                          // Shortest segment kept (pixels)
+#define PPHT_MAX_GAP        3U                          // Gap bridged inside a segment (pixels)
+#define PPHT_POINTS         4096U                       // Edge pixels voted per frame at most
+#define LANE_MAX_SEGMENTS   8U                          // Segments reported per frame
+#define LANE_PAINT_RADIUS   VISION_ADAPTIVE_RADIUS_DEFAULT // Half window of the local mean, ~3 paint widths
+#define LANE_PAINT_OFFSET   VISION_ADAPTIVE_OFFSET_DEFAULT // Luma lane paint stands above the local mean
+#define LANE_RUNS           1024U                       // Runs of the opened mask encoded per frame
+#define LANE_BLOBS          32U                         // Connected components measured per frame
+#define LANE_BLOB_MIN_AREA  20U                         // Smallest marking fragment kept (pixels)
+#define LANE_BLOB_MAX_WIDTH 12.0f                       // Widest marking across its axis (pixels)
+#define LANE_BLOB_MIN_ELONG 2.5f                        // Markings are strokes, glare and cars are not
+#define LANE_FIT_MIN_PIXELS 60U                         // Support a fit needs to steer the next search
+#define LANE_FIT_MAX_RMS    3.0f                        // Residual a fit may have to steer it (pixels)
+#define LANE_WIDTH_M        3.5f                        // Assumed lane width when one line is lost
+#define TRACK_WINDOW_PAD    (EDGE_GAUSS_RADIUS + 1U)    // Filter support around the tracked window
+
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -45,18 +78,97 @@
 DCMI_HandleTypeDef hdcmi;
 DMA_HandleTypeDef hdma_dcmi;
 
-// Buffer to store the captured image data
-uint8_t image_buffer[CAMERA_WIDTH * CAMERA_HEIGHT];
+I2C_HandleTypeDef hi2c1;
+
+TIM_HandleTypeDef htim1;
 
 /* USER CODE BEGIN PV */
+// Frame buffers rotated between the DCMI DMA and the processing loop
+uint8_t image_buffer[CAPTURE_BUFFER_COUNT][CACHE_ROUND_UP(CAPTURE_FRAME_BYTES)] CACHE_ALIGNED;
+
+// Smoothed gradient of the frame being processed, see vision_gradient.h
+uint8_t gradient_map[CAPTURE_FRAME_BYTES];
+uint16_t edge_gauss_rows[VISION_GAUSS_ROWS_WORDS(CAPTURE_LINE_BYTES, EDGE_GAUSS_RADIUS)] LINE_BUFFER;
+uint8_t edge_sobel_rows[VISION_SOBEL_ROWS_BYTES(CAPTURE_LINE_BYTES)] LINE_BUFFER;
+
+// Canny edges of the same frame; thresholds may be retuned while running
+uint8_t edge_map[CAPTURE_FRAME_BYTES];
+uint32_t canny_stack_items[CANNY_STACK_DEPTH] FAST_BSS;
+Vision_CannyStack_t canny_stack = { canny_stack_items, CANNY_STACK_DEPTH, 0, 0 };
+volatile Vision_CannyParams_t canny_params = { VISION_CANNY_LOW_DEFAULT, VISION_CANNY_HIGH_DEFAULT };
+
+// Luma statistics of the whole latest frame, for thresholds and exposure
+// control; they do not follow the tracked window
+Vision_Histogram_t frame_histogram FAST_BSS;
+volatile Vision_HistogramStats_t frame_stats;
+volatile uint32_t frame_stats_sequence;
+
+// Hough transform state with its column trigonometry, the accumulator over
+// the region of interest and the lines found in it
+Vision_Hough_t hough FAST_BSS;
+uint16_t hough_acc[VISION_HOUGH_ACC_WORDS(CAPTURE_LINE_BYTES, CAPTURE_LINES, HOUGH_THETAS)];
+Vision_HoughLine_t lane_lines[LANE_MAX_LINES];
+volatile uint32_t lane_line_count;
+
+// Bird's-eye view of the road, see Core/Src/ipm_lut.c for the ground window
+uint8_t birdseye_map[IPM_LUT_WIDTH * IPM_LUT_HEIGHT];
+uint8_t lane_mask_map[IPM_LUT_WIDTH * IPM_LUT_HEIGHT];
+uint32_t lane_mask_rows[VISION_ADAPTIVE_ROWS_WORDS(IPM_LUT_WIDTH, LANE_PAINT_RADIUS)] LINE_BUFFER;
+uint32_t lane_mask_bits[VISION_MASK_WORDS(IPM_LUT_WIDTH, IPM_LUT_HEIGHT)] FAST_BSS;
+uint32_t lane_morph_rows[VISION_MORPH_ROWS_WORDS(IPM_LUT_WIDTH)] LINE_BUFFER;
+
+// Connected components of the lane mask as runs; blobs that are not
+// stroke-shaped are erased before the lane search
+Vision_Run_t lane_run_items[LANE_RUNS] FAST_BSS;
+Vision_Runs_t lane_runs = { lane_run_items, LANE_RUNS, 0, 0 };
+Vision_Blob_t lane_blobs[LANE_BLOBS];
+uint8_t lane_blob_keep[LANE_BLOBS];
+volatile uint32_t lane_blob_count;
+const Vision_BlobShape_t lane_blob_shape = { LANE_BLOB_MIN_AREA, LANE_BLOB_MAX_WIDTH, LANE_BLOB_MIN_ELONG };
+
+// Lane pixels in bird's-eye coordinates, kept as fit sums only
+uint16_t lane_histogram[IPM_LUT_WIDTH];
+Vision_LanePixels_t lane_left = { NULL, NULL, 0, 0, 0, { 0 } };
+Vision_LanePixels_t lane_right = { NULL, NULL, 0, 0, 0, { 0 } };
+volatile Vision_LaneSearchParams_t lane_search = { VISION_LANE_WINDOWS_DEFAULT, VISION_LANE_MARGIN_DEFAULT,
+                                                   VISION_LANE_RECENTRE_DEFAULT, VISION_LANE_SEED_DEFAULT };
+
+// Probabilistic Hough: edge pixel list and the segments found, whose
+// lengths tell dashed markings from solid ones
+uint32_t ppht_points[PPHT_POINTS];
+Vision_HoughSegment_t lane_segments[LANE_MAX_SEGMENTS];
+volatile uint32_t lane_segment_count;
+
+// Lane fits in bird's-eye pixels and the geometry handed to steering
+Vision_LaneFit_t lane_fit_left;
+Vision_LaneFit_t lane_fit_right;
+Vision_LaneGeometry_t lane_geometry;
+volatile uint32_t lane_geometry_valid;
+
+// Lane tracker: while locked, the next frame searches lane_band only and
+// the edge stages cover lane_window, in captured pixels (add the capture
+// ROI origin for sensor coordinates)
+Vision_Track_t lane_track;
+Vision_LaneFit_t lane_track_left;
+Vision_LaneFit_t lane_track_right;
+Vision_TrackBand_t lane_band;
+Vision_TrackWindow_t lane_window;
+
+#if (CACHE_DMA_SCRATCH_BYTES > 0U)
+// Non-cacheable DMA landing area, see mpu.c
+uint8_t dma_scratch[CACHE_DMA_SCRATCH_BYTES] __attribute__((aligned(CACHE_DMA_SCRATCH_BYTES)));
+#endif
 
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
 void SystemClock_Config(void);
+static void MPU_Config(void);
 static void MX_GPIO_Init(void);
 static void MX_DCMI_Init(void);
 static void MX_DMA_Init(void);
+static void MX_I2C1_Init(void);
+static void MX_TIM1_Init(void);
 /* USER CODE BEGIN PFP */
 
 /* USER CODE END PFP */
@@ -73,80 +185,18 @@ static void MX_DMA_Init(void);
 int main(void)
 {
   /* USER CODE BEGIN 1 */
-  // Enable the clock signals for the DCMI and DMA peripherals
-	__HAL_RCC_DCMI_CLK_ENABLE();
-	__HAL_RCC_DMA2_CLK_ENABLE();
-
-	// Configure the DMA peripheral to transfer image data from the DCMI to the image buffer
-	DMA_HandleTypeDef dma_handle;
-	dma_handle.Instance = DMA2_Stream1;
-	dma_handle.Init.Request = DMA_REQUEST_DCMI;
-	dma_handle.Init.Direction = DMA_PERIPH_TO_MEMORY;
-	dma_handle.Init.PeriphInc = DMA_PINC_DISABLE;
-	dma_handle.Init.MemInc = DMA_MINC_ENABLE;
-	dma_handle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
-	dma_handle.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
-	dma_handle.Init.Mode = DMA_NORMAL;
-	dma_handle.Init.Priority = DMA_PRIORITY_HIGH;
-	dma_handle.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
-	HAL_DMA_Init(&dma_handle);
-	__HAL_LINKDMA(&hdcmi, DMA_Handle, dma_handle);
-
-	void DMA2_Stream1_IRQHandler(void)
-	{
-	  HAL_DMA_IRQHandler(&dma_handle);
-	}
-
-	// Configure the DCMI peripheral to capture image data from the camera module
-	DCMI_HandleTypeDef dcmi_handle;
-	dcmi_handle.Instance = DCMI;
-	dcmi_handle.Init.CaptureRate = DCMI_CR_ALL_FRAME;
-	dcmi_handle.Init.HSPolarity = DCMI_HSPOLARITY_HIGH;
-	dcmi_handle.Init.VSPolarity = DCMI_VSPOLARITY_HIGH;
-	dcmi_handle.Init.SynchroMode = DCMI_SYNCHRO_HARDWARE;
-	dcmi_handle.Init.PCKPolarity = DCMI_PCKPOLARITY_RISING;
-	dcmi_handle.Init.ExtendedDataMode = DCMI_EXTEND_DATA_8B;
-	dcmi_handle.Init.SyncroCode.FrameStartCode = 0xA5;
-	dcmi_handle.Init.SyncroCode.LineStartCode = 0x01;
-	dcmi_handle.Init.SyncroCode.LineEndCode = 0xFE;
-	dcmi_handle.Init.SyncroCode.FrameEndCode = 0x5A;
-	HAL_DCMI_Init(&dcmi_handle);
-
-	// Configure the VS (vertical synchronization) pin as an input
-	GPIO_InitTypeDef gpio_init;
-	gpio_init.Pin = GPIO_PIN_9;
-	gpio_init.Mode = GPIO_MODE_INPUT;
-	gpio_init.Pull = GPIO_NOPULL;
-	gpio_init.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
-	HAL_GPIO_Init(GPIOG, &gpio_init);
-
-	// Configure the HS (horizontal synchronization) pin as an input
-	gpio_init.Pin = GPIO_PIN_4;
-	HAL_GPIO_Init(GPIOA, &gpio_init);
-
-	// Configure the PCLK (pixel clock) pin as an input
-	gpio_init.Pin = GPIO_PIN_6;
-	HAL_GPIO_Init(GPIOA, &gpio_init);
-
-	// Configure the D0-D7 (data) pins as inputs
-	gpio_init.Pin = GPIO_PIN_6 | GPIO_PIN_7 | GPIO_PIN_8 | GPIO_PIN_9;
-	HAL_GPIO_Init(GPIOC, &gpio_init);
-	gpio_init.Pin = GPIO_PIN_4 | GPIO_PIN_5 | GPIO_PIN_6;
-	HAL_GPIO_Init(GPIOE, &gpio_init);
-	gpio_init.Pin = GPIO_PIN_3;
-	HAL_GPIO_Init(GPIOD, &gpio_init);
-
-	// Enable the DMA transfer complete interrupt
-	HAL_NVIC_SetPriority(DMA2_Stream1_IRQn, 0, 0);
-	HAL_NVIC_EnableIRQ(DMA2_Stream1_IRQn);
-
-	// Start the DMA transfer
-	HAL_DMA_Start_IT(&dma_handle, (uint32_t)&DCMI->DR, (uint32_t)image_buffer, CAMERA_WIDTH * CAMERA_HEIGHT);
-
-	// Start the image capture
-	HAL_DCMI_Start_DMA(&dcmi_handle, DCMI_MODE_SNAPSHOT, (uint32_t)image_buffer, CAMERA_WIDTH * CAMERA_HEIGHT);
+
   /* USER CODE END 1 */
 
+  /* MPU Configuration--------------------------------------------------------*/
+  MPU_Config();
+
+  /* Enable I-Cache---------------------------------------------------------*/
+  SCB_EnableICache();
+
+  /* Enable D-Cache---------------------------------------------------------*/
+  SCB_EnableDCache();
+
   /* MCU Configuration--------------------------------------------------------*/
 
   /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
@@ -164,9 +214,118 @@ int main(void)
 
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
-  MX_DCMI_Init();
   MX_DMA_Init();
+  MX_DCMI_Init();
+  MX_I2C1_Init();
+  MX_TIM1_Init();
   /* USER CODE BEGIN 2 */
+  OV7670_Bus_t camera_bus;
+  OV7670_ClockConfig_t camera_clock;
+  const Roi_t roi = { CAPTURE_ROI_X, CAPTURE_ROI_Y, CAPTURE_ROI_WIDTH, CAPTURE_ROI_HEIGHT };
+  uint8_t *frames[CAPTURE_BUFFER_COUNT];
+  uint8_t *frame;
+  uint32_t sequence;
+  Vision_Image_t gray;
+  Vision_Image_t gradient;
+  Vision_Image_t edges;
+  Vision_Image_t gray_roi;
+  Vision_Image_t gradient_roi;
+  Vision_Image_t edges_roi;
+  Vision_Edge_t edge;
+  Vision_Image_t birdseye;
+  Vision_Image_t lane_mask;
+  Vision_Mask_t lane_bits;
+  Vision_LaneSearchParams_t search;
+  Vision_CannyParams_t thresholds;
+  Vision_HistogramStats_t stats;
+  const Vision_HoughParams_t hough_params = { HOUGH_THETA_MIN, HOUGH_THETA_MAX, HOUGH_THETA_STEP };
+  Vision_PphtParams_t ppht_params = { PPHT_THRESHOLD, PPHT_MIN_LENGTH, PPHT_MAX_GAP, 0 };
+  Vision_TrackParams_t track_params = { VISION_TRACK_Q_DEFAULT, VISION_TRACK_R_DEFAULT, VISION_TRACK_GATE_DEFAULT,
+                                        0.0f, VISION_TRACK_LOCK_DEFAULT, VISION_TRACK_MISS_DEFAULT,
+                                        VISION_TRACK_MARGIN_MIN, VISION_TRACK_MARGIN_MAX };
+  uint32_t locked = 0;
+  int32_t lines;
+  int32_t blob_count;
+
+  for (uint32_t i = 0; i < CAPTURE_BUFFER_COUNT; i++)
+  {
+    frames[i] = image_buffer[i];
+  }
+
+  // The sensor needs XCLK running before it answers on SCCB
+  if (Xclk_Start(&htim1, CAMERA_FRAME_RATE, NULL) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  // Bring the sensor to the format and size the DCMI setup expects
+  SCCB_InitBus(&camera_bus, &hi2c1);
+  if (OV7670_Init(&camera_bus, CAMERA_SENSOR_RESOLUTION, CAMERA_SENSOR_FORMAT) != OV7670_OK)
+  {
+    Error_Handler();
+  }
+
+  if (Xclk_SetFrameRate(&htim1, &camera_bus, CAMERA_FRAME_RATE, &camera_clock) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  // YUV422 output: one PIXCLK per byte, i.e. the sensor internal clock
+  if ((camera_clock.xclk_hz / camera_clock.clkrc_div) > Clock_GetPlan()->dcmi_pixclk_max_hz)
+  {
+    Error_Handler();
+  }
+
+  if (Capture_SetProfile(&hdcmi, CAPTURE_PROFILE) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  if (Capture_SetRoi(&hdcmi, &roi) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  if (Capture_Start(&hdcmi, frames, CAPTURE_BUFFER_COUNT, sizeof(image_buffer[0])) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  // The luma profile stores one byte per pixel: every frame is a gray plane
+  // of the crop geometry
+  if (Vision_ImageInit(&gray, image_buffer[0], Capture_GetCrop()->line_bytes, Capture_GetCrop()->lines,
+                       Capture_GetCrop()->line_bytes) != VISION_OK)
+  {
+    Error_Handler();
+  }
+  if ((Vision_ImageInit(&gradient, gradient_map, gray.width, gray.height, gray.width) != VISION_OK) ||
+      (Vision_ImageInit(&edges, edge_map, gray.width, gray.height, gray.width) != VISION_OK) ||
+      (Vision_ImageInit(&birdseye, birdseye_map, IPM_LUT_WIDTH, IPM_LUT_HEIGHT, IPM_LUT_WIDTH) != VISION_OK) ||
+      (Vision_ImageInit(&lane_mask, lane_mask_map, IPM_LUT_WIDTH, IPM_LUT_HEIGHT, IPM_LUT_WIDTH) != VISION_OK) ||
+      (Vision_MaskInit(&lane_bits, lane_mask_bits, IPM_LUT_WIDTH, IPM_LUT_HEIGHT) != VISION_OK))
+  {
+    Error_Handler();
+  }
+  // The remap table must have been generated for this capture geometry
+  if ((ipm_lut.src_width != gray.width) || (ipm_lut.src_height != gray.height) ||
+      (ipm_lut.src_stride != gray.stride))
+  {
+    Error_Handler();
+  }
+  if (Vision_HoughInit(&hough, gray.width, gray.height, &hough_params, hough_acc,
+                       sizeof(hough_acc) / sizeof(hough_acc[0])) != VISION_OK)
+  {
+    Error_Handler();
+  }
+  track_params.width = (LANE_WIDTH_M * 1e6f) / (float)ipm_lut.x_step_um;
+  if (Vision_TrackInit(&lane_track, &track_params, IPM_LUT_HEIGHT) != VISION_OK)
+  {
+    Error_Handler();
+  }
+  lane_window.x = 0;
+  lane_window.y = 0;
+  lane_window.width = gray.width;
+  lane_window.height = gray.height;
 
   /* USER CODE END 2 */
 
@@ -177,6 +336,135 @@ int main(void)
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
+    // Process frame N while the DMA fills frame N+1
+    frame = Capture_AcquireFrame(&sequence);
+    if (frame == NULL)
+    {
+      continue;
+    }
+
+    gray.data = frame;
+
+    // Edge stages cover the tracked window, the whole frame unless locked
+    (void)Vision_ImageView(&gray, lane_window.x, lane_window.y, lane_window.width, lane_window.height, &gray_roi);
+    (void)Vision_ImageView(&gradient, lane_window.x, lane_window.y, lane_window.width, lane_window.height,
+                           &gradient_roi);
+    (void)Vision_ImageView(&edges, lane_window.x, lane_window.y, lane_window.width, lane_window.height, &edges_roi);
+
+    // Single read of the frame: every row is counted into the histogram,
+    // and rows of the window feed the Gaussian, whose rows feed Sobel inside DTCM
+    Vision_HistogramReset(&frame_histogram);
+    (void)Vision_EdgeInit(&edge, gray_roi.width, EDGE_GAUSS_RADIUS, EDGE_SOBEL_SHIFT, edge_gauss_rows,
+                          edge_sobel_rows);
+    for (uint32_t y = 0; y < gray.height; y++)
+    {
+      Vision_HistogramPushRow(&frame_histogram, VISION_ROW(&gray, y), gray.width);
+      if ((y - lane_window.y) < lane_window.height)
+      {
+        (void)Vision_EdgePush(&edge, VISION_ROW(&gray_roi, y - lane_window.y),
+                              VISION_ROW(&gradient_roi, edge.sobel.emitted));
+      }
+    }
+    while (Vision_EdgeFlush(&edge, VISION_ROW(&gradient_roi, edge.sobel.emitted)) > 0)
+    {
+    }
+    if (Vision_HistogramStats(&frame_histogram, VISION_HISTOGRAM_LOW_DEFAULT, VISION_HISTOGRAM_HIGH_DEFAULT,
+                              &stats) == VISION_OK)
+    {
+      frame_stats = stats;
+      frame_stats_sequence = sequence;
+    }
+    (void)Vision_IpmWarp(&ipm_lut, &gray, &birdseye, 0);
+
+    Capture_ReleaseFrame();
+
+    // Snapshot the thresholds so a retune never lands mid-frame
+    thresholds.low = canny_params.low;
+    thresholds.high = canny_params.high;
+    (void)Vision_Canny(&gradient_roi, &edges_roi, &thresholds, &canny_stack);
+
+    // Street lines: rho and theta relative to the top-left of lane_window
+    (void)Vision_HoughInit(&hough, edges_roi.width, edges_roi.height, &hough_params, hough_acc,
+                           sizeof(hough_acc) / sizeof(hough_acc[0]));
+    (void)Vision_HoughVote(&hough, &edges_roi);
+    lines = Vision_HoughPeaks(&hough, HOUGH_MIN_VOTES, lane_lines, LANE_MAX_LINES);
+    lane_line_count = (lines > 0) ? (uint32_t)lines : 0U;
+
+    // Segments last: this pass consumes the edge map
+    ppht_params.seed = sequence;
+    lines = Vision_HoughProbabilistic(&hough, &edges_roi, &ppht_params, ppht_points, PPHT_POINTS, lane_segments,
+                                      LANE_MAX_SEGMENTS);
+    lane_segment_count = (lines > 0) ? (uint32_t)lines : 0U;
+
+    // Lane pixels in the top-down view
+    search.windows = lane_search.windows;
+    search.margin = lane_search.margin;
+    search.recentre = lane_search.recentre;
+    search.min_seed = lane_search.min_seed;
+    // Paint brighter than its surroundings, so shadows and overpasses do not move the cut
+    (void)Vision_AdaptiveThreshold(&birdseye, &lane_mask, LANE_PAINT_RADIUS, LANE_PAINT_OFFSET, lane_mask_rows);
+
+    // Opening on the packed mask drops specks narrower than the paint, 32 pixels per word
+    (void)Vision_MaskPack(&lane_mask, &lane_bits);
+    (void)Vision_MaskOpen(&lane_bits, &lane_bits, lane_morph_rows);
+
+    // Keep only stroke-shaped blobs; unmeasured blobs are erased, and an
+    // overflowing run list leaves the mask as it is
+    (void)Vision_RunsFromMask(&lane_bits, &lane_runs);
+    blob_count = Vision_BlobLabel(&lane_runs, lane_blobs, LANE_BLOBS);
+    if ((blob_count >= 0) && (lane_runs.dropped == 0U))
+    {
+      for (uint32_t b = 0; (b < LANE_BLOBS) && (b < (uint32_t)blob_count); b++)
+      {
+        lane_blob_keep[b] = (uint8_t)Vision_BlobMatches(&lane_blobs[b], &lane_blob_shape);
+      }
+      (void)Vision_RunsToMask(&lane_runs, lane_blob_keep, &lane_bits);
+      lane_blob_count = (uint32_t)blob_count;
+    }
+    (void)Vision_MaskUnpack(&lane_bits, &lane_mask);
+    if (locked != 0U)
+    {
+      // Scan only the predicted corridor around each line
+      (void)Vision_LaneSearchAround(&lane_mask, &lane_band.left, lane_band.margin, &lane_left);
+      (void)Vision_LaneSearchAround(&lane_mask, &lane_band.right, lane_band.margin, &lane_right);
+    }
+    else
+    {
+      (void)Vision_LaneSlidingWindow(&lane_mask, &search, lane_histogram, &lane_left, &lane_right);
+    }
+
+    // Curve fits from the running sums; only confident ones reach the tracker
+    (void)Vision_LaneFitSolve(&lane_left.sums, &lane_fit_left);
+    (void)Vision_LaneFitSolve(&lane_right.sums, &lane_fit_right);
+    (void)Vision_TrackUpdate(&lane_track,
+                             (Vision_LaneFitConfident(&lane_fit_left, LANE_FIT_MIN_PIXELS, LANE_FIT_MAX_RMS) != 0U) ?
+                             &lane_fit_left : NULL,
+                             (Vision_LaneFitConfident(&lane_fit_right, LANE_FIT_MIN_PIXELS, LANE_FIT_MAX_RMS) != 0U) ?
+                             &lane_fit_right : NULL);
+
+    // Radius and offset in metres, from the filtered lines while tracking
+    if (Vision_TrackLines(&lane_track, &lane_track_left, &lane_track_right) == VISION_OK)
+    {
+      lane_geometry_valid = (Vision_LaneFitGeometry(&lane_track_left, &lane_track_right, &ipm_lut, LANE_WIDTH_M,
+                                                    &lane_geometry) == VISION_OK) ? 1U : 0U;
+    }
+    else
+    {
+      lane_geometry_valid = (Vision_LaneFitGeometry(&lane_fit_left, &lane_fit_right, &ipm_lut, LANE_WIDTH_M,
+                                                    &lane_geometry) == VISION_OK) ? 1U : 0U;
+    }
+
+    // Search region of the next frame
+    locked = ((lane_track.state == VISION_TRACK_LOCKED) &&
+              (Vision_TrackPredict(&lane_track, &lane_band) == VISION_OK) &&
+              (Vision_TrackWindow(&lane_band, &ipm_lut, TRACK_WINDOW_PAD, &lane_window) == VISION_OK)) ? 1U : 0U;
+    if (locked == 0U)
+    {
+      lane_window.x = 0;
+      lane_window.y = 0;
+      lane_window.width = gray.width;
+      lane_window.height = gray.height;
+    }
   }
   /* USER CODE END 3 */
 }
@@ -188,45 +476,14 @@ int main(void)
 
 void SystemClock_Config(void)
 {
-  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
-  RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
-
   /** Supply configuration update enable
   */
   HAL_PWREx_ConfigSupply(PWR_LDO_SUPPLY);
 
-  /** Configure the main internal regulator output voltage
-  */
-  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE3);
-
-  while(!__HAL_PWR_GET_FLAG(PWR_FLAG_VOSRDY)) {}
-
-  /** Initializes the RCC Oscillators according to the specified parameters
-  * in the RCC_OscInitTypeDef structure.
-  */
-  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSI;
-  RCC_OscInitStruct.HSIState = RCC_HSI_DIV1;
-  RCC_OscInitStruct.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
-  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_NONE;
-  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
-  {
-    Error_Handler();
-  }
-
-  /** Initializes the CPU, AHB and APB buses clocks
+  /** Voltage scaling, PLL1, bus prescalers and flash latency come from the
+  * clock profile
   */
-  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
-                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2
-                              |RCC_CLOCKTYPE_D3PCLK1|RCC_CLOCKTYPE_D1PCLK1;
-  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_HSI;
-  RCC_ClkInitStruct.SYSCLKDivider = RCC_SYSCLK_DIV1;
-  RCC_ClkInitStruct.AHBCLKDivider = RCC_HCLK_DIV1;
-  RCC_ClkInitStruct.APB3CLKDivider = RCC_APB3_DIV1;
-  RCC_ClkInitStruct.APB1CLKDivider = RCC_APB1_DIV1;
-  RCC_ClkInitStruct.APB2CLKDivider = RCC_APB2_DIV1;
-  RCC_ClkInitStruct.APB4CLKDivider = RCC_APB4_DIV1;
-
-  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_1) != HAL_OK)
+  if (Clock_ApplyProfile(CLOCK_PROFILE_BOOT) != HAL_OK)
   {
     Error_Handler();
   }
@@ -248,14 +505,12 @@ static void MX_DCMI_Init(void)
 
   /* USER CODE END DCMI_Init 1 */
   hdcmi.Instance = DCMI;
-  hdcmi.Init.SynchroMode = DCMI_SYNCHRO_EMBEDDED;
-  hdcmi.Init.PCKPolarity = DCMI_PCKPOLARITY_FALLING;
+  hdcmi.Init.SynchroMode = DCMI_SYNCHRO_HARDWARE;
+  hdcmi.Init.PCKPolarity = DCMI_PCKPOLARITY_RISING;
+  hdcmi.Init.VSPolarity = DCMI_VSPOLARITY_HIGH;
+  hdcmi.Init.HSPolarity = DCMI_HSPOLARITY_LOW;
   hdcmi.Init.CaptureRate = DCMI_CR_ALL_FRAME;
   hdcmi.Init.ExtendedDataMode = DCMI_EXTEND_DATA_8B;
-  hdcmi.Init.SyncroCode.FrameEndCode = 0;
-  hdcmi.Init.SyncroCode.FrameStartCode = 0;
-  hdcmi.Init.SyncroCode.LineStartCode = 0;
-  hdcmi.Init.SyncroCode.LineEndCode = 0;
   hdcmi.Init.JPEGMode = DCMI_JPEG_DISABLE;
   hdcmi.Init.ByteSelectMode = DCMI_BSM_ALL;
   hdcmi.Init.ByteSelectStart = DCMI_OEBS_ODD;
@@ -266,11 +521,145 @@ static void MX_DCMI_Init(void)
     Error_Handler();
   }
   /* USER CODE BEGIN DCMI_Init 2 */
+  // Polarities give the blanking level: the sensor (OV7670_COM10_SYNC) drives
+  // HREF high on valid data and VSYNC high between frames, and changes its
+  // data on the PCLK falling edge
+  // Frame interrupt drives the frame buffer rotation
+  HAL_NVIC_SetPriority(DCMI_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(DCMI_IRQn);
 
   /* USER CODE END DCMI_Init 2 */
 
 }
 
+/**
+  * @brief I2C1 Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_I2C1_Init(void)
+{
+
+  /* USER CODE BEGIN I2C1_Init 0 */
+
+  /* USER CODE END I2C1_Init 0 */
+
+  /* USER CODE BEGIN I2C1_Init 1 */
+
+  /* USER CODE END I2C1_Init 1 */
+  hi2c1.Instance = I2C1;
+  hi2c1.Init.Timing = 0x10707DBC;
+  hi2c1.Init.OwnAddress1 = 0;
+  hi2c1.Init.AddressingMode = I2C_ADDRESSINGMODE_7BIT;
+  hi2c1.Init.DualAddressMode = I2C_DUALADDRESS_DISABLE;
+  hi2c1.Init.OwnAddress2 = 0;
+  hi2c1.Init.OwnAddress2Masks = I2C_OA2_NOMASK;
+  hi2c1.Init.GeneralCallMode = I2C_GENERALCALL_DISABLE;
+  hi2c1.Init.NoStretchMode = I2C_NOSTRETCH_DISABLE;
+  if (HAL_I2C_Init(&hi2c1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Configure Analogue filter
+  */
+  if (HAL_I2CEx_ConfigAnalogFilter(&hi2c1, I2C_ANALOGFILTER_ENABLE) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Configure Digital filter
+  */
+  if (HAL_I2CEx_ConfigDigitalFilter(&hi2c1, 0) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN I2C1_Init 2 */
+
+  /* USER CODE END I2C1_Init 2 */
+
+}
+
+/**
+  * @brief TIM1 Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_TIM1_Init(void)
+{
+
+  /* USER CODE BEGIN TIM1_Init 0 */
+
+  /* USER CODE END TIM1_Init 0 */
+
+  TIM_ClockConfigTypeDef sClockSourceConfig = {0};
+  TIM_MasterConfigTypeDef sMasterConfig = {0};
+  TIM_OC_InitTypeDef sConfigOC = {0};
+  TIM_BreakDeadTimeConfigTypeDef sBreakDeadTimeConfig = {0};
+
+  /* USER CODE BEGIN TIM1_Init 1 */
+  // Period and pulse are replaced by Xclk_Start()
+  /* USER CODE END TIM1_Init 1 */
+  htim1.Instance = TIM1;
+  htim1.Init.Prescaler = 0;
+  htim1.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim1.Init.Period = 2;
+  htim1.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  htim1.Init.RepetitionCounter = 0;
+  htim1.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+  if (HAL_TIM_Base_Init(&htim1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sClockSourceConfig.ClockSource = TIM_CLOCKSOURCE_INTERNAL;
+  if (HAL_TIM_ConfigClockSource(&htim1, &sClockSourceConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  if (HAL_TIM_PWM_Init(&htim1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
+  sMasterConfig.MasterOutputTrigger2 = TIM_TRGO2_RESET;
+  sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+  if (HAL_TIMEx_MasterConfigSynchronization(&htim1, &sMasterConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sConfigOC.OCMode = TIM_OCMODE_PWM1;
+  sConfigOC.Pulse = 1;
+  sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
+  sConfigOC.OCNPolarity = TIM_OCNPOLARITY_HIGH;
+  sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
+  sConfigOC.OCIdleState = TIM_OCIDLESTATE_RESET;
+  sConfigOC.OCNIdleState = TIM_OCNIDLESTATE_RESET;
+  if (HAL_TIM_PWM_ConfigChannel(&htim1, &sConfigOC, TIM_CHANNEL_1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sBreakDeadTimeConfig.OffStateRunMode = TIM_OSSR_DISABLE;
+  sBreakDeadTimeConfig.OffStateIDLEMode = TIM_OSSI_DISABLE;
+  sBreakDeadTimeConfig.LockLevel = TIM_LOCKLEVEL_OFF;
+  sBreakDeadTimeConfig.DeadTime = 0;
+  sBreakDeadTimeConfig.BreakState = TIM_BREAK_DISABLE;
+  sBreakDeadTimeConfig.BreakPolarity = TIM_BREAKPOLARITY_HIGH;
+  sBreakDeadTimeConfig.BreakFilter = 0;
+  sBreakDeadTimeConfig.Break2State = TIM_BREAK2_DISABLE;
+  sBreakDeadTimeConfig.Break2Polarity = TIM_BREAK2POLARITY_HIGH;
+  sBreakDeadTimeConfig.Break2Filter = 0;
+  sBreakDeadTimeConfig.AutomaticOutput = TIM_AUTOMATICOUTPUT_DISABLE;
+  if (HAL_TIMEx_ConfigBreakDeadTime(&htim1, &sBreakDeadTimeConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN TIM1_Init 2 */
+
+  /* USER CODE END TIM1_Init 2 */
+  HAL_TIM_MspPostInit(&htim1);
+
+}
+
 /**
   * Enable DMA controller clock
   */
@@ -300,6 +689,7 @@ static void MX_GPIO_Init(void)
   __HAL_RCC_GPIOA_CLK_ENABLE();
   __HAL_RCC_GPIOC_CLK_ENABLE();
   __HAL_RCC_GPIOD_CLK_ENABLE();
+  __HAL_RCC_GPIOB_CLK_ENABLE();
 
 }
 
@@ -307,6 +697,18 @@ static void MX_GPIO_Init(void)
 
 /* USER CODE END 4 */
 
+/* MPU Configuration */
+
+static void MPU_Config(void)
+{
+  // Regions come from the layout table in mpu.c, which follows the linker
+  // script symbols
+  if (Mpu_ApplyLayout() != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
 /**
   * @brief  This function is executed in case of error occurrence.
   * @retval None
@@ -0,0 +1,158 @@
+/**
+  ******************************************************************************
+  * @file           : mpu.c
+  * @brief          : MPU region layout of the application memory.
+  ******************************************************************************
+  * The layout is the mpu_layout[] table below. Its ranges are linker
+  * symbols (__ram_d1_start, __stack_guard_start, ...) so the MPU follows the
+  * linker script instead of repeating its addresses. Region 0 is the CubeMX
+  * background region that stops speculative accesses to external memory
+  * space; table entries take regions 1 upward, a later entry overriding an
+  * earlier one where they overlap.
+  *
+  * Regions:
+  * - AXI SRAM (D1): processing buffers, .data/.bss, heap and stack.
+  *   Write-back / write-allocate.
+  * - D2 SRAM: DMA landing zones, not cacheable so no maintenance is needed.
+  * - Stack guard: no access, so running off the bottom of the main stack
+  *   raises a MemManage fault instead of silently corrupting the heap.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mpu.h"
+#include "cache.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  const uint8_t *start;
+  const uint8_t *end;
+  MpuMap_Attr_t attr;
+} Mpu_Layout_t;
+
+/* Private variables ---------------------------------------------------------*/
+// Symbols defined in the linker script
+extern uint8_t __ram_d1_start[];
+extern uint8_t __ram_d1_end[];
+extern uint8_t __ram_d2_start[];
+extern uint8_t __ram_d2_end[];
+extern uint8_t __stack_guard_start[];
+extern uint8_t __stack_guard_end[];
+
+static const Mpu_Layout_t mpu_layout[] =
+{
+  { __ram_d1_start,      __ram_d1_end,      MPU_MAP_WRITE_BACK },
+  { __ram_d2_start,      __ram_d2_end,      MPU_MAP_NON_CACHEABLE },
+#if (CACHE_DMA_SCRATCH_BYTES > 0U)
+  { dma_scratch,         dma_scratch + CACHE_DMA_SCRATCH_BYTES, MPU_MAP_NON_CACHEABLE },
+#endif
+  { __stack_guard_start, __stack_guard_end, MPU_MAP_NO_ACCESS },
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void Mpu_SetAttributes(MPU_Region_InitTypeDef *init, MpuMap_Attr_t attr);
+
+/**
+  * @brief  Program the MPU from mpu_layout[] and enable it with the default
+  *         memory map as background for privileged code.
+  * @retval HAL_ERROR if an entry cannot be encoded; the MPU then only holds
+  *         the background region
+  */
+HAL_StatusTypeDef Mpu_ApplyLayout(void)
+{
+  MPU_Region_InitTypeDef MPU_InitStruct = {0};
+  MpuMap_Region_t region;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t i;
+
+  /* Disables the MPU */
+  HAL_MPU_Disable();
+
+  // Background: no access to 0x60000000-0xDFFFFFFF (FMC / QSPI space)
+  MPU_InitStruct.Enable = MPU_REGION_ENABLE;
+  MPU_InitStruct.Number = MPU_REGION_NUMBER0;
+  MPU_InitStruct.BaseAddress = 0x0;
+  MPU_InitStruct.Size = MPU_REGION_SIZE_4GB;
+  MPU_InitStruct.SubRegionDisable = 0x87;
+  MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL0;
+  MPU_InitStruct.AccessPermission = MPU_REGION_NO_ACCESS;
+  MPU_InitStruct.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
+  MPU_InitStruct.IsShareable = MPU_ACCESS_SHAREABLE;
+  MPU_InitStruct.IsCacheable = MPU_ACCESS_NOT_CACHEABLE;
+  MPU_InitStruct.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+  HAL_MPU_ConfigRegion(&MPU_InitStruct);
+
+  for (i = 0; i < (sizeof(mpu_layout) / sizeof(mpu_layout[0])); i++)
+  {
+    if (MpuMap_Encode((uint32_t)mpu_layout[i].start, (uint32_t)mpu_layout[i].end, &region) != 0)
+    {
+      status = HAL_ERROR;
+      break;
+    }
+    // A guard that overhangs its range would fault on live data
+    if ((mpu_layout[i].attr == MPU_MAP_NO_ACCESS) && (region.limit != (uint32_t)mpu_layout[i].end))
+    {
+      status = HAL_ERROR;
+      break;
+    }
+
+    MPU_InitStruct.Number = (uint8_t)(MPU_REGION_NUMBER1 + i);
+    MPU_InitStruct.BaseAddress = region.base;
+    MPU_InitStruct.Size = region.size_field;
+    MPU_InitStruct.SubRegionDisable = region.srd;
+    Mpu_SetAttributes(&MPU_InitStruct, mpu_layout[i].attr);
+    HAL_MPU_ConfigRegion(&MPU_InitStruct);
+  }
+
+  /* Enables the MPU */
+  HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+
+  // Report MPU violations as MemManage rather than HardFault
+  SCB->SHCSR |= SCB_SHCSR_MEMFAULTENA_Msk;
+
+  return status;
+}
+
+/**
+  * @brief  Translate a layout attribute into TEX/C/B, access and XN bits.
+  * @param  init: region being configured
+  * @param  attr: layout attribute
+  * @retval None
+  */
+static void Mpu_SetAttributes(MPU_Region_InitTypeDef *init, MpuMap_Attr_t attr)
+{
+  init->Enable = MPU_REGION_ENABLE;
+  init->AccessPermission = MPU_REGION_FULL_ACCESS;
+  init->DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
+  // Shareable normal memory is not cached on the Cortex-M7
+  init->IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+
+  switch (attr)
+  {
+    case MPU_MAP_WRITE_BACK:
+      init->TypeExtField = MPU_TEX_LEVEL1;
+      init->IsCacheable = MPU_ACCESS_CACHEABLE;
+      init->IsBufferable = MPU_ACCESS_BUFFERABLE;
+      // Code may be executed from AXI SRAM (RAM debug build)
+      init->DisableExec = MPU_INSTRUCTION_ACCESS_ENABLE;
+      break;
+    case MPU_MAP_WRITE_THROUGH:
+      init->TypeExtField = MPU_TEX_LEVEL0;
+      init->IsCacheable = MPU_ACCESS_CACHEABLE;
+      init->IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+      break;
+    case MPU_MAP_NON_CACHEABLE:
+      init->TypeExtField = MPU_TEX_LEVEL1;
+      init->IsCacheable = MPU_ACCESS_NOT_CACHEABLE;
+      init->IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+      break;
+    case MPU_MAP_NO_ACCESS:
+    default:
+      init->TypeExtField = MPU_TEX_LEVEL0;
+      init->AccessPermission = MPU_REGION_NO_ACCESS;
+      init->IsCacheable = MPU_ACCESS_NOT_CACHEABLE;
+      init->IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+      break;
+  }
+}
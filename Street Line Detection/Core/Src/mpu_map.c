@@ -0,0 +1,94 @@
+/**
+  ******************************************************************************
+  * @file           : mpu_map.c
+  * @brief          : Encoding of address ranges into Cortex-M7 MPU regions.
+  ******************************************************************************
+  * An MPU region is a power of two in size, at least 32 bytes, and aligned
+  * to its size. Regions of 256 bytes and more are split into eight
+  * subregions that can be disabled one by one, which is how ranges such as
+  * the 288 KB D2 SRAM are covered without a second region.
+  *
+  * The encoder keeps the range start exact and rounds the end up to the next
+  * subregion boundary; the caller decides whether that overhang is
+  * acceptable (it never is for a no-access guard).
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mpu_map.h"
+
+#include <stddef.h>
+
+/**
+  * @brief  Find the smallest MPU region covering [start, end).
+  * @param  start: first address of the range
+  * @param  end: first address after the range
+  * @param  region: receives the encoding
+  * @retval 0 on success, -1 if the range is empty or cannot be encoded
+  */
+int32_t MpuMap_Encode(uint32_t start, uint32_t end, MpuMap_Region_t *region)
+{
+  uint32_t size_log2;
+  uint64_t region_size;
+  uint64_t base;
+  uint64_t sub;
+  uint64_t first;
+  uint64_t last;
+  uint32_t i;
+  uint8_t srd;
+
+  if ((region == NULL) || (end <= start))
+  {
+    return -1;
+  }
+
+  for (size_log2 = MPU_MAP_MIN_SIZE_LOG2; size_log2 <= 32U; size_log2++)
+  {
+    region_size = (uint64_t)1U << size_log2;
+    base = (uint64_t)start & ~(region_size - 1U);
+    if ((uint64_t)end > (base + region_size))
+    {
+      continue;
+    }
+
+    if (size_log2 < MPU_MAP_SUBREGION_LOG2)
+    {
+      // No subregions: the range must start on the region itself
+      if (base != start)
+      {
+        continue;
+      }
+      srd = 0U;
+      last = region_size;
+    }
+    else
+    {
+      sub = region_size / MPU_MAP_SUBREGIONS;
+      if ((((uint64_t)start - base) % sub) != 0U)
+      {
+        continue;
+      }
+      first = ((uint64_t)start - base) / sub;
+      last = (((uint64_t)end - base) + sub - 1U) / sub;
+
+      srd = 0U;
+      for (i = 0; i < MPU_MAP_SUBREGIONS; i++)
+      {
+        if ((i < first) || (i >= last))
+        {
+          srd |= (uint8_t)(1U << i);
+        }
+      }
+      last *= sub;
+    }
+
+    region->base = (uint32_t)base;
+    region->size_field = (uint8_t)(size_log2 - 1U);
+    region->srd = srd;
+    region->limit = (uint32_t)(base + last);
+
+    return 0;
+  }
+
+  return -1;
+}
@@ -0,0 +1,449 @@
+/**
+  ******************************************************************************
+  * @file           : ov7670.c
+  * @brief          : OV7670 register presets and table-driven SCCB loader.
+  ******************************************************************************
+  * Register tables are const arrays kept in flash. A preset is applied as
+  * reset, common defaults, resolution, then output format; every table is
+  * read back after it is written. Registers the sensor updates by itself
+  * (AGC/AEC/AWB results, the self-clearing reset bit) are excluded from the
+  * comparison, and a register written more than once in a table is only
+  * checked against its last value.
+  *
+  * The QVGA and QQVGA presets keep the sensor in VGA timing and use the DCW
+  * down-sampler with a matching PCLK divider, which also lowers the pixel
+  * rate seen by the DCMI. The frame timing stays VGA, so the frame rate only
+  * depends on XCLK and the CLKRC prescaler (OV7670_SolveClock()).
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ov7670.h"
+
+#include <stddef.h>
+
+/* Private define ------------------------------------------------------------*/
+#define OV7670_RESET_DELAY_MS   10U
+
+/* Private variables ---------------------------------------------------------*/
+static const OV7670_Reg_t ov7670_reset[] =
+{
+  { OV7670_REG_COM7, OV7670_COM7_RESET },
+  { OV7670_TABLE_DELAY, OV7670_RESET_DELAY_MS },
+  { OV7670_TABLE_END, 0x00 },
+};
+
+// Common settings: timing, gamma curve, AGC/AEC
+static const OV7670_Reg_t ov7670_defaults[] =
+{
+  { OV7670_REG_TSLB, 0x04 },
+  { OV7670_REG_COM10, OV7670_COM10_SYNC },   // Hardware sync for the DCMI, PCLK free running
+  { OV7670_REG_SCALING_XSC, 0x3A },
+  { OV7670_REG_SCALING_YSC, 0x35 },
+  { OV7670_REG_SCALING_PCLK_DELAY, 0x02 },
+  // Gamma curve
+  { 0x7A, 0x20 }, { 0x7B, 0x10 }, { 0x7C, 0x1E }, { 0x7D, 0x35 },
+  { 0x7E, 0x5A }, { 0x7F, 0x69 }, { 0x80, 0x76 }, { 0x81, 0x80 },
+  { 0x82, 0x88 }, { 0x83, 0x8F }, { 0x84, 0x96 }, { 0x85, 0xA3 },
+  { 0x86, 0xAF }, { 0x87, 0xC4 }, { 0x88, 0xD7 }, { 0x89, 0xE8 },
+  // AGC / AEC: disabled while seeding, then enabled
+  { OV7670_REG_COM8, 0xE0 },
+  { OV7670_REG_GAIN, 0x00 },
+  { OV7670_REG_AECH, 0x00 },
+  { OV7670_REG_COM4, 0x40 },
+  { OV7670_REG_COM9, 0x18 },
+  { OV7670_REG_BD50MAX, 0x05 },
+  { OV7670_REG_BD60MAX, 0x07 },
+  { OV7670_REG_AEW, 0x95 },
+  { OV7670_REG_AEB, 0x33 },
+  { OV7670_REG_VPT, 0xE3 },
+  { OV7670_REG_HAECC1, 0x78 },
+  { OV7670_REG_HAECC2, 0x68 },
+  { 0xA1, 0x03 },
+  { OV7670_REG_HAECC3, 0xD8 },
+  { OV7670_REG_HAECC4, 0xD8 },
+  { OV7670_REG_HAECC5, 0xF0 },
+  { OV7670_REG_HAECC6, 0x90 },
+  { OV7670_REG_HAECC7, 0x94 },
+  { OV7670_REG_COM8, 0xE5 },
+  { OV7670_TABLE_END, 0x00 },
+};
+
+static const OV7670_Reg_t ov7670_vga[] =
+{
+  { OV7670_REG_COM3, 0x00 },
+  { OV7670_REG_COM14, 0x00 },
+  { OV7670_REG_SCALING_DCWCTR, 0x11 },
+  { OV7670_REG_SCALING_PCLK_DIV, 0xF0 },
+  { OV7670_REG_HSTART, 0x13 },
+  { OV7670_REG_HSTOP, 0x01 },
+  { OV7670_REG_HREF, 0xB6 },
+  { OV7670_REG_VSTART, 0x02 },
+  { OV7670_REG_VSTOP, 0x7A },
+  { OV7670_REG_VREF, 0x0A },
+  { OV7670_TABLE_END, 0x00 },
+};
+
+static const OV7670_Reg_t ov7670_qvga[] =
+{
+  { OV7670_REG_COM3, 0x04 },    // DCW enable
+  { OV7670_REG_COM14, 0x19 },   // Manual scaling, PCLK / 2
+  { OV7670_REG_SCALING_DCWCTR, 0x11 },
+  { OV7670_REG_SCALING_PCLK_DIV, 0xF1 },
+  { OV7670_REG_HSTART, 0x16 },
+  { OV7670_REG_HSTOP, 0x04 },
+  { OV7670_REG_HREF, 0x24 },
+  { OV7670_REG_VSTART, 0x02 },
+  { OV7670_REG_VSTOP, 0x7A },
+  { OV7670_REG_VREF, 0x0A },
+  { OV7670_TABLE_END, 0x00 },
+};
+
+static const OV7670_Reg_t ov7670_qqvga[] =
+{
+  { OV7670_REG_COM3, 0x04 },    // DCW enable
+  { OV7670_REG_COM14, 0x1A },   // Manual scaling, PCLK / 4
+  { OV7670_REG_SCALING_DCWCTR, 0x22 },
+  { OV7670_REG_SCALING_PCLK_DIV, 0xF2 },
+  { OV7670_REG_HSTART, 0x16 },
+  { OV7670_REG_HSTOP, 0x04 },
+  { OV7670_REG_HREF, 0xA4 },
+  { OV7670_REG_VSTART, 0x02 },
+  { OV7670_REG_VSTOP, 0x7A },
+  { OV7670_REG_VREF, 0x0A },
+  { OV7670_TABLE_END, 0x00 },
+};
+
+static const OV7670_Reg_t ov7670_yuv422[] =
+{
+  { OV7670_REG_COM7, 0x00 },
+  { OV7670_REG_RGB444, 0x00 },
+  { OV7670_REG_COM1, 0x00 },    // No CCIR656 codes: sync is on HREF / VSYNC
+  { OV7670_REG_COM15, 0xC0 },   // Full 0-255 output range
+  { OV7670_REG_COM9, 0x48 },
+  { 0x4F, 0x80 }, { 0x50, 0x80 }, { 0x51, 0x00 },
+  { 0x52, 0x22 }, { 0x53, 0x5E }, { 0x54, 0x80 },
+  { OV7670_REG_COM13, 0xC0 },   // Gamma, UV saturation auto adjust
+  { OV7670_TABLE_END, 0x00 },
+};
+
+static const OV7670_Reg_t ov7670_rgb565[] =
+{
+  { OV7670_REG_COM7, 0x04 },
+  { OV7670_REG_RGB444, 0x00 },
+  { OV7670_REG_COM1, 0x00 },    // No CCIR656 codes: sync is on HREF / VSYNC
+  { OV7670_REG_COM15, 0xD0 },   // RGB565, full output range
+  { OV7670_REG_COM9, 0x38 },
+  { 0x4F, 0xB3 }, { 0x50, 0xB3 }, { 0x51, 0x00 },
+  { 0x52, 0x3D }, { 0x53, 0xA7 }, { 0x54, 0xE4 },
+  { OV7670_REG_COM13, 0xC0 },
+  { OV7670_TABLE_END, 0x00 },
+};
+
+static const OV7670_Reg_t ov7670_bayer[] =
+{
+  { OV7670_REG_COM7, 0x01 },
+  { OV7670_REG_COM13, 0x08 },
+  { OV7670_REG_COM16, 0x3D },
+  { OV7670_REG_REG76, 0xE1 },
+  { OV7670_TABLE_END, 0x00 },
+};
+
+static const OV7670_Reg_t *const ov7670_resolutions[OV7670_RES_COUNT] =
+{
+  [OV7670_RES_VGA]   = ov7670_vga,
+  [OV7670_RES_QVGA]  = ov7670_qvga,
+  [OV7670_RES_QQVGA] = ov7670_qqvga,
+};
+
+static const OV7670_Reg_t *const ov7670_formats[OV7670_FMT_COUNT] =
+{
+  [OV7670_FMT_YUV422]    = ov7670_yuv422,
+  [OV7670_FMT_RGB565]    = ov7670_rgb565,
+  [OV7670_FMT_BAYER_RAW] = ov7670_bayer,
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static int32_t OV7670_Apply(const OV7670_Bus_t *bus, const OV7670_Reg_t *table);
+static uint8_t OV7670_VerifyMask(uint8_t reg);
+static uint8_t OV7670_WrittenAgain(const OV7670_Reg_t *entry);
+
+/**
+  * @brief  Reset the sensor and load a resolution / output format preset.
+  * @param  bus: register access
+  * @param  resolution: output resolution
+  * @param  format: output format (raw Bayer requires VGA)
+  * @retval OV7670_OK or a negative OV7670_ERR_xxx code
+  */
+int32_t OV7670_Init(const OV7670_Bus_t *bus, OV7670_Resolution_t resolution, OV7670_Format_t format)
+{
+  int32_t status;
+
+  if ((bus == NULL) || (resolution >= OV7670_RES_COUNT) || (format >= OV7670_FMT_COUNT))
+  {
+    return OV7670_ERR_PARAM;
+  }
+  if ((format == OV7670_FMT_BAYER_RAW) && (resolution != OV7670_RES_VGA))
+  {
+    // The DCW down-sampler would mix Bayer sites
+    return OV7670_ERR_PARAM;
+  }
+
+  status = OV7670_CheckId(bus);
+  if (status != OV7670_OK)
+  {
+    return status;
+  }
+
+  status = OV7670_WriteTable(bus, ov7670_reset);
+  if (status == OV7670_OK)
+  {
+    status = OV7670_Apply(bus, ov7670_defaults);
+  }
+  if (status == OV7670_OK)
+  {
+    status = OV7670_Apply(bus, ov7670_resolutions[resolution]);
+  }
+  if (status == OV7670_OK)
+  {
+    status = OV7670_Apply(bus, ov7670_formats[format]);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Check the product ID and version registers.
+  * @param  bus: register access
+  * @retval OV7670_OK, OV7670_ERR_BUS or OV7670_ERR_ID
+  */
+int32_t OV7670_CheckId(const OV7670_Bus_t *bus)
+{
+  uint8_t pid;
+  uint8_t ver;
+
+  if ((bus->read(bus->ctx, OV7670_REG_PID, &pid) != 0) ||
+      (bus->read(bus->ctx, OV7670_REG_VER, &ver) != 0))
+  {
+    return OV7670_ERR_BUS;
+  }
+  if ((pid != OV7670_PID_VALUE) || (ver != OV7670_VER_VALUE))
+  {
+    return OV7670_ERR_ID;
+  }
+
+  return OV7670_OK;
+}
+
+/**
+  * @brief  Find the XCLK timer period and CLKRC divider giving the frame rate
+  *         closest to @p fps. XCLK is generated as timer_clock_hz / period and
+  *         must stay within the sensor input range; on ties the higher XCLK
+  *         and the smaller divider win.
+  * @param  timer_clock_hz: counter clock of the XCLK timer
+  * @param  fps: target frame rate (frames per second)
+  * @param  config: receives the selected setting
+  * @retval OV7670_OK, or OV7670_ERR_PARAM if no period reaches the XCLK range
+  */
+int32_t OV7670_SolveClock(uint32_t timer_clock_hz, uint32_t fps, OV7670_ClockConfig_t *config)
+{
+  uint32_t period;
+  uint32_t period_min;
+  uint32_t period_max;
+  uint32_t div;
+  uint32_t xclk;
+  uint64_t fps_milli;
+  uint64_t target = (uint64_t)fps * 1000U;
+  uint64_t error;
+  uint64_t best_error = UINT64_MAX;
+
+  if ((config == NULL) || (fps == 0U))
+  {
+    return OV7670_ERR_PARAM;
+  }
+
+  // Smallest period keeps XCLK <= max, largest keeps XCLK >= min; period 1
+  // cannot produce a clock edge
+  period_min = (timer_clock_hz + OV7670_XCLK_MAX_HZ - 1U) / OV7670_XCLK_MAX_HZ;
+  period_max = timer_clock_hz / OV7670_XCLK_MIN_HZ;
+  if (period_min < 2U)
+  {
+    period_min = 2U;
+  }
+
+  for (period = period_min; period <= period_max; period++)
+  {
+    xclk = timer_clock_hz / period;
+    for (div = 1U; div <= OV7670_CLKRC_MAX_DIV; div++)
+    {
+      fps_milli = ((uint64_t)xclk * 1000U) / ((uint64_t)div * OV7670_CLOCKS_PER_FRAME);
+      error = (fps_milli > target) ? (fps_milli - target) : (target - fps_milli);
+      if (error < best_error)
+      {
+        best_error = error;
+        config->timer_period = period;
+        config->clkrc_div = div;
+        config->xclk_hz = xclk;
+        config->fps_milli = (uint32_t)fps_milli;
+      }
+      if (fps_milli < target)
+      {
+        // Larger dividers only move further away
+        break;
+      }
+    }
+  }
+
+  return (best_error == UINT64_MAX) ? OV7670_ERR_PARAM : OV7670_OK;
+}
+
+/**
+  * @brief  Program the sensor internal clock prescaler.
+  * @param  bus: register access
+  * @param  clkrc_div: divider, 1 to OV7670_CLKRC_MAX_DIV
+  * @retval OV7670_OK, OV7670_ERR_PARAM or OV7670_ERR_BUS
+  */
+int32_t OV7670_SetClockDivider(const OV7670_Bus_t *bus, uint32_t clkrc_div)
+{
+  if ((bus == NULL) || (clkrc_div == 0U) || (clkrc_div > OV7670_CLKRC_MAX_DIV))
+  {
+    return OV7670_ERR_PARAM;
+  }
+  if (bus->write(bus->ctx, OV7670_REG_CLKRC, (uint8_t)(clkrc_div - 1U)) != 0)
+  {
+    return OV7670_ERR_BUS;
+  }
+
+  return OV7670_OK;
+}
+
+/**
+  * @brief  Write a register table up to its OV7670_TABLE_END entry.
+  * @param  bus: register access
+  * @param  table: register table
+  * @retval OV7670_OK or OV7670_ERR_BUS
+  */
+int32_t OV7670_WriteTable(const OV7670_Bus_t *bus, const OV7670_Reg_t *table)
+{
+  const OV7670_Reg_t *entry;
+
+  for (entry = table; entry->reg != OV7670_TABLE_END; entry++)
+  {
+    if (entry->reg == OV7670_TABLE_DELAY)
+    {
+      if (bus->delay_ms != NULL)
+      {
+        bus->delay_ms(bus->ctx, entry->value);
+      }
+      continue;
+    }
+    if (bus->write(bus->ctx, entry->reg, entry->value) != 0)
+    {
+      return OV7670_ERR_BUS;
+    }
+  }
+
+  return OV7670_OK;
+}
+
+/**
+  * @brief  Read back a register table and compare with the written values.
+  * @param  bus: register access
+  * @param  table: register table
+  * @param  failed_reg: if not NULL, receives the first mismatching register
+  * @retval OV7670_OK, OV7670_ERR_BUS or OV7670_ERR_VERIFY
+  */
+int32_t OV7670_VerifyTable(const OV7670_Bus_t *bus, const OV7670_Reg_t *table, uint8_t *failed_reg)
+{
+  const OV7670_Reg_t *entry;
+  uint8_t value;
+  uint8_t mask;
+
+  for (entry = table; entry->reg != OV7670_TABLE_END; entry++)
+  {
+    mask = OV7670_VerifyMask(entry->reg);
+    if ((entry->reg == OV7670_TABLE_DELAY) || (mask == 0U) || (OV7670_WrittenAgain(entry) != 0U))
+    {
+      continue;
+    }
+    if (bus->read(bus->ctx, entry->reg, &value) != 0)
+    {
+      return OV7670_ERR_BUS;
+    }
+    if (((value ^ entry->value) & mask) != 0U)
+    {
+      if (failed_reg != NULL)
+      {
+        *failed_reg = entry->reg;
+      }
+      return OV7670_ERR_VERIFY;
+    }
+  }
+
+  return OV7670_OK;
+}
+
+/**
+  * @brief  Write a table and read it back.
+  * @param  bus: register access
+  * @param  table: register table
+  * @retval OV7670_OK or a negative OV7670_ERR_xxx code
+  */
+static int32_t OV7670_Apply(const OV7670_Bus_t *bus, const OV7670_Reg_t *table)
+{
+  int32_t status = OV7670_WriteTable(bus, table);
+
+  if (status != OV7670_OK)
+  {
+    return status;
+  }
+
+  return OV7670_VerifyTable(bus, table, NULL);
+}
+
+/**
+  * @brief  Bits of a register expected to read back as written.
+  * @param  reg: register address
+  * @retval Comparison mask, 0 if the register is not checked
+  */
+static uint8_t OV7670_VerifyMask(uint8_t reg)
+{
+  switch (reg)
+  {
+    case OV7670_REG_GAIN:
+    case OV7670_REG_BLUE:
+    case OV7670_REG_RED:
+    case OV7670_REG_AECH:
+      // Updated by AGC / AWB / AEC
+      return 0x00U;
+    case OV7670_REG_VREF:
+      // Bits 7:6 hold AGC[9:8]
+      return 0x0FU;
+    case OV7670_REG_COM7:
+      // Reset bit clears itself
+      return 0x7FU;
+    default:
+      return 0xFFU;
+  }
+}
+
+/**
+  * @brief  Whether the register of @p entry is written again later in the
+  *         same table, in which case only the last value is checked.
+  * @param  entry: table entry
+  * @retval 1 if written again, 0 otherwise
+  */
+static uint8_t OV7670_WrittenAgain(const OV7670_Reg_t *entry)
+{
+  const OV7670_Reg_t *next;
+
+  for (next = entry + 1; next->reg != OV7670_TABLE_END; next++)
+  {
+    if (next->reg == entry->reg)
+    {
+      return 1U;
+    }
+  }
+
+  return 0U;
+}
@@ -0,0 +1,87 @@
+/**
+  ******************************************************************************
+  * @file           : roi.c
+  * @brief          : Region-of-interest to DCMI crop window conversion.
+  ******************************************************************************
+  * The DCMI crop window counts pixel clocks horizontally (one per byte in
+  * 8-bit mode) and lines vertically. Sizes are programmed minus one. Byte
+  * and line select then decimate the cropped window before it reaches the
+  * DMA. Every stored line must be a whole number of 32-bit words so that
+  * lines stay word aligned in the DMA destination buffer.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "roi.h"
+
+#include <stddef.h>
+
+/**
+  * @brief  Convert a rectangle in sensor pixels into crop register values,
+  *         buffer size and DMA transfer count.
+  * @param  roi: rectangle, must lie inside the sensor image
+  * @param  sensor_width: sensor output width (pixels)
+  * @param  sensor_height: sensor output height (lines)
+  * @param  format: bus pixel format and byte/line decimation
+  * @param  crop: receives the crop configuration
+  * @retval 0 on success, -1 if the rectangle cannot be captured
+  */
+int32_t Roi_ComputeCrop(const Roi_t *roi, uint32_t sensor_width, uint32_t sensor_height,
+                        const Roi_Format_t *format, Roi_Crop_t *crop)
+{
+  uint32_t bytes_per_pixel;
+  uint32_t bus_bytes;
+  uint32_t line_bytes;
+  uint32_t lines;
+  uint32_t frame_bytes;
+
+  if ((roi == NULL) || (crop == NULL) || (format == NULL) || (format->bytes_per_pixel == 0U))
+  {
+    return -1;
+  }
+  if (((format->byte_step != 1U) && (format->byte_step != 2U) && (format->byte_step != 4U)) ||
+      ((format->line_step != 1U) && (format->line_step != 2U)))
+  {
+    return -1;
+  }
+  if ((roi->width == 0U) || (roi->height == 0U))
+  {
+    return -1;
+  }
+  if (((uint32_t)roi->x + roi->width > sensor_width) || ((uint32_t)roi->y + roi->height > sensor_height))
+  {
+    return -1;
+  }
+
+  bytes_per_pixel = format->bytes_per_pixel;
+  bus_bytes = (uint32_t)roi->width * bytes_per_pixel;
+  if (((bus_bytes % format->byte_step) != 0U) || ((roi->height % format->line_step) != 0U))
+  {
+    return -1;
+  }
+
+  line_bytes = bus_bytes / format->byte_step;
+  lines = (uint32_t)roi->height / format->line_step;
+  frame_bytes = line_bytes * lines;
+
+  if (((line_bytes % 4U) != 0U) || ((frame_bytes / 4U) > ROI_DMA_MAX_WORDS))
+  {
+    return -1;
+  }
+  if ((((uint32_t)roi->x * bytes_per_pixel) > ROI_HOFFCNT_MAX) || (roi->y > ROI_VST_MAX) ||
+      ((bus_bytes - 1U) > ROI_CAPCNT_MAX) || ((roi->height - 1U) > ROI_VLINE_MAX))
+  {
+    return -1;
+  }
+
+  crop->x0 = (uint32_t)roi->x * bytes_per_pixel;
+  crop->y0 = roi->y;
+  crop->xsize = bus_bytes - 1U;
+  crop->ysize = (uint32_t)roi->height - 1U;
+  crop->line_bytes = line_bytes;
+  crop->lines = lines;
+  crop->frame_bytes = frame_bytes;
+  crop->dma_words = frame_bytes / 4U;
+
+  return 0;
+}
@@ -0,0 +1,86 @@
+/**
+  ******************************************************************************
+  * @file           : sccb.c
+  * @brief          : OV7670 register access over SCCB using the HAL I2C driver.
+  ******************************************************************************
+  * SCCB writes are plain I2C register writes. Reads must not use a repeated
+  * start: the register address is sent in its own transaction, terminated by
+  * a stop, before the data byte is read.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sccb.h"
+
+/* Private function prototypes -----------------------------------------------*/
+static int32_t SCCB_Write(void *ctx, uint8_t reg, uint8_t value);
+static int32_t SCCB_Read(void *ctx, uint8_t reg, uint8_t *value);
+static void SCCB_Delay(void *ctx, uint32_t ms);
+
+/**
+  * @brief  Bind an OV7670 bus descriptor to an initialised I2C handle.
+  * @param  bus: descriptor to fill
+  * @param  hi2c: I2C handle wired to the camera SIO_C / SIO_D pins
+  * @retval None
+  */
+void SCCB_InitBus(OV7670_Bus_t *bus, I2C_HandleTypeDef *hi2c)
+{
+  bus->write = SCCB_Write;
+  bus->read = SCCB_Read;
+  bus->delay_ms = SCCB_Delay;
+  bus->ctx = hi2c;
+}
+
+/**
+  * @brief  Write one sensor register.
+  * @param  ctx: I2C handle
+  * @param  reg: register address
+  * @param  value: register value
+  * @retval 0 on success, -1 on bus error
+  */
+static int32_t SCCB_Write(void *ctx, uint8_t reg, uint8_t value)
+{
+  uint8_t frame[2] = { reg, value };
+
+  if (HAL_I2C_Master_Transmit((I2C_HandleTypeDef *)ctx, OV7670_SCCB_ADDR, frame, sizeof(frame), SCCB_TIMEOUT_MS) != HAL_OK)
+  {
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Read one sensor register.
+  * @param  ctx: I2C handle
+  * @param  reg: register address
+  * @param  value: receives the register value
+  * @retval 0 on success, -1 on bus error
+  */
+static int32_t SCCB_Read(void *ctx, uint8_t reg, uint8_t *value)
+{
+  I2C_HandleTypeDef *hi2c = (I2C_HandleTypeDef *)ctx;
+
+  if (HAL_I2C_Master_Transmit(hi2c, OV7670_SCCB_ADDR, &reg, 1, SCCB_TIMEOUT_MS) != HAL_OK)
+  {
+    return -1;
+  }
+  if (HAL_I2C_Master_Receive(hi2c, OV7670_SCCB_ADDR, value, 1, SCCB_TIMEOUT_MS) != HAL_OK)
+  {
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Blocking delay between table entries.
+  * @param  ctx: unused
+  * @param  ms: delay in milliseconds
+  * @retval None
+  */
+static void SCCB_Delay(void *ctx, uint32_t ms)
+{
+  (void)ctx;
+  HAL_Delay(ms);
+}
@@ -35,14 +35,15 @@ static uint8_t *__sbrk_heap_end = NULL;
  *
  * @verbatim
  * ############################################################################
- * #  .data  #  .bss  #       newlib heap       #          MSP stack          #
- * #         #        #                         # Reserved by _Min_Stack_Size #
+ * #  .data  #  .bss  #  newlib heap  #  guard  #          MSP stack          #
+ * #         #        #               #         # Reserved by _Min_Stack_Size #
  * ############################################################################
  * ^-- RAM start      ^-- _end                             _estack, RAM end --^
  * @endverbatim
  *
  * This implementation starts allocating at the '_end' linker symbol
  * The '_Min_Stack_Size' linker symbol reserves a memory for the MSP stack
+ * and '_Stack_Guard_Size' the MPU no-access guard below it
  * The implementation considers '_estack' linker symbol to be RAM end
  * NOTE: If the MSP stack, at any point during execution, grows larger than the
  * reserved size, please increase the '_Min_Stack_Size'.
@@ -55,7 +56,8 @@ void *_sbrk(ptrdiff_t incr)
   extern uint8_t _end; /* Symbol defined in the linker script */
   extern uint8_t _estack; /* Symbol defined in the linker script */
   extern uint32_t _Min_Stack_Size; /* Symbol defined in the linker script */
-  const uint32_t stack_limit = (uint32_t)&_estack - (uint32_t)&_Min_Stack_Size;
+  extern uint32_t _Stack_Guard_Size; /* Symbol defined in the linker script */
+  const uint32_t stack_limit = (uint32_t)&_estack - (uint32_t)&_Min_Stack_Size - (uint32_t)&_Stack_Guard_Size;
   const uint8_t *max_heap = (uint8_t *)stack_limit;
   uint8_t *prev_heap_end;
 
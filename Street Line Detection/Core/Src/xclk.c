@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * @file           : xclk.c
+  * @brief          : Camera XCLK generation from a timer PWM channel.
+  ******************************************************************************
+  * The OV7670 has no oscillator of its own: its master clock comes from a
+  * 50 % duty PWM on an APB2 timer (TIM1_CH1 on PE9). The frame rate is set
+  * by XCLK together with the sensor CLKRC prescaler, and both are chosen by
+  * OV7670_SolveClock() so that a caller only asks for frames per second.
+  *
+  * ARR and CCR are preloaded, so a rate change takes effect on the next
+  * update event without a runt pulse on XCLK.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "xclk.h"
+
+/* Private function prototypes -----------------------------------------------*/
+static void Xclk_ApplyPeriod(TIM_HandleTypeDef *htim, uint32_t period);
+
+/**
+  * @brief  Counter clock of the APB2 timers (TIM1, TIM8, TIM15-17).
+  * @retval Timer clock in Hz
+  */
+uint32_t Xclk_GetTimerClock(void)
+{
+  uint32_t pclk = HAL_RCC_GetPCLK2Freq();
+
+  // Timers run at twice the APB clock whenever the APB prescaler divides
+  if ((RCC->D2CFGR & RCC_D2CFGR_D2PPRE2) != RCC_APB2_DIV1)
+  {
+    pclk *= 2U;
+  }
+
+  return pclk;
+}
+
+/**
+  * @brief  Start XCLK at the setting that best matches a frame rate. The
+  *         sensor is not accessed; its CLKRC is applied by OV7670_Init()
+  *         defaults and later by Xclk_SetFrameRate().
+  * @param  htim: PWM timer handle, initialised with prescaler 0
+  * @param  fps: target frame rate
+  * @param  applied: if not NULL, receives the selected setting
+  * @retval HAL status
+  */
+HAL_StatusTypeDef Xclk_Start(TIM_HandleTypeDef *htim, uint32_t fps, OV7670_ClockConfig_t *applied)
+{
+  OV7670_ClockConfig_t config;
+
+  if (OV7670_SolveClock(Xclk_GetTimerClock(), fps, &config) != OV7670_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  Xclk_ApplyPeriod(htim, config.timer_period);
+  __HAL_TIM_SET_COUNTER(htim, 0U);
+  // Load the preloaded registers before the output is enabled
+  htim->Instance->EGR = TIM_EGR_UG;
+
+  if (applied != NULL)
+  {
+    *applied = config;
+  }
+
+  return HAL_TIM_PWM_Start(htim, XCLK_TIM_CHANNEL);
+}
+
+/**
+  * @brief  Retune XCLK and the sensor prescaler for a new frame rate while
+  *         the clock is running.
+  * @param  htim: running PWM timer handle
+  * @param  bus: sensor register access, or NULL to leave CLKRC unchanged
+  * @param  fps: target frame rate
+  * @param  applied: if not NULL, receives the selected setting
+  * @retval HAL status
+  */
+HAL_StatusTypeDef Xclk_SetFrameRate(TIM_HandleTypeDef *htim, const OV7670_Bus_t *bus, uint32_t fps, OV7670_ClockConfig_t *applied)
+{
+  OV7670_ClockConfig_t config;
+
+  if (OV7670_SolveClock(Xclk_GetTimerClock(), fps, &config) != OV7670_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  Xclk_ApplyPeriod(htim, config.timer_period);
+
+  if ((bus != NULL) && (OV7670_SetClockDivider(bus, config.clkrc_div) != OV7670_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  if (applied != NULL)
+  {
+    *applied = config;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop XCLK. The sensor stops producing frames.
+  * @param  htim: PWM timer handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef Xclk_Stop(TIM_HandleTypeDef *htim)
+{
+  return HAL_TIM_PWM_Stop(htim, XCLK_TIM_CHANNEL);
+}
+
+/**
+  * @brief  Program a 50 % duty PWM of the given period.
+  * @param  htim: PWM timer handle
+  * @param  period: timer clocks per XCLK period (at least 2)
+  * @retval None
+  */
+static void Xclk_ApplyPeriod(TIM_HandleTypeDef *htim, uint32_t period)
+{
+  __HAL_TIM_SET_AUTORELOAD(htim, period - 1U);
+  __HAL_TIM_SET_COMPARE(htim, XCLK_TIM_CHANNEL, period / 2U);
+}
@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+"""Check code and buffer placement in a GNU ld map file.
+
+The linker scripts route FAST_CODE, FAST_DATA, FAST_BSS / LINE_BUFFER and
+DMA_BUFFER (Core/Inc/sections.h) to dedicated output sections. This script
+reads the .map file written by the build and verifies that:
+
+  - every placement section lies inside its memory region, and sections
+    copied by the startup code are loaded from flash (or RAM_EXEC);
+  - no input section meant for a placement section was left elsewhere;
+  - symbols named with --expect live in the requested region.
+
+Usage:
+  check_placement.py "Debug/Street Line Detection.map"
+  check_placement.py build.map --expect Vision_GaussRow=ITCMRAM \\
+                               --expect capture_band=RAM_D2
+
+Exit status is 0 when every check passes, 1 otherwise.
+"""
+
+import argparse
+import re
+import sys
+
+# Output section -> (run region, load regions or None when not copied)
+PLACEMENT = {
+    ".itcm_text":  ("ITCMRAM", ("FLASH", "RAM_EXEC")),
+    ".dtcm_data":  ("DTCMRAM", ("FLASH", "RAM_EXEC")),
+    ".dtcm_bss":   ("DTCMRAM", None),
+    ".dma_buffer": ("RAM_D2",  None),
+}
+
+# Input section prefix -> output section it must end up in
+ROUTING = {
+    ".itcm_text":  ".itcm_text",
+    ".dtcm_data":  ".dtcm_data",
+    ".dtcm_bss":   ".dtcm_bss",
+    ".dma_buffer": ".dma_buffer",
+}
+
+# Sections that are not loaded on the target
+NOT_ALLOCATED = (".debug", ".comment", ".ARM.attributes", ".stab")
+
+HEX = r"0x[0-9a-fA-F]+"
+RE_REGION = re.compile(r"^(\S+)\s+(" + HEX + r")\s+(" + HEX + r")")
+RE_OUTPUT = re.compile(r"^(\.\S+)(?:\s+(" + HEX + r")\s+(" + HEX + r")(?:\s+load address\s+(" + HEX + r"))?)?\s*$")
+RE_ADDR_ONLY = re.compile(r"^\s+(" + HEX + r")\s+(" + HEX + r")(?:\s+load address\s+(" + HEX + r"))?")
+RE_INPUT = re.compile(r"^ (\.\S+)(?:\s+(" + HEX + r")\s+(" + HEX + r")\s+(.*))?\s*$")
+RE_INPUT_CONT = re.compile(r"^\s+(" + HEX + r")\s+(" + HEX + r")\s+(\S.*)$")
+RE_SYMBOL = re.compile(r"^\s+(" + HEX + r")\s+([A-Za-z_][A-Za-z0-9_$.]*)\s*$")
+
+
+class MapFile:
+    """Regions, output sections, input sections and symbols of a map file."""
+
+    def __init__(self, path):
+        self.regions = {}
+        self.outputs = {}
+        self.inputs = []
+        self.symbols = {}
+        with open(path, encoding="utf-8", errors="replace") as handle:
+            self._parse(handle.read().splitlines())
+
+    def _parse(self, lines):
+        i = 0
+        while i < len(lines) and lines[i].strip() != "Memory Configuration":
+            i += 1
+        i += 1
+        while i < len(lines) and not lines[i].startswith("Linker script and memory map"):
+            match = RE_REGION.match(lines[i])
+            if match and match.group(1) not in ("Name", "*default*"):
+                self.regions[match.group(1)] = (int(match.group(2), 16), int(match.group(3), 16))
+            i += 1
+
+        current = None
+        pending_input = None
+        while i < len(lines):
+            line = lines[i]
+            i += 1
+            if line.startswith("/DISCARD/"):
+                current = None
+                continue
+
+            match = RE_OUTPUT.match(line)
+            if match:
+                name, addr, size, load = match.groups()
+                if addr is None and i < len(lines):
+                    cont = RE_ADDR_ONLY.match(lines[i])
+                    if cont:
+                        addr, size, load = cont.groups()
+                        i += 1
+                if addr is None or name.startswith(NOT_ALLOCATED):
+                    current = None
+                    continue
+                current = name
+                self.outputs[name] = (int(addr, 16), int(size, 16), int(load, 16) if load else None)
+                continue
+
+            if current is None:
+                continue
+
+            match = RE_INPUT.match(line)
+            if match:
+                name, addr, size, origin = match.groups()
+                if addr is None:
+                    pending_input = name
+                    continue
+                self.inputs.append((name, current, int(addr, 16), int(size, 16), origin.strip()))
+                pending_input = None
+                continue
+
+            if pending_input is not None:
+                cont = RE_INPUT_CONT.match(line)
+                pending = pending_input
+                pending_input = None
+                if cont:
+                    addr, size, origin = cont.groups()
+                    self.inputs.append((pending, current, int(addr, 16), int(size, 16), origin.strip()))
+                    continue
+
+            match = RE_SYMBOL.match(line)
+            if match:
+                self.symbols[match.group(2)] = int(match.group(1), 16)
+
+    def region_of(self, addr):
+        for name, (origin, length) in self.regions.items():
+            if origin <= addr < origin + length:
+                return name
+        return None
+
+    def in_region(self, region, addr, size):
+        if region not in self.regions:
+            return False
+        origin, length = self.regions[region]
+        return origin <= addr and addr + size <= origin + length
+
+
+def check(map_file, expectations):
+    errors = []
+
+    for section, (region, load_regions) in PLACEMENT.items():
+        if section not in map_file.outputs:
+            errors.append("%s: output section missing (linker script not updated?)" % section)
+            continue
+        addr, size, load = map_file.outputs[section]
+        if size == 0:
+            continue
+        if not map_file.in_region(region, addr, size):
+            errors.append("%s: 0x%08x+0x%x not inside %s" % (section, addr, size, region))
+        if load_regions is not None:
+            load_region = map_file.region_of(load) if load is not None else None
+            if load_region not in load_regions:
+                errors.append("%s: load address not in %s" % (section, "/".join(load_regions)))
+
+    for name, output, addr, size, origin in map_file.inputs:
+        for prefix, wanted in ROUTING.items():
+            if (name == prefix or name.startswith(prefix + ".")) and output != wanted and size != 0:
+                errors.append("%s (%s) ended up in %s instead of %s" % (name, origin, output, wanted))
+
+    for symbol, region in expectations:
+        if symbol not in map_file.symbols:
+            errors.append("%s: symbol not found in the map" % symbol)
+            continue
+        addr = map_file.symbols[symbol] & ~1
+        actual = map_file.region_of(addr)
+        if actual != region:
+            errors.append("%s: at 0x%08x in %s, expected %s" % (symbol, addr, actual, region))
+
+    return errors
+
+
+def parse_expectation(text):
+    if "=" not in text:
+        raise argparse.ArgumentTypeError("expected SYMBOL=REGION, got %r" % text)
+    symbol, region = text.split("=", 1)
+    return symbol.strip(), region.strip()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("map", help="linker map file")
+    parser.add_argument("--expect", action="append", default=[], type=parse_expectation,
+                        metavar="SYMBOL=REGION", help="require SYMBOL to be placed in REGION")
+    parser.add_argument("--quiet", action="store_true", help="only print errors")
+    args = parser.parse_args()
+
+    map_file = MapFile(args.map)
+    if not map_file.regions:
+        print("%s: no memory configuration found" % args.map, file=sys.stderr)
+        return 1
+
+    if not args.quiet:
+        for section in sorted(map_file.outputs, key=lambda s: map_file.outputs[s][0]):
+            addr, size, _ = map_file.outputs[section]
+            if size:
+                print("%-20s 0x%08x %8d  %s" % (section, addr, size, map_file.region_of(addr) or "-"))
+
+    errors = check(map_file, args.expect)
+    for error in errors:
+        print("error: " + error, file=sys.stderr)
+
+    return 1 if errors else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
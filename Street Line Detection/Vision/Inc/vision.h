@@ -0,0 +1,30 @@
+/**
+  ******************************************************************************
+  * @file           : vision.h
+  * @brief          : Hardware-independent image processing library.
+  *                   Umbrella header for the firmware and host programs.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __VISION_H
+#define __VISION_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_port.h"
+#include "vision_image.h"
+#include "vision_color.h"
+#include "vision_filter.h"
+#include "vision_gradient.h"
+#include "vision_integral.h"
+#include "vision_histogram.h"
+#include "vision_mask.h"
+#include "vision_blob.h"
+#include "vision_canny.h"
+#include "vision_hough.h"
+#include "vision_ipm.h"
+#include "vision_lanefit.h"
+#include "vision_lane.h"
+#include "vision_track.h"
+
+#endif /* __VISION_H */
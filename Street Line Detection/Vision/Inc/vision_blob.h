@@ -0,0 +1,94 @@
+/**
+  ******************************************************************************
+  * @file           : vision_blob.h
+  * @brief          : Header for vision_blob.c file.
+  *                   Run-length encoding and connected components of masks.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __VISION_BLOB_H
+#define __VISION_BLOB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_mask.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define VISION_RUNS_MAX    0xFFFFU  // Runs addressable by a 16-bit label
+#define VISION_BLOB_NONE   0xFFFFU  // Label of runs beyond the blob capacity
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Horizontal run of set pixels: row y, columns x_start to x_end - 1.
+  *        After labelling, label is the index of the run's blob.
+  */
+typedef struct
+{
+  uint16_t y;
+  uint16_t x_start;
+  uint16_t x_end;
+  uint16_t label;
+} Vision_Run_t;
+
+/**
+  * @brief Run-length encoded mask, in caller-owned storage. Runs are in
+  *        row order, left to right.
+  */
+typedef struct
+{
+  Vision_Run_t *runs;
+  uint32_t capacity;    // Elements of runs, at most VISION_RUNS_MAX
+  uint32_t count;       // Runs stored
+  uint32_t dropped;     // Runs found beyond capacity
+} Vision_Runs_t;
+
+/**
+  * @brief Connected component statistics. The raw sums are exact; the
+  *        centroid and central moments are derived from them.
+  */
+typedef struct
+{
+  uint32_t area;        // Pixels
+  uint16_t x_min;       // Bounding box, inclusive
+  uint16_t y_min;
+  uint16_t x_max;
+  uint16_t y_max;
+  uint32_t runs;        // Runs in the blob
+  uint64_t sx;          // Sums of x, y, x^2, y^2 and x * y
+  uint64_t sy;
+  uint64_t sxx;
+  uint64_t syy;
+  uint64_t sxy;
+  float cx;             // Centroid
+  float cy;
+  float mu20;           // Central second moments per pixel: variance of x,
+  float mu02;           // variance of y and covariance
+  float mu11;
+} Vision_Blob_t;
+
+/**
+  * @brief Shape test of a lane marking blob.
+  */
+typedef struct
+{
+  uint32_t min_area;    // Smallest blob kept (pixels)
+  float max_width;      // Widest minor axis (pixels)
+  float min_elongation; // Smallest ratio of major to minor axis
+} Vision_BlobShape_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+int32_t  Vision_RunsFromMask(const Vision_Mask_t *mask, Vision_Runs_t *runs);
+int32_t  Vision_RunsToMask(const Vision_Runs_t *runs, const uint8_t *keep, Vision_Mask_t *mask);
+int32_t  Vision_BlobLabel(Vision_Runs_t *runs, Vision_Blob_t *blobs, uint32_t max_blobs);
+void     Vision_BlobAxes(const Vision_Blob_t *blob, float *major, float *minor, float *angle);
+uint32_t Vision_BlobMatches(const Vision_Blob_t *blob, const Vision_BlobShape_t *shape);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __VISION_BLOB_H */
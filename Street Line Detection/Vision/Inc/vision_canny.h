@@ -0,0 +1,64 @@
+/**
+  ******************************************************************************
+  * @file           : vision_canny.h
+  * @brief          : Header for vision_canny.c file.
+  *                   Canny non-maximum suppression and hysteresis on packed
+  *                   gradient bytes.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __VISION_CANNY_H
+#define __VISION_CANNY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_gradient.h"
+
+/* Exported constants --------------------------------------------------------*/
+// Edge map values
+#define VISION_EDGE_NONE    0U
+#define VISION_EDGE_WEAK    1U    // Local maximum between the thresholds
+#define VISION_EDGE_STRONG  2U    // Local maximum above the high threshold
+#define VISION_EDGE         255U  // Final edge pixel
+
+#define VISION_CANNY_LOW_DEFAULT   4U   // Magnitudes in VISION_GRAD_MAG units
+#define VISION_CANNY_HIGH_DEFAULT  10U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Canny thresholds, in gradient magnitude units (0..VISION_GRAD_MAG_MAX).
+  */
+typedef struct
+{
+  uint8_t low;        // Weak edges start here
+  uint8_t high;       // Strong edges start here, >= low
+} Vision_CannyParams_t;
+
+/**
+  * @brief Caller-owned stack for edge following. Its depth bounds memory,
+  *        not correctness: overflowing costs an extra sweep of the map.
+  */
+typedef struct
+{
+  uint32_t *items;    // Packed pixel positions
+  uint32_t depth;     // Number of items
+  uint32_t peak;      // Highest fill reached by the last Vision_Canny() call
+  uint32_t sweeps;    // Map sweeps used by the last Vision_Canny() call
+} Vision_CannyStack_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+void    Vision_CannyNmsRow(const uint8_t *above, const uint8_t *row, const uint8_t *below,
+                           uint8_t *out, uint32_t width, const Vision_CannyParams_t *params);
+int32_t Vision_CannyHysteresis(Vision_Image_t *edges, Vision_CannyStack_t *stack);
+int32_t Vision_Canny(const Vision_Image_t *grad, Vision_Image_t *edges, const Vision_CannyParams_t *params,
+                     Vision_CannyStack_t *stack);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __VISION_CANNY_H */
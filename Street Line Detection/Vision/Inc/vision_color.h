@@ -0,0 +1,28 @@
+/**
+  ******************************************************************************
+  * @file           : vision_color.h
+  * @brief          : Header for vision_color.c file.
+  *                   Colour to gray plane conversion.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __VISION_COLOR_H
+#define __VISION_COLOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_image.h"
+
+/* Exported functions prototypes ---------------------------------------------*/
+void    Vision_YuyvToLumaRow(const uint8_t *VISION_RESTRICT yuyv, uint8_t *VISION_RESTRICT luma, uint32_t pixels);
+int32_t Vision_YuyvToLuma(const uint8_t *yuyv, uint32_t yuyv_stride, Vision_Image_t *luma);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __VISION_COLOR_H */
@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @file           : vision_filter.h
+  * @brief          : Header for vision_filter.c file.
+  *                   Separable fixed-point Gaussian smoothing on rolling rows.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __VISION_FILTER_H
+#define __VISION_FILTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_image.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define VISION_GAUSS_3X3   1U   // Radius of the [1 2 1] / 4 kernel
+#define VISION_GAUSS_5X5   2U   // Radius of the [1 4 6 4 1] / 16 kernel
+
+/* Exported macro ------------------------------------------------------------*/
+// Work rows (uint16_t elements) needed by a Gaussian of the given radius
+#define VISION_GAUSS_ROWS_WORDS(width, radius)  ((2U * (radius) + 1U) * (width))
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Streaming Gaussian state. The horizontally filtered rows of the
+  *        last 2 * radius + 1 input rows are kept in a circular buffer;
+  *        each new input row completes one output row radius rows above it.
+  */
+typedef struct
+{
+  uint32_t width;     // Pixels per row
+  uint32_t radius;    // VISION_GAUSS_3X3 or VISION_GAUSS_5X5
+  uint32_t taps;      // 2 * radius + 1 rows in the ring
+  uint32_t pushed;    // Rows in the ring history, including bottom padding
+  uint32_t rows_in;   // Real input rows received
+  uint32_t emitted;   // Output rows produced
+  uint16_t *rows;     // taps * width horizontal sums
+} Vision_Gauss_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+int32_t Vision_GaussInit(Vision_Gauss_t *gauss, uint32_t width, uint32_t radius, uint16_t *rows);
+int32_t Vision_GaussPush(Vision_Gauss_t *gauss, const uint8_t *in, uint8_t *out);
+int32_t Vision_GaussFlush(Vision_Gauss_t *gauss, uint8_t *out);
+int32_t Vision_GaussBlur(const Vision_Image_t *src, Vision_Image_t *dst, uint32_t radius, uint16_t *rows);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __VISION_FILTER_H */
@@ -0,0 +1,91 @@
+/**
+  ******************************************************************************
+  * @file           : vision_gradient.h
+  * @brief          : Header for vision_gradient.c file.
+  *                   Sobel gradient magnitude and direction in one byte, and
+  *                   the fused Gaussian + Sobel edge stage.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __VISION_GRADIENT_H
+#define __VISION_GRADIENT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_filter.h"
+
+/* Exported constants --------------------------------------------------------*/
+/*
+ * Gradient direction, quantised to 45 degree sectors. Image y grows
+ * downwards; the two neighbours across an edge lie along the gradient:
+ *   VISION_DIR_0   : (x-1, y)   and (x+1, y)    mostly horizontal gradient
+ *   VISION_DIR_45  : (x-1, y-1) and (x+1, y+1)  gx and gy of the same sign
+ *   VISION_DIR_90  : (x, y-1)   and (x, y+1)    mostly vertical gradient
+ *   VISION_DIR_135 : (x+1, y-1) and (x-1, y+1)  gx and gy of opposite signs
+ */
+#define VISION_DIR_0      0U
+#define VISION_DIR_45     1U
+#define VISION_DIR_90     2U
+#define VISION_DIR_135    3U
+
+#define VISION_GRAD_MAG_MAX        63U  // Magnitude saturates at 6 bits
+#define VISION_SOBEL_SHIFT_DEFAULT 3U   // L1 range 0..504 maps onto 0..63
+
+/* Exported macro ------------------------------------------------------------*/
+// Gradient byte: magnitude in bits 7..2, direction in bits 1..0, so a plain
+// byte compare against VISION_GRAD_PACK(t, 0) thresholds on magnitude
+#define VISION_GRAD_PACK(mag, dir)  ((uint8_t)(((mag) << 2) | (dir)))
+#define VISION_GRAD_MAG(g)          ((uint32_t)(g) >> 2)
+#define VISION_GRAD_DIR(g)          ((uint32_t)(g) & 3U)
+
+// Work rows (bytes) of the Sobel stage
+#define VISION_SOBEL_ROWS_BYTES(width)  (3U * (width))
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Streaming Sobel state: a ring of the last three input rows.
+  */
+typedef struct
+{
+  uint32_t width;     // Pixels per row
+  uint32_t shift;     // L1 magnitude right shift before saturation
+  uint32_t pushed;    // Rows in the ring history, including padding
+  uint32_t rows_in;   // Real input rows received
+  uint32_t emitted;   // Output rows produced
+  uint8_t *rows;      // 3 * width pixels
+} Vision_Sobel_t;
+
+/**
+  * @brief Fused edge stage: Gaussian rows land directly in the Sobel ring,
+  *        so the smoothed image never exists outside the line buffers.
+  */
+typedef struct
+{
+  Vision_Gauss_t gauss;
+  Vision_Sobel_t sobel;
+} Vision_Edge_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+int32_t  Vision_SobelInit(Vision_Sobel_t *sobel, uint32_t width, uint32_t shift, uint8_t *rows);
+uint8_t *Vision_SobelInput(const Vision_Sobel_t *sobel);
+int32_t  Vision_SobelCommit(Vision_Sobel_t *sobel, uint8_t *out);
+int32_t  Vision_SobelPush(Vision_Sobel_t *sobel, const uint8_t *in, uint8_t *out);
+int32_t  Vision_SobelFlush(Vision_Sobel_t *sobel, uint8_t *out);
+int32_t  Vision_Sobel(const Vision_Image_t *src, Vision_Image_t *grad, uint32_t shift, uint8_t *rows);
+
+int32_t  Vision_EdgeInit(Vision_Edge_t *edge, uint32_t width, uint32_t radius, uint32_t shift,
+                         uint16_t *gauss_rows, uint8_t *sobel_rows);
+int32_t  Vision_EdgePush(Vision_Edge_t *edge, const uint8_t *in, uint8_t *out);
+int32_t  Vision_EdgeFlush(Vision_Edge_t *edge, uint8_t *out);
+int32_t  Vision_Edge(const Vision_Image_t *src, Vision_Image_t *grad, uint32_t radius, uint32_t shift,
+                     uint16_t *gauss_rows, uint8_t *sobel_rows);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __VISION_GRADIENT_H */
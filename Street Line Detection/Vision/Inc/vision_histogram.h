@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * @file           : vision_histogram.h
+  * @brief          : Header for vision_histogram.c file.
+  *                   Streaming luma histogram and frame statistics.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __VISION_HISTOGRAM_H
+#define __VISION_HISTOGRAM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_image.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define VISION_HISTOGRAM_BINS        256U
+#define VISION_HISTOGRAM_LOW_DEFAULT   20U   // Dark percentile (per mille) bounding the range
+#define VISION_HISTOGRAM_HIGH_DEFAULT  980U  // Bright percentile (per mille) bounding the range
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief 256-bin histogram filled band by band. Neighbouring pixels are
+  *        counted in two tables so that runs of equal luma do not serialise
+  *        on one counter; statistics read both tables together.
+  */
+typedef struct
+{
+  uint32_t bins[2][VISION_HISTOGRAM_BINS];
+  uint32_t count;       // Pixels pushed since the last reset
+} Vision_Histogram_t;
+
+/**
+  * @brief Statistics of a histogram. Percentiles are the smallest luma with
+  *        at least that share of the pixels at or below it.
+  */
+typedef struct
+{
+  uint32_t count;       // Pixels counted
+  float mean;           // Mean luma
+  uint8_t min;          // Darkest and brightest pixel
+  uint8_t max;
+  uint8_t low;          // Percentile at low_per_mille
+  uint8_t median;
+  uint8_t high;         // Percentile at high_per_mille
+  uint8_t range;        // high - low: dynamic range without outliers
+  uint8_t otsu;         // Otsu threshold: a pixel above it is foreground
+} Vision_HistogramStats_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+void    Vision_HistogramReset(Vision_Histogram_t *hist);
+int32_t Vision_HistogramPush(Vision_Histogram_t *hist, const Vision_Image_t *band);
+void    Vision_HistogramPushRow(Vision_Histogram_t *hist, const uint8_t *row, uint32_t width);
+int32_t Vision_HistogramStats(const Vision_Histogram_t *hist, uint32_t low_per_mille, uint32_t high_per_mille,
+                              Vision_HistogramStats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __VISION_HISTOGRAM_H */
@@ -0,0 +1,129 @@
+/**
+  ******************************************************************************
+  * @file           : vision_hough.h
+  * @brief          : Header for vision_hough.c file.
+  *                   Fixed-point Hough line transform over a restricted
+  *                   theta range.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __VISION_HOUGH_H
+#define __VISION_HOUGH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_image.h"
+
+/* Exported constants --------------------------------------------------------*/
+/*
+ * A line is x * cos(theta) + y * sin(theta) = rho, with x and y measured
+ * from the top-left pixel of the voted image and theta in whole degrees
+ * from -90 to 89. Theta 0 is a vertical line; lane markings seen from the
+ * car lean at most some tens of degrees either way.
+ */
+#define VISION_HOUGH_THETA_MIN    (-90)
+#define VISION_HOUGH_THETA_MAX    89
+#define VISION_HOUGH_COLUMNS_MAX  ((uint32_t)(VISION_HOUGH_THETA_MAX - VISION_HOUGH_THETA_MIN + 1))
+
+#define VISION_HOUGH_LANE_THETA_MIN   (-60)  // Default lane search range
+#define VISION_HOUGH_LANE_THETA_MAX   60
+
+#define VISION_HOUGH_VOTED  1U  // Edge map mark of a pixel voted by the probabilistic mode
+
+/* Exported macro ------------------------------------------------------------*/
+// Theta columns for a range, and an upper bound on rho cells for a w x h
+// image (the exact count, diagonal + h, is computed by Vision_HoughInit())
+#define VISION_HOUGH_THETAS(min, max, step)  ((uint32_t)(((max) - (min)) / (step)) + 1U)
+#define VISION_HOUGH_RHOS_MAX(w, h)          ((w) + (2U * (h)))
+#define VISION_HOUGH_ACC_WORDS(w, h, thetas) ((thetas) * VISION_HOUGH_RHOS_MAX(w, h))
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Theta range swept by the transform.
+  */
+typedef struct
+{
+  int32_t theta_min;    // Degrees, >= VISION_HOUGH_THETA_MIN
+  int32_t theta_max;    // Degrees, <= VISION_HOUGH_THETA_MAX
+  uint32_t theta_step;  // Degrees between columns
+} Vision_HoughParams_t;
+
+/**
+  * @brief Accumulator of theta columns by rho cells. A one-pixel rho cell
+  *        is at most sqrt(2) pixels wide along a row or a column, so it
+  *        counts at most two votes per row (or per column) of the image:
+  *        16 bits cannot overflow for images up to 32767 pixels across.
+  *        Vision_HoughInit() also keeps diagonal + height below 65536 so
+  *        the Q15 rho sums fit in 32 bits. The column trigonometry lives
+  *        here too, filled once by Vision_HoughInit(), so voting needs no
+  *        stack tables; keep the state in static memory.
+  */
+typedef struct
+{
+  uint16_t *acc;        // thetas * rhos cells, theta-major
+  uint32_t thetas;      // Theta columns
+  uint32_t rhos;        // Rho cells per column, one pixel each
+  int32_t rho_min;      // Rho of cell 0: -(height - 1)
+  int32_t theta_min;    // Theta of column 0 (degrees)
+  uint32_t theta_step;  // Degrees between columns
+  uint32_t width;       // Voted image size
+  uint32_t height;
+  int16_t cos_q15[VISION_HOUGH_COLUMNS_MAX];  // Column cosines and sines (Q15),
+  int16_t sin_q15[VISION_HOUGH_COLUMNS_MAX];  // first thetas entries used
+} Vision_Hough_t;
+
+/**
+  * @brief Detected line.
+  */
+typedef struct
+{
+  int32_t rho;          // Pixels from the image origin
+  int32_t theta;        // Degrees
+  uint32_t votes;       // Accumulator count
+} Vision_HoughLine_t;
+
+/**
+  * @brief Progressive probabilistic transform settings.
+  */
+typedef struct
+{
+  uint32_t threshold;   // Votes that confirm a line
+  uint32_t min_length;  // Shorter segments are dropped (pixels, along the major axis)
+  uint32_t max_gap;     // Longest run of missing pixels bridged inside a segment
+  uint32_t seed;        // Voting order; equal seeds give equal results
+} Vision_PphtParams_t;
+
+/**
+  * @brief Detected segment.
+  */
+typedef struct
+{
+  int16_t x0;           // First end point
+  int16_t y0;
+  int16_t x1;           // Second end point
+  int16_t y1;
+  uint16_t length;      // Euclidean length (pixels)
+  int16_t theta;        // Degrees, as in Vision_HoughLine_t
+} Vision_HoughSegment_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+int32_t Vision_HoughInit(Vision_Hough_t *hough, uint32_t width, uint32_t height, const Vision_HoughParams_t *params,
+                         uint16_t *acc, uint32_t acc_words);
+void    Vision_HoughClear(Vision_Hough_t *hough);
+int32_t Vision_HoughVote(Vision_Hough_t *hough, const Vision_Image_t *edges);
+int32_t Vision_HoughPeaks(const Vision_Hough_t *hough, uint32_t min_votes, Vision_HoughLine_t *lines,
+                          uint32_t max_lines);
+int32_t Vision_HoughProbabilistic(Vision_Hough_t *hough, Vision_Image_t *edges, const Vision_PphtParams_t *params,
+                                  uint32_t *points, uint32_t point_capacity, Vision_HoughSegment_t *segments,
+                                  uint32_t max_segments);
+int32_t Vision_HoughLineAt(const Vision_HoughLine_t *line, int32_t y, int32_t *x_q16, int32_t *slope_q16);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __VISION_HOUGH_H */
@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @file           : vision_image.h
+  * @brief          : Header for vision_image.c file.
+  *                   Planar 8-bit image descriptor shared by all kernels.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __VISION_IMAGE_H
+#define __VISION_IMAGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vision_port.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define VISION_OK          0
+#define VISION_ERR_PARAM   (-1)   // Invalid argument or geometry mismatch
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief One 8-bit plane, e.g. the luma frame captured into image_buffer.
+  *        The descriptor never owns its pixels.
+  */
+typedef struct
+{
+  uint8_t *data;     // First pixel of the first row
+  uint32_t width;    // Pixels per row
+  uint32_t height;   // Rows
+  uint32_t stride;   // Bytes from one row to the next, >= width
+} Vision_Image_t;
+
+/* Exported macro ------------------------------------------------------------*/
+#define VISION_ROW(image, y)  ((image)->data + ((size_t)(y) * (image)->stride))
+
+/* Exported functions prototypes ---------------------------------------------*/
+int32_t Vision_ImageInit(Vision_Image_t *image, uint8_t *data, uint32_t width, uint32_t height, uint32_t stride);
+int32_t Vision_ImageView(const Vision_Image_t *image, uint32_t x, uint32_t y, uint32_t width, uint32_t height,
+                         Vision_Image_t *view);
+void    Vision_ImageFill(Vision_Image_t *image, uint8_t value);
+int32_t Vision_ImageCopy(const Vision_Image_t *src, Vision_Image_t *dst);
+int32_t Vision_ImageThreshold(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __VISION_IMAGE_H */
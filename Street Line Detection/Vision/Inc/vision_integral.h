@@ -0,0 +1,73 @@
+/**
+  ******************************************************************************
+  * @file           : vision_integral.h
+  * @brief          : Header for vision_integral.c file.
+  *                   Windowed integral image and mean-C adaptive threshold.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __VISION_INTEGRAL_H
+#define __VISION_INTEGRAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_image.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define VISION_ADAPTIVE_RADIUS_MAX      63U  // Largest window: 127 x 127
+#define VISION_ADAPTIVE_RADIUS_DEFAULT  8U   // 17 x 17 window
+#define VISION_ADAPTIVE_OFFSET_DEFAULT  20   // Luma above the local mean
+
+/* Exported macro ------------------------------------------------------------*/
+// Work rows (uint32_t elements) of an integral window of the given height
+#define VISION_INTEGRAL_ROWS_WORDS(width, slots)   ((slots) * ((width) + 1U))
+// Work rows (uint32_t elements) of an adaptive threshold of the given radius
+#define VISION_ADAPTIVE_ROWS_WORDS(width, radius)  VISION_INTEGRAL_ROWS_WORDS((width), (2U * (radius)) + 2U)
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Integral image kept for the last slots rows only. Row k holds the
+  *        sums of all pixels above row k and left of each column, with a
+  *        leading zero column; row 0 is all zero.
+  */
+typedef struct
+{
+  uint32_t width;     // Pixels per input row
+  uint32_t slots;     // Integral rows in the ring
+  uint32_t rows_in;   // Input rows received: the newest integral row
+  uint32_t *rows;     // slots * (width + 1) running sums
+} Vision_Integral_t;
+
+/**
+  * @brief Streaming mean-C threshold. Output row y is ready once input row
+  *        y + radius has been pushed.
+  */
+typedef struct
+{
+  Vision_Integral_t integral;
+  uint32_t height;    // Rows of the image
+  uint32_t radius;    // Window half size
+  int32_t offset;     // C: a pixel is set when it exceeds the window mean by more
+  uint32_t emitted;   // Output rows produced
+} Vision_Adaptive_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+int32_t         Vision_IntegralInit(Vision_Integral_t *integral, uint32_t width, uint32_t slots, uint32_t *rows);
+int32_t         Vision_IntegralPush(Vision_Integral_t *integral, const uint8_t *in);
+const uint32_t *Vision_IntegralRow(const Vision_Integral_t *integral, uint32_t row);
+int32_t Vision_AdaptiveInit(Vision_Adaptive_t *adaptive, uint32_t width, uint32_t height, uint32_t radius,
+                            int32_t offset, uint32_t *rows);
+int32_t Vision_AdaptivePush(Vision_Adaptive_t *adaptive, const uint8_t *in, uint8_t *out);
+int32_t Vision_AdaptiveFlush(Vision_Adaptive_t *adaptive, uint8_t *out);
+int32_t Vision_AdaptiveThreshold(const Vision_Image_t *src, Vision_Image_t *dst, uint32_t radius, int32_t offset,
+                                 uint32_t *rows);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __VISION_INTEGRAL_H */
@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * @file           : vision_ipm.h
+  * @brief          : Header for vision_ipm.c file.
+  *                   Inverse perspective mapping (bird's-eye view) through a
+  *                   precomputed source offset table.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __VISION_IPM_H
+#define __VISION_IPM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_image.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define VISION_IPM_NONE   0xFFFFU  // Table entry of a ground cell the camera does not see
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Camera calibration and ground window. Only the host table
+  *        generator (Tools/ipm_lut_gen.c) evaluates it; the target works from
+  *        the generated Vision_IpmLut_t alone.
+  */
+typedef struct
+{
+  float height_mm;      // Lens centre above the road
+  float pitch_deg;      // Downward tilt of the optical axis
+  float focal_px;       // Focal length in sensor pixels
+  float cx;             // Principal point in sensor pixels
+  float cy;
+  uint32_t src_x;       // Top-left of the source image (the ROI) on the sensor
+  uint32_t src_y;
+  uint32_t src_width;   // Source image size and line pitch
+  uint32_t src_height;
+  uint32_t src_stride;
+  float x_min_mm;       // Ground window: lateral range, left edge first
+  float x_max_mm;
+  float z_near_mm;      // Forward range from the point below the lens
+  float z_far_mm;
+  uint32_t width;       // Bird's-eye size: columns span x, rows run far to near
+  uint32_t height;
+} Vision_IpmCalib_t;
+
+/**
+  * @brief Generated remap table. Entry i is the offset of the source pixel
+  *        seen by bird's-eye pixel i, or VISION_IPM_NONE.
+  */
+typedef struct
+{
+  const uint16_t *offsets;  // width * height entries, row-major
+  uint32_t width;           // Bird's-eye size
+  uint32_t height;
+  uint32_t src_width;       // Source geometry the offsets were built for
+  uint32_t src_height;
+  uint32_t src_stride;
+  int32_t x_min_mm;         // Lateral position of the centre of column 0
+  int32_t z_far_mm;         // Forward distance of the centre of row 0
+  uint32_t x_step_um;       // Ground size of one column and one row
+  uint32_t z_step_um;
+} Vision_IpmLut_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+int32_t Vision_IpmWarp(const Vision_IpmLut_t *lut, const Vision_Image_t *src, Vision_Image_t *dst, uint8_t fill);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __VISION_IPM_H */
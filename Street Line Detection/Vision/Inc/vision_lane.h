@@ -0,0 +1,64 @@
+/**
+  ******************************************************************************
+  * @file           : vision_lane.h
+  * @brief          : Header for vision_lane.c file.
+  *                   Lane pixel search in a binary bird's-eye image.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __VISION_LANE_H
+#define __VISION_LANE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_image.h"
+#include "vision_lanefit.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define VISION_LANE_WINDOWS_DEFAULT   9U
+#define VISION_LANE_MARGIN_DEFAULT    12U
+#define VISION_LANE_RECENTRE_DEFAULT  8U
+#define VISION_LANE_SEED_DEFAULT      6U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Sliding-window search settings.
+  */
+typedef struct
+{
+  uint32_t windows;     // Windows stacked from the bottom to the top row
+  uint32_t margin;      // Half width of a window (pixels)
+  uint32_t recentre;    // Pixels in a window that move the next one onto their mean
+  uint32_t min_seed;    // Column histogram count needed to start a lane
+} Vision_LaneSearchParams_t;
+
+/**
+  * @brief Pixels of one lane: always summed for the fit, and optionally
+  *        listed in caller-owned storage.
+  */
+typedef struct
+{
+  uint16_t *x;              // Columns, or NULL to keep the sums only
+  uint16_t *y;              // Rows, or NULL to keep the sums only
+  uint32_t capacity;        // Elements of x and y
+  uint32_t count;           // Pixels listed
+  uint32_t dropped;         // Pixels found beyond capacity
+  Vision_LaneSums_t sums;   // Fit sums of every pixel found
+} Vision_LanePixels_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+void    Vision_LanePixelsReset(Vision_LanePixels_t *pixels, uint32_t height);
+int32_t Vision_LaneSlidingWindow(const Vision_Image_t *binary, const Vision_LaneSearchParams_t *params,
+                                 uint16_t *histogram, Vision_LanePixels_t *left, Vision_LanePixels_t *right);
+int32_t Vision_LaneSearchAround(const Vision_Image_t *binary, const Vision_LaneFit_t *fit, uint32_t margin,
+                                Vision_LanePixels_t *pixels);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __VISION_LANE_H */
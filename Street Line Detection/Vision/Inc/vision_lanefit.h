@@ -0,0 +1,79 @@
+/**
+  ******************************************************************************
+  * @file           : vision_lanefit.h
+  * @brief          : Header for vision_lanefit.c file.
+  *                   Incremental quadratic least-squares lane fit and its
+  *                   metric geometry.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __VISION_LANEFIT_H
+#define __VISION_LANEFIT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_ipm.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define VISION_LANE_MIN_PIXELS     24U       // Fewer pixels never make a fit
+#define VISION_LANE_RADIUS_MAX_M   10000.0f  // Radius reported for a straight lane
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Normal-equation sums of one lane. The lane is x as a function of
+  *        the bird's-eye row y; powers are taken of u = y - origin so the
+  *        sums stay small and the system well conditioned.
+  */
+typedef struct
+{
+  int32_t origin;       // Row the powers are taken about
+  uint32_t n;           // Pixels summed
+  int64_t su[5];        // Sum of u^k, k = 0..4 (su[0] == n)
+  int64_t sx[3];        // Sum of x * u^k, k = 0..2
+  int64_t sxx;          // Sum of x^2, for the residual
+} Vision_LaneSums_t;
+
+/**
+  * @brief Lane centre line in bird's-eye pixels: x = (a * y + b) * y + c.
+  */
+typedef struct
+{
+  float a;
+  float b;
+  float c;
+  float rms;            // Residual of the fit (pixels)
+  uint32_t pixels;      // Pixels the fit was made from
+  uint32_t valid;       // Non-zero once fitted
+} Vision_LaneFit_t;
+
+/**
+  * @brief Lane geometry at the bottom row of the bird's-eye view, in the
+  *        units of the steering controller.
+  */
+typedef struct
+{
+  float radius_m;       // Signed curvature radius: positive bends right,
+                        // +/-VISION_LANE_RADIUS_MAX_M when straight
+  float offset_m;       // Car position from the lane centre, positive right
+  float width_m;        // Distance between the two lane lines
+  uint32_t lanes;       // Lines used: bit 0 left, bit 1 right
+} Vision_LaneGeometry_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+void     Vision_LaneFitReset(Vision_LaneSums_t *sums, int32_t origin);
+void     Vision_LaneFitAddRow(Vision_LaneSums_t *sums, uint32_t y, uint32_t count, uint32_t x_sum,
+                              uint32_t xx_sum);
+int32_t  Vision_LaneFitSolve(const Vision_LaneSums_t *sums, Vision_LaneFit_t *fit);
+uint32_t Vision_LaneFitConfident(const Vision_LaneFit_t *fit, uint32_t min_pixels, float max_rms);
+int32_t  Vision_LaneFitGeometry(const Vision_LaneFit_t *left, const Vision_LaneFit_t *right,
+                                const Vision_IpmLut_t *lut, float nominal_width_m, Vision_LaneGeometry_t *geometry);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __VISION_LANEFIT_H */
@@ -0,0 +1,56 @@
+/**
+  ******************************************************************************
+  * @file           : vision_mask.h
+  * @brief          : Header for vision_mask.c file.
+  *                   Bit-packed binary masks and word-parallel morphology.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __VISION_MASK_H
+#define __VISION_MASK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_image.h"
+
+/* Exported macro ------------------------------------------------------------*/
+// 32-bit words per mask row and per mask
+#define VISION_MASK_STRIDE(width)         (((width) + 31U) / 32U)
+#define VISION_MASK_WORDS(width, height)  (VISION_MASK_STRIDE(width) * (height))
+// Work rows (uint32_t elements) of one morphology pass
+#define VISION_MORPH_ROWS_WORDS(width)    (3U * VISION_MASK_STRIDE(width))
+
+#define VISION_MASK_ROW(mask, y)  ((mask)->words + ((size_t)(y) * (mask)->stride))
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Binary image, one bit per pixel. Pixel x of a row is bit x % 32
+  *        of word x / 32; bits past the last pixel of a row are kept clear.
+  *        The descriptor never owns its words.
+  */
+typedef struct
+{
+  uint32_t *words;   // First word of the first row
+  uint32_t width;    // Pixels per row
+  uint32_t height;   // Rows
+  uint32_t stride;   // Words from one row to the next
+} Vision_Mask_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+int32_t Vision_MaskInit(Vision_Mask_t *mask, uint32_t *words, uint32_t width, uint32_t height);
+int32_t Vision_MaskPack(const Vision_Image_t *src, Vision_Mask_t *dst);
+int32_t Vision_MaskUnpack(const Vision_Mask_t *src, Vision_Image_t *dst);
+int32_t Vision_MaskErode(const Vision_Mask_t *src, Vision_Mask_t *dst, uint32_t *rows);
+int32_t Vision_MaskDilate(const Vision_Mask_t *src, Vision_Mask_t *dst, uint32_t *rows);
+int32_t Vision_MaskOpen(const Vision_Mask_t *src, Vision_Mask_t *dst, uint32_t *rows);
+int32_t Vision_MaskClose(const Vision_Mask_t *src, Vision_Mask_t *dst, uint32_t *rows);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __VISION_MASK_H */
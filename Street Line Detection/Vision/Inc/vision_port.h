@@ -0,0 +1,51 @@
+/**
+  ******************************************************************************
+  * @file           : vision_port.h
+  * @brief          : Compiler and placement hooks of the vision library.
+  ******************************************************************************
+  * The library builds unchanged for the Cortex-M7 firmware and for a host.
+  * On the target, kernels and their line buffers go to the TCM sections the
+  * firmware linker scripts provide (see Core/Inc/sections.h); on a host the
+  * hooks are empty. Either may be overridden from the build command line.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __VISION_PORT_H
+#define __VISION_PORT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+#if defined(__GNUC__) && defined(__arm__)
+#ifndef VISION_FAST_CODE
+#define VISION_FAST_CODE    __attribute__((section(".itcm_text"), long_call, noinline))
+#endif
+#ifndef VISION_LINE_BUFFER
+#define VISION_LINE_BUFFER  __attribute__((section(".dtcm_bss"), aligned(32)))
+#endif
+#else
+#ifndef VISION_FAST_CODE
+#define VISION_FAST_CODE
+#endif
+#ifndef VISION_LINE_BUFFER
+#define VISION_LINE_BUFFER
+#endif
+#endif
+
+#if defined(__GNUC__)
+#define VISION_RESTRICT     __restrict__
+#define VISION_ALIGNED(n)   __attribute__((aligned(n)))
+#define VISION_CTZ(x)       ((uint32_t)__builtin_ctz(x))  // Trailing zeros of x != 0: RBIT + CLZ on the M7
+#else
+#define VISION_RESTRICT
+#define VISION_ALIGNED(n)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __VISION_PORT_H */
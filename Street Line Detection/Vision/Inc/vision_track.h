@@ -0,0 +1,104 @@
+/**
+  ******************************************************************************
+  * @file           : vision_track.h
+  * @brief          : Header for vision_track.c file.
+  *                   Kalman lane tracker and search band prediction.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __VISION_TRACK_H
+#define __VISION_TRACK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_lanefit.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define VISION_TRACK_STATES  6U   // Offset, heading, curvature and their rates
+
+// Tracker states
+#define VISION_TRACK_LOST       0U  // No estimate: search the whole image
+#define VISION_TRACK_ACQUIRING  1U  // Estimate not yet trusted, or coasting
+#define VISION_TRACK_LOCKED     2U  // Search the predicted band only
+
+// Defaults, in bird's-eye pixels (see Vision_Track_t)
+#define VISION_TRACK_Q_DEFAULT       0.05f  // Rate noise per frame (pixels^2)
+#define VISION_TRACK_R_DEFAULT       4.0f   // Measurement noise (pixels^2)
+#define VISION_TRACK_GATE_DEFAULT    16.0f  // Mahalanobis distance^2 accepted
+#define VISION_TRACK_LOCK_DEFAULT    3U     // Accepted frames before locking
+#define VISION_TRACK_MISS_DEFAULT    5U     // Missed frames before the track is lost
+#define VISION_TRACK_MARGIN_MIN      4U     // Narrowest band half width (pixels)
+#define VISION_TRACK_MARGIN_MAX      24U    // Widest band half width (pixels)
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Tracker tuning.
+  */
+typedef struct
+{
+  float q;              // Process noise on each rate (pixels^2 per frame)
+  float r;              // Measurement noise of each component (pixels^2)
+  float gate;           // Largest squared Mahalanobis distance of an accepted measurement
+  float width;          // Lane width assumed until both lines are seen (pixels)
+  uint32_t lock_frames; // Consecutive accepted frames needed to lock
+  uint32_t miss_frames; // Consecutive rejected frames that lose the track
+  uint32_t margin_min;  // Band half width range (pixels)
+  uint32_t margin_max;
+} Vision_TrackParams_t;
+
+/**
+  * @brief Lane centre tracker. The centre line is
+  *        x = offset + heading * v + curvature * v^2, with v running from 0
+  *        at the bottom row to 1 at the top row of the bird's-eye view, so
+  *        all three terms are lateral displacements in pixels.
+  */
+typedef struct
+{
+  float x[VISION_TRACK_STATES];                       // Offset, heading, curvature, then their rates per frame
+  float p[VISION_TRACK_STATES][VISION_TRACK_STATES];  // State covariance
+  float width;          // Filtered distance between the lines (pixels)
+  uint32_t height;      // Bird's-eye rows
+  uint32_t state;       // VISION_TRACK_LOST, _ACQUIRING or _LOCKED
+  uint32_t hits;        // Consecutive accepted measurements
+  uint32_t misses;      // Consecutive rejected or missing measurements
+  Vision_TrackParams_t params;
+} Vision_Track_t;
+
+/**
+  * @brief Lane lines expected in the next frame and the corridor to search.
+  */
+typedef struct
+{
+  Vision_LaneFit_t left;
+  Vision_LaneFit_t right;
+  uint32_t margin;      // Half width of the corridor around each line (pixels)
+} Vision_TrackBand_t;
+
+/**
+  * @brief Rectangle of the source frame covering a band.
+  */
+typedef struct
+{
+  uint32_t x;
+  uint32_t y;
+  uint32_t width;
+  uint32_t height;
+} Vision_TrackWindow_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+int32_t  Vision_TrackInit(Vision_Track_t *track, const Vision_TrackParams_t *params, uint32_t height);
+uint32_t Vision_TrackUpdate(Vision_Track_t *track, const Vision_LaneFit_t *left, const Vision_LaneFit_t *right);
+int32_t  Vision_TrackLines(const Vision_Track_t *track, Vision_LaneFit_t *left, Vision_LaneFit_t *right);
+int32_t  Vision_TrackPredict(const Vision_Track_t *track, Vision_TrackBand_t *band);
+int32_t  Vision_TrackWindow(const Vision_TrackBand_t *band, const Vision_IpmLut_t *lut, uint32_t pad,
+                            Vision_TrackWindow_t *window);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __VISION_TRACK_H */
@@ -0,0 +1,412 @@
+/**
+  ******************************************************************************
+  * @file           : vision_blob.c
+  * @brief          : Run-length encoding and connected components of masks.
+  ******************************************************************************
+  * A packed mask is encoded as horizontal runs straight from its words. The
+  * ends of each run are found with a count-trailing-zeros per transition,
+  * so empty words cost one test. A sparse lane mask holds a few hundred
+  * runs where a pixel labeller would visit every pixel.
+  *
+  * Components are 8-connected. Labelling is union-find over runs: a run
+  * joins every run of the row above that touches it, found with one merge
+  * walk per row pair. The run label field holds the union-find parent
+  * while labelling runs, and a root always links under the smaller index.
+  * One forward pass then turns parents into blob indices in place, and one
+  * more accumulates area, bounding box and exact moment sums per blob. The
+  * runs with their labels are the compact form of the mask, e.g. for
+  * telemetry; Vision_RunsToMask() redraws a selection of blobs from them.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_blob.h"
+
+#include <math.h>
+#include <string.h>
+
+/* Private function prototypes -----------------------------------------------*/
+static void Vision_RunsAdd(Vision_Runs_t *runs, uint32_t y, uint32_t x_start, uint32_t x_end);
+static uint32_t Vision_BlobFind(Vision_Run_t *run, uint32_t index);
+static void Vision_BlobUnion(Vision_Run_t *run, uint32_t a, uint32_t b);
+static uint64_t Vision_BlobSquares(uint64_t n);
+#ifndef VISION_CTZ
+static uint32_t Vision_BlobCtz(uint32_t x);
+#define VISION_CTZ(x)  Vision_BlobCtz(x)
+#endif
+
+/**
+  * @brief  Encode the set pixels of a mask as runs.
+  * @param  mask: packed mask, at most 65535 pixels wide and high
+  * @param  runs: receives the runs; runs->capacity must be set
+  * @retval Number of runs found, or VISION_ERR_PARAM
+  */
+VISION_FAST_CODE int32_t Vision_RunsFromMask(const Vision_Mask_t *mask, Vision_Runs_t *runs)
+{
+  uint32_t y;
+
+  if ((mask == NULL) || (runs == NULL) || (runs->runs == NULL) || (runs->capacity > VISION_RUNS_MAX) ||
+      (mask->width > 0xFFFFU) || (mask->height > 0xFFFFU))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  runs->count = 0;
+  runs->dropped = 0;
+
+  for (y = 0; y < mask->height; y++)
+  {
+    const uint32_t *row = VISION_MASK_ROW(mask, y);
+    uint32_t carry = 0;   // Pixel left of the word; left of the row is clear
+    uint32_t in_run = 0;
+    uint32_t start = 0;
+    uint32_t i;
+
+    for (i = 0; i < mask->stride; i++)
+    {
+      uint32_t word = row[i];
+      uint32_t edges = word ^ ((word << 1) | carry);  // Bit x set where pixel x differs from x - 1
+
+      carry = word >> 31;
+      while (edges != 0U)
+      {
+        uint32_t x = (i * 32U) + VISION_CTZ(edges);
+
+        edges &= edges - 1U;
+        if (in_run == 0U)
+        {
+          start = x;
+        }
+        else
+        {
+          Vision_RunsAdd(runs, y, start, x);
+        }
+        in_run ^= 1U;
+      }
+    }
+    // Padding bits are clear, so only a run through the last pixel of a
+    // whole-word row is still open
+    if (in_run != 0U)
+    {
+      Vision_RunsAdd(runs, y, start, mask->width);
+    }
+  }
+
+  return (int32_t)(runs->count + runs->dropped);
+}
+
+/**
+  * @brief  Redraw labelled runs into a mask.
+  * @param  runs: labelled runs
+  * @param  keep: per blob index, non-zero to draw it; NULL draws every run
+  * @param  mask: cleared, then receives the runs kept
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_RunsToMask(const Vision_Runs_t *runs, const uint8_t *keep, Vision_Mask_t *mask)
+{
+  uint32_t y;
+  uint32_t i;
+
+  if ((runs == NULL) || (mask == NULL))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  for (y = 0; y < mask->height; y++)
+  {
+    memset(VISION_MASK_ROW(mask, y), 0, mask->stride * sizeof(uint32_t));
+  }
+
+  for (i = 0; i < runs->count; i++)
+  {
+    const Vision_Run_t *run = &runs->runs[i];
+    uint32_t *row;
+    uint32_t x;
+
+    if ((keep != NULL) && ((run->label == VISION_BLOB_NONE) || (keep[run->label] == 0U)))
+    {
+      continue;
+    }
+    if ((run->y >= mask->height) || (run->x_end > mask->width))
+    {
+      return VISION_ERR_PARAM;
+    }
+
+    row = VISION_MASK_ROW(mask, run->y);
+    x = run->x_start;
+    while (x < run->x_end)
+    {
+      uint32_t bit = x % 32U;
+      uint32_t span = ((run->x_end - x) < (32U - bit)) ? (run->x_end - x) : (32U - bit);
+      uint32_t bits = (span == 32U) ? 0xFFFFFFFFU : (((1UL << span) - 1U) << bit);
+
+      row[x / 32U] |= bits;
+      x += span;
+    }
+  }
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Label the 8-connected components of a run set and describe them.
+  * @param  runs: runs from Vision_RunsFromMask(); their labels are set
+  * @param  blobs: receives the statistics of the first max_blobs blobs, in
+  *         order of their topmost run
+  * @param  max_blobs: elements of blobs; runs of later blobs are labelled
+  *         VISION_BLOB_NONE
+  * @retval Number of blobs found, or VISION_ERR_PARAM
+  */
+int32_t Vision_BlobLabel(Vision_Runs_t *runs, Vision_Blob_t *blobs, uint32_t max_blobs)
+{
+  Vision_Run_t *run;
+  uint32_t prev_start = 0;
+  uint32_t prev_end = 0;
+  uint32_t row_start = 0;
+  uint32_t found = 0;
+  uint32_t i;
+
+  if ((runs == NULL) || (runs->runs == NULL) || ((blobs == NULL) && (max_blobs > 0U)) ||
+      (runs->count > VISION_RUNS_MAX))
+  {
+    return VISION_ERR_PARAM;
+  }
+  run = runs->runs;
+
+  // Union-find: each run joins the runs of the row above that touch it
+  for (i = 0; i < runs->count; i++)
+  {
+    uint32_t j;
+
+    if ((i == 0U) || (run[i].y != run[i - 1U].y))
+    {
+      // New row: the previous row becomes the row above if adjacent
+      prev_start = row_start;
+      prev_end = i;
+      row_start = i;
+      if ((i == 0U) || (run[i].y != (run[i - 1U].y + 1U)))
+      {
+        prev_start = i;
+        prev_end = i;
+      }
+    }
+
+    run[i].label = (uint16_t)i;
+
+    // Skip runs of the row above that end left of this one; later runs of
+    // this row lie further right and cannot touch them either
+    while ((prev_start < prev_end) && (run[prev_start].x_end < run[i].x_start))
+    {
+      prev_start++;
+    }
+    for (j = prev_start; (j < prev_end) && (run[j].x_start <= run[i].x_end); j++)
+    {
+      Vision_BlobUnion(run, i, j);
+    }
+  }
+
+  // Roots link under smaller indices, so a forward pass resolves every run
+  for (i = 0; i < runs->count; i++)
+  {
+    if (run[i].label == i)
+    {
+      run[i].label = (found < max_blobs) ? (uint16_t)found : (uint16_t)VISION_BLOB_NONE;
+      found++;
+    }
+    else
+    {
+      run[i].label = run[run[i].label].label;
+    }
+  }
+
+  // Statistics
+  for (i = 0; (i < max_blobs) && (i < found); i++)
+  {
+    memset(&blobs[i], 0, sizeof(blobs[i]));
+    blobs[i].x_min = 0xFFFFU;
+    blobs[i].y_min = 0xFFFFU;
+  }
+  for (i = 0; i < runs->count; i++)
+  {
+    Vision_Blob_t *blob;
+    uint64_t length = (uint64_t)run[i].x_end - run[i].x_start;
+    uint64_t y = run[i].y;
+    uint64_t sx;
+
+    if (run[i].label == VISION_BLOB_NONE)
+    {
+      continue;
+    }
+    blob = &blobs[run[i].label];
+
+    sx = (length * ((uint64_t)run[i].x_start + run[i].x_end - 1U)) / 2U;
+    blob->area += (uint32_t)length;
+    blob->runs++;
+    blob->sx += sx;
+    blob->sy += length * y;
+    blob->sxx += Vision_BlobSquares(run[i].x_end) - Vision_BlobSquares(run[i].x_start);
+    blob->syy += length * y * y;
+    blob->sxy += sx * y;
+    blob->x_min = (run[i].x_start < blob->x_min) ? run[i].x_start : blob->x_min;
+    blob->x_max = ((run[i].x_end - 1U) > blob->x_max) ? (uint16_t)(run[i].x_end - 1U) : blob->x_max;
+    blob->y_min = (run[i].y < blob->y_min) ? run[i].y : blob->y_min;
+    blob->y_max = (run[i].y > blob->y_max) ? run[i].y : blob->y_max;
+  }
+  for (i = 0; (i < max_blobs) && (i < found); i++)
+  {
+    Vision_Blob_t *blob = &blobs[i];
+    double area = (double)blob->area;
+    double cx = (double)blob->sx / area;
+    double cy = (double)blob->sy / area;
+
+    // Central moments are small differences of large terms: form them in double
+    blob->cx = (float)cx;
+    blob->cy = (float)cy;
+    blob->mu20 = (float)(((double)blob->sxx / area) - (cx * cx));
+    blob->mu02 = (float)(((double)blob->syy / area) - (cy * cy));
+    blob->mu11 = (float)(((double)blob->sxy / area) - (cx * cy));
+  }
+
+  return (int32_t)found;
+}
+
+/**
+  * @brief  Axes of the ellipse with the blob's second moments, scaled so a
+  *         solid n x m bar measures n by m.
+  * @param  blob: blob statistics
+  * @param  major: receives the long axis (pixels)
+  * @param  minor: receives the short axis (pixels)
+  * @param  angle: receives the long axis direction from the x axis (radians),
+  *         or NULL
+  * @retval None
+  */
+void Vision_BlobAxes(const Vision_Blob_t *blob, float *major, float *minor, float *angle)
+{
+  float mean = 0.5f * (blob->mu20 + blob->mu02);
+  float half = 0.5f * (blob->mu20 - blob->mu02);
+  float spread = sqrtf((half * half) + (blob->mu11 * blob->mu11));
+  float small = mean - spread;
+
+  // Pixel variance of n pixels in a line is (n^2 - 1) / 12
+  *major = sqrtf((12.0f * (mean + spread)) + 1.0f);
+  *minor = sqrtf((12.0f * ((small > 0.0f) ? small : 0.0f)) + 1.0f);
+  if (angle != NULL)
+  {
+    *angle = 0.5f * atan2f(2.0f * blob->mu11, blob->mu20 - blob->mu02);
+  }
+}
+
+/**
+  * @brief  Whether a blob is shaped like a lane marking.
+  * @param  blob: blob statistics
+  * @param  shape: shape limits
+  * @retval 1 if it matches, 0 otherwise
+  */
+uint32_t Vision_BlobMatches(const Vision_Blob_t *blob, const Vision_BlobShape_t *shape)
+{
+  float major;
+  float minor;
+
+  if (blob->area < shape->min_area)
+  {
+    return 0;
+  }
+
+  Vision_BlobAxes(blob, &major, &minor, NULL);
+
+  return ((minor <= shape->max_width) && (major >= (shape->min_elongation * minor))) ? 1U : 0U;
+}
+
+/**
+  * @brief  Append a run, or count it when the storage is full.
+  * @param  runs: run set
+  * @param  y: row
+  * @param  x_start: first column
+  * @param  x_end: one past the last column
+  * @retval None
+  */
+static void Vision_RunsAdd(Vision_Runs_t *runs, uint32_t y, uint32_t x_start, uint32_t x_end)
+{
+  Vision_Run_t *run;
+
+  if (runs->count >= runs->capacity)
+  {
+    runs->dropped++;
+    return;
+  }
+
+  run = &runs->runs[runs->count++];
+  run->y = (uint16_t)y;
+  run->x_start = (uint16_t)x_start;
+  run->x_end = (uint16_t)x_end;
+  run->label = 0;
+}
+
+/**
+  * @brief  Root of a run's set, halving the path on the way.
+  * @param  run: runs, label holding the parent
+  * @param  index: run
+  * @retval Root run
+  */
+static uint32_t Vision_BlobFind(Vision_Run_t *run, uint32_t index)
+{
+  while (run[index].label != index)
+  {
+    run[index].label = run[run[index].label].label;
+    index = run[index].label;
+  }
+
+  return index;
+}
+
+/**
+  * @brief  Merge the sets of two runs under the smaller root.
+  * @param  run: runs, label holding the parent
+  * @param  a: run
+  * @param  b: run
+  * @retval None
+  */
+static void Vision_BlobUnion(Vision_Run_t *run, uint32_t a, uint32_t b)
+{
+  uint32_t root_a = Vision_BlobFind(run, a);
+  uint32_t root_b = Vision_BlobFind(run, b);
+
+  if (root_a < root_b)
+  {
+    run[root_b].label = (uint16_t)root_a;
+  }
+  else if (root_b < root_a)
+  {
+    run[root_a].label = (uint16_t)root_b;
+  }
+}
+
+/**
+  * @brief  Sum of x^2 for x = 0 .. n - 1.
+  * @param  n: count
+  * @retval Sum
+  */
+static uint64_t Vision_BlobSquares(uint64_t n)
+{
+  return (n * (n - 1U) * ((2U * n) - 1U)) / 6U;
+}
+
+#ifndef __GNUC__
+/**
+  * @brief  Trailing zeros of a non-zero word.
+  * @param  x: word
+  * @retval Index of the lowest set bit
+  */
+static uint32_t Vision_BlobCtz(uint32_t x)
+{
+  uint32_t n = 0;
+
+  while ((x & 1U) == 0U)
+  {
+    x >>= 1;
+    n++;
+  }
+
+  return n;
+}
+#endif
@@ -0,0 +1,253 @@
+/**
+  ******************************************************************************
+  * @file           : vision_canny.c
+  * @brief          : Canny non-maximum suppression and hysteresis on packed
+  *                   gradient bytes.
+  ******************************************************************************
+  * Non-maximum suppression works one row at a time from a three-row window
+  * of the gradient map (see vision_gradient.h for the byte layout) and
+  * classifies every pixel as none, weak or strong. The outermost rows and
+  * columns are always none, so edge following never has to bound-check its
+  * neighbours.
+  *
+  * Hysteresis follows weak pixels outward from strong ones with an explicit
+  * stack supplied by the caller, so there is no recursion and no heap. A
+  * neighbour that cannot be pushed because the stack is full is left marked
+  * strong and picked up by another sweep of the map; the result is the same
+  * as with an unbounded stack.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_canny.h"
+
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define CANNY_PACK(x, y)  (((uint32_t)(y) << 16) | (uint32_t)(x))
+#define CANNY_X(p)        ((p) & 0xFFFFU)
+#define CANNY_Y(p)        ((p) >> 16)
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t Vision_CannyFollow(Vision_Image_t *edges, Vision_CannyStack_t *stack, uint32_t *overflow);
+
+/**
+  * @brief  Non-maximum suppression of one gradient row.
+  * @param  above: gradient row y - 1
+  * @param  row: gradient row y
+  * @param  below: gradient row y + 1
+  * @param  out: receives VISION_EDGE_NONE/WEAK/STRONG for row y; the first
+  *         and last pixels are always VISION_EDGE_NONE
+  * @param  width: pixels per row
+  * @param  params: thresholds
+  * @retval None
+  */
+VISION_FAST_CODE void Vision_CannyNmsRow(const uint8_t *above, const uint8_t *row, const uint8_t *below,
+                                         uint8_t *out, uint32_t width, const Vision_CannyParams_t *params)
+{
+  uint32_t low = VISION_GRAD_PACK(params->low, 0U);
+  uint32_t high = VISION_GRAD_PACK(params->high, 0U);
+  uint32_t x;
+
+  out[0] = VISION_EDGE_NONE;
+  if (width < 2U)
+  {
+    return;
+  }
+
+  for (x = 1U; x < (width - 1U); x++)
+  {
+    uint32_t g = row[x];
+    uint32_t mag;
+    uint32_t a;
+    uint32_t b;
+
+    if (g < low)
+    {
+      out[x] = VISION_EDGE_NONE;
+      continue;
+    }
+
+    switch (VISION_GRAD_DIR(g))
+    {
+      case VISION_DIR_0:
+        a = row[x - 1U];
+        b = row[x + 1U];
+        break;
+      case VISION_DIR_45:
+        a = above[x - 1U];
+        b = below[x + 1U];
+        break;
+      case VISION_DIR_90:
+        a = above[x];
+        b = below[x];
+        break;
+      default:
+        a = above[x + 1U];
+        b = below[x - 1U];
+        break;
+    }
+
+    // Ties go to the first neighbour so plateaus stay one pixel thick
+    mag = VISION_GRAD_MAG(g);
+    if ((mag <= VISION_GRAD_MAG(a)) || (mag < VISION_GRAD_MAG(b)))
+    {
+      out[x] = VISION_EDGE_NONE;
+    }
+    else
+    {
+      out[x] = (g >= high) ? VISION_EDGE_STRONG : VISION_EDGE_WEAK;
+    }
+  }
+  out[width - 1U] = VISION_EDGE_NONE;
+}
+
+/**
+  * @brief  Turn a map of VISION_EDGE_NONE/WEAK/STRONG into final edges:
+  *         strong pixels and weak pixels 8-connected to them become
+  *         VISION_EDGE, everything else VISION_EDGE_NONE.
+  * @param  edges: classified map, border pixels VISION_EDGE_NONE
+  * @param  stack: edge following stack, at least one item
+  * @retval Number of edge pixels, or VISION_ERR_PARAM
+  */
+int32_t Vision_CannyHysteresis(Vision_Image_t *edges, Vision_CannyStack_t *stack)
+{
+  uint32_t count = 0;
+  uint32_t overflow;
+  uint32_t x;
+  uint32_t y;
+
+  if ((edges == NULL) || (stack == NULL) || (stack->items == NULL) || (stack->depth == 0U) ||
+      (edges->width > 0x10000U) || (edges->height > 0x10000U))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  stack->peak = 0;
+  stack->sweeps = 0;
+
+  do
+  {
+    overflow = 0;
+    stack->sweeps++;
+    count += Vision_CannyFollow(edges, stack, &overflow);
+  } while (overflow != 0U);
+
+  // Weak pixels never reached from a strong one are dropped
+  for (y = 0; y < edges->height; y++)
+  {
+    uint8_t *row = VISION_ROW(edges, y);
+
+    for (x = 0; x < edges->width; x++)
+    {
+      row[x] = (row[x] == VISION_EDGE) ? VISION_EDGE : VISION_EDGE_NONE;
+    }
+  }
+
+  return (int32_t)count;
+}
+
+/**
+  * @brief  Canny edges from a gradient map.
+  * @param  grad: gradient bytes from Vision_Sobel() or Vision_Edge()
+  * @param  edges: receives VISION_EDGE / VISION_EDGE_NONE; same size as
+  *         @p grad and not overlapping it
+  * @param  params: thresholds, may change from call to call
+  * @param  stack: edge following stack
+  * @retval Number of edge pixels, or VISION_ERR_PARAM
+  */
+int32_t Vision_Canny(const Vision_Image_t *grad, Vision_Image_t *edges, const Vision_CannyParams_t *params,
+                     Vision_CannyStack_t *stack)
+{
+  uint32_t y;
+
+  if ((grad == NULL) || (edges == NULL) || (params == NULL) || (params->low > params->high) ||
+      (grad->width != edges->width) || (grad->height != edges->height) || (grad->data == edges->data))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  for (y = 0; y < grad->height; y++)
+  {
+    if ((y == 0U) || ((y + 1U) == grad->height))
+    {
+      memset(VISION_ROW(edges, y), VISION_EDGE_NONE, edges->width);
+      continue;
+    }
+    Vision_CannyNmsRow(VISION_ROW(grad, y - 1U), VISION_ROW(grad, y), VISION_ROW(grad, y + 1U),
+                       VISION_ROW(edges, y), grad->width, params);
+  }
+
+  return Vision_CannyHysteresis(edges, stack);
+}
+
+/**
+  * @brief  One sweep of edge following: every strong pixel becomes an edge
+  *         and spreads to its weak and strong neighbours.
+  * @param  edges: classified map
+  * @param  stack: edge following stack
+  * @param  overflow: set when a neighbour had to be left for another sweep
+  * @retval Number of pixels turned into edges
+  */
+VISION_FAST_CODE static uint32_t Vision_CannyFollow(Vision_Image_t *edges, Vision_CannyStack_t *stack,
+                                                    uint32_t *overflow)
+{
+  uint32_t count = 0;
+  uint32_t top;
+  uint32_t x;
+  uint32_t y;
+
+  for (y = 1U; (y + 1U) < edges->height; y++)
+  {
+    for (x = 1U; (x + 1U) < edges->width; x++)
+    {
+      if (VISION_ROW(edges, y)[x] != VISION_EDGE_STRONG)
+      {
+        continue;
+      }
+
+      VISION_ROW(edges, y)[x] = VISION_EDGE;
+      count++;
+      stack->items[0] = CANNY_PACK(x, y);
+      top = 1U;
+
+      while (top > 0U)
+      {
+        uint32_t p = stack->items[--top];
+        uint32_t px = CANNY_X(p);
+        uint32_t py = CANNY_Y(p);
+        uint32_t ny;
+        uint32_t nx;
+
+        for (ny = py - 1U; ny <= (py + 1U); ny++)
+        {
+          uint8_t *row = VISION_ROW(edges, ny);
+
+          for (nx = px - 1U; nx <= (px + 1U); nx++)
+          {
+            if ((row[nx] != VISION_EDGE_WEAK) && (row[nx] != VISION_EDGE_STRONG))
+            {
+              continue;
+            }
+            if (top == stack->depth)
+            {
+              // Left strong: a later sweep continues from here
+              row[nx] = VISION_EDGE_STRONG;
+              *overflow = 1U;
+              continue;
+            }
+            row[nx] = VISION_EDGE;
+            count++;
+            stack->items[top++] = CANNY_PACK(nx, ny);
+            if (top > stack->peak)
+            {
+              stack->peak = top;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return count;
+}
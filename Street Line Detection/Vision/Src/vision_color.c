@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file           : vision_color.c
+  * @brief          : Colour to gray plane conversion.
+  ******************************************************************************
+  * The OV7670 sends YUV422 as Y0 U0 Y1 V0, so a 32-bit word written by the
+  * DCMI DMA holds two pixels: V0 Y1 U0 Y0 from the most significant byte
+  * down. Luma is every even byte.
+  *
+  * On cores with the DSP extension two words (four pixels) are packed with
+  * PKHBT/PKHTB and narrowed with UXTB16 into one output word, i.e. two loads,
+  * five ALU operations and one store per four pixels. Elsewhere a byte loop
+  * produces the same result bit for bit; Test/test_color.c builds both.
+  *
+  * With the luma capture profiles the DCMI byte select already drops the
+  * chroma during capture; this kernel serves full YUV422 captures.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_color.h"
+
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+// The packed path may be forced on a host (-DVISION_COLOR_SIMD=1) to test it
+#ifndef VISION_COLOR_SIMD
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define VISION_COLOR_SIMD  1
+#else
+#define VISION_COLOR_SIMD  0
+#endif
+#endif
+
+#if VISION_COLOR_SIMD
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include <arm_acle.h>
+#define VISION_UXTB16(x)  __uxtb16(x)
+#else
+#define VISION_UXTB16(x)  ((x) & 0x00FF00FFU)  // Bytes 0 and 2 as halfwords, as UXTB16
+#endif
+#endif
+
+/**
+  * @brief  Extract the luma of one YUYV row.
+  * @param  yuyv: source row, 2 * @p pixels bytes
+  * @param  luma: destination row, @p pixels bytes
+  * @param  pixels: pixels in the row
+  * @retval None
+  */
+VISION_FAST_CODE void Vision_YuyvToLumaRow(const uint8_t *VISION_RESTRICT yuyv, uint8_t *VISION_RESTRICT luma, uint32_t pixels)
+{
+  uint32_t i = 0;
+
+#if VISION_COLOR_SIMD
+  uint32_t w0;
+  uint32_t w1;
+  uint32_t lo;
+  uint32_t hi;
+  uint32_t out;
+
+  // memcpy compiles to single LDR/STR, which the M7 allows unaligned
+  for (; (i + 4U) <= pixels; i += 4U)
+  {
+    memcpy(&w0, yuyv + (2U * i), 4U);
+    memcpy(&w1, yuyv + (2U * i) + 4U, 4U);
+    lo = (w0 & 0x0000FFFFU) | (w1 << 16);   // PKHBT: U1 Y2 U0 Y0
+    hi = (w0 >> 16) | (w1 & 0xFFFF0000U);   // PKHTB: V1 Y3 V0 Y1
+    out = VISION_UXTB16(lo) | (VISION_UXTB16(hi) << 8);
+    memcpy(luma + i, &out, 4U);
+  }
+#endif
+
+  for (; i < pixels; i++)
+  {
+    luma[i] = yuyv[2U * i];
+  }
+}
+
+/**
+  * @brief  Extract the luma plane of a YUYV frame.
+  * @param  yuyv: first byte of the YUYV frame
+  * @param  yuyv_stride: bytes between YUYV rows, at least 2 * luma->width
+  * @param  luma: destination plane; its size gives the frame size
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_YuyvToLuma(const uint8_t *yuyv, uint32_t yuyv_stride, Vision_Image_t *luma)
+{
+  uint32_t y;
+
+  if ((yuyv == NULL) || (luma == NULL) || (yuyv_stride < (2U * luma->width)))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  for (y = 0; y < luma->height; y++)
+  {
+    Vision_YuyvToLumaRow(yuyv + ((size_t)y * yuyv_stride), VISION_ROW(luma, y), luma->width);
+  }
+
+  return VISION_OK;
+}
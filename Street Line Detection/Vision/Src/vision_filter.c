@@ -0,0 +1,266 @@
+/**
+  ******************************************************************************
+  * @file           : vision_filter.c
+  * @brief          : Separable fixed-point Gaussian smoothing on rolling rows.
+  ******************************************************************************
+  * The binomial kernels [1 2 1] and [1 4 6 4 1] are applied as a horizontal
+  * pass into 16-bit row sums and a vertical pass over a ring of
+  * 2 * radius + 1 of those rows, then rounded back to 8 bits with one shift.
+  * Borders replicate the edge pixels.
+  *
+  * Only the ring is needed as working memory (3.2 KB for a 320-pixel 5x5
+  * pass), so it fits in DTCM next to the caller's rows and no second frame
+  * is ever allocated. Rows are pushed one at a time, which suits both whole
+  * frames (Vision_GaussBlur(), in place if wanted) and DCMI bands as they
+  * arrive. Output row y is produced by the push of input row y + radius;
+  * Vision_GaussFlush() produces the last radius rows.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_filter.h"
+
+#include <string.h>
+
+/* Private function prototypes -----------------------------------------------*/
+static void Vision_GaussHorizontal(const uint8_t *VISION_RESTRICT in, uint16_t *VISION_RESTRICT sums,
+                                   uint32_t width, uint32_t radius);
+static void Vision_GaussVertical(const Vision_Gauss_t *gauss, uint8_t *VISION_RESTRICT out);
+static uint16_t *Vision_GaussSlot(const Vision_Gauss_t *gauss, uint32_t row);
+
+/**
+  * @brief  Prepare a streaming Gaussian.
+  * @param  gauss: state to initialise
+  * @param  width: pixels per row
+  * @param  radius: VISION_GAUSS_3X3 or VISION_GAUSS_5X5
+  * @param  rows: VISION_GAUSS_ROWS_WORDS(width, radius) elements
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_GaussInit(Vision_Gauss_t *gauss, uint32_t width, uint32_t radius, uint16_t *rows)
+{
+  if ((gauss == NULL) || (rows == NULL) || (width == 0U) ||
+      ((radius != VISION_GAUSS_3X3) && (radius != VISION_GAUSS_5X5)))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  gauss->width = width;
+  gauss->radius = radius;
+  gauss->taps = (2U * radius) + 1U;
+  gauss->pushed = 0;
+  gauss->rows_in = 0;
+  gauss->emitted = 0;
+  gauss->rows = rows;
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Feed the next input row.
+  * @param  gauss: streaming state
+  * @param  in: input row, gauss->width pixels
+  * @param  out: receives output row gauss->emitted when one is ready; may be
+  *         an earlier input row of the same image
+  * @retval 1 if @p out was written, 0 if not yet, VISION_ERR_PARAM
+  */
+VISION_FAST_CODE int32_t Vision_GaussPush(Vision_Gauss_t *gauss, const uint8_t *in, uint8_t *out)
+{
+  uint32_t pad;
+
+  if ((gauss == NULL) || (in == NULL) || (out == NULL))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  Vision_GaussHorizontal(in, Vision_GaussSlot(gauss, gauss->pushed), gauss->width, gauss->radius);
+
+  if (gauss->pushed == 0U)
+  {
+    // Top border: rows -radius..-1 repeat row 0, stored ahead of it
+    for (pad = 1U; pad <= gauss->radius; pad++)
+    {
+      memcpy(Vision_GaussSlot(gauss, gauss->pushed + pad), Vision_GaussSlot(gauss, 0U),
+             gauss->width * sizeof(uint16_t));
+    }
+    gauss->pushed = gauss->radius;
+  }
+
+  gauss->pushed++;
+  gauss->rows_in++;
+
+  if (gauss->pushed < gauss->taps)
+  {
+    return 0;
+  }
+
+  Vision_GaussVertical(gauss, out);
+  gauss->emitted++;
+
+  return 1;
+}
+
+/**
+  * @brief  Produce one of the last radius output rows once every input row
+  *         has been pushed. Call until it returns 0.
+  * @param  gauss: streaming state
+  * @param  out: receives output row gauss->emitted
+  * @retval 1 if @p out was written, 0 when all rows are out, VISION_ERR_PARAM
+  */
+int32_t Vision_GaussFlush(Vision_Gauss_t *gauss, uint8_t *out)
+{
+  if ((gauss == NULL) || (out == NULL))
+  {
+    return VISION_ERR_PARAM;
+  }
+  if (gauss->emitted >= gauss->rows_in)
+  {
+    return 0;
+  }
+
+  // Bottom border: repeat the last input row
+  memcpy(Vision_GaussSlot(gauss, gauss->pushed), Vision_GaussSlot(gauss, gauss->pushed - 1U),
+         gauss->width * sizeof(uint16_t));
+  gauss->pushed++;
+
+  if (gauss->pushed < gauss->taps)
+  {
+    // Fewer input rows than the kernel height: keep padding
+    return Vision_GaussFlush(gauss, out);
+  }
+
+  Vision_GaussVertical(gauss, out);
+  gauss->emitted++;
+
+  return 1;
+}
+
+/**
+  * @brief  Smooth a whole image.
+  * @param  src: input image
+  * @param  dst: output image of the same size; may be @p src
+  * @param  radius: VISION_GAUSS_3X3 or VISION_GAUSS_5X5
+  * @param  rows: VISION_GAUSS_ROWS_WORDS(src->width, radius) elements
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_GaussBlur(const Vision_Image_t *src, Vision_Image_t *dst, uint32_t radius, uint16_t *rows)
+{
+  Vision_Gauss_t gauss;
+  uint32_t y;
+
+  if ((src == NULL) || (dst == NULL) || (src->width != dst->width) || (src->height != dst->height) ||
+      (Vision_GaussInit(&gauss, src->width, radius, rows) != VISION_OK))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  for (y = 0; y < src->height; y++)
+  {
+    (void)Vision_GaussPush(&gauss, VISION_ROW(src, y), VISION_ROW(dst, gauss.emitted));
+  }
+  while (Vision_GaussFlush(&gauss, VISION_ROW(dst, gauss.emitted)) > 0)
+  {
+  }
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Horizontal pass with replicated borders.
+  * @param  in: input row
+  * @param  sums: receives the weighted sums (weights add up to 4 or 16)
+  * @param  width: pixels per row
+  * @param  radius: kernel radius
+  * @retval None
+  */
+VISION_FAST_CODE static void Vision_GaussHorizontal(const uint8_t *VISION_RESTRICT in, uint16_t *VISION_RESTRICT sums,
+                                                    uint32_t width, uint32_t radius)
+{
+  uint32_t x;
+  uint32_t last = width - 1U;
+
+  if (radius == VISION_GAUSS_3X3)
+  {
+    if (width == 1U)
+    {
+      sums[0] = (uint16_t)(4U * in[0]);
+      return;
+    }
+    sums[0] = (uint16_t)((3U * in[0]) + in[1]);
+    for (x = 1U; x < last; x++)
+    {
+      sums[x] = (uint16_t)(in[x - 1U] + (2U * in[x]) + in[x + 1U]);
+    }
+    sums[last] = (uint16_t)(in[last - 1U] + (3U * in[last]));
+    return;
+  }
+
+  if (width < 5U)
+  {
+    // Narrow rows: clamp every tap
+    for (x = 0; x < width; x++)
+    {
+      uint32_t l1 = (x > 0U) ? (x - 1U) : 0U;
+      uint32_t l2 = (x > 1U) ? (x - 2U) : 0U;
+      uint32_t r1 = (x < last) ? (x + 1U) : last;
+      uint32_t r2 = ((x + 1U) < last) ? (x + 2U) : last;
+      sums[x] = (uint16_t)(in[l2] + (4U * in[l1]) + (6U * in[x]) + (4U * in[r1]) + in[r2]);
+    }
+    return;
+  }
+
+  sums[0] = (uint16_t)((11U * in[0]) + (4U * in[1]) + in[2]);
+  sums[1] = (uint16_t)((5U * in[0]) + (6U * in[1]) + (4U * in[2]) + in[3]);
+  for (x = 2U; x < (last - 1U); x++)
+  {
+    sums[x] = (uint16_t)(in[x - 2U] + in[x + 2U] + (4U * (in[x - 1U] + in[x + 1U])) + (6U * in[x]));
+  }
+  sums[last - 1U] = (uint16_t)(in[last - 3U] + (4U * in[last - 2U]) + (6U * in[last - 1U]) + (5U * in[last]));
+  sums[last] = (uint16_t)(in[last - 2U] + (4U * in[last - 1U]) + (11U * in[last]));
+}
+
+/**
+  * @brief  Vertical pass over the ring, centred radius rows above the newest.
+  * @param  gauss: streaming state
+  * @param  out: output row
+  * @retval None
+  */
+VISION_FAST_CODE static void Vision_GaussVertical(const Vision_Gauss_t *gauss, uint8_t *VISION_RESTRICT out)
+{
+  uint32_t x;
+  uint32_t first = gauss->pushed - gauss->taps;
+  const uint16_t *r0 = Vision_GaussSlot(gauss, first);
+  const uint16_t *r1 = Vision_GaussSlot(gauss, first + 1U);
+  const uint16_t *r2 = Vision_GaussSlot(gauss, first + 2U);
+
+  if (gauss->radius == VISION_GAUSS_3X3)
+  {
+    // Weights total 4 * 4
+    for (x = 0; x < gauss->width; x++)
+    {
+      out[x] = (uint8_t)((r0[x] + (2U * r1[x]) + r2[x] + 8U) >> 4);
+    }
+    return;
+  }
+
+  {
+    const uint16_t *r3 = Vision_GaussSlot(gauss, first + 3U);
+    const uint16_t *r4 = Vision_GaussSlot(gauss, first + 4U);
+
+    // Weights total 16 * 16
+    for (x = 0; x < gauss->width; x++)
+    {
+      out[x] = (uint8_t)((r0[x] + r4[x] + (4U * (r1[x] + r3[x])) + (6U * r2[x]) + 128U) >> 8);
+    }
+  }
+}
+
+/**
+  * @brief  Ring slot holding the horizontal sums of a history row.
+  * @param  gauss: streaming state
+  * @param  row: history row number (padding included)
+  * @retval Row of sums
+  */
+static uint16_t *Vision_GaussSlot(const Vision_Gauss_t *gauss, uint32_t row)
+{
+  return gauss->rows + ((row % gauss->taps) * gauss->width);
+}
@@ -0,0 +1,370 @@
+/**
+  ******************************************************************************
+  * @file           : vision_gradient.c
+  * @brief          : Sobel gradient magnitude and direction in one byte, and
+  *                   the fused Gaussian + Sobel edge stage.
+  ******************************************************************************
+  * Each output byte carries the L1 magnitude |gx| + |gy| (shifted and
+  * saturated to 6 bits) and the gradient direction quantised to four 45
+  * degree sectors, which is all Canny non-maximum suppression needs. The
+  * sector comes from comparing |gy| against |gx| scaled by tan(22.5) and
+  * tan(67.5) in fixed point, so no atan2 or square root is evaluated.
+  *
+  * The Sobel stage keeps three input rows in a ring, like the Gaussian. In
+  * the fused edge stage the Gaussian writes its output rows straight into
+  * that ring, so a frame in RAM_D1 is read exactly once and only the
+  * gradient bytes are written back.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_gradient.h"
+
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+// tan(22.5) and tan(67.5) in Q8
+#define SOBEL_TAN_22_Q8   106U
+#define SOBEL_TAN_67_Q8   618U
+
+/* Private function prototypes -----------------------------------------------*/
+static void Vision_SobelRow(const Vision_Sobel_t *sobel, uint8_t *VISION_RESTRICT out);
+static inline uint8_t Vision_SobelPixel(int32_t gx, int32_t gy, uint32_t shift);
+static uint8_t *Vision_SobelSlot(const Vision_Sobel_t *sobel, uint32_t row);
+
+/**
+  * @brief  Prepare a streaming Sobel stage.
+  * @param  sobel: state to initialise
+  * @param  width: pixels per row
+  * @param  shift: L1 magnitude right shift, VISION_SOBEL_SHIFT_DEFAULT
+  *         suits smoothed 8-bit input
+  * @param  rows: VISION_SOBEL_ROWS_BYTES(width) bytes
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_SobelInit(Vision_Sobel_t *sobel, uint32_t width, uint32_t shift, uint8_t *rows)
+{
+  if ((sobel == NULL) || (rows == NULL) || (width == 0U) || (shift > 5U))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  sobel->width = width;
+  sobel->shift = shift;
+  sobel->pushed = 0;
+  sobel->rows_in = 0;
+  sobel->emitted = 0;
+  sobel->rows = rows;
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Ring slot the next input row must be written to before
+  *         Vision_SobelCommit(). Lets a producer fill the ring in place.
+  * @param  sobel: streaming state
+  * @retval Row of sobel->width pixels
+  */
+uint8_t *Vision_SobelInput(const Vision_Sobel_t *sobel)
+{
+  return Vision_SobelSlot(sobel, sobel->pushed);
+}
+
+/**
+  * @brief  Accept the row written to Vision_SobelInput().
+  * @param  sobel: streaming state
+  * @param  out: receives gradient row sobel->emitted when one is ready
+  * @retval 1 if @p out was written, 0 if not yet, VISION_ERR_PARAM
+  */
+VISION_FAST_CODE int32_t Vision_SobelCommit(Vision_Sobel_t *sobel, uint8_t *out)
+{
+  if ((sobel == NULL) || (out == NULL))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  if (sobel->pushed == 0U)
+  {
+    // Top border: row -1 repeats row 0
+    memcpy(Vision_SobelSlot(sobel, 1U), Vision_SobelSlot(sobel, 0U), sobel->width);
+    sobel->pushed = 1U;
+  }
+
+  sobel->pushed++;
+  sobel->rows_in++;
+
+  if (sobel->pushed < 3U)
+  {
+    return 0;
+  }
+
+  Vision_SobelRow(sobel, out);
+  sobel->emitted++;
+
+  return 1;
+}
+
+/**
+  * @brief  Feed the next input row.
+  * @param  sobel: streaming state
+  * @param  in: input row, sobel->width pixels
+  * @param  out: receives gradient row sobel->emitted when one is ready
+  * @retval 1 if @p out was written, 0 if not yet, VISION_ERR_PARAM
+  */
+int32_t Vision_SobelPush(Vision_Sobel_t *sobel, const uint8_t *in, uint8_t *out)
+{
+  if ((sobel == NULL) || (in == NULL))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  memcpy(Vision_SobelInput(sobel), in, sobel->width);
+
+  return Vision_SobelCommit(sobel, out);
+}
+
+/**
+  * @brief  Produce the last gradient row once every input row has been
+  *         pushed. Call until it returns 0.
+  * @param  sobel: streaming state
+  * @param  out: receives gradient row sobel->emitted
+  * @retval 1 if @p out was written, 0 when all rows are out, VISION_ERR_PARAM
+  */
+int32_t Vision_SobelFlush(Vision_Sobel_t *sobel, uint8_t *out)
+{
+  if ((sobel == NULL) || (out == NULL))
+  {
+    return VISION_ERR_PARAM;
+  }
+  if (sobel->emitted >= sobel->rows_in)
+  {
+    return 0;
+  }
+
+  // Bottom border: repeat the last input row
+  memcpy(Vision_SobelSlot(sobel, sobel->pushed), Vision_SobelSlot(sobel, sobel->pushed - 1U), sobel->width);
+  sobel->pushed++;
+
+  Vision_SobelRow(sobel, out);
+  sobel->emitted++;
+
+  return 1;
+}
+
+/**
+  * @brief  Gradient of a whole image.
+  * @param  src: input image
+  * @param  grad: gradient bytes, same size as @p src; may be @p src
+  * @param  shift: L1 magnitude right shift
+  * @param  rows: VISION_SOBEL_ROWS_BYTES(src->width) bytes
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_Sobel(const Vision_Image_t *src, Vision_Image_t *grad, uint32_t shift, uint8_t *rows)
+{
+  Vision_Sobel_t sobel;
+  uint32_t y;
+
+  if ((src == NULL) || (grad == NULL) || (src->width != grad->width) || (src->height != grad->height) ||
+      (Vision_SobelInit(&sobel, src->width, shift, rows) != VISION_OK))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  for (y = 0; y < src->height; y++)
+  {
+    (void)Vision_SobelPush(&sobel, VISION_ROW(src, y), VISION_ROW(grad, sobel.emitted));
+  }
+  while (Vision_SobelFlush(&sobel, VISION_ROW(grad, sobel.emitted)) > 0)
+  {
+  }
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Prepare the fused Gaussian + Sobel stage.
+  * @param  edge: state to initialise
+  * @param  width: pixels per row
+  * @param  radius: VISION_GAUSS_3X3 or VISION_GAUSS_5X5
+  * @param  shift: L1 magnitude right shift
+  * @param  gauss_rows: VISION_GAUSS_ROWS_WORDS(width, radius) elements
+  * @param  sobel_rows: VISION_SOBEL_ROWS_BYTES(width) bytes
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_EdgeInit(Vision_Edge_t *edge, uint32_t width, uint32_t radius, uint32_t shift,
+                        uint16_t *gauss_rows, uint8_t *sobel_rows)
+{
+  if ((edge == NULL) ||
+      (Vision_GaussInit(&edge->gauss, width, radius, gauss_rows) != VISION_OK) ||
+      (Vision_SobelInit(&edge->sobel, width, shift, sobel_rows) != VISION_OK))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Feed the next raw input row. Output row y is produced by the push
+  *         of input row y + radius + 1.
+  * @param  edge: fused stage state
+  * @param  in: input row
+  * @param  out: receives gradient row edge->sobel.emitted when one is ready
+  * @retval 1 if @p out was written, 0 if not yet, VISION_ERR_PARAM
+  */
+int32_t Vision_EdgePush(Vision_Edge_t *edge, const uint8_t *in, uint8_t *out)
+{
+  int32_t status;
+
+  if ((edge == NULL) || (out == NULL))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  status = Vision_GaussPush(&edge->gauss, in, Vision_SobelInput(&edge->sobel));
+  if (status <= 0)
+  {
+    return status;
+  }
+
+  return Vision_SobelCommit(&edge->sobel, out);
+}
+
+/**
+  * @brief  Produce the remaining gradient rows once every input row has
+  *         been pushed. Call until it returns 0.
+  * @param  edge: fused stage state
+  * @param  out: receives gradient row edge->sobel.emitted
+  * @retval 1 if @p out was written, 0 when all rows are out, VISION_ERR_PARAM
+  */
+int32_t Vision_EdgeFlush(Vision_Edge_t *edge, uint8_t *out)
+{
+  int32_t status;
+
+  if ((edge == NULL) || (out == NULL))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  // Drain the Gaussian into the Sobel ring first
+  while ((status = Vision_GaussFlush(&edge->gauss, Vision_SobelInput(&edge->sobel))) > 0)
+  {
+    status = Vision_SobelCommit(&edge->sobel, out);
+    if (status != 0)
+    {
+      return status;
+    }
+  }
+  if (status < 0)
+  {
+    return status;
+  }
+
+  return Vision_SobelFlush(&edge->sobel, out);
+}
+
+/**
+  * @brief  Smoothed gradient of a whole image in one pass over @p src.
+  * @param  src: input image
+  * @param  grad: gradient bytes, same size as @p src; may be @p src
+  * @param  radius: VISION_GAUSS_3X3 or VISION_GAUSS_5X5
+  * @param  shift: L1 magnitude right shift
+  * @param  gauss_rows: VISION_GAUSS_ROWS_WORDS(src->width, radius) elements
+  * @param  sobel_rows: VISION_SOBEL_ROWS_BYTES(src->width) bytes
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_Edge(const Vision_Image_t *src, Vision_Image_t *grad, uint32_t radius, uint32_t shift,
+                    uint16_t *gauss_rows, uint8_t *sobel_rows)
+{
+  Vision_Edge_t edge;
+  uint32_t y;
+
+  if ((src == NULL) || (grad == NULL) || (src->width != grad->width) || (src->height != grad->height) ||
+      (Vision_EdgeInit(&edge, src->width, radius, shift, gauss_rows, sobel_rows) != VISION_OK))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  for (y = 0; y < src->height; y++)
+  {
+    (void)Vision_EdgePush(&edge, VISION_ROW(src, y), VISION_ROW(grad, edge.sobel.emitted));
+  }
+  while (Vision_EdgeFlush(&edge, VISION_ROW(grad, edge.sobel.emitted)) > 0)
+  {
+  }
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Gradient row centred on the middle row of the ring, with
+  *         replicated left and right borders.
+  * @param  sobel: streaming state
+  * @param  out: gradient row
+  * @retval None
+  */
+VISION_FAST_CODE static void Vision_SobelRow(const Vision_Sobel_t *sobel, uint8_t *VISION_RESTRICT out)
+{
+  const uint8_t *r0 = Vision_SobelSlot(sobel, sobel->pushed - 3U);
+  const uint8_t *r1 = Vision_SobelSlot(sobel, sobel->pushed - 2U);
+  const uint8_t *r2 = Vision_SobelSlot(sobel, sobel->pushed - 1U);
+  uint32_t last = sobel->width - 1U;
+  uint32_t shift = sobel->shift;
+  uint32_t x;
+
+  if (last == 0U)
+  {
+    out[0] = VISION_GRAD_PACK(0U, VISION_DIR_0);
+    return;
+  }
+
+  // Borders replicate the edge column
+  out[0] = Vision_SobelPixel(((int32_t)r0[1] - r0[0]) + (2 * ((int32_t)r1[1] - r1[0])) + ((int32_t)r2[1] - r2[0]),
+                             ((int32_t)(3U * r2[0]) + r2[1]) - ((int32_t)(3U * r0[0]) + r0[1]), shift);
+  for (x = 1U; x < last; x++)
+  {
+    int32_t gx = ((int32_t)r0[x + 1U] - r0[x - 1U]) + (2 * ((int32_t)r1[x + 1U] - r1[x - 1U])) +
+                 ((int32_t)r2[x + 1U] - r2[x - 1U]);
+    int32_t gy = ((int32_t)r2[x - 1U] + (2 * r2[x]) + r2[x + 1U]) - ((int32_t)r0[x - 1U] + (2 * r0[x]) + r0[x + 1U]);
+
+    out[x] = Vision_SobelPixel(gx, gy, shift);
+  }
+  out[last] = Vision_SobelPixel(((int32_t)r0[last] - r0[last - 1U]) + (2 * ((int32_t)r1[last] - r1[last - 1U])) +
+                                ((int32_t)r2[last] - r2[last - 1U]),
+                                ((int32_t)r2[last - 1U] + (3U * r2[last])) - ((int32_t)r0[last - 1U] + (3U * r0[last])),
+                                shift);
+}
+
+/**
+  * @brief  Pack one gradient.
+  * @param  gx: horizontal Sobel response
+  * @param  gy: vertical Sobel response (positive when brighter below)
+  * @param  shift: L1 magnitude right shift
+  * @retval Gradient byte
+  */
+static inline uint8_t Vision_SobelPixel(int32_t gx, int32_t gy, uint32_t shift)
+{
+  uint32_t ax = (uint32_t)((gx < 0) ? -gx : gx);
+  uint32_t ay = (uint32_t)((gy < 0) ? -gy : gy);
+  uint32_t mag = (ax + ay) >> shift;
+  uint32_t diagonal = ((gx ^ gy) >= 0) ? VISION_DIR_45 : VISION_DIR_135;
+  uint32_t dir;
+
+  mag = (mag > VISION_GRAD_MAG_MAX) ? VISION_GRAD_MAG_MAX : mag;
+
+  // Written as selects rather than branches: noisy rows defeat prediction
+  dir = ((ay << 8) >= (ax * SOBEL_TAN_67_Q8)) ? VISION_DIR_90 : diagonal;
+  dir = ((ay << 8) <= (ax * SOBEL_TAN_22_Q8)) ? VISION_DIR_0 : dir;
+
+  return VISION_GRAD_PACK(mag, dir);
+}
+
+/**
+  * @brief  Ring slot holding a history row.
+  * @param  sobel: streaming state
+  * @param  row: history row number (padding included)
+  * @retval Row of pixels
+  */
+static uint8_t *Vision_SobelSlot(const Vision_Sobel_t *sobel, uint32_t row)
+{
+  return sobel->rows + ((row % 3U) * sobel->width);
+}
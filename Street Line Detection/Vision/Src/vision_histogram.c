@@ -0,0 +1,200 @@
+/**
+  ******************************************************************************
+  * @file           : vision_histogram.c
+  * @brief          : Streaming luma histogram and frame statistics.
+  ******************************************************************************
+  * The histogram is filled one band at a time. A capture band callback can
+  * push each band while the DMA fills the next one, so the statistics of a
+  * frame are ready when its last band lands, without another pass over the
+  * frame buffer. Pushing a whole frame as a single band works the same way,
+  * and a loop that already walks the rows of a frame can count each row as
+  * it reads it with Vision_HistogramPushRow().
+  *
+  * Counting is a load, an increment and a store to a bin picked by the
+  * pixel. Road surfaces are flat, so neighbouring pixels often hit the same
+  * bin, and each increment would then wait for the store before it.
+  * Alternate pixels go to two tables, which halves that chain.
+  *
+  * Vision_HistogramStats() reads both tables side by side rather than
+  * merging them into a copy. It derives the extremes, mean, percentiles and
+  * Otsu threshold in a few passes over the 256 bins, so their cost does not
+  * depend on the frame size. The Otsu threshold maximises the between-class
+  * variance w0 * w1 * (m0 - m1)^2. This is evaluated as
+  * (S * w0 - s0 * N)^2 / (w0 * w1), where N and S are the pixel count and
+  * luma sum, and w0 and s0 the count and sum up to the candidate threshold.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_histogram.h"
+
+#include <string.h>
+
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t Vision_HistogramPercentile(const Vision_Histogram_t *hist, uint32_t per_mille);
+
+/**
+  * @brief  Empty the histogram, e.g. at the first band of a frame.
+  * @param  hist: histogram to clear
+  * @retval None
+  */
+void Vision_HistogramReset(Vision_Histogram_t *hist)
+{
+  if (hist != NULL)
+  {
+    memset(hist, 0, sizeof(*hist));
+  }
+}
+
+/**
+  * @brief  Count the pixels of one band.
+  * @param  hist: histogram to add to
+  * @param  band: rows to count, e.g. a band delivered by the capture DMA
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_HistogramPush(Vision_Histogram_t *hist, const Vision_Image_t *band)
+{
+  uint32_t y;
+
+  if ((hist == NULL) || (band == NULL) || (band->data == NULL))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  for (y = 0; y < band->height; y++)
+  {
+    Vision_HistogramPushRow(hist, VISION_ROW(band, y), band->width);
+  }
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Count the pixels of one row.
+  * @param  hist: histogram to add to, not NULL
+  * @param  row: pixels to count
+  * @param  width: pixels in the row
+  * @retval None
+  */
+VISION_FAST_CODE void Vision_HistogramPushRow(Vision_Histogram_t *hist, const uint8_t *row, uint32_t width)
+{
+  uint32_t *VISION_RESTRICT even = hist->bins[0];
+  uint32_t *VISION_RESTRICT odd = hist->bins[1];
+  uint32_t x;
+
+  for (x = 0; (x + 4U) <= width; x += 4U)
+  {
+    even[row[x]]++;
+    odd[row[x + 1U]]++;
+    even[row[x + 2U]]++;
+    odd[row[x + 3U]]++;
+  }
+  for (; x < width; x++)
+  {
+    even[row[x]]++;
+  }
+  hist->count += width;
+}
+
+/**
+  * @brief  Summarise the histogram.
+  * @param  hist: histogram of at least one pixel
+  * @param  low_per_mille: dark percentile, e.g. VISION_HISTOGRAM_LOW_DEFAULT
+  * @param  high_per_mille: bright percentile, low_per_mille to 1000
+  * @param  stats: receives the statistics
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_HistogramStats(const Vision_Histogram_t *hist, uint32_t low_per_mille, uint32_t high_per_mille,
+                              Vision_HistogramStats_t *stats)
+{
+  const uint32_t *even;
+  const uint32_t *odd;
+  uint64_t sum = 0;
+  uint64_t sum0 = 0;
+  uint32_t w0 = 0;
+  double best = -1.0;
+  uint32_t first = VISION_HISTOGRAM_BINS;
+  uint32_t last = 0;
+  uint32_t v;
+
+  if ((hist == NULL) || (stats == NULL) || (hist->count == 0U) || (low_per_mille > high_per_mille) ||
+      (high_per_mille > 1000U))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  even = hist->bins[0];
+  odd = hist->bins[1];
+
+  for (v = 0; v < VISION_HISTOGRAM_BINS; v++)
+  {
+    uint32_t n = even[v] + odd[v];
+
+    sum += (uint64_t)n * v;
+    if (n != 0U)
+    {
+      first = (first > v) ? v : first;
+      last = v;
+    }
+  }
+
+  stats->min = (uint8_t)first;
+  stats->max = (uint8_t)last;
+
+  stats->count = hist->count;
+  stats->mean = (float)((double)sum / (double)hist->count);
+  stats->low = Vision_HistogramPercentile(hist, low_per_mille);
+  stats->median = Vision_HistogramPercentile(hist, 500U);
+  stats->high = Vision_HistogramPercentile(hist, high_per_mille);
+  stats->range = (uint8_t)(stats->high - stats->low);
+
+  // A single-valued frame has no split: every pixel is background
+  stats->otsu = stats->max;
+  for (v = stats->min; v < stats->max; v++)
+  {
+    uint32_t n = even[v] + odd[v];
+    double diff;
+    double between;
+
+    w0 += n;
+    sum0 += (uint64_t)n * v;
+    diff = (double)((int64_t)(sum * w0) - (int64_t)(sum0 * hist->count));
+    between = (diff * diff) / ((double)w0 * (double)(hist->count - w0));
+    if (between > best)
+    {
+      best = between;
+      stats->otsu = (uint8_t)v;
+    }
+  }
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Smallest luma with at least per_mille of the pixels at or below it.
+  * @param  hist: histogram of at least one pixel
+  * @param  per_mille: share of the pixels, 0 to 1000
+  * @retval Luma value
+  */
+static uint8_t Vision_HistogramPercentile(const Vision_Histogram_t *hist, uint32_t per_mille)
+{
+  uint64_t target = (((uint64_t)hist->count * per_mille) + 999U) / 1000U;
+  uint64_t below = 0;
+  uint32_t v;
+
+  if (target == 0U)
+  {
+    target = 1U;
+  }
+
+  for (v = 0; v < (VISION_HISTOGRAM_BINS - 1U); v++)
+  {
+    below += hist->bins[0][v] + hist->bins[1][v];
+    if (below >= target)
+    {
+      break;
+    }
+  }
+
+  return (uint8_t)v;
+}
@@ -0,0 +1,668 @@
+/**
+  ******************************************************************************
+  * @file           : vision_hough.c
+  * @brief          : Fixed-point Hough line transform over a restricted
+  *                   theta range.
+  ******************************************************************************
+  * Trigonometry comes from a Q15 sine table in flash; each vote costs two
+  * multiplies, an add and a rounding shift. Only the configured theta
+  * columns are swept, so limiting the range to plausible lane angles cuts
+  * the voting cost in proportion. Rho is quantised to one pixel, and
+  * because the origin is the top-left pixel, rho cannot be below
+  * -(height - 1). The accumulator is therefore sized from the image (the
+  * ROI) rather than from a worst-case frame.
+  *
+  * Peaks are cells that are at least min_votes and no smaller than any of
+  * their eight neighbours (ties go to the first one in scan order). They
+  * are returned strongest first.
+  *
+  * The progressive probabilistic mode (Matas, Galambos and Kittler) votes
+  * edge pixels one at a time in random order. As soon as a cell reaches the
+  * threshold it walks the edge map along that line, bridging gaps of up to
+  * max_gap pixels, and reports the segment. Then it withdraws the votes of
+  * the pixels it swallowed. Pixels already claimed by a line are never
+  * voted, so a sparse road image is done after a fraction of the votes of
+  * the full transform. Segment lengths are kept, so dashed markings can be
+  * told from solid ones.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_hough.h"
+
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define HOUGH_SIN_OFFSET  90   // Table index of sin(0)
+#define HOUGH_COS_OFFSET  180  // Table index of cos(0) = sin(90)
+
+#define HOUGH_WALK_SHIFT  16     // Fixed-point fraction of the segment walk
+#define HOUGH_PACK(x, y)  (((uint32_t)(y) << 16) | (uint32_t)(x))
+#define HOUGH_X(p)        ((int32_t)((p) & 0xFFFFU))
+#define HOUGH_Y(p)        ((int32_t)((p) >> 16))
+
+/* Private variables ---------------------------------------------------------*/
+// sin(d) in Q15 for d = -90..179 degrees; cos(t) = sin(t + 90)
+static const int16_t hough_sin_q15[270] =
+{
+  -32767, -32763, -32748, -32723, -32688, -32643, -32588, -32524, -32449, -32365,  // -90..-81
+  -32270, -32166, -32052, -31928, -31795, -31651, -31499, -31336, -31164, -30983,  // -80..-71
+  -30792, -30592, -30382, -30163, -29935, -29698, -29452, -29197, -28932, -28660,  // -70..-61
+  -28378, -28088, -27789, -27482, -27166, -26842, -26510, -26170, -25822, -25466,  // -60..-51
+  -25102, -24730, -24351, -23965, -23571, -23170, -22763, -22348, -21926, -21498,  // -50..-41
+  -21063, -20622, -20174, -19720, -19261, -18795, -18324, -17847, -17364, -16877,  // -40..-31
+  -16384, -15886, -15384, -14876, -14365, -13848, -13328, -12803, -12275, -11743,  // -30..-21
+  -11207, -10668, -10126,  -9580,  -9032,  -8481,  -7927,  -7371,  -6813,  -6252,  // -20..-11
+   -5690,  -5126,  -4560,  -3993,  -3425,  -2856,  -2286,  -1715,  -1144,   -572,  // -10..-1
+       0,    572,   1144,   1715,   2286,   2856,   3425,   3993,   4560,   5126,  // 0..9
+    5690,   6252,   6813,   7371,   7927,   8481,   9032,   9580,  10126,  10668,  // 10..19
+   11207,  11743,  12275,  12803,  13328,  13848,  14365,  14876,  15384,  15886,  // 20..29
+   16384,  16877,  17364,  17847,  18324,  18795,  19261,  19720,  20174,  20622,  // 30..39
+   21063,  21498,  21926,  22348,  22763,  23170,  23571,  23965,  24351,  24730,  // 40..49
+   25102,  25466,  25822,  26170,  26510,  26842,  27166,  27482,  27789,  28088,  // 50..59
+   28378,  28660,  28932,  29197,  29452,  29698,  29935,  30163,  30382,  30592,  // 60..69
+   30792,  30983,  31164,  31336,  31499,  31651,  31795,  31928,  32052,  32166,  // 70..79
+   32270,  32365,  32449,  32524,  32588,  32643,  32688,  32723,  32748,  32763,  // 80..89
+   32767,  32763,  32748,  32723,  32688,  32643,  32588,  32524,  32449,  32365,  // 90..99
+   32270,  32166,  32052,  31928,  31795,  31651,  31499,  31336,  31164,  30983,  // 100..109
+   30792,  30592,  30382,  30163,  29935,  29698,  29452,  29197,  28932,  28660,  // 110..119
+   28378,  28088,  27789,  27482,  27166,  26842,  26510,  26170,  25822,  25466,  // 120..129
+   25102,  24730,  24351,  23965,  23571,  23170,  22763,  22348,  21926,  21498,  // 130..139
+   21063,  20622,  20174,  19720,  19261,  18795,  18324,  17847,  17364,  16877,  // 140..149
+   16384,  15886,  15384,  14876,  14365,  13848,  13328,  12803,  12275,  11743,  // 150..159
+   11207,  10668,  10126,   9580,   9032,   8481,   7927,   7371,   6813,   6252,  // 160..169
+    5690,   5126,   4560,   3993,   3425,   2856,   2286,   1715,   1144,    572,  // 170..179
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void Vision_HoughColumns(Vision_Hough_t *hough);
+static uint32_t Vision_HoughVotePoint(Vision_Hough_t *hough, int32_t x, int32_t y, uint32_t *best);
+static void Vision_HoughUnvotePoint(Vision_Hough_t *hough, int32_t x, int32_t y);
+static uint32_t Vision_HoughWalk(Vision_Hough_t *hough, Vision_Image_t *edges, uint32_t point, uint32_t column,
+                                 uint32_t max_gap, uint32_t min_length, Vision_HoughSegment_t *segment);
+static uint32_t Vision_HoughIsqrt(uint32_t value);
+static uint32_t Vision_HoughIsPeak(const Vision_Hough_t *hough, uint32_t t, uint32_t r);
+
+/**
+  * @brief  Size an accumulator for a w x h image and a theta range.
+  * @param  hough: state to initialise
+  * @param  width: voted image width
+  * @param  height: voted image height
+  * @param  params: theta range
+  * @param  acc: accumulator storage
+  * @param  acc_words: elements in @p acc, at least
+  *         VISION_HOUGH_ACC_WORDS(width, height, thetas)
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_HoughInit(Vision_Hough_t *hough, uint32_t width, uint32_t height, const Vision_HoughParams_t *params,
+                         uint16_t *acc, uint32_t acc_words)
+{
+  uint32_t diagonal;
+
+  if ((hough == NULL) || (params == NULL) || (acc == NULL) || (width == 0U) || (height == 0U) ||
+      (width > 0x7FFFU) || (height > 0x7FFFU) || (params->theta_step == 0U) ||
+      (params->theta_min < VISION_HOUGH_THETA_MIN) || (params->theta_max > VISION_HOUGH_THETA_MAX) ||
+      (params->theta_min > params->theta_max))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  diagonal = Vision_HoughIsqrt((width * width) + (height * height)) + 1U;
+
+  // Voting sums x * cos + y * sin + (height - 1) * 2^15 in 32 bits; that
+  // stays below rhos * 2^15, so rhos must fit in 16 bits
+  if ((diagonal + height) > 0xFFFFU)
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  hough->acc = acc;
+  hough->thetas = VISION_HOUGH_THETAS(params->theta_min, params->theta_max, params->theta_step);
+  hough->rhos = diagonal + height;
+  hough->rho_min = -(int32_t)(height - 1U);
+  hough->theta_min = params->theta_min;
+  hough->theta_step = params->theta_step;
+  hough->width = width;
+  hough->height = height;
+
+  if ((hough->thetas * hough->rhos) > acc_words)
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  Vision_HoughColumns(hough);
+  Vision_HoughClear(hough);
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Zero the accumulator before voting a new frame.
+  * @param  hough: transform state
+  * @retval None
+  */
+void Vision_HoughClear(Vision_Hough_t *hough)
+{
+  memset(hough->acc, 0, hough->thetas * hough->rhos * sizeof(uint16_t));
+}
+
+/**
+  * @brief  Add the votes of every non-zero pixel of an edge map.
+  * @param  hough: transform state
+  * @param  edges: edge map of the size given to Vision_HoughInit()
+  * @retval Number of edge pixels voted, or VISION_ERR_PARAM
+  */
+VISION_FAST_CODE int32_t Vision_HoughVote(Vision_Hough_t *hough, const Vision_Image_t *edges)
+{
+  const int16_t *cos_q15;
+  const int16_t *sin_q15;
+  int32_t count = 0;
+  int32_t bias;
+  uint32_t t;
+  uint32_t x;
+  uint32_t y;
+
+  if ((hough == NULL) || (edges == NULL) || (edges->width != hough->width) || (edges->height != hough->height))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  // The bias moves rho_min to cell 0 and rounds
+  bias = (-hough->rho_min * 32768) + (1 << 14);
+  cos_q15 = hough->cos_q15;
+  sin_q15 = hough->sin_q15;
+
+  for (y = 0; y < edges->height; y++)
+  {
+    const uint8_t *row = VISION_ROW(edges, y);
+
+    for (x = 0; x < edges->width; x++)
+    {
+      uint16_t *column = hough->acc;
+
+      if (row[x] == 0U)
+      {
+        continue;
+      }
+
+      for (t = 0; t < hough->thetas; t++)
+      {
+        int32_t rho = (((int32_t)x * cos_q15[t]) + ((int32_t)y * sin_q15[t]) + bias) >> 15;
+
+        column[rho]++;
+        column += hough->rhos;
+      }
+      count++;
+    }
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Find the strongest local maxima of the accumulator.
+  * @param  hough: transform state
+  * @param  min_votes: smallest accepted peak
+  * @param  lines: receives up to @p max_lines lines, strongest first
+  * @param  max_lines: capacity of @p lines
+  * @retval Number of lines written, or VISION_ERR_PARAM
+  */
+int32_t Vision_HoughPeaks(const Vision_Hough_t *hough, uint32_t min_votes, Vision_HoughLine_t *lines,
+                          uint32_t max_lines)
+{
+  uint32_t found = 0;
+  uint32_t t;
+  uint32_t r;
+
+  if ((hough == NULL) || (lines == NULL) || (max_lines == 0U))
+  {
+    return VISION_ERR_PARAM;
+  }
+  if (min_votes == 0U)
+  {
+    min_votes = 1U;
+  }
+
+  for (t = 0; t < hough->thetas; t++)
+  {
+    const uint16_t *column = hough->acc + (t * hough->rhos);
+
+    for (r = 0; r < hough->rhos; r++)
+    {
+      uint32_t votes = column[r];
+      uint32_t slot;
+
+      if ((votes < min_votes) || ((found == max_lines) && (votes <= lines[found - 1U].votes)) ||
+          (Vision_HoughIsPeak(hough, t, r) == 0U))
+      {
+        continue;
+      }
+
+      // Insert in descending order, dropping the weakest when full
+      slot = (found < max_lines) ? found++ : (max_lines - 1U);
+      while ((slot > 0U) && (lines[slot - 1U].votes < votes))
+      {
+        lines[slot] = lines[slot - 1U];
+        slot--;
+      }
+      lines[slot].rho = hough->rho_min + (int32_t)r;
+      lines[slot].theta = hough->theta_min + (int32_t)(t * hough->theta_step);
+      lines[slot].votes = votes;
+    }
+  }
+
+  return (int32_t)found;
+}
+
+/**
+  * @brief  Progressive probabilistic Hough transform.
+  * @param  hough: transform state; its accumulator is cleared and reused
+  * @param  edges: edge map of the size given to Vision_HoughInit(). It is
+  *         consumed: pixels claimed by a segment are cleared and voted ones
+  *         are left as VISION_HOUGH_VOTED
+  * @param  params: threshold, length, gap and seed
+  * @param  points: scratch for the edge pixel list
+  * @param  point_capacity: elements in @p points; edge pixels beyond it are
+  *         never voted but can still belong to a segment
+  * @param  segments: receives up to @p max_segments segments in the order
+  *         they were confirmed
+  * @param  max_segments: capacity of @p segments; voting stops when full
+  * @retval Number of segments written, or VISION_ERR_PARAM
+  */
+int32_t Vision_HoughProbabilistic(Vision_Hough_t *hough, Vision_Image_t *edges, const Vision_PphtParams_t *params,
+                                  uint32_t *points, uint32_t point_capacity, Vision_HoughSegment_t *segments,
+                                  uint32_t max_segments)
+{
+  uint32_t seed;
+  uint32_t count = 0;
+  uint32_t found = 0;
+  uint32_t x;
+  uint32_t y;
+
+  if ((hough == NULL) || (edges == NULL) || (params == NULL) || (points == NULL) || (segments == NULL) ||
+      (edges->width != hough->width) || (edges->height != hough->height) || (params->threshold == 0U))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  Vision_HoughClear(hough);
+
+  for (y = 0; y < edges->height; y++)
+  {
+    const uint8_t *row = VISION_ROW(edges, y);
+
+    for (x = 0; (x < edges->width) && (count < point_capacity); x++)
+    {
+      if (row[x] != 0U)
+      {
+        points[count++] = HOUGH_PACK(x, y);
+      }
+    }
+  }
+
+  seed = params->seed;
+  while ((count > 0U) && (found < max_segments))
+  {
+    uint32_t index;
+    uint32_t point;
+    uint32_t column;
+    uint8_t *pixel;
+
+    // Draw a random pending pixel and remove it from the list
+    seed = (seed * 1664525U) + 1013904223U;
+    index = (uint32_t)(((uint64_t)seed * count) >> 32);
+    point = points[index];
+    points[index] = points[--count];
+
+    pixel = &VISION_ROW(edges, (uint32_t)HOUGH_Y(point))[HOUGH_X(point)];
+    if (*pixel == 0U)
+    {
+      continue;  // Already part of a segment
+    }
+    *pixel = VISION_HOUGH_VOTED;
+
+    if (Vision_HoughVotePoint(hough, HOUGH_X(point), HOUGH_Y(point), &column) < params->threshold)
+    {
+      continue;
+    }
+
+    if (Vision_HoughWalk(hough, edges, point, column, params->max_gap, params->min_length, &segments[found]) != 0U)
+    {
+      found++;
+    }
+  }
+
+  return (int32_t)found;
+}
+
+/**
+  * @brief  Position and slope of a line at a given image row.
+  * @param  line: detected line
+  * @param  y: image row
+  * @param  x_q16: if not NULL, receives the column in Q16
+  * @param  slope_q16: if not NULL, receives dx/dy in Q16
+  * @retval VISION_OK, or VISION_ERR_PARAM for a line too close to
+  *         horizontal to cross rows
+  */
+int32_t Vision_HoughLineAt(const Vision_HoughLine_t *line, int32_t y, int32_t *x_q16, int32_t *slope_q16)
+{
+  int64_t cos_q15;
+  int64_t sin_q15;
+
+  if ((line == NULL) || (line->theta <= VISION_HOUGH_THETA_MIN) || (line->theta > VISION_HOUGH_THETA_MAX))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  cos_q15 = hough_sin_q15[line->theta + HOUGH_COS_OFFSET];
+  sin_q15 = hough_sin_q15[line->theta + HOUGH_SIN_OFFSET];
+
+  // x = (rho - y sin) / cos, dx/dy = -sin / cos
+  if (x_q16 != NULL)
+  {
+    *x_q16 = (int32_t)(((((int64_t)line->rho * 32768) - ((int64_t)y * sin_q15)) * 65536) / cos_q15);
+  }
+  if (slope_q16 != NULL)
+  {
+    *slope_q16 = (int32_t)((-sin_q15 * 65536) / cos_q15);
+  }
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Fill the Q15 cosine and sine of every theta column.
+  * @param  hough: transform state with its theta range set
+  * @retval None
+  */
+static void Vision_HoughColumns(Vision_Hough_t *hough)
+{
+  uint32_t t;
+
+  for (t = 0; t < hough->thetas; t++)
+  {
+    int32_t theta = hough->theta_min + (int32_t)(t * hough->theta_step);
+
+    hough->cos_q15[t] = hough_sin_q15[theta + HOUGH_COS_OFFSET];
+    hough->sin_q15[t] = hough_sin_q15[theta + HOUGH_SIN_OFFSET];
+  }
+}
+
+/**
+  * @brief  Vote one pixel into every theta column.
+  * @param  hough: transform state
+  * @param  x: pixel column
+  * @param  y: pixel row
+  * @param  best: receives the column of the largest updated cell
+  * @retval Votes of the largest updated cell
+  */
+VISION_FAST_CODE static uint32_t Vision_HoughVotePoint(Vision_Hough_t *hough, int32_t x, int32_t y, uint32_t *best)
+{
+  const int16_t *cos_q15 = hough->cos_q15;
+  const int16_t *sin_q15 = hough->sin_q15;
+  int32_t bias = (-hough->rho_min * 32768) + (1 << 14);
+  uint16_t *column = hough->acc;
+  uint32_t max = 0;
+  uint32_t t;
+
+  *best = 0;
+  for (t = 0; t < hough->thetas; t++)
+  {
+    uint16_t *cell = &column[((x * cos_q15[t]) + (y * sin_q15[t]) + bias) >> 15];
+
+    (*cell)++;
+    if (*cell > max)
+    {
+      max = *cell;
+      *best = t;
+    }
+    column += hough->rhos;
+  }
+
+  return max;
+}
+
+/**
+  * @brief  Withdraw the votes of one pixel.
+  * @param  hough: transform state
+  * @param  x: pixel column
+  * @param  y: pixel row
+  * @retval None
+  */
+static void Vision_HoughUnvotePoint(Vision_Hough_t *hough, int32_t x, int32_t y)
+{
+  const int16_t *cos_q15 = hough->cos_q15;
+  const int16_t *sin_q15 = hough->sin_q15;
+  int32_t bias = (-hough->rho_min * 32768) + (1 << 14);
+  uint16_t *column = hough->acc;
+  uint32_t t;
+
+  for (t = 0; t < hough->thetas; t++)
+  {
+    column[((x * cos_q15[t]) + (y * sin_q15[t]) + bias) >> 15]--;
+    column += hough->rhos;
+  }
+}
+
+/**
+  * @brief  Follow a confirmed line through the edge map in both directions
+  *         from a pixel, then clear the pixels it covers, one pixel either
+  *         side included. If the segment is long enough, withdraw the votes
+  *         of the pixels it covered.
+  * @param  hough: transform state
+  * @param  edges: edge map being consumed
+  * @param  point: packed pixel that confirmed the line
+  * @param  column: theta column of the confirmed line
+  * @param  max_gap: longest bridged run of empty pixels
+  * @param  min_length: shortest kept segment, along the major axis
+  * @param  segment: receives the segment when it is kept
+  * @retval 1 if @p segment was written, 0 if the segment was too short
+  */
+static uint32_t Vision_HoughWalk(Vision_Hough_t *hough, Vision_Image_t *edges, uint32_t point, uint32_t column,
+                                 uint32_t max_gap, uint32_t min_length, Vision_HoughSegment_t *segment)
+{
+  // Direction along the line, perpendicular to the normal (cos, sin)
+  int32_t a = -hough->sin_q15[column];
+  int32_t b = hough->cos_q15[column];
+  int32_t abs_a = (a < 0) ? -a : a;
+  int32_t abs_b = (b < 0) ? -b : b;
+  int32_t x0 = HOUGH_X(point);
+  int32_t y0 = HOUGH_Y(point);
+  int32_t end_x[2];
+  int32_t end_y[2];
+  int32_t dx0;
+  int32_t dy0;
+  uint32_t step_x = (abs_a > abs_b) ? 1U : 0U;
+  uint32_t keep;
+  uint32_t pass;
+  uint32_t k;
+
+  // Step one pixel along the major axis, the minor axis in fixed point
+  if (step_x != 0U)
+  {
+    dx0 = (a > 0) ? 1 : -1;
+    dy0 = (int32_t)(((int64_t)b * (1 << HOUGH_WALK_SHIFT)) / abs_a);
+    y0 = (y0 * (1 << HOUGH_WALK_SHIFT)) + (1 << (HOUGH_WALK_SHIFT - 1));
+  }
+  else
+  {
+    dy0 = (b > 0) ? 1 : -1;
+    dx0 = (int32_t)(((int64_t)a * (1 << HOUGH_WALK_SHIFT)) / abs_b);
+    x0 = (x0 * (1 << HOUGH_WALK_SHIFT)) + (1 << (HOUGH_WALK_SHIFT - 1));
+  }
+
+  end_x[0] = end_x[1] = HOUGH_X(point);
+  end_y[0] = end_y[1] = HOUGH_Y(point);
+  keep = 0;
+
+  // Pass 0 finds the end points, pass 1 clears up to them
+  for (pass = 0; pass < 2U; pass++)
+  {
+    for (k = 0; k < 2U; k++)
+    {
+      int32_t dx = (k == 0U) ? dx0 : -dx0;
+      int32_t dy = (k == 0U) ? dy0 : -dy0;
+      int32_t x = x0;
+      int32_t y = y0;
+      uint32_t gap = 0;
+
+      for (;; x += dx, y += dy)
+      {
+        int32_t px = (step_x != 0U) ? x : (x >> HOUGH_WALK_SHIFT);
+        int32_t py = (step_x != 0U) ? (y >> HOUGH_WALK_SHIFT) : y;
+        uint32_t hit = 0;
+        int32_t side;
+
+        if ((px < 0) || (py < 0) || (px >= (int32_t)edges->width) || (py >= (int32_t)edges->height))
+        {
+          break;
+        }
+
+        // The line is one pixel either side of the walk across the minor
+        // axis, which absorbs the drift of a one-degree theta quantum
+        for (side = -1; side <= 1; side++)
+        {
+          int32_t sx = (step_x != 0U) ? px : (px + side);
+          int32_t sy = (step_x != 0U) ? (py + side) : py;
+          uint8_t *pixel;
+
+          if ((sx < 0) || (sy < 0) || (sx >= (int32_t)edges->width) || (sy >= (int32_t)edges->height))
+          {
+            continue;
+          }
+          pixel = &VISION_ROW(edges, (uint32_t)sy)[sx];
+          if (*pixel == 0U)
+          {
+            continue;
+          }
+          hit = 1U;
+          if (pass != 0U)
+          {
+            if ((keep != 0U) && (*pixel == VISION_HOUGH_VOTED))
+            {
+              Vision_HoughUnvotePoint(hough, sx, sy);
+            }
+            *pixel = 0U;
+          }
+        }
+
+        if (pass == 0U)
+        {
+          if (hit != 0U)
+          {
+            gap = 0;
+            end_x[k] = px;
+            end_y[k] = py;
+          }
+          else if (++gap > max_gap)
+          {
+            break;
+          }
+        }
+        else if ((px == end_x[k]) && (py == end_y[k]))
+        {
+          break;
+        }
+      }
+    }
+
+    if (pass == 0U)
+    {
+      int32_t span_x = end_x[1] - end_x[0];
+      int32_t span_y = end_y[1] - end_y[0];
+
+      span_x = (span_x < 0) ? -span_x : span_x;
+      span_y = (span_y < 0) ? -span_y : span_y;
+      keep = ((uint32_t)((span_x > span_y) ? span_x : span_y) >= min_length) ? 1U : 0U;
+    }
+  }
+
+  if (keep == 0U)
+  {
+    return 0;
+  }
+
+  segment->x0 = (int16_t)end_x[0];
+  segment->y0 = (int16_t)end_y[0];
+  segment->x1 = (int16_t)end_x[1];
+  segment->y1 = (int16_t)end_y[1];
+  segment->length = (uint16_t)Vision_HoughIsqrt((uint32_t)(((end_x[1] - end_x[0]) * (end_x[1] - end_x[0])) +
+                                                           ((end_y[1] - end_y[0]) * (end_y[1] - end_y[0]))));
+  segment->theta = (int16_t)(hough->theta_min + (int32_t)(column * hough->theta_step));
+
+  return 1U;
+}
+
+/**
+  * @brief  Integer square root, rounded down.
+  * @param  value: radicand
+  * @retval floor(sqrt(value))
+  */
+static uint32_t Vision_HoughIsqrt(uint32_t value)
+{
+  uint32_t root = 0;
+  uint32_t bit = 1UL << 30;
+
+  while (bit > value)
+  {
+    bit >>= 2;
+  }
+  while (bit != 0U)
+  {
+    if (value >= (root + bit))
+    {
+      value -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else
+    {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+
+  return root;
+}
+
+/**
+  * @brief  Local maximum test over the eight neighbouring cells. Earlier
+  *         cells in scan order must be strictly smaller, later ones no
+  *         larger, so a plateau yields one peak.
+  * @param  hough: transform state
+  * @param  t: theta column
+  * @param  r: rho cell
+  * @retval 1 for a peak, 0 otherwise
+  */
+static uint32_t Vision_HoughIsPeak(const Vision_Hough_t *hough, uint32_t t, uint32_t r)
+{
+  uint32_t votes = hough->acc[(t * hough->rhos) + r];
+  int32_t dt;
+  int32_t dr;
+
+  for (dt = -1; dt <= 1; dt++)
+  {
+    int32_t nt = (int32_t)t + dt;
+
+    if ((nt < 0) || (nt >= (int32_t)hough->thetas))
+    {
+      continue;
+    }
+    for (dr = -1; dr <= 1; dr++)
+    {
+      int32_t nr = (int32_t)r + dr;
+      uint32_t other;
+
+      if ((nr < 0) || (nr >= (int32_t)hough->rhos) || ((dt == 0) && (dr == 0)))
+      {
+        continue;
+      }
+      other = hough->acc[((uint32_t)nt * hough->rhos) + (uint32_t)nr];
+      if ((other > votes) || ((other == votes) && ((dt < 0) || ((dt == 0) && (dr < 0)))))
+      {
+        return 0;
+      }
+    }
+  }
+
+  return 1U;
+}
@@ -0,0 +1,137 @@
+/**
+  ******************************************************************************
+  * @file           : vision_image.c
+  * @brief          : Planar 8-bit image descriptor shared by all kernels.
+  ******************************************************************************
+  * The vision library is hardware independent: it only sees memory through
+  * Vision_Image_t, so the same kernels run on the captured frames in the
+  * firmware and on files loaded by a host program.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_image.h"
+
+#include <string.h>
+
+/**
+  * @brief  Describe a plane held in caller memory.
+  * @param  image: descriptor to fill
+  * @param  data: first pixel
+  * @param  width: pixels per row
+  * @param  height: rows
+  * @param  stride: bytes between rows, at least @p width
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_ImageInit(Vision_Image_t *image, uint8_t *data, uint32_t width, uint32_t height, uint32_t stride)
+{
+  if ((image == NULL) || (data == NULL) || (width == 0U) || (height == 0U) || (stride < width))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  image->data = data;
+  image->width = width;
+  image->height = height;
+  image->stride = stride;
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Describe a rectangle of an image without copying it.
+  * @param  image: parent image
+  * @param  x: left column of the rectangle
+  * @param  y: top row of the rectangle
+  * @param  width: rectangle width
+  * @param  height: rectangle height
+  * @param  view: receives the sub-image, sharing the parent stride
+  * @retval VISION_OK or VISION_ERR_PARAM if the rectangle leaves the image
+  */
+int32_t Vision_ImageView(const Vision_Image_t *image, uint32_t x, uint32_t y, uint32_t width, uint32_t height,
+                         Vision_Image_t *view)
+{
+  if ((image == NULL) || (view == NULL) || (width == 0U) || (height == 0U) ||
+      (x >= image->width) || (y >= image->height) ||
+      (width > (image->width - x)) || (height > (image->height - y)))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  view->data = VISION_ROW(image, y) + x;
+  view->width = width;
+  view->height = height;
+  view->stride = image->stride;
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Set every pixel of an image.
+  * @param  image: image to fill
+  * @param  value: pixel value
+  * @retval None
+  */
+void Vision_ImageFill(Vision_Image_t *image, uint8_t value)
+{
+  uint32_t y;
+
+  for (y = 0; y < image->height; y++)
+  {
+    memset(VISION_ROW(image, y), value, image->width);
+  }
+}
+
+/**
+  * @brief  Copy the pixels of one image into another of the same size.
+  * @param  src: source image
+  * @param  dst: destination image
+  * @retval VISION_OK or VISION_ERR_PARAM if the sizes differ
+  */
+int32_t Vision_ImageCopy(const Vision_Image_t *src, Vision_Image_t *dst)
+{
+  uint32_t y;
+
+  if ((src == NULL) || (dst == NULL) || (src->width != dst->width) || (src->height != dst->height))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  for (y = 0; y < src->height; y++)
+  {
+    memmove(VISION_ROW(dst, y), VISION_ROW(src, y), src->width);
+  }
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Binarise an image with a fixed level: 255 at or above, 0 below.
+  * @param  src: source image
+  * @param  dst: destination image of the same size; may be @p src
+  * @param  level: smallest value mapped to 255
+  * @retval VISION_OK or VISION_ERR_PARAM if the sizes differ
+  */
+VISION_FAST_CODE int32_t Vision_ImageThreshold(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t level)
+{
+  uint32_t x;
+  uint32_t y;
+
+  if ((src == NULL) || (dst == NULL) || (src->width != dst->width) || (src->height != dst->height))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  for (y = 0; y < src->height; y++)
+  {
+    const uint8_t *in = VISION_ROW(src, y);
+    uint8_t *out = VISION_ROW(dst, y);
+
+    for (x = 0; x < src->width; x++)
+    {
+      out[x] = (in[x] >= level) ? 255U : 0U;
+    }
+  }
+
+  return VISION_OK;
+}
@@ -0,0 +1,286 @@
+/**
+  ******************************************************************************
+  * @file           : vision_integral.c
+  * @brief          : Windowed integral image and mean-C adaptive threshold.
+  ******************************************************************************
+  * The integral image is built one input row at a time: each new row adds
+  * the running sum of its pixels to the row above. Only the last few
+  * integral rows are kept, in a ring sized to the window height. Memory
+  * therefore follows the block size and not the frame: 16 rows of a
+  * 320-pixel image take 20 KB, where a full 640x480 integral image would
+  * take 1.2 MB. Sums are 32-bit. Window sums are differences of four
+  * entries, so they stay exact even if the running sums wrap.
+  *
+  * The adaptive threshold compares each pixel with the mean of the
+  * (2 * radius + 1)^2 window around it. The window is clipped at the image
+  * borders. The mean is never divided out: the test is pixel * area >
+  * sum + C * area. Each pixel reads five entries whatever the window size.
+  * The pixel itself is recovered from the integral rows, so the output can
+  * overwrite the input in place.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_integral.h"
+
+#include <string.h>
+
+/* Private function prototypes -----------------------------------------------*/
+static void Vision_AdaptiveRow(const Vision_Adaptive_t *adaptive, uint8_t *VISION_RESTRICT out);
+static uint32_t *Vision_IntegralSlot(const Vision_Integral_t *integral, uint32_t row);
+
+/**
+  * @brief  Prepare an integral window.
+  * @param  integral: state to initialise
+  * @param  width: pixels per input row
+  * @param  slots: integral rows kept, at least 2
+  * @param  rows: VISION_INTEGRAL_ROWS_WORDS(width, slots) elements
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_IntegralInit(Vision_Integral_t *integral, uint32_t width, uint32_t slots, uint32_t *rows)
+{
+  if ((integral == NULL) || (rows == NULL) || (width == 0U) || (slots < 2U))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  integral->width = width;
+  integral->slots = slots;
+  integral->rows_in = 0;
+  integral->rows = rows;
+
+  // Integral row 0: nothing above the first image row
+  memset(Vision_IntegralSlot(integral, 0U), 0, (width + 1U) * sizeof(uint32_t));
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Append the integral row below the next input row.
+  * @param  integral: integral window
+  * @param  in: input row, integral->width pixels
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+VISION_FAST_CODE int32_t Vision_IntegralPush(Vision_Integral_t *integral, const uint8_t *in)
+{
+  const uint32_t *VISION_RESTRICT above;
+  uint32_t *VISION_RESTRICT sums;
+  uint32_t run = 0;
+  uint32_t x;
+
+  if ((integral == NULL) || (in == NULL))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  above = Vision_IntegralSlot(integral, integral->rows_in);
+  sums = Vision_IntegralSlot(integral, integral->rows_in + 1U);
+
+  sums[0] = 0;
+  for (x = 0; x < integral->width; x++)
+  {
+    run += in[x];
+    sums[x + 1U] = above[x + 1U] + run;
+  }
+  integral->rows_in++;
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  One of the integral rows still held.
+  * @param  integral: integral window
+  * @param  row: integral row, 0 to integral->rows_in
+  * @retval width + 1 sums, or NULL if the row is not in the window
+  */
+const uint32_t *Vision_IntegralRow(const Vision_Integral_t *integral, uint32_t row)
+{
+  if ((integral == NULL) || (row > integral->rows_in) || ((row + integral->slots) <= integral->rows_in))
+  {
+    return NULL;
+  }
+
+  return Vision_IntegralSlot(integral, row);
+}
+
+/**
+  * @brief  Prepare a streaming adaptive threshold.
+  * @param  adaptive: state to initialise
+  * @param  width: pixels per row
+  * @param  height: rows of the image
+  * @param  radius: window half size, 1 to VISION_ADAPTIVE_RADIUS_MAX
+  * @param  offset: C, luma a pixel must exceed its window mean by
+  * @param  rows: VISION_ADAPTIVE_ROWS_WORDS(width, radius) elements
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_AdaptiveInit(Vision_Adaptive_t *adaptive, uint32_t width, uint32_t height, uint32_t radius,
+                            int32_t offset, uint32_t *rows)
+{
+  if ((adaptive == NULL) || (height == 0U) || (radius == 0U) || (radius > VISION_ADAPTIVE_RADIUS_MAX) ||
+      (offset < -255) || (offset > 255) ||
+      (Vision_IntegralInit(&adaptive->integral, width, (2U * radius) + 2U, rows) != VISION_OK))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  adaptive->height = height;
+  adaptive->radius = radius;
+  adaptive->offset = offset;
+  adaptive->emitted = 0;
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Feed the next input row.
+  * @param  adaptive: streaming state
+  * @param  in: input row
+  * @param  out: receives output row adaptive->emitted when one is ready;
+  *         may be an earlier input row of the same image
+  * @retval 1 if @p out was written, 0 if not yet, VISION_ERR_PARAM
+  */
+int32_t Vision_AdaptivePush(Vision_Adaptive_t *adaptive, const uint8_t *in, uint8_t *out)
+{
+  if ((adaptive == NULL) || (out == NULL) || (adaptive->integral.rows_in >= adaptive->height) ||
+      (Vision_IntegralPush(&adaptive->integral, in) != VISION_OK))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  if (adaptive->integral.rows_in < (adaptive->emitted + adaptive->radius + 1U))
+  {
+    return 0;
+  }
+
+  Vision_AdaptiveRow(adaptive, out);
+  adaptive->emitted++;
+
+  return 1;
+}
+
+/**
+  * @brief  Produce one of the last radius output rows once every input row
+  *         has been pushed. Call until it returns 0.
+  * @param  adaptive: streaming state
+  * @param  out: receives output row adaptive->emitted
+  * @retval 1 if @p out was written, 0 when all rows are out, VISION_ERR_PARAM
+  */
+int32_t Vision_AdaptiveFlush(Vision_Adaptive_t *adaptive, uint8_t *out)
+{
+  if ((adaptive == NULL) || (out == NULL))
+  {
+    return VISION_ERR_PARAM;
+  }
+  if (adaptive->emitted >= adaptive->integral.rows_in)
+  {
+    return 0;
+  }
+
+  // Windows of the bottom rows are clipped to the last input row
+  Vision_AdaptiveRow(adaptive, out);
+  adaptive->emitted++;
+
+  return 1;
+}
+
+/**
+  * @brief  Threshold a whole image against its local means.
+  * @param  src: input image
+  * @param  dst: output image of the same size, 255 where set; may be @p src
+  * @param  radius: window half size, 1 to VISION_ADAPTIVE_RADIUS_MAX
+  * @param  offset: C, luma a pixel must exceed its window mean by
+  * @param  rows: VISION_ADAPTIVE_ROWS_WORDS(src->width, radius) elements
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_AdaptiveThreshold(const Vision_Image_t *src, Vision_Image_t *dst, uint32_t radius, int32_t offset,
+                                 uint32_t *rows)
+{
+  Vision_Adaptive_t adaptive;
+  uint32_t y;
+
+  if ((src == NULL) || (dst == NULL) || (src->width != dst->width) || (src->height != dst->height) ||
+      (Vision_AdaptiveInit(&adaptive, src->width, src->height, radius, offset, rows) != VISION_OK))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  for (y = 0; y < src->height; y++)
+  {
+    (void)Vision_AdaptivePush(&adaptive, VISION_ROW(src, y), VISION_ROW(dst, adaptive.emitted));
+  }
+  while (Vision_AdaptiveFlush(&adaptive, VISION_ROW(dst, adaptive.emitted)) > 0)
+  {
+  }
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Threshold output row adaptive->emitted.
+  * @param  adaptive: streaming state
+  * @param  out: output row
+  * @retval None
+  */
+VISION_FAST_CODE static void Vision_AdaptiveRow(const Vision_Adaptive_t *adaptive, uint8_t *VISION_RESTRICT out)
+{
+  const Vision_Integral_t *integral = &adaptive->integral;
+  uint32_t width = integral->width;
+  uint32_t radius = adaptive->radius;
+  uint32_t y = adaptive->emitted;
+  uint32_t y0 = (y > radius) ? (y - radius) : 0U;
+  uint32_t y1 = ((y + radius + 1U) < integral->rows_in) ? (y + radius + 1U) : integral->rows_in;
+  const uint32_t *top = Vision_IntegralSlot(integral, y0);
+  const uint32_t *bottom = Vision_IntegralSlot(integral, y1);
+  const uint32_t *above = Vision_IntegralSlot(integral, y);
+  const uint32_t *below = Vision_IntegralSlot(integral, y + 1U);
+  int32_t rows = (int32_t)(y1 - y0);
+  int32_t offset = adaptive->offset;
+  uint32_t inner_start = (radius < width) ? radius : width;
+  uint32_t inner_end = (width > (2U * radius)) ? (width - radius) : inner_start;
+  int32_t area;
+  int32_t sum;
+  int32_t pixel;
+  uint32_t x;
+
+  // Interior: the window never leaves the row, so its area is fixed
+  area = rows * (int32_t)((2U * radius) + 1U);
+  for (x = inner_start; x < inner_end; x++)
+  {
+    sum = (int32_t)((bottom[x + radius + 1U] - bottom[x - radius]) - (top[x + radius + 1U] - top[x - radius]));
+    pixel = (int32_t)((below[x + 1U] - below[x]) - (above[x + 1U] - above[x]));
+    out[x] = (((pixel - offset) * area) > sum) ? 255U : 0U;
+  }
+
+  // Borders: windows clipped to the row
+  for (x = 0; x < width; x++)
+  {
+    uint32_t x0;
+    uint32_t x1;
+
+    if (x == inner_start)
+    {
+      x = inner_end;
+      if (x >= width)
+      {
+        break;
+      }
+    }
+    x0 = (x > radius) ? (x - radius) : 0U;
+    x1 = ((x + radius + 1U) < width) ? (x + radius + 1U) : width;
+    area = rows * (int32_t)(x1 - x0);
+    sum = (int32_t)((bottom[x1] - bottom[x0]) - (top[x1] - top[x0]));
+    pixel = (int32_t)((below[x + 1U] - below[x]) - (above[x + 1U] - above[x]));
+    out[x] = (((pixel - offset) * area) > sum) ? 255U : 0U;
+  }
+}
+
+/**
+  * @brief  Ring slot of an integral row.
+  * @param  integral: integral window
+  * @param  row: integral row
+  * @retval First sum of the row
+  */
+static uint32_t *Vision_IntegralSlot(const Vision_Integral_t *integral, uint32_t row)
+{
+  return integral->rows + ((row % integral->slots) * (integral->width + 1U));
+}
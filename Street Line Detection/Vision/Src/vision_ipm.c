@@ -0,0 +1,61 @@
+/**
+  ******************************************************************************
+  * @file           : vision_ipm.c
+  * @brief          : Inverse perspective mapping (bird's-eye view) through a
+  *                   precomputed source offset table.
+  ******************************************************************************
+  * The projection from road to sensor is evaluated once, on the host, by
+  * Tools/ipm_lut_gen.c, which writes the table as C source. On the target
+  * the warp is a single gather loop of 16-bit offsets with no arithmetic
+  * beyond the indexing, and the table can stay in flash.
+  *
+  * Sampling is nearest-neighbour. Bird's-eye rows are evenly spaced on the
+  * ground, so the far rows repeat source pixels and the near rows skip
+  * some. Columns are evenly spaced too, so lane markings keep a constant
+  * width and distances in pixels convert to millimetres with the step
+  * sizes in the table.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_ipm.h"
+
+/**
+  * @brief  Warp a source image into the bird's-eye view.
+  * @param  lut: generated table
+  * @param  src: source image with the geometry the table was built for
+  * @param  dst: bird's-eye image of lut->width x lut->height
+  * @param  fill: value of ground cells outside the camera view
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+VISION_FAST_CODE int32_t Vision_IpmWarp(const Vision_IpmLut_t *lut, const Vision_Image_t *src, Vision_Image_t *dst,
+                                        uint8_t fill)
+{
+  const uint16_t *offsets;
+  const uint8_t *pixels;
+  uint32_t x;
+  uint32_t y;
+
+  if ((lut == NULL) || (src == NULL) || (dst == NULL) || (lut->offsets == NULL) ||
+      (src->width != lut->src_width) || (src->height != lut->src_height) || (src->stride != lut->src_stride) ||
+      (dst->width != lut->width) || (dst->height != lut->height))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  offsets = lut->offsets;
+  pixels = src->data;
+  for (y = 0; y < dst->height; y++)
+  {
+    uint8_t *VISION_RESTRICT row = VISION_ROW(dst, y);
+
+    for (x = 0; x < dst->width; x++)
+    {
+      uint32_t offset = *offsets++;
+
+      row[x] = (offset != VISION_IPM_NONE) ? pixels[offset] : fill;
+    }
+  }
+
+  return VISION_OK;
+}
@@ -0,0 +1,253 @@
+/**
+  ******************************************************************************
+  * @file           : vision_lane.c
+  * @brief          : Lane pixel search in a binary bird's-eye image.
+  ******************************************************************************
+  * Cold start: a column histogram of the lower half of the image seeds one
+  * lane in each half, and a stack of windows follows each lane from the
+  * bottom row upwards. Each window collects the set pixels within margin of
+  * its centre and, when it holds enough of them, moves the next window onto
+  * their mean column.
+  *
+  * Steady state: when the previous frame produced a trusted fit, the
+  * histogram and the windows are skipped and only a band of margin pixels
+  * either side of the fitted curve is scanned, one span per row.
+  *
+  * Every pixel found goes into the fit sums of its lane as its row is
+  * scanned, so the fit needs no pixel list. A list is kept only when the
+  * caller provides storage; pixels beyond its capacity are counted but not
+  * stored.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_lane.h"
+
+#include <string.h>
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t Vision_LaneCollect(const Vision_Image_t *binary, uint32_t y, int32_t x_min, int32_t x_max,
+                                   Vision_LanePixels_t *pixels, uint32_t *x_sum);
+static int32_t Vision_LanePeak(const uint16_t *histogram, uint32_t first, uint32_t last, uint32_t min_seed);
+static void Vision_LaneFollow(const Vision_Image_t *binary, const Vision_LaneSearchParams_t *params, int32_t base,
+                              Vision_LanePixels_t *pixels);
+
+/**
+  * @brief  Empty a pixel set before a new search.
+  * @param  pixels: pixel set
+  * @param  height: rows of the image searched; the fit sums are centred on
+  *         its middle row
+  * @retval None
+  */
+void Vision_LanePixelsReset(Vision_LanePixels_t *pixels, uint32_t height)
+{
+  pixels->count = 0;
+  pixels->dropped = 0;
+  Vision_LaneFitReset(&pixels->sums, (int32_t)(height / 2U));
+}
+
+/**
+  * @brief  Histogram-seeded sliding-window search for both lanes.
+  * @param  binary: bird's-eye image, non-zero pixels are lane candidates
+  * @param  params: window count, margin and thresholds
+  * @param  histogram: binary->width elements of scratch
+  * @param  left: receives the pixels of the lane seeded in the left half
+  * @param  right: receives the pixels of the lane seeded in the right half
+  * @retval Number of lanes seeded (0 to 2), or VISION_ERR_PARAM
+  */
+int32_t Vision_LaneSlidingWindow(const Vision_Image_t *binary, const Vision_LaneSearchParams_t *params,
+                                 uint16_t *histogram, Vision_LanePixels_t *left, Vision_LanePixels_t *right)
+{
+  int32_t left_base;
+  int32_t right_base;
+  uint32_t x;
+  uint32_t y;
+
+  if ((binary == NULL) || (params == NULL) || (histogram == NULL) || (left == NULL) || (right == NULL) ||
+      (params->windows == 0U) || (params->windows > binary->height) || (binary->width < 2U))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  Vision_LanePixelsReset(left, binary->height);
+  Vision_LanePixelsReset(right, binary->height);
+
+  // Lanes are closest to parallel and least cluttered near the car
+  memset(histogram, 0, binary->width * sizeof(uint16_t));
+  for (y = binary->height / 2U; y < binary->height; y++)
+  {
+    const uint8_t *row = VISION_ROW(binary, y);
+
+    for (x = 0; x < binary->width; x++)
+    {
+      histogram[x] += (row[x] != 0U) ? 1U : 0U;
+    }
+  }
+
+  left_base = Vision_LanePeak(histogram, 0U, binary->width / 2U, params->min_seed);
+  right_base = Vision_LanePeak(histogram, binary->width / 2U, binary->width, params->min_seed);
+
+  if (left_base >= 0)
+  {
+    Vision_LaneFollow(binary, params, left_base, left);
+  }
+  if (right_base >= 0)
+  {
+    Vision_LaneFollow(binary, params, right_base, right);
+  }
+
+  return ((left_base >= 0) ? 1 : 0) + ((right_base >= 0) ? 1 : 0);
+}
+
+/**
+  * @brief  Collect the pixels within margin of a previous fit.
+  * @param  binary: bird's-eye image, non-zero pixels are lane candidates
+  * @param  fit: previous fit of this lane, must be valid
+  * @param  margin: half width of the band around the curve (pixels)
+  * @param  pixels: receives the pixels found
+  * @retval Number of pixels found, or VISION_ERR_PARAM
+  */
+int32_t Vision_LaneSearchAround(const Vision_Image_t *binary, const Vision_LaneFit_t *fit, uint32_t margin,
+                                Vision_LanePixels_t *pixels)
+{
+  uint32_t x_sum;
+  uint32_t y;
+
+  if ((binary == NULL) || (fit == NULL) || (pixels == NULL) || (fit->valid == 0U))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  Vision_LanePixelsReset(pixels, binary->height);
+
+  for (y = 0; y < binary->height; y++)
+  {
+    float centre = (((fit->a * (float)y) + fit->b) * (float)y) + fit->c;
+    int32_t x_centre;
+
+    // Rows where the curve has left the image contribute nothing
+    if ((centre < -(float)margin) || (centre > (float)(binary->width + margin)))
+    {
+      continue;
+    }
+    x_centre = (int32_t)centre;
+    (void)Vision_LaneCollect(binary, y, x_centre - (int32_t)margin, x_centre + (int32_t)margin, pixels, &x_sum);
+  }
+
+  return (int32_t)pixels->sums.n;
+}
+
+/**
+  * @brief  Follow one lane upwards with a stack of windows.
+  * @param  binary: bird's-eye image
+  * @param  params: search settings
+  * @param  base: column of the histogram seed
+  * @param  pixels: receives the lane pixels
+  * @retval None
+  */
+static void Vision_LaneFollow(const Vision_Image_t *binary, const Vision_LaneSearchParams_t *params, int32_t base,
+                              Vision_LanePixels_t *pixels)
+{
+  uint32_t window_rows = binary->height / params->windows;
+  int32_t centre = base;
+  uint32_t w;
+
+  for (w = 0; w < params->windows; w++)
+  {
+    // Window 0 sits on the bottom row; the top one takes the remainder
+    uint32_t y_end = binary->height - (w * window_rows);
+    uint32_t y_start = ((w + 1U) == params->windows) ? 0U : (y_end - window_rows);
+    uint32_t found = 0;
+    uint32_t x_sum = 0;
+    uint32_t y;
+
+    for (y = y_start; y < y_end; y++)
+    {
+      uint32_t row_sum;
+
+      found += Vision_LaneCollect(binary, y, centre - (int32_t)params->margin, centre + (int32_t)params->margin,
+                                  pixels, &row_sum);
+      x_sum += row_sum;
+    }
+
+    if ((found >= params->recentre) && (found > 0U))
+    {
+      centre = (int32_t)(x_sum / found);
+    }
+  }
+}
+
+/**
+  * @brief  Add the set pixels of one row span to a pixel set and its sums.
+  * @param  binary: bird's-eye image
+  * @param  y: row
+  * @param  x_min: first column of the span, clipped to the image
+  * @param  x_max: last column of the span, clipped to the image
+  * @param  pixels: pixel set
+  * @param  x_sum: receives the sum of the columns found
+  * @retval Number of set pixels in the span
+  */
+VISION_FAST_CODE static uint32_t Vision_LaneCollect(const Vision_Image_t *binary, uint32_t y, int32_t x_min,
+                                                    int32_t x_max, Vision_LanePixels_t *pixels, uint32_t *x_sum)
+{
+  const uint8_t *row = VISION_ROW(binary, y);
+  uint32_t found = 0;
+  uint32_t sum = 0;
+  uint32_t sum_sq = 0;
+  int32_t x;
+
+  x_min = (x_min < 0) ? 0 : x_min;
+  x_max = (x_max >= (int32_t)binary->width) ? ((int32_t)binary->width - 1) : x_max;
+
+  for (x = x_min; x <= x_max; x++)
+  {
+    if (row[x] == 0U)
+    {
+      continue;
+    }
+    found++;
+    sum += (uint32_t)x;
+    sum_sq += (uint32_t)x * (uint32_t)x;
+    if (pixels->count < pixels->capacity)
+    {
+      pixels->x[pixels->count] = (uint16_t)x;
+      pixels->y[pixels->count] = (uint16_t)y;
+      pixels->count++;
+    }
+    else
+    {
+      pixels->dropped++;
+    }
+  }
+
+  Vision_LaneFitAddRow(&pixels->sums, y, found, sum, sum_sq);
+
+  *x_sum = sum;
+  return found;
+}
+
+/**
+  * @brief  Tallest histogram column in a range.
+  * @param  histogram: column counts
+  * @param  first: first column of the range
+  * @param  last: one past the last column
+  * @param  min_seed: smallest accepted count
+  * @retval Column, or -1 if no column reaches @p min_seed
+  */
+static int32_t Vision_LanePeak(const uint16_t *histogram, uint32_t first, uint32_t last, uint32_t min_seed)
+{
+  int32_t best = -1;
+  uint32_t best_count = (min_seed > 0U) ? (min_seed - 1U) : 0U;
+  uint32_t x;
+
+  for (x = first; x < last; x++)
+  {
+    if (histogram[x] > best_count)
+    {
+      best_count = histogram[x];
+      best = (int32_t)x;
+    }
+  }
+
+  return best;
+}
@@ -0,0 +1,285 @@
+/**
+  ******************************************************************************
+  * @file           : vision_lanefit.c
+  * @brief          : Incremental quadratic least-squares lane fit and its
+  *                   metric geometry.
+  ******************************************************************************
+  * The lane search adds each row's pixels to a set of normal-equation sums
+  * as it finds them (count, sum of x and sum of x^2 per row), so no pixel
+  * list is needed. The sums are exact 64-bit integers over rows centred on
+  * the middle of the image. The 3x3 system is scaled to [-1, 1] and solved
+  * in single precision with partial pivoting, which the Cortex-M7 FPU does
+  * in hardware. Only the residual, a difference of large nearly equal
+  * terms, is formed in double.
+  *
+  * Geometry converts the fit to metres using the ground step sizes of the
+  * bird's-eye table. Radius and offset are taken at the bottom row, the
+  * road closest to the car. With one line missing, the other is shifted
+  * by a nominal lane width.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_lanefit.h"
+
+#include <math.h>
+
+/* Private define ------------------------------------------------------------*/
+#define LANEFIT_PIVOT_MIN  1e-6f   // Relative pivot below which the system is singular
+
+/**
+  * @brief  Clear the sums before a new frame.
+  * @param  sums: lane sums
+  * @param  origin: row the powers are taken about, normally height / 2
+  * @retval None
+  */
+void Vision_LaneFitReset(Vision_LaneSums_t *sums, int32_t origin)
+{
+  uint32_t k;
+
+  sums->origin = origin;
+  sums->n = 0;
+  for (k = 0; k < 5U; k++)
+  {
+    sums->su[k] = 0;
+  }
+  for (k = 0; k < 3U; k++)
+  {
+    sums->sx[k] = 0;
+  }
+  sums->sxx = 0;
+}
+
+/**
+  * @brief  Add the lane pixels found on one row.
+  * @param  sums: lane sums
+  * @param  y: row
+  * @param  count: pixels found on the row
+  * @param  x_sum: sum of their columns
+  * @param  xx_sum: sum of their squared columns
+  * @retval None
+  */
+void Vision_LaneFitAddRow(Vision_LaneSums_t *sums, uint32_t y, uint32_t count, uint32_t x_sum, uint32_t xx_sum)
+{
+  int64_t u = (int64_t)y - sums->origin;
+  int64_t u2 = u * u;
+
+  if (count == 0U)
+  {
+    return;
+  }
+
+  sums->n += count;
+  sums->su[0] += count;
+  sums->su[1] += count * u;
+  sums->su[2] += count * u2;
+  sums->su[3] += count * u2 * u;
+  sums->su[4] += count * u2 * u2;
+  sums->sx[0] += x_sum;
+  sums->sx[1] += x_sum * u;
+  sums->sx[2] += x_sum * u2;
+  sums->sxx += xx_sum;
+}
+
+/**
+  * @brief  Least-squares quadratic through the summed pixels.
+  * @param  sums: lane sums
+  * @param  fit: receives the fit; fit->valid is cleared on failure
+  * @retval VISION_OK, or VISION_ERR_PARAM with too few pixels or rows
+  */
+int32_t Vision_LaneFitSolve(const Vision_LaneSums_t *sums, Vision_LaneFit_t *fit)
+{
+  float m[3][4];
+  float p[3];
+  float scale;
+  float power[5];
+  double rss;
+  uint32_t i;
+  uint32_t j;
+  uint32_t k;
+
+  if ((sums == NULL) || (fit == NULL))
+  {
+    return VISION_ERR_PARAM;
+  }
+  fit->valid = 0;
+  fit->pixels = sums->n;
+  if (sums->n < VISION_LANE_MIN_PIXELS)
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  // t = u / scale spans about [-1, 1]
+  scale = (sums->origin > 0) ? (float)sums->origin : 1.0f;
+  power[0] = 1.0f;
+  for (k = 1U; k < 5U; k++)
+  {
+    power[k] = power[k - 1U] * scale;
+  }
+  for (i = 0; i < 3U; i++)
+  {
+    for (j = 0; j < 3U; j++)
+    {
+      m[i][j] = (float)sums->su[i + j] / power[i + j];
+    }
+    m[i][3] = (float)sums->sx[i] / power[i];
+  }
+
+  // Gaussian elimination with partial pivoting
+  for (k = 0; k < 3U; k++)
+  {
+    uint32_t pivot = k;
+
+    for (i = k + 1U; i < 3U; i++)
+    {
+      if (fabsf(m[i][k]) > fabsf(m[pivot][k]))
+      {
+        pivot = i;
+      }
+    }
+    if (fabsf(m[pivot][k]) < (LANEFIT_PIVOT_MIN * m[0][0]))
+    {
+      return VISION_ERR_PARAM;  // Pixels on fewer than three rows
+    }
+    if (pivot != k)
+    {
+      for (j = k; j < 4U; j++)
+      {
+        float swap = m[k][j];
+
+        m[k][j] = m[pivot][j];
+        m[pivot][j] = swap;
+      }
+    }
+    for (i = k + 1U; i < 3U; i++)
+    {
+      float factor = m[i][k] / m[k][k];
+
+      for (j = k; j < 4U; j++)
+      {
+        m[i][j] -= factor * m[k][j];
+      }
+    }
+  }
+  for (k = 3U; k-- > 0U;)
+  {
+    float value = m[k][3];
+
+    for (j = k + 1U; j < 3U; j++)
+    {
+      value -= m[k][j] * p[j];
+    }
+    p[k] = value / m[k][k];
+  }
+
+  // Back from t to the image row: x = p2 t^2 + p1 t + p0, t = (y - origin) / scale
+  fit->a = p[2] / (scale * scale);
+  fit->b = (p[1] / scale) - (2.0f * fit->a * (float)sums->origin);
+  fit->c = (p[0] - ((p[1] * (float)sums->origin) / scale)) + (fit->a * (float)sums->origin * (float)sums->origin);
+
+  // Residual: sum x^2 - p . (sums of x t^k)
+  rss = (double)sums->sxx - (((double)p[0] * (double)sums->sx[0]) +
+                             (((double)p[1] * (double)sums->sx[1]) / (double)scale) +
+                             (((double)p[2] * (double)sums->sx[2]) / ((double)scale * (double)scale)));
+  fit->rms = (rss > 0.0) ? sqrtf((float)(rss / sums->n)) : 0.0f;
+  fit->valid = 1U;
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Whether a fit is good enough to guide the next frame's search.
+  * @param  fit: lane fit
+  * @param  min_pixels: smallest pixel support
+  * @param  max_rms: largest residual (pixels)
+  * @retval 1 if confident, 0 otherwise
+  */
+uint32_t Vision_LaneFitConfident(const Vision_LaneFit_t *fit, uint32_t min_pixels, float max_rms)
+{
+  return ((fit != NULL) && (fit->valid != 0U) && (fit->pixels >= min_pixels) && (fit->rms <= max_rms)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Curvature radius and lateral offset in metres at the bottom row.
+  * @param  left: left lane fit, may be invalid
+  * @param  right: right lane fit, may be invalid
+  * @param  lut: bird's-eye table the fits were made in
+  * @param  nominal_width_m: lane width assumed when one line is missing
+  * @param  geometry: receives the result
+  * @retval VISION_OK, or VISION_ERR_PARAM when neither fit is valid
+  */
+int32_t Vision_LaneFitGeometry(const Vision_LaneFit_t *left, const Vision_LaneFit_t *right,
+                               const Vision_IpmLut_t *lut, float nominal_width_m, Vision_LaneGeometry_t *geometry)
+{
+  const Vision_LaneFit_t *fits[2] = { left, right };
+  float x_step;
+  float z_step;
+  float y;
+  float position[2] = { 0.0f, 0.0f };
+  float curvature = 0.0f;
+  uint32_t used = 0;
+  uint32_t k;
+
+  if ((left == NULL) || (right == NULL) || (lut == NULL) || (geometry == NULL))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  x_step = (float)lut->x_step_um * 1e-6f;  // Metres per column
+  z_step = (float)lut->z_step_um * 1e-6f;  // Metres per row
+  y = (float)(lut->height - 1U);
+
+  for (k = 0; k < 2U; k++)
+  {
+    const Vision_LaneFit_t *fit = fits[k];
+    float slope;
+    float bend;
+    float stretch;
+
+    if (fit->valid == 0U)
+    {
+      continue;
+    }
+
+    // Lateral position X (m) of the line at the bottom row; X = 0 is the car axis
+    position[k] = ((float)lut->x_min_mm * 1e-3f) + (x_step * (((fit->a * y) + fit->b) * y + fit->c));
+
+    // X as a function of forward distance Z: rows run towards the car, so dZ = -z_step dy
+    slope = -(x_step / z_step) * ((2.0f * fit->a * y) + fit->b);
+    bend = (2.0f * fit->a * x_step) / (z_step * z_step);
+    stretch = 1.0f + (slope * slope);
+    curvature += bend / (stretch * sqrtf(stretch));
+    used |= 1UL << k;
+  }
+
+  if (used == 0U)
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  // Stand in for a missing line with the nominal lane width
+  if (used == 1U)
+  {
+    position[1] = position[0] + nominal_width_m;
+  }
+  else if (used == 2U)
+  {
+    position[0] = position[1] - nominal_width_m;
+  }
+
+  // Average curvature rather than radius, so a nearly straight line cannot swamp a bent one
+  curvature /= (used == 3U) ? 2.0f : 1.0f;
+  if (fabsf(curvature) <= (1.0f / VISION_LANE_RADIUS_MAX_M))
+  {
+    geometry->radius_m = (curvature < 0.0f) ? -VISION_LANE_RADIUS_MAX_M : VISION_LANE_RADIUS_MAX_M;
+  }
+  else
+  {
+    geometry->radius_m = 1.0f / curvature;
+  }
+  geometry->offset_m = -0.5f * (position[0] + position[1]);
+  geometry->width_m = position[1] - position[0];
+  geometry->lanes = used;
+
+  return VISION_OK;
+}
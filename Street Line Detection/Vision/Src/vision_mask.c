@@ -0,0 +1,309 @@
+/**
+  ******************************************************************************
+  * @file           : vision_mask.c
+  * @brief          : Bit-packed binary masks and word-parallel morphology.
+  ******************************************************************************
+  * A mask stores 32 pixels per word. A 640x480 lane mask then takes 38 KB
+  * and fits in DTCM, against 300 KB at one byte per pixel.
+  *
+  * Erosion and dilation use a 3x3 square element and are separable. The
+  * horizontal pass shifts each word by one pixel either way and carries
+  * the end bits in from the neighbouring words. It then ANDs (erode) or
+  * ORs (dilate) the three, handling 32 pixels with a few shifts and
+  * boolean operations. The vertical pass combines three horizontal results
+  * word by word. The horizontal results sit in a three-row ring, so a pass
+  * may write its output over its input. Borders replicate the edge pixels,
+  * so the image edge neither erodes nor grows a mask.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_mask.h"
+
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define MASK_ERODE   0U
+#define MASK_DILATE  1U
+
+/* Private function prototypes -----------------------------------------------*/
+static int32_t Vision_MaskMorph(const Vision_Mask_t *src, Vision_Mask_t *dst, uint32_t *rows, uint32_t op);
+static void Vision_MaskHorizontal(const uint32_t *VISION_RESTRICT in, uint32_t *VISION_RESTRICT out,
+                                  uint32_t width, uint32_t op);
+static uint32_t Vision_MaskTail(uint32_t width);
+
+/**
+  * @brief  Describe a packed mask over caller-owned words.
+  * @param  mask: descriptor to fill
+  * @param  words: VISION_MASK_WORDS(width, height) elements
+  * @param  width: pixels per row
+  * @param  height: rows
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_MaskInit(Vision_Mask_t *mask, uint32_t *words, uint32_t width, uint32_t height)
+{
+  if ((mask == NULL) || (words == NULL) || (width == 0U) || (height == 0U))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  mask->words = words;
+  mask->width = width;
+  mask->height = height;
+  mask->stride = VISION_MASK_STRIDE(width);
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Pack a binary image: every non-zero pixel becomes a set bit.
+  * @param  src: binary image, e.g. a thresholded plane
+  * @param  dst: mask of the same size
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+VISION_FAST_CODE int32_t Vision_MaskPack(const Vision_Image_t *src, Vision_Mask_t *dst)
+{
+  uint32_t x;
+  uint32_t y;
+
+  if ((src == NULL) || (dst == NULL) || (src->width != dst->width) || (src->height != dst->height))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  for (y = 0; y < src->height; y++)
+  {
+    const uint8_t *in = VISION_ROW(src, y);
+    uint32_t *out = VISION_MASK_ROW(dst, y);
+
+    for (x = 0; x < src->width; x += 32U)
+    {
+      uint32_t count = ((src->width - x) < 32U) ? (src->width - x) : 32U;
+      uint32_t word = 0;
+      uint32_t bit;
+
+      for (bit = 0; bit < count; bit++)
+      {
+        word |= ((in[x + bit] != 0U) ? 1UL : 0UL) << bit;
+      }
+      out[x / 32U] = word;
+    }
+  }
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Expand a mask to a binary image, 255 where set.
+  * @param  src: mask
+  * @param  dst: image of the same size
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+VISION_FAST_CODE int32_t Vision_MaskUnpack(const Vision_Mask_t *src, Vision_Image_t *dst)
+{
+  uint32_t x;
+  uint32_t y;
+
+  if ((src == NULL) || (dst == NULL) || (src->width != dst->width) || (src->height != dst->height))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  for (y = 0; y < src->height; y++)
+  {
+    const uint32_t *in = VISION_MASK_ROW(src, y);
+    uint8_t *out = VISION_ROW(dst, y);
+
+    for (x = 0; x < src->width; x++)
+    {
+      out[x] = (((in[x / 32U] >> (x % 32U)) & 1U) != 0U) ? 255U : 0U;
+    }
+  }
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  3x3 erosion: a pixel stays set only if its whole neighbourhood is.
+  * @param  src: input mask
+  * @param  dst: output mask of the same size; may be @p src
+  * @param  rows: VISION_MORPH_ROWS_WORDS(src->width) elements
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_MaskErode(const Vision_Mask_t *src, Vision_Mask_t *dst, uint32_t *rows)
+{
+  return Vision_MaskMorph(src, dst, rows, MASK_ERODE);
+}
+
+/**
+  * @brief  3x3 dilation: a pixel is set if any pixel of its neighbourhood is.
+  * @param  src: input mask
+  * @param  dst: output mask of the same size; may be @p src
+  * @param  rows: VISION_MORPH_ROWS_WORDS(src->width) elements
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_MaskDilate(const Vision_Mask_t *src, Vision_Mask_t *dst, uint32_t *rows)
+{
+  return Vision_MaskMorph(src, dst, rows, MASK_DILATE);
+}
+
+/**
+  * @brief  3x3 opening: erosion then dilation, removes specks.
+  * @param  src: input mask
+  * @param  dst: output mask of the same size; may be @p src
+  * @param  rows: VISION_MORPH_ROWS_WORDS(src->width) elements
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_MaskOpen(const Vision_Mask_t *src, Vision_Mask_t *dst, uint32_t *rows)
+{
+  if (Vision_MaskMorph(src, dst, rows, MASK_ERODE) != VISION_OK)
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  return Vision_MaskMorph(dst, dst, rows, MASK_DILATE);
+}
+
+/**
+  * @brief  3x3 closing: dilation then erosion, bridges one-pixel gaps.
+  * @param  src: input mask
+  * @param  dst: output mask of the same size; may be @p src
+  * @param  rows: VISION_MORPH_ROWS_WORDS(src->width) elements
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+int32_t Vision_MaskClose(const Vision_Mask_t *src, Vision_Mask_t *dst, uint32_t *rows)
+{
+  if (Vision_MaskMorph(src, dst, rows, MASK_DILATE) != VISION_OK)
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  return Vision_MaskMorph(dst, dst, rows, MASK_ERODE);
+}
+
+/**
+  * @brief  One separable 3x3 pass.
+  * @param  src: input mask
+  * @param  dst: output mask of the same size; may be @p src
+  * @param  rows: three rows of horizontal results
+  * @param  op: MASK_ERODE or MASK_DILATE
+  * @retval VISION_OK or VISION_ERR_PARAM
+  */
+static int32_t Vision_MaskMorph(const Vision_Mask_t *src, Vision_Mask_t *dst, uint32_t *rows, uint32_t op)
+{
+  uint32_t stride;
+  uint32_t y;
+  uint32_t i;
+
+  if ((src == NULL) || (dst == NULL) || (rows == NULL) || (src->width != dst->width) ||
+      (src->height != dst->height))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  stride = VISION_MASK_STRIDE(src->width);
+
+  // Ring slot y % 3 holds the horizontal result of row y; row -1 repeats row 0
+  Vision_MaskHorizontal(VISION_MASK_ROW(src, 0U), rows, src->width, op);
+  memcpy(rows + (2U * stride), rows, stride * sizeof(uint32_t));
+  for (y = 0; y < src->height; y++)
+  {
+    const uint32_t *above = rows + (((y + 2U) % 3U) * stride);
+    const uint32_t *centre = rows + ((y % 3U) * stride);
+    uint32_t *below = rows + (((y + 1U) % 3U) * stride);
+    uint32_t *out = VISION_MASK_ROW(dst, y);
+
+    // Read src row y + 1 before dst row y is written; the row below the last repeats it
+    if ((y + 1U) < src->height)
+    {
+      Vision_MaskHorizontal(VISION_MASK_ROW(src, y + 1U), below, src->width, op);
+    }
+    else
+    {
+      memcpy(below, centre, stride * sizeof(uint32_t));
+    }
+
+    if (op == MASK_ERODE)
+    {
+      for (i = 0; i < stride; i++)
+      {
+        out[i] = above[i] & centre[i] & below[i];
+      }
+    }
+    else
+    {
+      for (i = 0; i < stride; i++)
+      {
+        out[i] = above[i] | centre[i] | below[i];
+      }
+    }
+  }
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Horizontal 1x3 pass over one packed row.
+  * @param  in: input row
+  * @param  out: output row
+  * @param  width: pixels in the row
+  * @param  op: MASK_ERODE or MASK_DILATE
+  * @retval None
+  */
+VISION_FAST_CODE static void Vision_MaskHorizontal(const uint32_t *VISION_RESTRICT in, uint32_t *VISION_RESTRICT out,
+                                                   uint32_t width, uint32_t op)
+{
+  uint32_t words = VISION_MASK_STRIDE(width);
+  uint32_t tail = Vision_MaskTail(width);
+  uint32_t last_bit = (width - 1U) % 32U;
+  uint32_t prev;
+  uint32_t word;
+  uint32_t i;
+
+  // Left border: pixel -1 repeats pixel 0
+  prev = in[0] << 31;
+  for (i = 0; i < words; i++)
+  {
+    uint32_t next;
+    uint32_t left;
+    uint32_t right;
+
+    word = in[i];
+    if ((i + 1U) < words)
+    {
+      next = in[i + 1U];
+    }
+    else
+    {
+      // Right border: pixel width repeats pixel width - 1
+      uint32_t edge = (word >> last_bit) & 1U;
+
+      if (last_bit == 31U)
+      {
+        next = edge;
+      }
+      else
+      {
+        word |= edge << (last_bit + 1U);
+        next = 0;
+      }
+    }
+
+    left = (word << 1) | (prev >> 31);    // Bit x holds pixel x - 1
+    right = (word >> 1) | (next << 31);   // Bit x holds pixel x + 1
+    out[i] = (op == MASK_ERODE) ? (word & left & right) : (word | left | right);
+    prev = word;
+  }
+
+  out[words - 1U] &= tail;
+}
+
+/**
+  * @brief  Bits of the last word of a row that hold pixels.
+  * @param  width: pixels per row
+  * @retval Mask of the valid bits
+  */
+static uint32_t Vision_MaskTail(uint32_t width)
+{
+  return ((width % 32U) == 0U) ? 0xFFFFFFFFU : ((1UL << (width % 32U)) - 1U);
+}
@@ -0,0 +1,475 @@
+/**
+  ******************************************************************************
+  * @file           : vision_track.c
+  * @brief          : Kalman lane tracker and search band prediction.
+  ******************************************************************************
+  * The tracker follows the lane centre line in the bird's-eye view with a
+  * constant-velocity Kalman filter: offset, heading and curvature plus one
+  * rate each, advanced one frame per update. The measurement is the centre
+  * line of the frame's lane fits, or one fit shifted by half the filtered
+  * lane width. It observes the first three states directly, so the gain
+  * needs only a 3x3 inverse and the whole filter is a few hundred float
+  * operations on fixed-size arrays.
+  *
+  * Measurements far outside the predicted covariance are rejected as
+  * misses. A run of accepted frames locks the track. A locked track
+  * publishes the lines it expects next frame, with a corridor that widens
+  * with the position uncertainty. The detector then searches only that
+  * band. Vision_TrackWindow() maps the band back through the remap table
+  * to the rectangle of the source frame the edge stages need to cover.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_track.h"
+
+#include <math.h>
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define TRACK_MEASURED  3U     // States observed: offset, heading, curvature
+#define TRACK_WIDTH_GAIN 0.125f // Low-pass gain of the lane width
+
+/* Private function prototypes -----------------------------------------------*/
+static void Vision_TrackPropagate(float x[VISION_TRACK_STATES],
+                                  float p[VISION_TRACK_STATES][VISION_TRACK_STATES], float q);
+static void Vision_TrackFromFit(const Vision_LaneFit_t *fit, float span, float z[TRACK_MEASURED]);
+static void Vision_TrackToFit(const float z[TRACK_MEASURED], float shift, float span, Vision_LaneFit_t *fit);
+static void Vision_TrackMiss(Vision_Track_t *track);
+
+/**
+  * @brief  Initialise a lost tracker.
+  * @param  track: tracker
+  * @param  params: tuning, copied
+  * @param  height: bird's-eye rows
+  * @retval VISION_OK, or VISION_ERR_PARAM
+  */
+int32_t Vision_TrackInit(Vision_Track_t *track, const Vision_TrackParams_t *params, uint32_t height)
+{
+  if ((track == NULL) || (params == NULL) || (height < 2U) || (params->r <= 0.0f) || (params->width <= 0.0f) ||
+      (params->margin_min > params->margin_max))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  memset(track, 0, sizeof(*track));
+  track->params = *params;
+  track->width = params->width;
+  track->height = height;
+  track->state = VISION_TRACK_LOST;
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Advance the tracker by one frame and fold in the frame's fits.
+  * @param  track: tracker
+  * @param  left: left lane fit, or NULL / invalid when not found
+  * @param  right: right lane fit, or NULL / invalid when not found
+  * @retval Tracker state after the update, VISION_TRACK_LOST without a tracker
+  */
+uint32_t Vision_TrackUpdate(Vision_Track_t *track, const Vision_LaneFit_t *left, const Vision_LaneFit_t *right)
+{
+  float span;
+  float z[TRACK_MEASURED];
+  float side[TRACK_MEASURED];
+  float s[TRACK_MEASURED][TRACK_MEASURED];
+  float si[TRACK_MEASURED][TRACK_MEASURED];
+  float k[VISION_TRACK_STATES][TRACK_MEASURED];
+  float hp[TRACK_MEASURED][VISION_TRACK_STATES];
+  float y[TRACK_MEASURED];
+  float r;
+  float width = -1.0f;
+  float det;
+  float d2;
+  uint32_t has_left = ((left != NULL) && (left->valid != 0U)) ? 1U : 0U;
+  uint32_t has_right = ((right != NULL) && (right->valid != 0U)) ? 1U : 0U;
+  uint32_t i;
+  uint32_t j;
+  uint32_t m;
+
+  if (track == NULL)
+  {
+    return VISION_TRACK_LOST;
+  }
+
+  span = (float)(track->height - 1U);
+  r = track->params.r;
+
+  if (track->state != VISION_TRACK_LOST)
+  {
+    Vision_TrackPropagate(track->x, track->p, track->params.q);
+  }
+
+  // Centre line measurement
+  if ((has_left != 0U) && (has_right != 0U))
+  {
+    Vision_TrackFromFit(left, span, z);
+    Vision_TrackFromFit(right, span, side);
+    width = side[0] - z[0];
+    for (i = 0; i < TRACK_MEASURED; i++)
+    {
+      z[i] = 0.5f * (z[i] + side[i]);
+    }
+    r *= 0.5f;  // Mean of two lines
+  }
+  else if (has_left != 0U)
+  {
+    Vision_TrackFromFit(left, span, z);
+    z[0] += 0.5f * track->width;
+  }
+  else if (has_right != 0U)
+  {
+    Vision_TrackFromFit(right, span, z);
+    z[0] -= 0.5f * track->width;
+  }
+  else
+  {
+    Vision_TrackMiss(track);
+    return track->state;
+  }
+
+  if (track->state == VISION_TRACK_LOST)
+  {
+    // Start from the measurement with unknown rates
+    memset(track->x, 0, sizeof(track->x));
+    memset(track->p, 0, sizeof(track->p));
+    for (i = 0; i < TRACK_MEASURED; i++)
+    {
+      track->x[i] = z[i];
+      track->p[i][i] = r;
+      track->p[i + TRACK_MEASURED][i + TRACK_MEASURED] = track->params.r;
+    }
+    if (width > 0.0f)
+    {
+      track->width = width;
+    }
+    track->hits = 1U;
+    track->misses = 0;
+    track->state = (track->params.lock_frames <= 1U) ? VISION_TRACK_LOCKED : VISION_TRACK_ACQUIRING;
+    return track->state;
+  }
+
+  // Innovation and its covariance S = P[0:3][0:3] + R
+  for (i = 0; i < TRACK_MEASURED; i++)
+  {
+    y[i] = z[i] - track->x[i];
+    for (j = 0; j < TRACK_MEASURED; j++)
+    {
+      s[i][j] = track->p[i][j];
+    }
+    s[i][i] += r;
+  }
+
+  // S is symmetric: inverse by cofactors
+  si[0][0] = (s[1][1] * s[2][2]) - (s[1][2] * s[2][1]);
+  si[0][1] = (s[0][2] * s[2][1]) - (s[0][1] * s[2][2]);
+  si[0][2] = (s[0][1] * s[1][2]) - (s[0][2] * s[1][1]);
+  si[1][1] = (s[0][0] * s[2][2]) - (s[0][2] * s[2][0]);
+  si[1][2] = (s[0][2] * s[1][0]) - (s[0][0] * s[1][2]);
+  si[2][2] = (s[0][0] * s[1][1]) - (s[0][1] * s[1][0]);
+  det = (s[0][0] * si[0][0]) + (s[0][1] * si[0][1]) + (s[0][2] * si[0][2]);
+  if (det <= 0.0f)
+  {
+    Vision_TrackMiss(track);
+    return track->state;
+  }
+  det = 1.0f / det;
+  si[0][0] *= det;
+  si[0][1] *= det;
+  si[0][2] *= det;
+  si[1][1] *= det;
+  si[1][2] *= det;
+  si[2][2] *= det;
+  si[1][0] = si[0][1];
+  si[2][0] = si[0][2];
+  si[2][1] = si[1][2];
+
+  // Gate on the Mahalanobis distance of the innovation
+  d2 = 0.0f;
+  for (i = 0; i < TRACK_MEASURED; i++)
+  {
+    for (j = 0; j < TRACK_MEASURED; j++)
+    {
+      d2 += y[i] * si[i][j] * y[j];
+    }
+  }
+  if (d2 > track->params.gate)
+  {
+    Vision_TrackMiss(track);
+    return track->state;
+  }
+
+  // K = P H' S^-1, x += K y, P -= K H P
+  for (i = 0; i < VISION_TRACK_STATES; i++)
+  {
+    for (j = 0; j < TRACK_MEASURED; j++)
+    {
+      k[i][j] = (track->p[i][0] * si[0][j]) + (track->p[i][1] * si[1][j]) + (track->p[i][2] * si[2][j]);
+    }
+  }
+  for (m = 0; m < TRACK_MEASURED; m++)
+  {
+    for (j = 0; j < VISION_TRACK_STATES; j++)
+    {
+      hp[m][j] = track->p[m][j];
+    }
+  }
+  for (i = 0; i < VISION_TRACK_STATES; i++)
+  {
+    track->x[i] += (k[i][0] * y[0]) + (k[i][1] * y[1]) + (k[i][2] * y[2]);
+    for (j = 0; j < VISION_TRACK_STATES; j++)
+    {
+      track->p[i][j] -= (k[i][0] * hp[0][j]) + (k[i][1] * hp[1][j]) + (k[i][2] * hp[2][j]);
+    }
+  }
+  // Keep P symmetric against float round-off
+  for (i = 0; i < VISION_TRACK_STATES; i++)
+  {
+    for (j = i + 1U; j < VISION_TRACK_STATES; j++)
+    {
+      float mean = 0.5f * (track->p[i][j] + track->p[j][i]);
+
+      track->p[i][j] = mean;
+      track->p[j][i] = mean;
+    }
+  }
+
+  if (width > 0.0f)
+  {
+    track->width += TRACK_WIDTH_GAIN * (width - track->width);
+  }
+  track->misses = 0;
+  track->hits++;
+  if (track->hits >= track->params.lock_frames)
+  {
+    track->state = VISION_TRACK_LOCKED;
+  }
+
+  return track->state;
+}
+
+/**
+  * @brief  Current filtered estimate of both lane lines.
+  * @param  track: tracker
+  * @param  left: receives the left line
+  * @param  right: receives the right line
+  * @retval VISION_OK, or VISION_ERR_PARAM when the track is lost
+  */
+int32_t Vision_TrackLines(const Vision_Track_t *track, Vision_LaneFit_t *left, Vision_LaneFit_t *right)
+{
+  float span;
+
+  if ((track == NULL) || (left == NULL) || (right == NULL) || (track->state == VISION_TRACK_LOST))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  span = (float)(track->height - 1U);
+  Vision_TrackToFit(track->x, -0.5f * track->width, span, left);
+  Vision_TrackToFit(track->x, 0.5f * track->width, span, right);
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Lines expected in the next frame and the corridor to search.
+  * @param  track: tracker
+  * @param  band: receives both lines and the corridor half width
+  * @retval VISION_OK, or VISION_ERR_PARAM when the track is lost
+  */
+int32_t Vision_TrackPredict(const Vision_Track_t *track, Vision_TrackBand_t *band)
+{
+  float span;
+  float x[VISION_TRACK_STATES];
+  float p[VISION_TRACK_STATES][VISION_TRACK_STATES];
+  float margin;
+
+  if ((track == NULL) || (band == NULL) || (track->state == VISION_TRACK_LOST))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  span = (float)(track->height - 1U);
+  memcpy(x, track->x, sizeof(x));
+  memcpy(p, track->p, sizeof(p));
+  Vision_TrackPropagate(x, p, track->params.q);
+
+  Vision_TrackToFit(x, -0.5f * track->width, span, &band->left);
+  Vision_TrackToFit(x, 0.5f * track->width, span, &band->right);
+
+  // Three standard deviations of the offset on top of the line width itself
+  margin = (float)track->params.margin_min + (3.0f * sqrtf((p[0][0] > 0.0f) ? p[0][0] : 0.0f));
+  band->margin = (margin < (float)track->params.margin_max) ? (uint32_t)margin : track->params.margin_max;
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Bounding rectangle, in the source frame, of a band's corridors.
+  * @param  band: predicted band
+  * @param  lut: remap table of the bird's-eye view
+  * @param  pad: pixels added on every side, for filter support
+  * @param  window: receives the rectangle, clipped to the source frame
+  * @retval VISION_OK, or VISION_ERR_PARAM when no corridor pixel is mapped
+  */
+int32_t Vision_TrackWindow(const Vision_TrackBand_t *band, const Vision_IpmLut_t *lut, uint32_t pad,
+                           Vision_TrackWindow_t *window)
+{
+  uint32_t x_min = UINT32_MAX;
+  uint32_t y_min = UINT32_MAX;
+  uint32_t x_max = 0;
+  uint32_t y_max = 0;
+  uint32_t y;
+
+  if ((band == NULL) || (lut == NULL) || (window == NULL) || (lut->src_stride == 0U))
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  for (y = 0; y < lut->height; y++)
+  {
+    // A bird's-eye row is a straight source line: its extremes lie on the corridor ends
+    float fy = (float)y;
+    float ends[2];
+    uint32_t e;
+
+    ends[0] = (((band->left.a * fy) + band->left.b) * fy) + band->left.c - (float)band->margin;
+    ends[1] = (((band->right.a * fy) + band->right.b) * fy) + band->right.c + (float)band->margin;
+    if ((ends[1] < 0.0f) || (ends[0] > (float)(lut->width - 1U)))
+    {
+      continue;
+    }
+
+    for (e = 0; e < 2U; e++)
+    {
+      float column = ends[e];
+      uint32_t offset;
+      uint32_t sx;
+      uint32_t sy;
+
+      column = (column < 0.0f) ? 0.0f : column;
+      column = (column > (float)(lut->width - 1U)) ? (float)(lut->width - 1U) : column;
+      offset = lut->offsets[(y * lut->width) + (uint32_t)column];
+      if (offset == VISION_IPM_NONE)
+      {
+        continue;
+      }
+      sy = offset / lut->src_stride;
+      sx = offset - (sy * lut->src_stride);
+      x_min = (sx < x_min) ? sx : x_min;
+      x_max = (sx > x_max) ? sx : x_max;
+      y_min = (sy < y_min) ? sy : y_min;
+      y_max = (sy > y_max) ? sy : y_max;
+    }
+  }
+
+  if (x_min > x_max)
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  x_min = (x_min > pad) ? (x_min - pad) : 0U;
+  y_min = (y_min > pad) ? (y_min - pad) : 0U;
+  x_max = ((x_max + pad) < lut->src_width) ? (x_max + pad) : (lut->src_width - 1U);
+  y_max = ((y_max + pad) < lut->src_height) ? (y_max + pad) : (lut->src_height - 1U);
+
+  window->x = x_min;
+  window->y = y_min;
+  window->width = x_max - x_min + 1U;
+  window->height = y_max - y_min + 1U;
+
+  return VISION_OK;
+}
+
+/**
+  * @brief  Advance state and covariance by one frame: x' = F x,
+  *         P' = F P F' + Q, with F adding each rate to its state.
+  * @param  x: state
+  * @param  p: covariance
+  * @param  q: process noise on the rates
+  * @retval None
+  */
+static void Vision_TrackPropagate(float x[VISION_TRACK_STATES],
+                                  float p[VISION_TRACK_STATES][VISION_TRACK_STATES], float q)
+{
+  uint32_t i;
+  uint32_t j;
+
+  for (i = 0; i < TRACK_MEASURED; i++)
+  {
+    x[i] += x[i + TRACK_MEASURED];
+  }
+
+  // Rows: F P
+  for (i = 0; i < TRACK_MEASURED; i++)
+  {
+    for (j = 0; j < VISION_TRACK_STATES; j++)
+    {
+      p[i][j] += p[i + TRACK_MEASURED][j];
+    }
+  }
+  // Columns: (F P) F'
+  for (i = 0; i < VISION_TRACK_STATES; i++)
+  {
+    for (j = 0; j < TRACK_MEASURED; j++)
+    {
+      p[i][j] += p[i][j + TRACK_MEASURED];
+    }
+  }
+  for (i = TRACK_MEASURED; i < VISION_TRACK_STATES; i++)
+  {
+    p[i][i] += q;
+  }
+}
+
+/**
+  * @brief  Offset, heading and curvature of a fit: with Y the bottom row
+  *         and v = (Y - y) / Y, x = (a Y^2 + b Y + c) - (2 a Y + b) Y v + a Y^2 v^2.
+  * @param  fit: lane fit
+  * @param  span: Y
+  * @param  z: receives offset, heading and curvature
+  * @retval None
+  */
+static void Vision_TrackFromFit(const Vision_LaneFit_t *fit, float span, float z[TRACK_MEASURED])
+{
+  z[0] = (((fit->a * span) + fit->b) * span) + fit->c;
+  z[1] = -((2.0f * fit->a * span) + fit->b) * span;
+  z[2] = fit->a * span * span;
+}
+
+/**
+  * @brief  Lane fit of a centre line shifted sideways.
+  * @param  z: offset, heading and curvature of the centre line
+  * @param  shift: lateral shift (pixels)
+  * @param  span: Y
+  * @param  fit: receives the fit
+  * @retval None
+  */
+static void Vision_TrackToFit(const float z[TRACK_MEASURED], float shift, float span, Vision_LaneFit_t *fit)
+{
+  fit->a = z[2] / (span * span);
+  fit->b = -(z[1] + (2.0f * z[2])) / span;
+  fit->c = z[0] + shift + z[1] + z[2];
+  fit->rms = 0.0f;
+  fit->pixels = 0;
+  fit->valid = 1U;
+}
+
+/**
+  * @brief  Coast through a frame without an accepted measurement; the
+  *         prediction stands as the estimate.
+  * @param  track: tracker
+  * @retval None
+  */
+static void Vision_TrackMiss(Vision_Track_t *track)
+{
+  if (track->state == VISION_TRACK_LOST)
+  {
+    return;
+  }
+
+  track->hits = 0;
+  track->misses++;
+  track->state = (track->misses > track->params.miss_frames) ? VISION_TRACK_LOST : VISION_TRACK_ACQUIRING;
+}
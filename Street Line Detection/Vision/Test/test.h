@@ -0,0 +1,58 @@
+/**
+  ******************************************************************************
+  * @file           : test.h
+  * @brief          : Minimal check macros for the host unit tests.
+  ******************************************************************************
+  * Every Test/test_*.c file is one host program. It is linked against
+  * build/libvision.a and, where it needs them, against the hardware
+  * independent Core modules. A failed check prints its location and the
+  * test goes on; TEST_RESULT() returns the exit status the runner expects.
+  *
+  *   make -C Vision test
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TEST_H
+#define __TEST_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t test_checks;
+static uint32_t test_failures;
+
+/* Exported macro ------------------------------------------------------------*/
+#define TEST_CHECK(cond)                                                      \
+  do                                                                          \
+  {                                                                           \
+    test_checks++;                                                            \
+    if (!(cond))                                                              \
+    {                                                                         \
+      test_failures++;                                                        \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+    }                                                                         \
+  } while (0)
+
+#define TEST_CHECK_EQ(actual, expected)                                       \
+  do                                                                          \
+  {                                                                           \
+    long long test_a = (long long)(actual);                                   \
+    long long test_e = (long long)(expected);                                 \
+    test_checks++;                                                            \
+    if (test_a != test_e)                                                     \
+    {                                                                         \
+      test_failures++;                                                        \
+      fprintf(stderr, "%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, \
+              #actual, test_a, test_e);                                       \
+    }                                                                         \
+  } while (0)
+
+// Summary line and exit status of a test program
+#define TEST_RESULT(name)                                                     \
+  (printf("%-16s %u checks, %u failed\n", (name), (unsigned)test_checks,     \
+          (unsigned)test_failures), (test_failures == 0U) ? 0 : 1)
+
+#endif /* __TEST_H */
@@ -0,0 +1,167 @@
+/**
+  ******************************************************************************
+  * @file           : test_band_seq.c
+  * @brief          : Host tests of the band streaming line sequencing.
+  ******************************************************************************
+  * Drives Core/Src/band_seq.c the way the capture driver does in band mode:
+  * BandSeq_BandComplete() stands for the DMA half-transfer and
+  * transfer-complete interrupts, BandSeq_FrameStart() for VSYNC.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "band_seq.h"
+#include "test.h"
+
+#include <stddef.h>
+
+/* Private define ------------------------------------------------------------*/
+#define TEST_LINES       120U  // Captured luma lines of the road ROI
+#define TEST_BAND_LINES  8U
+#define TEST_BANDS       (TEST_LINES / TEST_BAND_LINES)
+
+/* Private function prototypes -----------------------------------------------*/
+static void Test_Init(void);
+static void Test_Frame(void);
+static void Test_FirstLine(void);
+static void Test_ExtraBand(void);
+static void Test_VsyncMidFrame(void);
+static uint32_t Test_Bands(BandSeq_t *seq, uint32_t bands, uint32_t *first, uint32_t *last);
+
+int main(void)
+{
+  Test_Init();
+  Test_Frame();
+  Test_FirstLine();
+  Test_ExtraBand();
+  Test_VsyncMidFrame();
+
+  return TEST_RESULT("band_seq");
+}
+
+static void Test_Init(void)
+{
+  BandSeq_t seq;
+
+  TEST_CHECK_EQ(BandSeq_Init(NULL, TEST_LINES, TEST_BAND_LINES, 0U), -1);
+  TEST_CHECK_EQ(BandSeq_Init(&seq, TEST_LINES, 0U, 0U), -1);
+  TEST_CHECK_EQ(BandSeq_Init(&seq, TEST_LINES, 16U, 0U), -1);
+  TEST_CHECK_EQ(BandSeq_Init(&seq, TEST_LINES, TEST_BAND_LINES, 0U), 0);
+  TEST_CHECK_EQ(seq.next_line, 0U);
+  TEST_CHECK_EQ(seq.extra, 0U);
+}
+
+// Frame after frame: every band is delivered once, in line order
+static void Test_Frame(void)
+{
+  BandSeq_t seq;
+  uint32_t expected;
+  uint32_t line = 0;
+  uint32_t band;
+  uint32_t ordered = 1U;
+  uint32_t frame;
+
+  (void)BandSeq_Init(&seq, TEST_LINES, TEST_BAND_LINES, 0U);
+  for (frame = 0; frame < 3U; frame++)
+  {
+    expected = 0;
+    for (band = 0; band < TEST_BANDS; band++)
+    {
+      if ((BandSeq_BandComplete(&seq, &line) != 1U) || (line != expected))
+      {
+        ordered = 0U;
+      }
+      expected += TEST_BAND_LINES;
+    }
+    BandSeq_FrameStart(&seq);
+  }
+  TEST_CHECK_EQ(ordered, 1U);
+  TEST_CHECK_EQ(seq.extra, 0U);
+}
+
+// Bands lying wholly above first_line are numbered but not delivered
+static void Test_FirstLine(void)
+{
+  BandSeq_t seq;
+  uint32_t first = 0;
+  uint32_t last = 0;
+
+  (void)BandSeq_Init(&seq, TEST_LINES, TEST_BAND_LINES, 20U);
+  TEST_CHECK_EQ(Test_Bands(&seq, TEST_BANDS, &first, &last), TEST_BANDS - 2U);
+  TEST_CHECK_EQ(first, 16U);
+  TEST_CHECK_EQ(last, TEST_LINES - TEST_BAND_LINES);
+
+  // The band just above first_line is skipped, the one starting on it is not
+  (void)BandSeq_Init(&seq, TEST_LINES, TEST_BAND_LINES, 16U);
+  TEST_CHECK_EQ(Test_Bands(&seq, TEST_BANDS, &first, &last), TEST_BANDS - 2U);
+  TEST_CHECK_EQ(first, 16U);
+}
+
+// A frame longer than configured: bands past the last line wait for VSYNC
+static void Test_ExtraBand(void)
+{
+  BandSeq_t seq;
+  uint32_t line = 0xFFFFFFFFU;
+  uint32_t first = 0;
+  uint32_t last = 0;
+
+  (void)BandSeq_Init(&seq, TEST_LINES, TEST_BAND_LINES, 0U);
+  TEST_CHECK_EQ(Test_Bands(&seq, TEST_BANDS, &first, &last), TEST_BANDS);
+
+  TEST_CHECK_EQ(BandSeq_BandComplete(&seq, &line), 0U);
+  TEST_CHECK_EQ(BandSeq_BandComplete(&seq, &line), 0U);
+  TEST_CHECK_EQ(line, 0xFFFFFFFFU);
+  TEST_CHECK_EQ(seq.extra, 2U);
+
+  BandSeq_FrameStart(&seq);
+  TEST_CHECK_EQ(BandSeq_BandComplete(&seq, &line), 1U);
+  TEST_CHECK_EQ(line, 0U);
+}
+
+// VSYNC in the middle of a frame (a short frame, or the DMA re-armed): numbering restarts at 0
+static void Test_VsyncMidFrame(void)
+{
+  BandSeq_t seq;
+  uint32_t first = 0;
+  uint32_t last = 0;
+
+  (void)BandSeq_Init(&seq, TEST_LINES, TEST_BAND_LINES, 0U);
+  TEST_CHECK_EQ(Test_Bands(&seq, 5U, &first, &last), 5U);
+  TEST_CHECK_EQ(last, 4U * TEST_BAND_LINES);
+
+  BandSeq_FrameStart(&seq);
+  TEST_CHECK_EQ(Test_Bands(&seq, TEST_BANDS, &first, &last), TEST_BANDS);
+  TEST_CHECK_EQ(first, 0U);
+  TEST_CHECK_EQ(last, TEST_LINES - TEST_BAND_LINES);
+  TEST_CHECK_EQ(seq.extra, 0U);
+}
+
+/**
+  * @brief  Complete a number of bands.
+  * @param  seq: band sequencer
+  * @param  bands: bands completed by the DMA
+  * @param  first: receives the first line of the first band delivered
+  * @param  last: receives the first line of the last band delivered
+  * @retval Number of bands delivered
+  */
+static uint32_t Test_Bands(BandSeq_t *seq, uint32_t bands, uint32_t *first, uint32_t *last)
+{
+  uint32_t delivered = 0;
+  uint32_t line;
+  uint32_t i;
+
+  for (i = 0; i < bands; i++)
+  {
+    if (BandSeq_BandComplete(seq, &line) != 0U)
+    {
+      if (delivered == 0U)
+      {
+        *first = line;
+      }
+      *last = line;
+      delivered++;
+    }
+  }
+
+  return delivered;
+}
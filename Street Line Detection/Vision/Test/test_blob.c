@@ -0,0 +1,375 @@
+/**
+  ******************************************************************************
+  * @file           : test_blob.c
+  * @brief          : Host tests of the run-length connected components.
+  ******************************************************************************
+  * Vision_BlobLabel() is compared with an 8-connected flood fill over a
+  * byte-per-pixel copy of the mask. The fill numbers blobs in raster order
+  * of their first pixel, which is the order of their topmost run. Labels,
+  * area, bounding box, the raw moment sums and the centroid must all agree,
+  * including for blobs that only touch at a corner and for blobs past the
+  * max_blobs capacity.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision.h"
+#include "test.h"
+
+#include <math.h>
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define TEST_WIDTH      45U  // Rows span two words
+#define TEST_HEIGHT     14U
+#define TEST_PIXELS     (TEST_WIDTH * TEST_HEIGHT)
+#define TEST_RUNS       ((TEST_WIDTH / 2U + 1U) * TEST_HEIGHT)
+#define TEST_NO_LABEL   0xFFFFU
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief Flood fill result of one blob.
+  */
+typedef struct
+{
+  uint32_t area;
+  uint32_t x_min;
+  uint32_t y_min;
+  uint32_t x_max;
+  uint32_t y_max;
+  uint64_t sx;
+  uint64_t sy;
+  uint64_t sxx;
+  uint64_t syy;
+  uint64_t sxy;
+} Test_Blob_t;
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t pixels[TEST_PIXELS];
+static uint16_t ref_labels[TEST_PIXELS];
+static uint32_t fill_stack[TEST_PIXELS];
+static Test_Blob_t ref_blobs[TEST_PIXELS];
+static uint32_t mask_words[VISION_MASK_WORDS(TEST_WIDTH, TEST_HEIGHT)];
+static Vision_Run_t run_storage[TEST_RUNS];
+static Vision_Blob_t blobs[TEST_PIXELS];
+
+/* Private function prototypes -----------------------------------------------*/
+static void Test_DiagonalContact(void);
+static void Test_Merge(void);
+static void Test_Noise(void);
+static void Test_Capacity(void);
+static void Test_Params(void);
+static int32_t Test_Label(Vision_Runs_t *runs, uint32_t max_blobs);
+static uint32_t Test_FloodFill(void);
+static uint32_t Test_Compare(const Vision_Runs_t *runs, uint32_t count, uint32_t max_blobs);
+static void Test_Draw(const char *const *rows, uint32_t height);
+static void Test_FillNoise(uint32_t seed, uint32_t density);
+
+int main(void)
+{
+  Test_DiagonalContact();
+  Test_Merge();
+  Test_Noise();
+  Test_Capacity();
+  Test_Params();
+
+  return TEST_RESULT("blob");
+}
+
+// Pixels touching only at a corner belong to one blob; a one-pixel gap splits
+static void Test_DiagonalContact(void)
+{
+  static const char *const rows[] =
+  {
+    "#.......#...#",
+    ".#.....#....#",
+    "..#...#......",
+    "...#.#.....#.",
+    "....#......#.",
+  };
+  Vision_Runs_t runs;
+  uint32_t count;
+
+  Test_Draw(rows, sizeof(rows) / sizeof(rows[0]));
+  count = Test_FloodFill();
+  TEST_CHECK_EQ(count, 3U);
+  TEST_CHECK_EQ(Test_Label(&runs, TEST_PIXELS), count);
+  TEST_CHECK_EQ(Test_Compare(&runs, count, TEST_PIXELS), 1U);
+  TEST_CHECK_EQ(blobs[0].area, 9U);
+  TEST_CHECK_EQ(blobs[0].x_max, 8U);
+  TEST_CHECK_EQ(blobs[0].y_max, 4U);
+  TEST_CHECK(fabsf(blobs[0].cx - 4.0f) < 1e-5f);
+}
+
+// Arms that only meet further down merge, and the earlier root wins
+static void Test_Merge(void)
+{
+  static const char *const rows[] =
+  {
+    "#.#.#...###.......................#.#",
+    "#.#.#...#.#.......................#.#",
+    "#.#.#...#.#.....##########........#.#",
+    "#####...#.#.....#........#........###",
+    "........###.....#..####..#...........",
+    "................####..####...........",
+  };
+  Vision_Runs_t runs;
+  uint32_t count;
+
+  Test_Draw(rows, sizeof(rows) / sizeof(rows[0]));
+  count = Test_FloodFill();
+  TEST_CHECK_EQ(count, 4U);
+  TEST_CHECK_EQ(Test_Label(&runs, TEST_PIXELS), count);
+  TEST_CHECK_EQ(Test_Compare(&runs, count, TEST_PIXELS), 1U);
+  TEST_CHECK_EQ(blobs[0].area, 14U);
+  TEST_CHECK_EQ(blobs[0].runs, 10U);
+}
+
+// Random masks from sparse to dense
+static void Test_Noise(void)
+{
+  Vision_Runs_t runs;
+  uint32_t density;
+  uint32_t seed;
+
+  for (density = 1U; density <= 3U; density++)
+  {
+    for (seed = 1U; seed <= 8U; seed++)
+    {
+      uint32_t count;
+
+      Test_FillNoise((density * 31U) + seed, density);
+      count = Test_FloodFill();
+      TEST_CHECK_EQ(Test_Label(&runs, TEST_PIXELS), count);
+      if (Test_Compare(&runs, count, TEST_PIXELS) != 1U)
+      {
+        fprintf(stderr, "density %u/4, seed %u\n", (unsigned)density, (unsigned)seed);
+        TEST_CHECK(0);
+      }
+    }
+  }
+}
+
+// Blobs past max_blobs are counted and labelled VISION_BLOB_NONE; the others are unchanged
+static void Test_Capacity(void)
+{
+  Vision_Runs_t runs;
+  uint32_t count;
+  uint32_t i;
+
+  Test_FillNoise(7U, 1U);
+  count = Test_FloodFill();
+  TEST_CHECK(count > 5U);
+
+  TEST_CHECK_EQ(Test_Label(&runs, 5U), count);
+  TEST_CHECK_EQ(Test_Compare(&runs, count, 5U), 1U);
+
+  // Nothing is written past the capacity
+  memset(blobs, 0xA5, sizeof(blobs));
+  TEST_CHECK_EQ(Test_Label(&runs, 0U), count);
+  for (i = 0; i < runs.count; i++)
+  {
+    TEST_CHECK_EQ(run_storage[i].label, VISION_BLOB_NONE);
+  }
+  TEST_CHECK_EQ(blobs[0].area, 0xA5A5A5A5U);
+
+  // Labelling rebuilds the parents, so the same runs can be labelled again
+  TEST_CHECK_EQ(Vision_BlobLabel(&runs, NULL, 0U), count);
+}
+
+static void Test_Params(void)
+{
+  Vision_Runs_t runs = { run_storage, TEST_RUNS, 0U, 0U };
+
+  TEST_CHECK_EQ(Vision_BlobLabel(NULL, blobs, 1U), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_BlobLabel(&runs, NULL, 1U), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_BlobLabel(&runs, blobs, 1U), 0);
+}
+
+/**
+  * @brief  Pack the test pixels, encode them as runs and label them.
+  * @param  runs: receives the run set over run_storage
+  * @param  max_blobs: capacity passed to Vision_BlobLabel()
+  * @retval Vision_BlobLabel() result
+  */
+static int32_t Test_Label(Vision_Runs_t *runs, uint32_t max_blobs)
+{
+  Vision_Image_t image;
+  Vision_Mask_t mask;
+
+  (void)Vision_ImageInit(&image, pixels, TEST_WIDTH, TEST_HEIGHT, TEST_WIDTH);
+  (void)Vision_MaskInit(&mask, mask_words, TEST_WIDTH, TEST_HEIGHT);
+  (void)Vision_MaskPack(&image, &mask);
+
+  runs->runs = run_storage;
+  runs->capacity = TEST_RUNS;
+  if (Vision_RunsFromMask(&mask, runs) < 0)
+  {
+    return VISION_ERR_PARAM;
+  }
+
+  return Vision_BlobLabel(runs, blobs, max_blobs);
+}
+
+/**
+  * @brief  Label the test pixels with an 8-connected flood fill and sum
+  *         the statistics of every blob.
+  * @retval Number of blobs
+  */
+static uint32_t Test_FloodFill(void)
+{
+  uint32_t count = 0;
+  uint32_t start;
+
+  memset(ref_labels, 0xFF, sizeof(ref_labels));
+  for (start = 0; start < TEST_PIXELS; start++)
+  {
+    Test_Blob_t *blob = &ref_blobs[count];
+    uint32_t top = 0;
+
+    if ((pixels[start] == 0U) || (ref_labels[start] != TEST_NO_LABEL))
+    {
+      continue;
+    }
+
+    memset(blob, 0, sizeof(*blob));
+    blob->x_min = TEST_WIDTH;
+    blob->y_min = TEST_HEIGHT;
+    ref_labels[start] = (uint16_t)count;
+    fill_stack[top++] = start;
+    while (top > 0U)
+    {
+      uint32_t p = fill_stack[--top];
+      uint64_t x = p % TEST_WIDTH;
+      uint64_t y = p / TEST_WIDTH;
+      int32_t dx;
+      int32_t dy;
+
+      blob->area++;
+      blob->sx += x;
+      blob->sy += y;
+      blob->sxx += x * x;
+      blob->syy += y * y;
+      blob->sxy += x * y;
+      blob->x_min = (x < blob->x_min) ? (uint32_t)x : blob->x_min;
+      blob->y_min = (y < blob->y_min) ? (uint32_t)y : blob->y_min;
+      blob->x_max = (x > blob->x_max) ? (uint32_t)x : blob->x_max;
+      blob->y_max = (y > blob->y_max) ? (uint32_t)y : blob->y_max;
+
+      for (dy = -1; dy <= 1; dy++)
+      {
+        for (dx = -1; dx <= 1; dx++)
+        {
+          int32_t nx = (int32_t)x + dx;
+          int32_t ny = (int32_t)y + dy;
+          uint32_t n;
+
+          if ((nx < 0) || (ny < 0) || (nx >= (int32_t)TEST_WIDTH) || (ny >= (int32_t)TEST_HEIGHT))
+          {
+            continue;
+          }
+          n = ((uint32_t)ny * TEST_WIDTH) + (uint32_t)nx;
+          if ((pixels[n] != 0U) && (ref_labels[n] == TEST_NO_LABEL))
+          {
+            ref_labels[n] = (uint16_t)count;
+            fill_stack[top++] = n;
+          }
+        }
+      }
+    }
+    count++;
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Compare the labelled runs and blob statistics with the flood fill.
+  * @param  runs: labelled runs
+  * @param  count: blobs found by the flood fill
+  * @param  max_blobs: capacity given to Vision_BlobLabel()
+  * @retval 1 if everything matches, 0 otherwise
+  */
+static uint32_t Test_Compare(const Vision_Runs_t *runs, uint32_t count, uint32_t max_blobs)
+{
+  uint32_t i;
+  uint32_t x;
+
+  for (i = 0; i < runs->count; i++)
+  {
+    const Vision_Run_t *run = &runs->runs[i];
+
+    for (x = run->x_start; x < run->x_end; x++)
+    {
+      uint32_t want = ref_labels[(run->y * TEST_WIDTH) + x];
+
+      if (run->label != ((want < max_blobs) ? want : VISION_BLOB_NONE))
+      {
+        return 0U;
+      }
+    }
+  }
+
+  for (i = 0; (i < count) && (i < max_blobs); i++)
+  {
+    const Test_Blob_t *ref = &ref_blobs[i];
+    const Vision_Blob_t *blob = &blobs[i];
+    double cx = (double)ref->sx / ref->area;
+    double cy = (double)ref->sy / ref->area;
+
+    if ((blob->area != ref->area) || (blob->x_min != ref->x_min) || (blob->y_min != ref->y_min) ||
+        (blob->x_max != ref->x_max) || (blob->y_max != ref->y_max) || (blob->sx != ref->sx) ||
+        (blob->sy != ref->sy) || (blob->sxx != ref->sxx) || (blob->syy != ref->syy) || (blob->sxy != ref->sxy))
+    {
+      return 0U;
+    }
+    if ((fabs(blob->cx - cx) > 1e-4) || (fabs(blob->cy - cy) > 1e-4) ||
+        (fabs(blob->mu20 - (((double)ref->sxx / ref->area) - (cx * cx))) > 1e-3) ||
+        (fabs(blob->mu02 - (((double)ref->syy / ref->area) - (cy * cy))) > 1e-3) ||
+        (fabs(blob->mu11 - (((double)ref->sxy / ref->area) - (cx * cy))) > 1e-3))
+    {
+      return 0U;
+    }
+  }
+
+  return 1U;
+}
+
+/**
+  * @brief  Fill the test pixels from a picture, '#' set; the rest is clear.
+  * @param  rows: picture rows, at most TEST_WIDTH characters each
+  * @param  height: picture rows
+  * @retval None
+  */
+static void Test_Draw(const char *const *rows, uint32_t height)
+{
+  uint32_t x;
+  uint32_t y;
+
+  memset(pixels, 0, sizeof(pixels));
+  for (y = 0; y < height; y++)
+  {
+    for (x = 0; rows[y][x] != '\0'; x++)
+    {
+      pixels[(y * TEST_WIDTH) + x] = (rows[y][x] == '#') ? 1U : 0U;
+    }
+  }
+}
+
+/**
+  * @brief  Deterministic binary noise over the test pixels.
+  * @param  seed: generator seed
+  * @param  density: quarters of the pixels that are set (1..3)
+  * @retval None
+  */
+static void Test_FillNoise(uint32_t seed, uint32_t density)
+{
+  uint32_t state = seed;
+  uint32_t i;
+
+  for (i = 0; i < TEST_PIXELS; i++)
+  {
+    state = (state * 1103515245U) + 12345U;
+    pixels[i] = (((state >> 16) & 3U) < density) ? 1U : 0U;
+  }
+}
@@ -0,0 +1,183 @@
+/**
+  ******************************************************************************
+  * @file           : test_canny.c
+  * @brief          : Golden-image test of the edge and Canny stages.
+  ******************************************************************************
+  * Test/data/canny_road.pgm is a 160x120 synthetic road: noisy asphalt, a
+  * shadow band, a solid and a dashed curved marking and a blob. It goes
+  * through the chain main() runs: fused 5x5 Gaussian + Sobel, then Canny
+  * with the default thresholds. The edge map must match
+  * Test/data/canny_road_edges.pgm bit for bit, with a full-size stack and
+  * with a stack small enough to overflow.
+  *
+  * After an intended change of the output, regenerate the reference and
+  * review the new image before committing it. The Makefile builds the data
+  * directory into the program, so this works from any directory:
+  *
+  *   make -C Vision build/test_canny && Vision/build/test_canny --update
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision.h"
+#include "test.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#ifndef TEST_DATA_DIR
+#define TEST_DATA_DIR     "Test/data"  // Relative to Vision/ when built by hand
+#endif
+#define TEST_INPUT        TEST_DATA_DIR "/canny_road.pgm"
+#define TEST_EXPECTED     TEST_DATA_DIR "/canny_road_edges.pgm"
+#define TEST_MAX_PIXELS   (320U * 240U)
+#define TEST_STACK_DEPTH  1024U
+#define TEST_STACK_SMALL  3U   // Forces overflow and extra sweeps
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t input[TEST_MAX_PIXELS];
+static uint8_t expected[TEST_MAX_PIXELS];
+static uint8_t gradient[TEST_MAX_PIXELS];
+static uint8_t edges[TEST_MAX_PIXELS];
+static uint32_t stack_items[TEST_STACK_DEPTH];
+
+/* Private function prototypes -----------------------------------------------*/
+static int32_t Test_RunChain(const Vision_Image_t *src, Vision_Image_t *dst, uint32_t depth);
+static int32_t Test_ReadPgm(const char *path, uint8_t *pixels, uint32_t *width, uint32_t *height);
+static int32_t Test_WritePgm(const char *path, const uint8_t *pixels, uint32_t width, uint32_t height);
+
+int main(int argc, char *argv[])
+{
+  uint32_t width;
+  uint32_t height;
+  uint32_t expected_width;
+  uint32_t expected_height;
+  uint32_t mismatches;
+  int32_t found;
+  uint32_t i;
+  Vision_Image_t src;
+  Vision_Image_t dst;
+
+  if (Test_ReadPgm(TEST_INPUT, input, &width, &height) != 0)
+  {
+    fprintf(stderr, "cannot read %s\n", TEST_INPUT);
+    return 1;
+  }
+  (void)Vision_ImageInit(&src, input, width, height, width);
+  (void)Vision_ImageInit(&dst, edges, width, height, width);
+
+  if ((argc > 1) && (strcmp(argv[1], "--update") == 0))
+  {
+    (void)Test_RunChain(&src, &dst, TEST_STACK_DEPTH);
+    return (Test_WritePgm(TEST_EXPECTED, edges, width, height) == 0) ? 0 : 1;
+  }
+
+  if (Test_ReadPgm(TEST_EXPECTED, expected, &expected_width, &expected_height) != 0)
+  {
+    fprintf(stderr, "cannot read %s\n", TEST_EXPECTED);
+    return 1;
+  }
+  TEST_CHECK_EQ(expected_width, width);
+  TEST_CHECK_EQ(expected_height, height);
+
+  found = Test_RunChain(&src, &dst, TEST_STACK_DEPTH);
+  TEST_CHECK(found > 0);
+  mismatches = 0;
+  for (i = 0; i < (width * height); i++)
+  {
+    mismatches += (edges[i] != expected[i]) ? 1U : 0U;
+  }
+  TEST_CHECK_EQ(mismatches, 0U);
+
+  // The stack depth bounds memory only: the edge map must not change
+  memset(edges, 0, sizeof(edges));
+  TEST_CHECK_EQ(Test_RunChain(&src, &dst, TEST_STACK_SMALL), found);
+  TEST_CHECK_EQ(memcmp(edges, expected, width * height), 0);
+
+  return TEST_RESULT("canny");
+}
+
+/**
+  * @brief  Gradient and Canny edges of @p src with the firmware settings.
+  * @param  src: luma image
+  * @param  dst: receives the edge map
+  * @param  depth: edge following stack depth, at most TEST_STACK_DEPTH
+  * @retval Edge pixels found
+  */
+static int32_t Test_RunChain(const Vision_Image_t *src, Vision_Image_t *dst, uint32_t depth)
+{
+  static uint16_t gauss_rows[VISION_GAUSS_ROWS_WORDS(320U, VISION_GAUSS_5X5)];
+  static uint8_t sobel_rows[VISION_SOBEL_ROWS_BYTES(320U)];
+  const Vision_CannyParams_t params = { VISION_CANNY_LOW_DEFAULT, VISION_CANNY_HIGH_DEFAULT };
+  Vision_CannyStack_t stack = { stack_items, depth, 0, 0 };
+  Vision_Image_t grad;
+
+  (void)Vision_ImageInit(&grad, gradient, src->width, src->height, src->width);
+  TEST_CHECK_EQ(Vision_Edge(src, &grad, VISION_GAUSS_5X5, VISION_SOBEL_SHIFT_DEFAULT, gauss_rows, sobel_rows),
+                VISION_OK);
+  return Vision_Canny(&grad, dst, &params, &stack);
+}
+
+/**
+  * @brief  Load a binary 8-bit PGM (P5) of at most TEST_MAX_PIXELS pixels.
+  * @param  path: file to read
+  * @param  pixels: receives the rows, packed
+  * @param  width: receives the width
+  * @param  height: receives the height
+  * @retval 0 on success, -1 otherwise
+  */
+static int32_t Test_ReadPgm(const char *path, uint8_t *pixels, uint32_t *width, uint32_t *height)
+{
+  FILE *file = fopen(path, "rb");
+  unsigned int w;
+  unsigned int h;
+  unsigned int maxval;
+  int32_t status = -1;
+
+  if (file == NULL)
+  {
+    return -1;
+  }
+  if ((fscanf(file, "P5 %u %u %u", &w, &h, &maxval) == 3) && (maxval == 255U) && (fgetc(file) != EOF) &&
+      (w > 0U) && (h > 0U) && (((size_t)w * h) <= TEST_MAX_PIXELS) &&
+      (fread(pixels, 1, (size_t)w * h, file) == ((size_t)w * h)))
+  {
+    *width = w;
+    *height = h;
+    status = 0;
+  }
+  fclose(file);
+
+  return status;
+}
+
+/**
+  * @brief  Save packed 8-bit rows as a binary PGM (P5).
+  * @param  path: file to write
+  * @param  pixels: rows, packed
+  * @param  width: pixels per row
+  * @param  height: rows
+  * @retval 0 on success, -1 otherwise
+  */
+static int32_t Test_WritePgm(const char *path, const uint8_t *pixels, uint32_t width, uint32_t height)
+{
+  FILE *file = fopen(path, "wb");
+  int32_t status = -1;
+
+  if (file == NULL)
+  {
+    return -1;
+  }
+  if ((fprintf(file, "P5\n%u %u\n255\n", (unsigned int)width, (unsigned int)height) > 0) &&
+      (fwrite(pixels, 1, (size_t)width * height, file) == ((size_t)width * height)))
+  {
+    status = 0;
+  }
+  if (fclose(file) != 0)
+  {
+    status = -1;
+  }
+
+  return status;
+}
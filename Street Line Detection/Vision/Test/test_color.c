@@ -0,0 +1,166 @@
+/**
+  ******************************************************************************
+  * @file           : test_color.c
+  * @brief          : Host tests of the YUYV to luma conversion.
+  ******************************************************************************
+  * The library built for the host uses the byte loop. This file compiles
+  * Src/vision_color.c a second time with VISION_COLOR_SIMD forced on and
+  * the functions renamed, so the packed word path the Cortex-M7 runs is
+  * exercised as well. Both must match a plain reference bit for bit, for
+  * widths that leave 0 to 3 pixels after the last group of four, odd
+  * strides and unaligned rows.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision.h"
+#include "test.h"
+
+#include <string.h>
+
+// Packed path under other names, next to the library's byte loop
+#undef VISION_COLOR_SIMD
+#define VISION_COLOR_SIMD     1
+#define Vision_YuyvToLumaRow  Test_SimdLumaRow
+#define Vision_YuyvToLuma     Test_SimdLuma
+#include "../Src/vision_color.c"
+#undef Vision_YuyvToLumaRow
+#undef Vision_YuyvToLuma
+
+/* Private define ------------------------------------------------------------*/
+#define TEST_WIDTH_MAX   67U
+#define TEST_HEIGHT      5U
+#define TEST_SRC_STRIDE  ((2U * TEST_WIDTH_MAX) + 3U)  // Odd, so rows start unaligned
+#define TEST_DST_STRIDE  (TEST_WIDTH_MAX + 1U)
+#define TEST_GUARD       0xA5U
+
+/* Private variables ---------------------------------------------------------*/
+static const uint32_t test_widths[] = { 1U, 2U, 3U, 4U, 5U, 7U, 8U, 31U, 33U, 64U, 65U, 66U, 67U };
+
+static uint8_t yuyv[(TEST_SRC_STRIDE * TEST_HEIGHT) + 4U];
+static uint8_t expected[TEST_DST_STRIDE * TEST_HEIGHT];
+static uint8_t portable[TEST_DST_STRIDE * TEST_HEIGHT];
+static uint8_t packed[TEST_DST_STRIDE * TEST_HEIGHT];
+
+/* Private function prototypes -----------------------------------------------*/
+static void Test_Rows(void);
+static void Test_Frames(void);
+static void Test_Params(void);
+static void Test_FillNoise(uint8_t *pixels, uint32_t bytes, uint32_t seed);
+static void Test_Reference(const uint8_t *src, uint32_t src_stride, uint32_t width, uint32_t height);
+
+int main(void)
+{
+  Test_Rows();
+  Test_Frames();
+  Test_Params();
+
+  return TEST_RESULT("color");
+}
+
+// Single rows at every source alignment; bytes past the row stay untouched
+static void Test_Rows(void)
+{
+  uint32_t offset;
+  uint32_t w;
+
+  for (w = 0; w < (sizeof(test_widths) / sizeof(test_widths[0])); w++)
+  {
+    uint32_t width = test_widths[w];
+
+    for (offset = 0; offset < 4U; offset++)
+    {
+      Test_FillNoise(yuyv, sizeof(yuyv), (width * 4U) + offset);
+      Test_Reference(yuyv + offset, 0U, width, 1U);
+      memset(portable, TEST_GUARD, sizeof(portable));
+      memset(packed, TEST_GUARD, sizeof(packed));
+
+      Vision_YuyvToLumaRow(yuyv + offset, portable, width);
+      Test_SimdLumaRow(yuyv + offset, packed, width);
+      TEST_CHECK(memcmp(portable, expected, width) == 0);
+      TEST_CHECK(memcmp(packed, expected, width) == 0);
+      TEST_CHECK_EQ(portable[width], TEST_GUARD);
+      TEST_CHECK_EQ(packed[width], TEST_GUARD);
+    }
+  }
+}
+
+// Whole frames with padded strides on both sides: the two paths are identical
+static void Test_Frames(void)
+{
+  Vision_Image_t a;
+  Vision_Image_t b;
+  uint32_t w;
+
+  for (w = 0; w < (sizeof(test_widths) / sizeof(test_widths[0])); w++)
+  {
+    uint32_t width = test_widths[w];
+    uint32_t src_stride = (2U * width) + 1U;
+
+    Test_FillNoise(yuyv, sizeof(yuyv), width);
+    Test_Reference(yuyv, src_stride, width, TEST_HEIGHT);
+    memset(portable, TEST_GUARD, sizeof(portable));
+    memset(packed, TEST_GUARD, sizeof(packed));
+    (void)Vision_ImageInit(&a, portable, width, TEST_HEIGHT, TEST_DST_STRIDE);
+    (void)Vision_ImageInit(&b, packed, width, TEST_HEIGHT, TEST_DST_STRIDE);
+
+    TEST_CHECK_EQ(Vision_YuyvToLuma(yuyv, src_stride, &a), VISION_OK);
+    TEST_CHECK_EQ(Test_SimdLuma(yuyv, src_stride, &b), VISION_OK);
+    TEST_CHECK(memcmp(portable, packed, sizeof(portable)) == 0);
+    TEST_CHECK(memcmp(portable, expected, sizeof(expected)) == 0);
+  }
+}
+
+static void Test_Params(void)
+{
+  Vision_Image_t image;
+
+  (void)Vision_ImageInit(&image, portable, 8U, 2U, 8U);
+  TEST_CHECK_EQ(Vision_YuyvToLuma(NULL, 16U, &image), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_YuyvToLuma(yuyv, 16U, NULL), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_YuyvToLuma(yuyv, 15U, &image), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Test_SimdLuma(yuyv, 15U, &image), VISION_ERR_PARAM);
+}
+
+/**
+  * @brief  Deterministic pseudo-random bytes.
+  * @param  pixels: buffer to fill
+  * @param  bytes: buffer size
+  * @param  seed: generator seed
+  * @retval None
+  */
+static void Test_FillNoise(uint8_t *pixels, uint32_t bytes, uint32_t seed)
+{
+  uint32_t state = seed;
+  uint32_t i;
+
+  for (i = 0; i < bytes; i++)
+  {
+    state = (state * 1103515245U) + 12345U;
+    pixels[i] = (uint8_t)(state >> 16);
+  }
+}
+
+/**
+  * @brief  Luma by definition: byte 2 * x of each YUYV row. Padding bytes
+  *         of the expected plane hold TEST_GUARD.
+  * @param  src: first YUYV row
+  * @param  src_stride: bytes between YUYV rows
+  * @param  width: pixels per row
+  * @param  height: rows
+  * @retval None
+  */
+static void Test_Reference(const uint8_t *src, uint32_t src_stride, uint32_t width, uint32_t height)
+{
+  uint32_t x;
+  uint32_t y;
+
+  memset(expected, TEST_GUARD, sizeof(expected));
+  for (y = 0; y < height; y++)
+  {
+    for (x = 0; x < width; x++)
+    {
+      expected[(y * TEST_DST_STRIDE) + x] = src[(y * src_stride) + (2U * x)];
+    }
+  }
+}
@@ -0,0 +1,169 @@
+/**
+  ******************************************************************************
+  * @file           : test_frame_ring.c
+  * @brief          : Host tests of the capture frame buffer rotation.
+  ******************************************************************************
+  * Drives Core/Src/frame_ring.c the way the DCMI interrupt and the processing
+  * loop do: FrameRing_FrameComplete() stands for the frame interrupt, and
+  * FrameRing_Acquire() / FrameRing_Release() for the loop.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "frame_ring.h"
+#include "test.h"
+
+#include <stddef.h>
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t frames[FRAME_RING_MAX_BUFFERS][4];
+static uint8_t *const buffers[FRAME_RING_MAX_BUFFERS] = { frames[0], frames[1], frames[2] };
+
+/* Private function prototypes -----------------------------------------------*/
+static void Test_Init(void);
+static void Test_Rotation(void);
+static void Test_TwoBuffersOverrun(void);
+static void Test_TwoBuffersDropOldest(void);
+static void Test_ThreeBuffers(void);
+static void Test_ReleaseOrdering(void);
+
+int main(void)
+{
+  Test_Init();
+  Test_Rotation();
+  Test_TwoBuffersOverrun();
+  Test_TwoBuffersDropOldest();
+  Test_ThreeBuffers();
+  Test_ReleaseOrdering();
+
+  return TEST_RESULT("frame_ring");
+}
+
+static void Test_Init(void)
+{
+  FrameRing_t ring;
+  uint8_t *const missing[2] = { frames[0], NULL };
+
+  TEST_CHECK_EQ(FrameRing_Init(&ring, buffers, 1U), -1);
+  TEST_CHECK_EQ(FrameRing_Init(&ring, buffers, FRAME_RING_MAX_BUFFERS + 1U), -1);
+  TEST_CHECK_EQ(FrameRing_Init(&ring, missing, 2U), -1);
+  TEST_CHECK_EQ(FrameRing_Init(NULL, buffers, 2U), -1);
+
+  TEST_CHECK_EQ(FrameRing_Init(&ring, buffers, 2U), 0);
+  TEST_CHECK(FrameRing_DmaTarget(&ring) == frames[0]);
+  TEST_CHECK(FrameRing_Acquire(&ring, NULL) == NULL);
+}
+
+// filling -> ready -> in use -> free, with the DMA moving on each frame
+static void Test_Rotation(void)
+{
+  FrameRing_t ring;
+  uint32_t sequence = 0;
+
+  (void)FrameRing_Init(&ring, buffers, 2U);
+
+  TEST_CHECK(FrameRing_FrameComplete(&ring) == frames[1]);
+  TEST_CHECK(FrameRing_DmaTarget(&ring) == frames[1]);
+  TEST_CHECK(FrameRing_Acquire(&ring, &sequence) == frames[0]);
+  TEST_CHECK_EQ(sequence, 1U);
+  FrameRing_Release(&ring);
+
+  TEST_CHECK(FrameRing_FrameComplete(&ring) == frames[0]);
+  TEST_CHECK(FrameRing_Acquire(&ring, &sequence) == frames[1]);
+  TEST_CHECK_EQ(sequence, 2U);
+  FrameRing_Release(&ring);
+
+  TEST_CHECK_EQ(ring.dropped, 0U);
+}
+
+// Two buffers, consumer still busy: the DMA refills its own buffer
+static void Test_TwoBuffersOverrun(void)
+{
+  FrameRing_t ring;
+  uint32_t sequence = 0;
+
+  (void)FrameRing_Init(&ring, buffers, 2U);
+  (void)FrameRing_FrameComplete(&ring);
+  TEST_CHECK(FrameRing_Acquire(&ring, &sequence) == frames[0]);
+
+  TEST_CHECK(FrameRing_FrameComplete(&ring) == frames[1]);
+  TEST_CHECK(FrameRing_FrameComplete(&ring) == frames[1]);
+  TEST_CHECK_EQ(ring.dropped, 2U);
+  TEST_CHECK_EQ(ring.sequence, 1U);
+  TEST_CHECK(FrameRing_Acquire(&ring, NULL) == NULL);
+
+  // Once released, the next completed frame is published again
+  FrameRing_Release(&ring);
+  TEST_CHECK(FrameRing_FrameComplete(&ring) == frames[0]);
+  TEST_CHECK(FrameRing_Acquire(&ring, &sequence) == frames[1]);
+  TEST_CHECK_EQ(sequence, 2U);
+}
+
+// Two buffers, consumer idle: a frame never picked up is replaced by the newer one
+static void Test_TwoBuffersDropOldest(void)
+{
+  FrameRing_t ring;
+  uint32_t sequence = 0;
+
+  (void)FrameRing_Init(&ring, buffers, 2U);
+  TEST_CHECK(FrameRing_FrameComplete(&ring) == frames[1]);
+  TEST_CHECK(FrameRing_FrameComplete(&ring) == frames[0]);
+  TEST_CHECK(FrameRing_FrameComplete(&ring) == frames[1]);
+  TEST_CHECK_EQ(ring.dropped, 2U);
+
+  TEST_CHECK(FrameRing_Acquire(&ring, &sequence) == frames[0]);
+  TEST_CHECK_EQ(sequence, 3U);
+}
+
+// Three buffers: the DMA always has a free target, even while a frame is held
+static void Test_ThreeBuffers(void)
+{
+  FrameRing_t ring;
+  uint32_t sequence = 0;
+
+  (void)FrameRing_Init(&ring, buffers, 3U);
+  TEST_CHECK(FrameRing_FrameComplete(&ring) == frames[1]);
+  TEST_CHECK(FrameRing_Acquire(&ring, &sequence) == frames[0]);
+
+  TEST_CHECK(FrameRing_FrameComplete(&ring) == frames[2]);
+  TEST_CHECK_EQ(ring.dropped, 0U);
+  // Frame 1 is stale: the DMA reuses it for the next frame, the newest stays ready
+  TEST_CHECK(FrameRing_FrameComplete(&ring) == frames[1]);
+  TEST_CHECK_EQ(ring.dropped, 1U);
+  TEST_CHECK_EQ(ring.ready, 2U);
+  TEST_CHECK(FrameRing_FrameComplete(&ring) == frames[2]);
+  TEST_CHECK_EQ(ring.dropped, 2U);
+  TEST_CHECK_EQ(ring.ready, 1U);
+
+  // The held frame is never a DMA target
+  TEST_CHECK(FrameRing_DmaTarget(&ring) != frames[0]);
+
+  FrameRing_Release(&ring);
+  TEST_CHECK(FrameRing_Acquire(&ring, &sequence) == frames[1]);
+  TEST_CHECK_EQ(sequence, 4U);
+  TEST_CHECK(FrameRing_FrameComplete(&ring) == frames[0]);
+}
+
+static void Test_ReleaseOrdering(void)
+{
+  FrameRing_t ring;
+
+  (void)FrameRing_Init(&ring, buffers, 3U);
+  (void)FrameRing_FrameComplete(&ring);
+  TEST_CHECK(FrameRing_Acquire(&ring, NULL) == frames[0]);
+
+  // A second acquire while holding a frame fails even with a new frame ready
+  (void)FrameRing_FrameComplete(&ring);
+  TEST_CHECK(FrameRing_Acquire(&ring, NULL) == NULL);
+  TEST_CHECK_EQ(ring.ready, 1U);
+
+  // Releasing does not consume the ready frame, and a double release is harmless
+  FrameRing_Release(&ring);
+  FrameRing_Release(&ring);
+  TEST_CHECK_EQ(ring.in_use, FRAME_RING_NONE);
+  TEST_CHECK(FrameRing_Acquire(&ring, NULL) == frames[1]);
+  FrameRing_Release(&ring);
+
+  // Nothing new has completed since
+  TEST_CHECK(FrameRing_Acquire(&ring, NULL) == NULL);
+}
@@ -0,0 +1,165 @@
+/**
+  ******************************************************************************
+  * @file           : test_histogram.c
+  * @brief          : Host tests of the luma histogram and its statistics.
+  ******************************************************************************
+  * The statistics read the two count tables in place. Counting a band at
+  * once or row by row must give the same histogram.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision.h"
+#include "test.h"
+
+/* Private define ------------------------------------------------------------*/
+#define TEST_WIDTH   23U  // Odd, so rows end with a partial group of four
+#define TEST_HEIGHT  17U
+#define TEST_STRIDE  24U
+
+/* Private variables ---------------------------------------------------------*/
+static Vision_Histogram_t hist;
+static Vision_Histogram_t reference;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Test_Stats(void);
+static void Test_Params(void);
+static void Test_Rows(void);
+static void Test_FillNoise(uint8_t *pixels, uint32_t bytes);
+static uint32_t Test_SameCounts(const Vision_Histogram_t *a, const Vision_Histogram_t *b);
+
+int main(void)
+{
+  Test_Stats();
+  Test_Params();
+  Test_Rows();
+
+  return TEST_RESULT("histogram");
+}
+
+// Two flat halves: every statistic is known exactly
+static void Test_Stats(void)
+{
+  static uint8_t pixels[TEST_STRIDE * TEST_HEIGHT];
+  Vision_HistogramStats_t stats;
+  Vision_Image_t image;
+  Vision_Image_t half;
+
+  (void)Vision_ImageInit(&image, pixels, 9U, 10U, TEST_STRIDE);
+  (void)Vision_ImageView(&image, 0U, 0U, 9U, 5U, &half);
+  Vision_ImageFill(&half, 40U);
+  (void)Vision_ImageView(&image, 0U, 5U, 9U, 5U, &half);
+  Vision_ImageFill(&half, 200U);
+
+  Vision_HistogramReset(&hist);
+  TEST_CHECK_EQ(Vision_HistogramPush(&hist, &image), VISION_OK);
+  TEST_CHECK_EQ(Vision_HistogramStats(&hist, VISION_HISTOGRAM_LOW_DEFAULT, VISION_HISTOGRAM_HIGH_DEFAULT, &stats),
+                VISION_OK);
+  TEST_CHECK_EQ(stats.count, 90U);
+  TEST_CHECK(stats.mean == 120.0f);
+  TEST_CHECK_EQ(stats.min, 40U);
+  TEST_CHECK_EQ(stats.max, 200U);
+  TEST_CHECK_EQ(stats.low, 40U);
+  TEST_CHECK_EQ(stats.median, 40U);
+  TEST_CHECK_EQ(stats.high, 200U);
+  TEST_CHECK_EQ(stats.range, 160U);
+  TEST_CHECK_EQ(stats.otsu, 40U);
+
+  // The tables are read, never merged into
+  TEST_CHECK_EQ(hist.bins[0][40] + hist.bins[1][40], 45U);
+  TEST_CHECK(hist.bins[1][40] != 0U);
+
+  // A single-valued frame has no split
+  Vision_ImageFill(&image, 77U);
+  Vision_HistogramReset(&hist);
+  (void)Vision_HistogramPush(&hist, &image);
+  (void)Vision_HistogramStats(&hist, 0U, 1000U, &stats);
+  TEST_CHECK_EQ(stats.min, 77U);
+  TEST_CHECK_EQ(stats.max, 77U);
+  TEST_CHECK_EQ(stats.low, 77U);
+  TEST_CHECK_EQ(stats.high, 77U);
+  TEST_CHECK_EQ(stats.range, 0U);
+  TEST_CHECK_EQ(stats.otsu, 77U);
+}
+
+static void Test_Params(void)
+{
+  static uint8_t pixels[4];
+  Vision_HistogramStats_t stats;
+  Vision_Image_t image;
+
+  (void)Vision_ImageInit(&image, pixels, 4U, 1U, 4U);
+  Vision_HistogramReset(&hist);
+  TEST_CHECK_EQ(Vision_HistogramStats(&hist, 0U, 1000U, &stats), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_HistogramPush(NULL, &image), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_HistogramPush(&hist, NULL), VISION_ERR_PARAM);
+
+  (void)Vision_HistogramPush(&hist, &image);
+  TEST_CHECK_EQ(Vision_HistogramStats(&hist, 0U, 1000U, NULL), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_HistogramStats(&hist, 600U, 500U, &stats), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_HistogramStats(&hist, 0U, 1001U, &stats), VISION_ERR_PARAM);
+}
+
+static void Test_Rows(void)
+{
+  static uint8_t pixels[TEST_STRIDE * TEST_HEIGHT];
+  Vision_Image_t image;
+  uint32_t y;
+
+  Test_FillNoise(pixels, sizeof(pixels));
+  (void)Vision_ImageInit(&image, pixels, TEST_WIDTH, TEST_HEIGHT, TEST_STRIDE);
+
+  Vision_HistogramReset(&reference);
+  (void)Vision_HistogramPush(&reference, &image);
+  TEST_CHECK_EQ(reference.count, TEST_WIDTH * TEST_HEIGHT);
+
+  Vision_HistogramReset(&hist);
+  for (y = 0; y < TEST_HEIGHT; y++)
+  {
+    Vision_HistogramPushRow(&hist, VISION_ROW(&image, y), TEST_WIDTH);
+  }
+  TEST_CHECK_EQ(Test_SameCounts(&hist, &reference), 1U);
+}
+
+/**
+  * @brief  Deterministic pseudo-random bytes.
+  * @param  pixels: buffer to fill
+  * @param  bytes: buffer size
+  * @retval None
+  */
+static void Test_FillNoise(uint8_t *pixels, uint32_t bytes)
+{
+  uint32_t state = 12345U;
+  uint32_t i;
+
+  for (i = 0; i < bytes; i++)
+  {
+    state = (state * 1103515245U) + 12345U;
+    pixels[i] = (uint8_t)(state >> 16);
+  }
+}
+
+/**
+  * @brief  Compare two histograms bin by bin, whatever table each pixel went to.
+  * @param  a: first histogram
+  * @param  b: second histogram
+  * @retval 1 if the counts match, 0 otherwise
+  */
+static uint32_t Test_SameCounts(const Vision_Histogram_t *a, const Vision_Histogram_t *b)
+{
+  uint32_t v;
+
+  if (a->count != b->count)
+  {
+    return 0U;
+  }
+  for (v = 0; v < VISION_HISTOGRAM_BINS; v++)
+  {
+    if ((a->bins[0][v] + a->bins[1][v]) != (b->bins[0][v] + b->bins[1][v]))
+    {
+      return 0U;
+    }
+  }
+
+  return 1U;
+}
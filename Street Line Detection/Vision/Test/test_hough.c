@@ -0,0 +1,103 @@
+/**
+  ******************************************************************************
+  * @file           : test_hough.c
+  * @brief          : Host tests of the Hough transform size limits.
+  ******************************************************************************
+  * Voting sums Q15 products in 32 bits, so Vision_HoughInit() has to turn
+  * away images whose rho range does not fit in 16 bits. The widest accepted
+  * image must still vote into the last rho cell.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision.h"
+#include "test.h"
+
+/* Private define ------------------------------------------------------------*/
+#define TEST_WIDE     0x7FFFU  // Widest accepted image, one row high
+#define TEST_SIZE     64U      // Square image of the diagonal test
+#define TEST_RHO      ((((TEST_WIDE - 1U) * 32767U) + 16384U) >> 15)  // Rho cell of the last wide pixel
+
+/* Private variables ---------------------------------------------------------*/
+static Vision_Hough_t hough;
+static uint16_t acc[TEST_WIDE + 2U];
+static uint8_t pixels[TEST_WIDE];
+
+/* Private function prototypes -----------------------------------------------*/
+static void Test_Bounds(void);
+static void Test_WidestRow(void);
+static void Test_Diagonal(void);
+
+int main(void)
+{
+  Test_Bounds();
+  Test_WidestRow();
+  Test_Diagonal();
+
+  return TEST_RESULT("hough");
+}
+
+// Sizes whose Q15 rho sums would overflow are rejected before the accumulator is touched
+static void Test_Bounds(void)
+{
+  const Vision_HoughParams_t params = { 0, 0, 1U };
+
+  TEST_CHECK_EQ(Vision_HoughInit(&hough, 0x7FFFU, 0x7FFFU, &params, acc, 0xFFFFFFFFU), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_HoughInit(&hough, 0x8000U, 1U, &params, acc, 0xFFFFFFFFU), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_HoughInit(&hough, 1U, 0x8000U, &params, acc, 0xFFFFFFFFU), VISION_ERR_PARAM);
+
+  // Both sides in range, but diagonal + height = 37537 + 28000 is not
+  TEST_CHECK_EQ(Vision_HoughInit(&hough, 25000U, 28000U, &params, acc, 0xFFFFFFFFU), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_HoughInit(&hough, 30000U, 30000U, &params, acc, 0xFFFFFFFFU), VISION_ERR_PARAM);
+
+  TEST_CHECK_EQ(Vision_HoughInit(&hough, 4U, 4U, NULL, acc, 64U), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_HoughInit(&hough, 4U, 4U, &params, acc, 4U), VISION_ERR_PARAM);
+}
+
+// The last pixel of the widest row votes inside the accumulator
+static void Test_WidestRow(void)
+{
+  const Vision_HoughParams_t params = { 0, 0, 1U };
+  Vision_HoughLine_t line;
+  Vision_Image_t image;
+
+  TEST_CHECK_EQ(Vision_HoughInit(&hough, TEST_WIDE, 1U, &params, acc, sizeof(acc) / sizeof(acc[0])), VISION_OK);
+  TEST_CHECK(hough.rhos <= (sizeof(acc) / sizeof(acc[0])));
+  TEST_CHECK_EQ(hough.rho_min, 0);
+
+  (void)Vision_ImageInit(&image, pixels, TEST_WIDE, 1U, TEST_WIDE);
+  Vision_ImageFill(&image, 0U);
+  pixels[TEST_WIDE - 1U] = 255U;
+
+  // cos(0) is 32767 in Q15, so the far pixel rounds one cell short
+  TEST_CHECK_EQ(Vision_HoughVote(&hough, &image), 1);
+  TEST_CHECK_EQ(acc[TEST_RHO], 1U);
+  TEST_CHECK_EQ(Vision_HoughPeaks(&hough, 1U, &line, 1U), 1);
+  TEST_CHECK_EQ(line.rho, TEST_RHO);
+  TEST_CHECK_EQ(line.theta, 0);
+}
+
+// A 45 degree line through the origin peaks at theta -45, rho 0, one vote per pixel
+static void Test_Diagonal(void)
+{
+  const Vision_HoughParams_t params = { -60, 60, 1U };
+  Vision_HoughLine_t line;
+  Vision_Image_t image;
+  uint32_t i;
+
+  TEST_CHECK_EQ(Vision_HoughInit(&hough, TEST_SIZE, TEST_SIZE, &params, acc, sizeof(acc) / sizeof(acc[0])),
+                VISION_OK);
+
+  (void)Vision_ImageInit(&image, pixels, TEST_SIZE, TEST_SIZE, TEST_SIZE);
+  Vision_ImageFill(&image, 0U);
+  for (i = 0; i < TEST_SIZE; i++)
+  {
+    VISION_ROW(&image, i)[i] = 255U;
+  }
+
+  TEST_CHECK_EQ(Vision_HoughVote(&hough, &image), (long long)TEST_SIZE);
+  TEST_CHECK_EQ(Vision_HoughPeaks(&hough, TEST_SIZE / 2U, &line, 1U), 1);
+  TEST_CHECK_EQ(line.theta, -45);
+  TEST_CHECK_EQ(line.rho, 0);
+  TEST_CHECK_EQ(line.votes, TEST_SIZE);
+}
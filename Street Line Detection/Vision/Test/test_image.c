@@ -0,0 +1,103 @@
+/**
+  ******************************************************************************
+  * @file           : test_image.c
+  * @brief          : Host tests of the image descriptor helpers.
+  ******************************************************************************
+  * Views share the parent's pixels and stride. Fill and copy touch only
+  * the pixels of a row, never the padding up to the stride.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision.h"
+#include "test.h"
+
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define TEST_WIDTH   12U
+#define TEST_HEIGHT  6U
+#define TEST_STRIDE  16U
+#define TEST_PAD     0xA5U
+
+/* Private function prototypes -----------------------------------------------*/
+static void Test_Init(void);
+static void Test_View(void);
+static void Test_FillCopy(void);
+
+int main(void)
+{
+  Test_Init();
+  Test_View();
+  Test_FillCopy();
+
+  return TEST_RESULT("image");
+}
+
+static void Test_Init(void)
+{
+  static uint8_t pixels[TEST_STRIDE * TEST_HEIGHT];
+  Vision_Image_t image;
+
+  TEST_CHECK_EQ(Vision_ImageInit(&image, pixels, TEST_WIDTH, TEST_HEIGHT, TEST_STRIDE), VISION_OK);
+  TEST_CHECK(VISION_ROW(&image, 2U) == &pixels[2U * TEST_STRIDE]);
+  TEST_CHECK_EQ(Vision_ImageInit(&image, pixels, TEST_WIDTH, TEST_HEIGHT, TEST_WIDTH - 1U), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_ImageInit(&image, NULL, TEST_WIDTH, TEST_HEIGHT, TEST_STRIDE), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_ImageInit(&image, pixels, 0U, TEST_HEIGHT, TEST_STRIDE), VISION_ERR_PARAM);
+}
+
+static void Test_View(void)
+{
+  static uint8_t pixels[TEST_STRIDE * TEST_HEIGHT];
+  Vision_Image_t image;
+  Vision_Image_t view;
+
+  (void)Vision_ImageInit(&image, pixels, TEST_WIDTH, TEST_HEIGHT, TEST_STRIDE);
+
+  TEST_CHECK_EQ(Vision_ImageView(&image, 3U, 2U, 5U, 4U, &view), VISION_OK);
+  TEST_CHECK(view.data == &pixels[(2U * TEST_STRIDE) + 3U]);
+  TEST_CHECK_EQ(view.width, 5U);
+  TEST_CHECK_EQ(view.height, 4U);
+  TEST_CHECK_EQ(view.stride, TEST_STRIDE);
+
+  // A view may reach the border but not cross it
+  TEST_CHECK_EQ(Vision_ImageView(&image, TEST_WIDTH - 5U, TEST_HEIGHT - 4U, 5U, 4U, &view), VISION_OK);
+  TEST_CHECK_EQ(Vision_ImageView(&image, TEST_WIDTH - 4U, 0U, 5U, 1U, &view), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_ImageView(&image, 0U, TEST_HEIGHT - 3U, 1U, 4U, &view), VISION_ERR_PARAM);
+}
+
+static void Test_FillCopy(void)
+{
+  static uint8_t a[TEST_STRIDE * TEST_HEIGHT];
+  static uint8_t b[TEST_STRIDE * TEST_HEIGHT];
+  Vision_Image_t src;
+  Vision_Image_t dst;
+  Vision_Image_t view;
+  uint32_t x;
+  uint32_t y;
+
+  memset(a, TEST_PAD, sizeof(a));
+  memset(b, TEST_PAD, sizeof(b));
+  (void)Vision_ImageInit(&src, a, TEST_WIDTH, TEST_HEIGHT, TEST_STRIDE);
+  (void)Vision_ImageInit(&dst, b, TEST_WIDTH, TEST_HEIGHT, TEST_STRIDE);
+
+  Vision_ImageFill(&src, 10U);
+  (void)Vision_ImageView(&src, 2U, 1U, 4U, 3U, &view);
+  Vision_ImageFill(&view, 200U);
+  TEST_CHECK_EQ(Vision_ImageCopy(&src, &dst), VISION_OK);
+
+  for (y = 0; y < TEST_HEIGHT; y++)
+  {
+    for (x = 0; x < TEST_STRIDE; x++)
+    {
+      uint8_t inside = ((x >= 2U) && (x < 6U) && (y >= 1U) && (y < 4U)) ? 200U : 10U;
+      uint8_t expected = (x < TEST_WIDTH) ? inside : TEST_PAD;
+
+      TEST_CHECK_EQ(a[(y * TEST_STRIDE) + x], expected);
+      TEST_CHECK_EQ(b[(y * TEST_STRIDE) + x], expected);
+    }
+  }
+
+  (void)Vision_ImageInit(&dst, b, TEST_WIDTH - 1U, TEST_HEIGHT, TEST_STRIDE);
+  TEST_CHECK_EQ(Vision_ImageCopy(&src, &dst), VISION_ERR_PARAM);
+}
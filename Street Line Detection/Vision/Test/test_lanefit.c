@@ -0,0 +1,222 @@
+/**
+  ******************************************************************************
+  * @file           : test_lanefit.c
+  * @brief          : Host tests of the quadratic lane fit and its geometry.
+  ******************************************************************************
+  * Synthetic lanes are summed row by row the way the lane search does it.
+  * The rows are multiples of 8 so every x of x = (y - 240)^2 / 64 + c is a
+  * whole pixel: the fit must give back a, b and c, and a zero residual for
+  * a one-pixel line. The geometry checks use a bird's-eye table with 1 cm
+  * columns and 5 cm rows, whose centre column is the car axis.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision.h"
+#include "test.h"
+
+#include <math.h>
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define TEST_HEIGHT     241U  // Bird's-eye rows; the bottom row is 240
+#define TEST_BOTTOM     240
+#define TEST_ROW_STEP   8U
+#define TEST_A_DEN      64
+
+/* Private variables ---------------------------------------------------------*/
+static const Vision_IpmLut_t lut =
+{
+  NULL, 640U, TEST_HEIGHT, 0U, 0U, 0U,
+  -3200,   // Column 320 is the car axis
+  15000,
+  10000U,  // 1 cm columns
+  50000U,  // 5 cm rows
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void Test_Recover(void);
+static void Test_Residual(void);
+static void Test_Degenerate(void);
+static void Test_Geometry(void);
+static void Test_OneLine(void);
+static void Test_SumLine(Vision_LaneSums_t *sums, int32_t bend, int32_t c, uint32_t spread, uint32_t y_first);
+static void Test_Fit(Vision_LaneFit_t *fit, int32_t bend, int32_t c);
+
+int main(void)
+{
+  Test_Recover();
+  Test_Residual();
+  Test_Degenerate();
+  Test_Geometry();
+  Test_OneLine();
+
+  return TEST_RESULT("lanefit");
+}
+
+// A one-pixel quadratic line comes back with its coefficients and no residual
+static void Test_Recover(void)
+{
+  Vision_LaneSums_t sums;
+  Vision_LaneFit_t fit;
+  int32_t bend;
+
+  for (bend = -1; bend <= 1; bend++)
+  {
+    // x = bend * (y - 240)^2 / 64 + 1000 = a y^2 + b y + c
+    float a = (float)bend / TEST_A_DEN;
+    float b = -2.0f * a * TEST_BOTTOM;
+    float c = (a * TEST_BOTTOM * TEST_BOTTOM) + 1000.0f;
+
+    Vision_LaneFitReset(&sums, (int32_t)(TEST_HEIGHT / 2U));
+    Test_SumLine(&sums, bend, 1000, 0U, 0U);
+    TEST_CHECK_EQ(Vision_LaneFitSolve(&sums, &fit), VISION_OK);
+    TEST_CHECK_EQ(fit.valid, 1U);
+    TEST_CHECK_EQ(fit.pixels, (TEST_BOTTOM / TEST_ROW_STEP) + 1U);
+    TEST_CHECK(fabsf(fit.a - a) < 1e-6f);
+    TEST_CHECK(fabsf(fit.b - b) < 1e-3f);
+    TEST_CHECK(fabsf(fit.c - c) < 0.05f);
+    TEST_CHECK(fit.rms < 0.05f);
+  }
+}
+
+// Three pixels per row around the line: same fit, rms sqrt(2 / 3)
+static void Test_Residual(void)
+{
+  Vision_LaneSums_t sums;
+  Vision_LaneFit_t fit;
+
+  Vision_LaneFitReset(&sums, (int32_t)(TEST_HEIGHT / 2U));
+  Test_SumLine(&sums, 1, 1000, 1U, 0U);
+  TEST_CHECK_EQ(Vision_LaneFitSolve(&sums, &fit), VISION_OK);
+  TEST_CHECK_EQ(fit.pixels, 3U * ((TEST_BOTTOM / TEST_ROW_STEP) + 1U));
+  TEST_CHECK(fabsf(fit.a - (1.0f / TEST_A_DEN)) < 1e-6f);
+  TEST_CHECK(fabsf(fit.rms - sqrtf(2.0f / 3.0f)) < 0.05f);
+  TEST_CHECK_EQ(Vision_LaneFitConfident(&fit, 24U, 1.0f), 1U);
+  TEST_CHECK_EQ(Vision_LaneFitConfident(&fit, 24U, 0.5f), 0U);
+}
+
+// Too few pixels, or pixels on fewer than three rows, give no fit
+static void Test_Degenerate(void)
+{
+  Vision_LaneSums_t sums;
+  Vision_LaneFit_t fit;
+
+  Vision_LaneFitReset(&sums, (int32_t)(TEST_HEIGHT / 2U));
+  Test_SumLine(&sums, 1, 300, 0U, 224U);
+  TEST_CHECK_EQ(Vision_LaneFitSolve(&sums, &fit), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(fit.valid, 0U);
+
+  Vision_LaneFitReset(&sums, (int32_t)(TEST_HEIGHT / 2U));
+  Vision_LaneFitAddRow(&sums, 100U, 20U, 20U * 300U, 20U * 300U * 300U);
+  Vision_LaneFitAddRow(&sums, 140U, 20U, 20U * 310U, 20U * 310U * 310U);
+  TEST_CHECK_EQ(Vision_LaneFitSolve(&sums, &fit), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(fit.valid, 0U);
+
+  TEST_CHECK_EQ(Vision_LaneFitSolve(NULL, &fit), VISION_ERR_PARAM);
+}
+
+// Bending right gives a positive radius; lines right of the car give a negative offset
+static void Test_Geometry(void)
+{
+  Vision_LaneGeometry_t geometry;
+  Vision_LaneFit_t left;
+  Vision_LaneFit_t right;
+
+  // Bottom columns 280 and 360: 0.4 m either side of the car axis
+  Test_Fit(&left, 1, 280);
+  Test_Fit(&right, 1, 360);
+  TEST_CHECK_EQ(Vision_LaneFitGeometry(&left, &right, &lut, 3.5f, &geometry), VISION_OK);
+  TEST_CHECK_EQ(geometry.lanes, 3U);
+  TEST_CHECK(fabsf(geometry.width_m - 0.8f) < 1e-3f);
+  TEST_CHECK(fabsf(geometry.offset_m) < 1e-3f);
+  // d2X/dZ2 = 2 a x_step / z_step^2 = 0.125 / m, flat at the bottom row
+  TEST_CHECK(fabsf(geometry.radius_m - 8.0f) < 0.01f);
+
+  Test_Fit(&left, -1, 280);
+  Test_Fit(&right, -1, 360);
+  (void)Vision_LaneFitGeometry(&left, &right, &lut, 3.5f, &geometry);
+  TEST_CHECK(fabsf(geometry.radius_m + 8.0f) < 0.01f);
+
+  // The lane 20 cm to the right: the car sits left of the centre
+  Test_Fit(&left, 0, 300);
+  Test_Fit(&right, 0, 380);
+  (void)Vision_LaneFitGeometry(&left, &right, &lut, 3.5f, &geometry);
+  TEST_CHECK(fabsf(geometry.offset_m + 0.2f) < 1e-3f);
+  TEST_CHECK(fabsf(geometry.radius_m) == VISION_LANE_RADIUS_MAX_M);
+
+  Test_Fit(&left, 0, 260);
+  Test_Fit(&right, 0, 340);
+  (void)Vision_LaneFitGeometry(&left, &right, &lut, 3.5f, &geometry);
+  TEST_CHECK(fabsf(geometry.offset_m - 0.2f) < 1e-3f);
+}
+
+// A missing line is stood in for at the nominal width
+static void Test_OneLine(void)
+{
+  Vision_LaneGeometry_t geometry;
+  Vision_LaneFit_t left;
+  Vision_LaneFit_t right;
+
+  Test_Fit(&left, 1, 280);
+  memset(&right, 0, sizeof(right));
+  TEST_CHECK_EQ(Vision_LaneFitGeometry(&left, &right, &lut, 0.8f, &geometry), VISION_OK);
+  TEST_CHECK_EQ(geometry.lanes, 1U);
+  TEST_CHECK(fabsf(geometry.width_m - 0.8f) < 1e-6f);
+  TEST_CHECK(fabsf(geometry.offset_m) < 1e-3f);
+  TEST_CHECK(geometry.radius_m > 0.0f);
+
+  TEST_CHECK_EQ(Vision_LaneFitGeometry(&right, &left, &lut, 0.8f, &geometry), VISION_OK);
+  TEST_CHECK_EQ(geometry.lanes, 2U);
+  TEST_CHECK(fabsf(geometry.offset_m - 0.8f) < 1e-3f);
+
+  left.valid = 0U;
+  TEST_CHECK_EQ(Vision_LaneFitGeometry(&left, &right, &lut, 0.8f, &geometry), VISION_ERR_PARAM);
+}
+
+/**
+  * @brief  Sum the line x = bend * (y - 240)^2 / 64 + c on every eighth row.
+  * @param  sums: lane sums
+  * @param  bend: -1, 0 or 1
+  * @param  c: column at the bottom row; the line must not leave the image
+  * @param  spread: extra pixels either side of the line on each row
+  * @param  y_first: first row summed, a multiple of 8
+  * @retval None
+  */
+static void Test_SumLine(Vision_LaneSums_t *sums, int32_t bend, int32_t c, uint32_t spread, uint32_t y_first)
+{
+  uint32_t y;
+
+  for (y = y_first; y <= (uint32_t)TEST_BOTTOM; y += TEST_ROW_STEP)
+  {
+    int32_t u = (int32_t)y - TEST_BOTTOM;
+    uint32_t centre = (uint32_t)(((bend * u * u) / TEST_A_DEN) + c);
+    uint32_t x_sum = 0;
+    uint32_t xx_sum = 0;
+    uint32_t x;
+
+    for (x = centre - spread; x <= (centre + spread); x++)
+    {
+      x_sum += x;
+      xx_sum += x * x;
+    }
+    Vision_LaneFitAddRow(sums, y, (2U * spread) + 1U, x_sum, xx_sum);
+  }
+}
+
+/**
+  * @brief  Fit a three-pixel synthetic line over the near half of the rows,
+  *         where its columns stay in the bird's-eye view.
+  * @param  fit: receives the fit
+  * @param  bend: -1, 0 or 1
+  * @param  c: column at the bottom row
+  * @retval None
+  */
+static void Test_Fit(Vision_LaneFit_t *fit, int32_t bend, int32_t c)
+{
+  Vision_LaneSums_t sums;
+
+  Vision_LaneFitReset(&sums, (int32_t)(TEST_HEIGHT / 2U));
+  Test_SumLine(&sums, bend, c, 1U, TEST_HEIGHT / 2U);
+  (void)Vision_LaneFitSolve(&sums, fit);
+}
@@ -0,0 +1,301 @@
+/**
+  ******************************************************************************
+  * @file           : test_mask.c
+  * @brief          : Host tests of the bit-packed mask morphology.
+  ******************************************************************************
+  * Every operation is compared with a byte-per-pixel 3x3 reference that
+  * replicates the border pixels. The widths put the last pixel just before,
+  * on and just after a word boundary, so the carries between words, the
+  * tail mask and the right border are all exercised. Each operation runs
+  * out of place and in place.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision.h"
+#include "test.h"
+
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define TEST_WIDTH_MAX  65U
+#define TEST_HEIGHT     9U
+#define TEST_ERODE      0U
+#define TEST_DILATE     1U
+
+/* Private typedef -----------------------------------------------------------*/
+typedef int32_t (*Test_MorphFunc_t)(const Vision_Mask_t *src, Vision_Mask_t *dst, uint32_t *rows);
+
+/**
+  * @brief Operation under test and its reference as one or two passes.
+  */
+typedef struct
+{
+  const char *name;
+  Test_MorphFunc_t func;
+  uint32_t first;   // TEST_ERODE or TEST_DILATE
+  uint32_t passes;  // 1, or 2 for open / close (second pass is the other op)
+} Test_Morph_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const uint32_t test_widths[] = { 31U, 32U, 33U, 65U };
+
+static const Test_Morph_t test_morphs[] =
+{
+  { "erode",  Vision_MaskErode,  TEST_ERODE,  1U },
+  { "dilate", Vision_MaskDilate, TEST_DILATE, 1U },
+  { "open",   Vision_MaskOpen,   TEST_ERODE,  2U },
+  { "close",  Vision_MaskClose,  TEST_DILATE, 2U },
+};
+
+static uint8_t source[TEST_WIDTH_MAX * TEST_HEIGHT];
+static uint8_t expected[TEST_WIDTH_MAX * TEST_HEIGHT];
+static uint8_t scratch[TEST_WIDTH_MAX * TEST_HEIGHT];
+static uint8_t unpacked[TEST_WIDTH_MAX * TEST_HEIGHT];
+static uint32_t src_words[VISION_MASK_WORDS(TEST_WIDTH_MAX, TEST_HEIGHT)];
+static uint32_t dst_words[VISION_MASK_WORDS(TEST_WIDTH_MAX, TEST_HEIGHT)];
+static uint32_t rows[VISION_MORPH_ROWS_WORDS(TEST_WIDTH_MAX)];
+
+/* Private function prototypes -----------------------------------------------*/
+static void Test_PackRoundTrip(void);
+static void Test_Morphology(void);
+static void Test_Borders(void);
+static void Test_Params(void);
+static void Test_FillNoise(uint8_t *pixels, uint32_t count, uint32_t seed, uint32_t density);
+static void Test_Reference(const uint8_t *in, uint8_t *out, uint32_t width, uint32_t height, uint32_t op);
+static uint32_t Test_MaskMatches(const Vision_Mask_t *mask, const uint8_t *pixels);
+
+int main(void)
+{
+  Test_PackRoundTrip();
+  Test_Morphology();
+  Test_Borders();
+  Test_Params();
+
+  return TEST_RESULT("mask");
+}
+
+// Packing then unpacking gives back the binary image with clear tail bits
+static void Test_PackRoundTrip(void)
+{
+  Vision_Image_t image;
+  Vision_Mask_t mask;
+  uint32_t w;
+  uint32_t y;
+
+  for (w = 0; w < (sizeof(test_widths) / sizeof(test_widths[0])); w++)
+  {
+    uint32_t width = test_widths[w];
+
+    Test_FillNoise(source, width * TEST_HEIGHT, width, 2U);
+    memset(src_words, 0xFF, sizeof(src_words));
+    (void)Vision_MaskInit(&mask, src_words, width, TEST_HEIGHT);
+    (void)Vision_ImageInit(&image, source, width, TEST_HEIGHT, width);
+    TEST_CHECK_EQ(Vision_MaskPack(&image, &mask), VISION_OK);
+    TEST_CHECK_EQ(Test_MaskMatches(&mask, source), 1U);
+
+    (void)Vision_ImageInit(&image, unpacked, width, TEST_HEIGHT, width);
+    TEST_CHECK_EQ(Vision_MaskUnpack(&mask, &image), VISION_OK);
+    for (y = 0; y < (width * TEST_HEIGHT); y++)
+    {
+      if (unpacked[y] != ((source[y] != 0U) ? 255U : 0U))
+      {
+        break;
+      }
+    }
+    TEST_CHECK_EQ(y, width * TEST_HEIGHT);
+  }
+}
+
+// Every operation, width and density against the byte-wise reference, out of place and in place
+static void Test_Morphology(void)
+{
+  Vision_Image_t image;
+  Vision_Mask_t src;
+  Vision_Mask_t dst;
+  uint32_t density;
+  uint32_t m;
+  uint32_t w;
+
+  for (m = 0; m < (sizeof(test_morphs) / sizeof(test_morphs[0])); m++)
+  {
+    const Test_Morph_t *morph = &test_morphs[m];
+
+    for (w = 0; w < (sizeof(test_widths) / sizeof(test_widths[0])); w++)
+    {
+      uint32_t width = test_widths[w];
+
+      for (density = 1U; density <= 3U; density++)
+      {
+        Test_FillNoise(source, width * TEST_HEIGHT, (m * 97U) + (w * 13U) + density, density);
+        Test_Reference(source, (morph->passes == 2U) ? scratch : expected, width, TEST_HEIGHT, morph->first);
+        if (morph->passes == 2U)
+        {
+          Test_Reference(scratch, expected, width, TEST_HEIGHT, TEST_DILATE - morph->first);
+        }
+
+        (void)Vision_MaskInit(&src, src_words, width, TEST_HEIGHT);
+        (void)Vision_MaskInit(&dst, dst_words, width, TEST_HEIGHT);
+        (void)Vision_ImageInit(&image, source, width, TEST_HEIGHT, width);
+        (void)Vision_MaskPack(&image, &src);
+
+        memset(dst_words, 0xFF, sizeof(dst_words));
+        TEST_CHECK_EQ(morph->func(&src, &dst, rows), VISION_OK);
+        if (Test_MaskMatches(&dst, expected) != 1U)
+        {
+          fprintf(stderr, "%s, width %u, density %u/4, out of place\n", morph->name, (unsigned)width,
+                  (unsigned)density);
+          TEST_CHECK(0);
+        }
+
+        TEST_CHECK_EQ(morph->func(&src, &src, rows), VISION_OK);
+        if (Test_MaskMatches(&src, expected) != 1U)
+        {
+          fprintf(stderr, "%s, width %u, density %u/4, in place\n", morph->name, (unsigned)width,
+                  (unsigned)density);
+          TEST_CHECK(0);
+        }
+      }
+    }
+  }
+}
+
+// Set pixels on the border survive erosion, and a full mask stays full
+static void Test_Borders(void)
+{
+  Vision_Image_t image;
+  Vision_Mask_t mask;
+  uint32_t w;
+
+  for (w = 0; w < (sizeof(test_widths) / sizeof(test_widths[0])); w++)
+  {
+    uint32_t width = test_widths[w];
+
+    memset(source, 1, width * TEST_HEIGHT);
+    (void)Vision_MaskInit(&mask, src_words, width, TEST_HEIGHT);
+    (void)Vision_ImageInit(&image, source, width, TEST_HEIGHT, width);
+    (void)Vision_MaskPack(&image, &mask);
+    (void)Vision_MaskErode(&mask, &mask, rows);
+    TEST_CHECK_EQ(Test_MaskMatches(&mask, source), 1U);
+
+    // A lone pixel in the last column grows only inwards
+    memset(source, 0, width * TEST_HEIGHT);
+    source[(4U * width) + width - 1U] = 1U;
+    (void)Vision_MaskPack(&image, &mask);
+    (void)Vision_MaskDilate(&mask, &mask, rows);
+    Test_Reference(source, expected, width, TEST_HEIGHT, TEST_DILATE);
+    TEST_CHECK_EQ(Test_MaskMatches(&mask, expected), 1U);
+    TEST_CHECK_EQ(mask.words[(4U * mask.stride) + mask.stride - 1U] >> ((width - 1U) % 32U), 1U);
+  }
+}
+
+static void Test_Params(void)
+{
+  Vision_Mask_t a;
+  Vision_Mask_t b;
+
+  TEST_CHECK_EQ(Vision_MaskInit(&a, NULL, 8U, 8U), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_MaskInit(&a, src_words, 0U, 8U), VISION_ERR_PARAM);
+  (void)Vision_MaskInit(&a, src_words, 8U, 8U);
+  (void)Vision_MaskInit(&b, dst_words, 9U, 8U);
+  TEST_CHECK_EQ(Vision_MaskErode(&a, &b, rows), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_MaskDilate(&a, &a, NULL), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_MaskOpen(&a, NULL, rows), VISION_ERR_PARAM);
+  TEST_CHECK_EQ(Vision_MaskClose(NULL, &a, rows), VISION_ERR_PARAM);
+}
+
+/**
+  * @brief  Deterministic binary noise.
+  * @param  pixels: buffer to fill with 0 / 1
+  * @param  count: pixels to fill
+  * @param  seed: generator seed
+  * @param  density: quarters of the pixels that are set (1..3)
+  * @retval None
+  */
+static void Test_FillNoise(uint8_t *pixels, uint32_t count, uint32_t seed, uint32_t density)
+{
+  uint32_t state = seed;
+  uint32_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    state = (state * 1103515245U) + 12345U;
+    pixels[i] = (((state >> 16) & 3U) < density) ? 1U : 0U;
+  }
+}
+
+/**
+  * @brief  Byte-wise 3x3 erosion or dilation with replicated borders.
+  * @param  in: 0 / 1 pixels, stride @p width
+  * @param  out: 0 / 1 result, stride @p width
+  * @param  width: pixels per row
+  * @param  height: rows
+  * @param  op: TEST_ERODE or TEST_DILATE
+  * @retval None
+  */
+static void Test_Reference(const uint8_t *in, uint8_t *out, uint32_t width, uint32_t height, uint32_t op)
+{
+  int32_t x;
+  int32_t y;
+  int32_t dx;
+  int32_t dy;
+
+  for (y = 0; y < (int32_t)height; y++)
+  {
+    for (x = 0; x < (int32_t)width; x++)
+    {
+      uint8_t value = (op == TEST_ERODE) ? 1U : 0U;
+
+      for (dy = -1; dy <= 1; dy++)
+      {
+        for (dx = -1; dx <= 1; dx++)
+        {
+          int32_t sx = x + dx;
+          int32_t sy = y + dy;
+
+          sx = (sx < 0) ? 0 : ((sx >= (int32_t)width) ? ((int32_t)width - 1) : sx);
+          sy = (sy < 0) ? 0 : ((sy >= (int32_t)height) ? ((int32_t)height - 1) : sy);
+          if (op == TEST_ERODE)
+          {
+            value &= in[(sy * (int32_t)width) + sx];
+          }
+          else
+          {
+            value |= in[(sy * (int32_t)width) + sx];
+          }
+        }
+      }
+      out[(y * (int32_t)width) + x] = value;
+    }
+  }
+}
+
+/**
+  * @brief  Compare a mask with 0 / 1 pixels; bits past the row end must be clear.
+  * @param  mask: mask to check
+  * @param  pixels: expected pixels, stride mask->width
+  * @retval 1 if they match, 0 otherwise
+  */
+static uint32_t Test_MaskMatches(const Vision_Mask_t *mask, const uint8_t *pixels)
+{
+  uint32_t x;
+  uint32_t y;
+
+  for (y = 0; y < mask->height; y++)
+  {
+    const uint32_t *row = VISION_MASK_ROW(mask, y);
+
+    for (x = 0; x < (mask->stride * 32U); x++)
+    {
+      uint32_t bit = (row[x / 32U] >> (x % 32U)) & 1U;
+      uint32_t want = (x < mask->width) ? pixels[(y * mask->width) + x] : 0U;
+
+      if (bit != want)
+      {
+        return 0U;
+      }
+    }
+  }
+
+  return 1U;
+}
@@ -0,0 +1,324 @@
+/**
+  ******************************************************************************
+  * @file           : test_ov7670.c
+  * @brief          : Host tests of the OV7670 table loader on a fake SCCB bus.
+  ******************************************************************************
+  * The fake bus is a 256-entry register file behind the OV7670_Bus_t
+  * callbacks. It answers the ID registers, clears the reset bit of COM7 by
+  * itself, and changes the registers the sensor's AGC / AEC / AWB own. It
+  * can also hold register bits stuck at zero, to fail a readback, and
+  * NACK a chosen register on write or read.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ov7670.h"
+#include "test.h"
+
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint8_t regs[256];
+  uint8_t stuck[256];       // Bits that always read back as zero
+  uint32_t writes[256];     // Writes per register
+  uint32_t reads[256];      // Reads per register
+  int32_t nack_write;       // Register whose write fails, or -1
+  int32_t nack_read;        // Register whose read fails, or -1
+  uint32_t delay_ms;        // Total delay requested
+} Fake_Sccb_t;
+
+/* Private define ------------------------------------------------------------*/
+#define FAKE_NONE  (-1)
+
+/* Private function prototypes -----------------------------------------------*/
+static void Fake_Init(Fake_Sccb_t *fake, OV7670_Bus_t *bus);
+static int32_t Fake_Write(void *ctx, uint8_t reg, uint8_t value);
+static int32_t Fake_Read(void *ctx, uint8_t reg, uint8_t *value);
+static void Fake_Delay(void *ctx, uint32_t ms);
+static void Test_CheckId(void);
+static void Test_InitPreset(void);
+static void Test_InitParams(void);
+static void Test_SyncOutput(void);
+static void Test_ReadbackMismatch(void);
+static void Test_Nack(void);
+static void Test_WrittenAgain(void);
+static void Test_ClockDivider(void);
+
+int main(void)
+{
+  Test_CheckId();
+  Test_InitPreset();
+  Test_InitParams();
+  Test_SyncOutput();
+  Test_ReadbackMismatch();
+  Test_Nack();
+  Test_WrittenAgain();
+  Test_ClockDivider();
+
+  return TEST_RESULT("ov7670");
+}
+
+static void Test_CheckId(void)
+{
+  Fake_Sccb_t fake;
+  OV7670_Bus_t bus;
+
+  Fake_Init(&fake, &bus);
+  TEST_CHECK_EQ(OV7670_CheckId(&bus), OV7670_OK);
+
+  fake.regs[OV7670_REG_PID] = 0x77U;
+  TEST_CHECK_EQ(OV7670_CheckId(&bus), OV7670_ERR_ID);
+
+  Fake_Init(&fake, &bus);
+  fake.nack_read = OV7670_REG_VER;
+  TEST_CHECK_EQ(OV7670_CheckId(&bus), OV7670_ERR_BUS);
+}
+
+// Full QVGA YUV422 preset: every table written, waited on and read back
+static void Test_InitPreset(void)
+{
+  Fake_Sccb_t fake;
+  OV7670_Bus_t bus;
+
+  Fake_Init(&fake, &bus);
+  TEST_CHECK_EQ(OV7670_Init(&bus, OV7670_RES_QVGA, OV7670_FMT_YUV422), OV7670_OK);
+
+  TEST_CHECK_EQ(fake.writes[OV7670_REG_COM7], 2U);  // Reset, then output format
+  TEST_CHECK_EQ(fake.delay_ms, 10U);
+  TEST_CHECK_EQ(fake.regs[OV7670_REG_COM3], 0x04U);
+  TEST_CHECK_EQ(fake.regs[OV7670_REG_COM14], 0x19U);
+  TEST_CHECK_EQ(fake.regs[OV7670_REG_COM9], 0x48U);  // Format table overrides the defaults
+  TEST_CHECK_EQ(fake.regs[OV7670_REG_COM8], 0xE5U);
+
+  // Readback covered the tables, but skipped what the sensor owns
+  TEST_CHECK(fake.reads[OV7670_REG_COM3] >= 1U);
+  TEST_CHECK(fake.reads[OV7670_REG_COM15] >= 1U);
+  TEST_CHECK_EQ(fake.reads[OV7670_REG_GAIN], 0U);
+  TEST_CHECK_EQ(fake.reads[OV7670_REG_AECH], 0U);
+
+  Fake_Init(&fake, &bus);
+  TEST_CHECK_EQ(OV7670_Init(&bus, OV7670_RES_VGA, OV7670_FMT_BAYER_RAW), OV7670_OK);
+  TEST_CHECK_EQ(fake.regs[OV7670_REG_COM7], 0x01U);
+}
+
+static void Test_InitParams(void)
+{
+  Fake_Sccb_t fake;
+  OV7670_Bus_t bus;
+
+  Fake_Init(&fake, &bus);
+  TEST_CHECK_EQ(OV7670_Init(NULL, OV7670_RES_QVGA, OV7670_FMT_YUV422), OV7670_ERR_PARAM);
+  TEST_CHECK_EQ(OV7670_Init(&bus, OV7670_RES_COUNT, OV7670_FMT_YUV422), OV7670_ERR_PARAM);
+  TEST_CHECK_EQ(OV7670_Init(&bus, OV7670_RES_QVGA, OV7670_FMT_COUNT), OV7670_ERR_PARAM);
+  TEST_CHECK_EQ(OV7670_Init(&bus, OV7670_RES_QQVGA, OV7670_FMT_BAYER_RAW), OV7670_ERR_PARAM);
+
+  // Rejected before any bus traffic
+  TEST_CHECK_EQ(fake.reads[OV7670_REG_PID], 0U);
+  TEST_CHECK_EQ(fake.writes[OV7670_REG_COM7], 0U);
+}
+
+// Every preset leaves the sync outputs as MX_DCMI_Init samples them:
+// HREF / VSYNC active high on their pins, data valid on the PCLK rising edge
+static void Test_SyncOutput(void)
+{
+  static const OV7670_Resolution_t resolutions[] = { OV7670_RES_VGA, OV7670_RES_QVGA, OV7670_RES_QQVGA };
+  Fake_Sccb_t fake;
+  OV7670_Bus_t bus;
+  uint32_t r;
+  uint32_t f;
+
+  TEST_CHECK_EQ(OV7670_COM10_SYNC, 0x00U);
+  for (r = 0; r < (sizeof(resolutions) / sizeof(resolutions[0])); r++)
+  {
+    for (f = 0; f < OV7670_FMT_COUNT; f++)
+    {
+      Fake_Init(&fake, &bus);
+      if (OV7670_Init(&bus, resolutions[r], (OV7670_Format_t)f) != OV7670_OK)
+      {
+        continue;  // Raw Bayer outside VGA, covered by Test_InitParams()
+      }
+      TEST_CHECK_EQ(fake.regs[OV7670_REG_COM10], OV7670_COM10_SYNC);
+      TEST_CHECK_EQ(fake.regs[OV7670_REG_COM10] & (OV7670_COM10_PCLK_REV | OV7670_COM10_HREF_REV |
+                                                   OV7670_COM10_VS_NEG), 0U);
+      TEST_CHECK_EQ(fake.regs[OV7670_REG_COM1] & OV7670_COM1_CCIR656, 0U);
+      TEST_CHECK(fake.writes[OV7670_REG_COM10] >= 1U);
+    }
+  }
+}
+
+static void Test_ReadbackMismatch(void)
+{
+  static const OV7670_Reg_t table[] =
+  {
+    { OV7670_REG_COM3, 0x04 },
+    { OV7670_REG_COM14, 0x19 },
+    { OV7670_REG_COM15, 0xC0 },
+    { OV7670_TABLE_END, 0x00 },
+  };
+  Fake_Sccb_t fake;
+  OV7670_Bus_t bus;
+  uint8_t failed = 0;
+
+  Fake_Init(&fake, &bus);
+  TEST_CHECK_EQ(OV7670_WriteTable(&bus, table), OV7670_OK);
+  TEST_CHECK_EQ(OV7670_VerifyTable(&bus, table, &failed), OV7670_OK);
+
+  fake.stuck[OV7670_REG_COM14] = 0x10U;
+  TEST_CHECK_EQ(OV7670_VerifyTable(&bus, table, &failed), OV7670_ERR_VERIFY);
+  TEST_CHECK_EQ(failed, OV7670_REG_COM14);
+  TEST_CHECK_EQ(OV7670_VerifyTable(&bus, table, NULL), OV7670_ERR_VERIFY);
+
+  // The preset stops at the first table that does not read back
+  Fake_Init(&fake, &bus);
+  fake.stuck[OV7670_REG_TSLB] = 0x04U;
+  TEST_CHECK_EQ(OV7670_Init(&bus, OV7670_RES_QVGA, OV7670_FMT_YUV422), OV7670_ERR_VERIFY);
+  TEST_CHECK_EQ(fake.writes[OV7670_REG_COM3], 0U);
+
+  // Bits the sensor drives are outside the comparison mask
+  Fake_Init(&fake, &bus);
+  fake.stuck[OV7670_REG_VREF] = 0xC0U;
+  TEST_CHECK_EQ(OV7670_Init(&bus, OV7670_RES_QVGA, OV7670_FMT_YUV422), OV7670_OK);
+}
+
+static void Test_Nack(void)
+{
+  static const OV7670_Reg_t table[] =
+  {
+    { OV7670_REG_COM3, 0x04 },
+    { OV7670_REG_COM14, 0x19 },
+    { OV7670_REG_COM15, 0xC0 },
+    { OV7670_TABLE_END, 0x00 },
+  };
+  Fake_Sccb_t fake;
+  OV7670_Bus_t bus;
+
+  // A NACK stops the table at that register
+  Fake_Init(&fake, &bus);
+  fake.nack_write = OV7670_REG_COM14;
+  TEST_CHECK_EQ(OV7670_WriteTable(&bus, table), OV7670_ERR_BUS);
+  TEST_CHECK_EQ(fake.writes[OV7670_REG_COM3], 1U);
+  TEST_CHECK_EQ(fake.writes[OV7670_REG_COM15], 0U);
+
+  Fake_Init(&fake, &bus);
+  (void)OV7670_WriteTable(&bus, table);
+  fake.nack_read = OV7670_REG_COM15;
+  TEST_CHECK_EQ(OV7670_VerifyTable(&bus, table, NULL), OV7670_ERR_BUS);
+
+  Fake_Init(&fake, &bus);
+  fake.nack_write = OV7670_REG_COM7;
+  TEST_CHECK_EQ(OV7670_Init(&bus, OV7670_RES_QVGA, OV7670_FMT_YUV422), OV7670_ERR_BUS);
+  TEST_CHECK_EQ(fake.delay_ms, 0U);
+
+  Fake_Init(&fake, &bus);
+  fake.nack_read = OV7670_REG_COM3;
+  TEST_CHECK_EQ(OV7670_Init(&bus, OV7670_RES_QVGA, OV7670_FMT_YUV422), OV7670_ERR_BUS);
+}
+
+// A register written twice in one table is checked against its last value only
+static void Test_WrittenAgain(void)
+{
+  static const OV7670_Reg_t table[] =
+  {
+    { OV7670_REG_COM8, 0xE0 },
+    { OV7670_REG_COM4, 0x40 },
+    { OV7670_REG_COM8, 0xE5 },
+    { OV7670_TABLE_END, 0x00 },
+  };
+  Fake_Sccb_t fake;
+  OV7670_Bus_t bus;
+
+  Fake_Init(&fake, &bus);
+  TEST_CHECK_EQ(OV7670_WriteTable(&bus, table), OV7670_OK);
+  TEST_CHECK_EQ(OV7670_VerifyTable(&bus, table, NULL), OV7670_OK);
+  TEST_CHECK_EQ(fake.writes[OV7670_REG_COM8], 2U);
+  TEST_CHECK_EQ(fake.reads[OV7670_REG_COM8], 1U);
+}
+
+static void Test_ClockDivider(void)
+{
+  Fake_Sccb_t fake;
+  OV7670_Bus_t bus;
+
+  Fake_Init(&fake, &bus);
+  TEST_CHECK_EQ(OV7670_SetClockDivider(&bus, 1U), OV7670_OK);
+  TEST_CHECK_EQ(fake.regs[OV7670_REG_CLKRC], 0x00U);
+  TEST_CHECK_EQ(OV7670_SetClockDivider(&bus, OV7670_CLKRC_MAX_DIV), OV7670_OK);
+  TEST_CHECK_EQ(fake.regs[OV7670_REG_CLKRC], OV7670_CLKRC_MAX_DIV - 1U);
+  TEST_CHECK_EQ(OV7670_SetClockDivider(&bus, 0U), OV7670_ERR_PARAM);
+  TEST_CHECK_EQ(OV7670_SetClockDivider(&bus, OV7670_CLKRC_MAX_DIV + 1U), OV7670_ERR_PARAM);
+
+  fake.nack_write = OV7670_REG_CLKRC;
+  TEST_CHECK_EQ(OV7670_SetClockDivider(&bus, 2U), OV7670_ERR_BUS);
+}
+
+/**
+  * @brief  Power-on register file with the sensor ID and no faults.
+  * @param  fake: register file to reset
+  * @param  bus: receives the callbacks bound to @p fake
+  * @retval None
+  */
+static void Fake_Init(Fake_Sccb_t *fake, OV7670_Bus_t *bus)
+{
+  memset(fake, 0, sizeof(*fake));
+  fake->regs[OV7670_REG_PID] = OV7670_PID_VALUE;
+  fake->regs[OV7670_REG_VER] = OV7670_VER_VALUE;
+  fake->nack_write = FAKE_NONE;
+  fake->nack_read = FAKE_NONE;
+
+  bus->write = Fake_Write;
+  bus->read = Fake_Read;
+  bus->delay_ms = Fake_Delay;
+  bus->ctx = fake;
+}
+
+static int32_t Fake_Write(void *ctx, uint8_t reg, uint8_t value)
+{
+  Fake_Sccb_t *fake = ctx;
+
+  if ((int32_t)reg == fake->nack_write)
+  {
+    return -1;
+  }
+
+  fake->writes[reg]++;
+  // The reset bit of COM7 clears itself
+  fake->regs[reg] = (reg == OV7670_REG_COM7) ? (uint8_t)(value & (uint8_t)~OV7670_COM7_RESET) : value;
+
+  return 0;
+}
+
+static int32_t Fake_Read(void *ctx, uint8_t reg, uint8_t *value)
+{
+  Fake_Sccb_t *fake = ctx;
+
+  if ((int32_t)reg == fake->nack_read)
+  {
+    return -1;
+  }
+
+  fake->reads[reg]++;
+  switch (reg)
+  {
+    case OV7670_REG_GAIN:
+    case OV7670_REG_BLUE:
+    case OV7670_REG_RED:
+    case OV7670_REG_AECH:
+      // Running AGC / AWB / AEC
+      *value = (uint8_t)(fake->regs[reg] + fake->reads[reg]);
+      break;
+    default:
+      *value = fake->regs[reg] & (uint8_t)~fake->stuck[reg];
+      break;
+  }
+
+  return 0;
+}
+
+static void Fake_Delay(void *ctx, uint32_t ms)
+{
+  Fake_Sccb_t *fake = ctx;
+
+  fake->delay_ms += ms;
+}
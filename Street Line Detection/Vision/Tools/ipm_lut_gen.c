@@ -0,0 +1,369 @@
+/**
+  ******************************************************************************
+  * @file           : ipm_lut_gen.c
+  * @brief          : Host generator of the bird's-eye remap table.
+  ******************************************************************************
+  * Projects the centre of every bird's-eye ground cell into the sensor with
+  * a pinhole camera at a given height and pitch, and writes the resulting
+  * source offsets as a C table plus its header, for Vision_IpmWarp(). All
+  * trigonometry happens here; the firmware only indexes the table.
+  *
+  *   make -C Vision ipm_lut            # regenerate Core/Src/ipm_lut.c
+  *   build/ipm_lut_gen --pitch-deg 8 --output lut.c --header lut.h
+  *
+  * Defaults match the capture configuration in Core/Inc/capture.h: luma of
+  * the bottom half of a 320x240 frame.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision_ipm.h"
+
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  const char *option;
+  char kind;            // 'f' float, 'u' uint32_t
+  void *value;
+} Gen_Option_t;
+
+/* Private define ------------------------------------------------------------*/
+#define GEN_PI          3.14159265358979323846
+#define GEN_PER_LINE    12U   // Table entries per output line
+
+/* Private variables ---------------------------------------------------------*/
+static Vision_IpmCalib_t calib =
+{
+  1200.0f,              // height_mm
+  10.0f,                // pitch_deg
+  300.0f,               // focal_px: about 56 degrees across 320 pixels
+  160.0f, 120.0f,       // cx, cy
+  0U, 120U,             // src_x, src_y
+  320U, 120U, 320U,     // src_width, src_height, src_stride
+  -2000.0f, 2000.0f,    // x_min_mm, x_max_mm
+  2000.0f, 6000.0f,     // z_near_mm, z_far_mm
+  160U, 120U            // width, height
+};
+
+static const Gen_Option_t gen_options[] =
+{
+  { "--height-mm",  'f', &calib.height_mm },
+  { "--pitch-deg",  'f', &calib.pitch_deg },
+  { "--focal-px",   'f', &calib.focal_px },
+  { "--cx",         'f', &calib.cx },
+  { "--cy",         'f', &calib.cy },
+  { "--src-x",      'u', &calib.src_x },
+  { "--src-y",      'u', &calib.src_y },
+  { "--src-width",  'u', &calib.src_width },
+  { "--src-height", 'u', &calib.src_height },
+  { "--src-stride", 'u', &calib.src_stride },
+  { "--x-min-mm",   'f', &calib.x_min_mm },
+  { "--x-max-mm",   'f', &calib.x_max_mm },
+  { "--z-near-mm",  'f', &calib.z_near_mm },
+  { "--z-far-mm",   'f', &calib.z_far_mm },
+  { "--width",      'u', &calib.width },
+  { "--height",     'u', &calib.height },
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static int Gen_Build(const Vision_IpmCalib_t *cfg, uint16_t *offsets, uint32_t *visible);
+static int Gen_WriteSource(FILE *out, const Vision_IpmCalib_t *cfg, const uint16_t *offsets, const char *name,
+                           const char *header);
+static int Gen_WriteHeader(FILE *out, const Vision_IpmCalib_t *cfg, const char *name, const char *header);
+static void Gen_Upper(char *dst, const char *src, size_t size);
+static const char *Gen_BaseName(const char *path);
+static void Gen_Usage(void);
+
+int main(int argc, char *argv[])
+{
+  const char *name = "ipm_lut";
+  const char *source_path = NULL;
+  const char *header_path = NULL;
+  uint16_t *offsets;
+  uint32_t visible;
+  FILE *out;
+  int i;
+
+  for (i = 1; i < argc; i++)
+  {
+    size_t k;
+    int matched = 0;
+
+    if ((i + 1) >= argc)
+    {
+      Gen_Usage();
+      return 2;
+    }
+    if (strcmp(argv[i], "--name") == 0)
+    {
+      name = argv[++i];
+      continue;
+    }
+    if (strcmp(argv[i], "--output") == 0)
+    {
+      source_path = argv[++i];
+      continue;
+    }
+    if (strcmp(argv[i], "--header") == 0)
+    {
+      header_path = argv[++i];
+      continue;
+    }
+    for (k = 0; k < (sizeof(gen_options) / sizeof(gen_options[0])); k++)
+    {
+      if (strcmp(argv[i], gen_options[k].option) == 0)
+      {
+        if (gen_options[k].kind == 'f')
+        {
+          *(float *)gen_options[k].value = strtof(argv[i + 1], NULL);
+        }
+        else
+        {
+          *(uint32_t *)gen_options[k].value = (uint32_t)strtoul(argv[i + 1], NULL, 0);
+        }
+        matched = 1;
+        i++;
+        break;
+      }
+    }
+    if (!matched)
+    {
+      Gen_Usage();
+      return 2;
+    }
+  }
+
+  if ((calib.width == 0U) || (calib.height == 0U) || (calib.src_stride < calib.src_width) ||
+      (calib.x_max_mm <= calib.x_min_mm) || (calib.z_far_mm <= calib.z_near_mm) || (calib.focal_px <= 0.0f) ||
+      (((calib.src_height - 1U) * calib.src_stride) + calib.src_width > VISION_IPM_NONE))
+  {
+    fprintf(stderr, "ipm_lut_gen: invalid geometry (offsets must fit 16 bits)\n");
+    return 1;
+  }
+
+  offsets = malloc(calib.width * calib.height * sizeof(uint16_t));
+  if ((offsets == NULL) || (Gen_Build(&calib, offsets, &visible) != 0))
+  {
+    return 1;
+  }
+
+  out = (source_path != NULL) ? fopen(source_path, "w") : stdout;
+  if ((out == NULL) ||
+      (Gen_WriteSource(out, &calib, offsets, name, (header_path != NULL) ? Gen_BaseName(header_path) : NULL) != 0))
+  {
+    fprintf(stderr, "ipm_lut_gen: cannot write the table\n");
+    return 1;
+  }
+  if (out != stdout)
+  {
+    fclose(out);
+  }
+
+  if (header_path != NULL)
+  {
+    out = fopen(header_path, "w");
+    if ((out == NULL) || (Gen_WriteHeader(out, &calib, name, Gen_BaseName(header_path)) != 0))
+    {
+      fprintf(stderr, "ipm_lut_gen: cannot write the header\n");
+      return 1;
+    }
+    fclose(out);
+  }
+
+  fprintf(stderr, "ipm_lut_gen: %ux%u cells, %u visible (%.0f%%)\n", (unsigned)calib.width,
+          (unsigned)calib.height, (unsigned)visible, (100.0 * visible) / (calib.width * calib.height));
+  free(offsets);
+  return 0;
+}
+
+/**
+  * @brief  Project every ground cell centre into the source image.
+  * @param  cfg: calibration and ground window
+  * @param  offsets: receives width * height entries
+  * @param  visible: receives the number of cells seen by the camera
+  * @retval 0
+  */
+static int Gen_Build(const Vision_IpmCalib_t *cfg, uint16_t *offsets, uint32_t *visible)
+{
+  double pitch = cfg->pitch_deg * (GEN_PI / 180.0);
+  double sin_p = sin(pitch);
+  double cos_p = cos(pitch);
+  double x_step = (cfg->x_max_mm - cfg->x_min_mm) / cfg->width;
+  double z_step = (cfg->z_far_mm - cfg->z_near_mm) / cfg->height;
+  uint32_t i;
+  uint32_t j;
+
+  *visible = 0;
+  for (j = 0; j < cfg->height; j++)
+  {
+    // Row 0 is the far edge of the window
+    double z = cfg->z_far_mm - ((j + 0.5) * z_step);
+
+    for (i = 0; i < cfg->width; i++)
+    {
+      double x = cfg->x_min_mm + ((i + 0.5) * x_step);
+      // Camera frame: x right, y down, z along the optical axis
+      double yc = (cfg->height_mm * cos_p) - (z * sin_p);
+      double zc = (cfg->height_mm * sin_p) + (z * cos_p);
+      uint16_t offset = VISION_IPM_NONE;
+
+      if (zc > 0.0)
+      {
+        double u = floor(cfg->cx + ((cfg->focal_px * x) / zc)) - cfg->src_x;
+        double v = floor(cfg->cy + ((cfg->focal_px * yc) / zc)) - cfg->src_y;
+
+        if ((u >= 0.0) && (v >= 0.0) && (u < cfg->src_width) && (v < cfg->src_height))
+        {
+          offset = (uint16_t)(((uint32_t)v * cfg->src_stride) + (uint32_t)u);
+          (*visible)++;
+        }
+      }
+      offsets[(j * cfg->width) + i] = offset;
+    }
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Write the table source file.
+  * @param  out: destination
+  * @param  cfg: calibration, recorded in the file banner
+  * @param  offsets: table entries
+  * @param  name: C identifier of the table
+  * @param  header: header file name to include, or NULL for vision_ipm.h
+  * @retval 0 on success, -1 on a write error
+  */
+static int Gen_WriteSource(FILE *out, const Vision_IpmCalib_t *cfg, const uint16_t *offsets, const char *name,
+                           const char *header)
+{
+  uint32_t count = cfg->width * cfg->height;
+  char line[64];
+  uint32_t k;
+
+  fprintf(out, "/**\n");
+  fprintf(out, "  ******************************************************************************\n");
+  fprintf(out, "  * @file           : %s.c\n", name);
+  fprintf(out, "  * @brief          : Bird's-eye remap table for Vision_IpmWarp().\n");
+  fprintf(out, "  *                   Generated by Vision/Tools/ipm_lut_gen.c, do not edit.\n");
+  fprintf(out, "  ******************************************************************************\n");
+  fprintf(out, "  * Camera     : %.1f mm high, pitch %.2f deg, focal %.1f px, centre (%.1f, %.1f)\n",
+          cfg->height_mm, cfg->pitch_deg, cfg->focal_px, cfg->cx, cfg->cy);
+  fprintf(out, "  * Source     : %ux%u at (%u, %u) on the sensor, stride %u\n", (unsigned)cfg->src_width,
+          (unsigned)cfg->src_height, (unsigned)cfg->src_x, (unsigned)cfg->src_y, (unsigned)cfg->src_stride);
+  fprintf(out, "  * Ground     : x %.0f..%.0f mm, z %.0f..%.0f mm, %ux%u cells\n", cfg->x_min_mm, cfg->x_max_mm,
+          cfg->z_near_mm, cfg->z_far_mm, (unsigned)cfg->width, (unsigned)cfg->height);
+  fprintf(out, "  ******************************************************************************\n");
+  fprintf(out, "  */\n\n");
+  fprintf(out, "/* Includes ------------------------------------------------------------------*/\n");
+  fprintf(out, "#include \"%s\"\n\n", (header != NULL) ? header : "vision_ipm.h");
+  fprintf(out, "/* Private variables ---------------------------------------------------------*/\n");
+  fprintf(out, "static const uint16_t %s_offsets[%u] =\n{\n", name, (unsigned)count);
+  for (k = 0; k < count; k++)
+  {
+    fprintf(out, "%s0x%04X,%s", ((k % GEN_PER_LINE) == 0U) ? "  " : " ", offsets[k],
+            (((k % GEN_PER_LINE) == (GEN_PER_LINE - 1U)) || ((k + 1U) == count)) ? "\n" : "");
+  }
+  fprintf(out, "};\n\n");
+  fprintf(out, "/* Exported variables --------------------------------------------------------*/\n");
+  fprintf(out, "const Vision_IpmLut_t %s =\n{\n", name);
+  fprintf(out, "  %s_offsets,\n", name);
+  snprintf(line, sizeof(line), "%uU, %uU,", (unsigned)cfg->width, (unsigned)cfg->height);
+  fprintf(out, "  %-22s// width, height\n", line);
+  snprintf(line, sizeof(line), "%uU, %uU, %uU,", (unsigned)cfg->src_width, (unsigned)cfg->src_height,
+           (unsigned)cfg->src_stride);
+  fprintf(out, "  %-22s// src_width, src_height, src_stride\n", line);
+  snprintf(line, sizeof(line), "%ld, %ld,",
+           lround(cfg->x_min_mm + ((cfg->x_max_mm - cfg->x_min_mm) / (2.0 * cfg->width))),
+           lround(cfg->z_far_mm - ((cfg->z_far_mm - cfg->z_near_mm) / (2.0 * cfg->height))));
+  fprintf(out, "  %-22s// x_min_mm, z_far_mm (cell centres)\n", line);
+  snprintf(line, sizeof(line), "%luU, %luU",
+           (unsigned long)lround((1000.0 * (cfg->x_max_mm - cfg->x_min_mm)) / cfg->width),
+           (unsigned long)lround((1000.0 * (cfg->z_far_mm - cfg->z_near_mm)) / cfg->height));
+  fprintf(out, "  %-22s// x_step_um, z_step_um\n", line);
+  fprintf(out, "};\n");
+
+  return ferror(out) ? -1 : 0;
+}
+
+/**
+  * @brief  Write the table header file.
+  * @param  out: destination
+  * @param  cfg: calibration, for the size macros
+  * @param  name: C identifier of the table
+  * @param  header: header file name, for the include guard
+  * @retval 0 on success, -1 on a write error
+  */
+static int Gen_WriteHeader(FILE *out, const Vision_IpmCalib_t *cfg, const char *name, const char *header)
+{
+  char guard[64];
+  char prefix[64];
+
+  Gen_Upper(guard, header, sizeof(guard));
+  Gen_Upper(prefix, name, sizeof(prefix));
+
+  fprintf(out, "/**\n");
+  fprintf(out, "  ******************************************************************************\n");
+  fprintf(out, "  * @file           : %s\n", header);
+  fprintf(out, "  * @brief          : Header for %s.c file.\n", name);
+  fprintf(out, "  *                   Generated by Vision/Tools/ipm_lut_gen.c, do not edit.\n");
+  fprintf(out, "  ******************************************************************************\n");
+  fprintf(out, "  */\n\n");
+  fprintf(out, "/* Define to prevent recursive inclusion -------------------------------------*/\n");
+  fprintf(out, "#ifndef __%s\n#define __%s\n\n", guard, guard);
+  fprintf(out, "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n");
+  fprintf(out, "/* Includes ------------------------------------------------------------------*/\n");
+  fprintf(out, "#include \"vision_ipm.h\"\n\n");
+  fprintf(out, "/* Exported constants --------------------------------------------------------*/\n");
+  fprintf(out, "#define %s_WIDTH   %uU  // Bird's-eye columns\n", prefix, (unsigned)cfg->width);
+  fprintf(out, "#define %s_HEIGHT  %uU  // Bird's-eye rows, far to near\n\n", prefix, (unsigned)cfg->height);
+  fprintf(out, "/* Exported variables --------------------------------------------------------*/\n");
+  fprintf(out, "extern const Vision_IpmLut_t %s;\n\n", name);
+  fprintf(out, "#ifdef __cplusplus\n}\n#endif\n\n");
+  fprintf(out, "#endif /* __%s */\n", guard);
+
+  return ferror(out) ? -1 : 0;
+}
+
+/**
+  * @brief  Upper-case identifier from a name, other characters as '_'.
+  * @param  dst: destination
+  * @param  src: source name
+  * @param  size: capacity of @p dst
+  * @retval None
+  */
+static void Gen_Upper(char *dst, const char *src, size_t size)
+{
+  size_t k;
+
+  for (k = 0; (src[k] != '\0') && ((k + 1U) < size); k++)
+  {
+    dst[k] = isalnum((unsigned char)src[k]) ? (char)toupper((unsigned char)src[k]) : '_';
+  }
+  dst[k] = '\0';
+}
+
+static const char *Gen_BaseName(const char *path)
+{
+  const char *slash = strrchr(path, '/');
+
+  return (slash != NULL) ? (slash + 1) : path;
+}
+
+static void Gen_Usage(void)
+{
+  size_t k;
+
+  fprintf(stderr, "usage: ipm_lut_gen [--name id] [--output file.c] [--header file.h]");
+  for (k = 0; k < (sizeof(gen_options) / sizeof(gen_options[0])); k++)
+  {
+    fprintf(stderr, " [%s n]", gen_options[k].option);
+  }
+  fprintf(stderr, "\n");
+}
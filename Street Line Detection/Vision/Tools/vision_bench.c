@@ -0,0 +1,498 @@
+/**
+  ******************************************************************************
+  * @file           : vision_bench.c
+  * @brief          : Host throughput benchmark for the vision kernels.
+  ******************************************************************************
+  * Runs each stage on a synthetic road image (bright lane stripes on a noisy
+  * grey background) at 640x480, 320x240 and 160x120 and prints the time per
+  * frame. Host numbers only rank variants against each other; the board is
+  * still the reference for the frame budget.
+  *
+  *   make -C Vision bench && Vision/build/vision_bench [iterations]
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "vision.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  const char *name;
+  void (*run)(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+  void (*prepare)(Vision_Image_t *image, uint8_t *work);  // Untimed input conversion, or NULL
+} Bench_Stage_t;
+
+/* Private define ------------------------------------------------------------*/
+#define BENCH_ITERATIONS  200U
+// Work area layout: line buffers first, then a frame-sized map
+#define BENCH_WORK_ROWS   0U                  // Gaussian ring
+#define BENCH_WORK_ROWS2  (32U * 1024U)       // Second ring of fused stages
+#define BENCH_WORK_STACK  (64U * 1024U)       // Canny stack
+#define BENCH_WORK_MAP    (128U * 1024U)      // Intermediate frame or packed mask
+#define BENCH_WORK_ACC    (512U * 1024U)      // Hough accumulator, adaptive threshold rows
+#define BENCH_ACC_WORDS   VISION_HOUGH_ACC_WORDS(640U, 480U, 180U)
+#define BENCH_WORK_BYTES  (BENCH_WORK_ACC + (BENCH_ACC_WORDS * 2U))
+#define BENCH_STACK_DEPTH 1024U
+#define BENCH_LANE_PIXELS 4096U
+#define BENCH_RUNS        8192U
+#define BENCH_BLOBS       256U
+
+/* Private variables ---------------------------------------------------------*/
+static const uint32_t bench_sizes[][2] = { { 640U, 480U }, { 320U, 240U }, { 160U, 120U } };
+
+/* Private function prototypes -----------------------------------------------*/
+static void Bench_Gauss3(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_Gauss5(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_Sobel(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_GaussThenSobel(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_Edge(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_EdgeHistogram(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_Canny(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_Adaptive3(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_Adaptive15(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_Histogram(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_HoughFull(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_HoughLanes(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_HoughPpht(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_Hough(const Vision_Image_t *edges, uint8_t *work, int32_t theta_min, int32_t theta_max);
+static void Bench_LaneWindow(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_LaneAround(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_LaneFit(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_ErodeBytes(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_MaskPack(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_MaskErode(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_MaskClose(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_BlobRuns(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_BlobLabel(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work);
+static void Bench_LaneSearch(const Vision_Image_t *src, Vision_LanePixels_t *left, Vision_LanePixels_t *right);
+static void Bench_ToEdges(Vision_Image_t *image, uint8_t *work);
+static void Bench_ToBinary(Vision_Image_t *image, uint8_t *work);
+static void Bench_ToMask(Vision_Image_t *image, uint8_t *work);
+static void Bench_FillRoad(Vision_Image_t *image);
+static double Bench_Seconds(void);
+
+static const Bench_Stage_t bench_stages[] =
+{
+  { "gauss 3x3", Bench_Gauss3, NULL },
+  { "gauss 5x5", Bench_Gauss5, NULL },
+  { "sobel", Bench_Sobel, NULL },
+  { "gauss+sobel", Bench_GaussThenSobel, NULL },
+  { "edge fused", Bench_Edge, NULL },
+  { "edge+hist", Bench_EdgeHistogram, NULL },
+  { "canny", Bench_Canny, NULL },
+  { "adapt 7x7", Bench_Adaptive3, NULL },
+  { "adapt 31x31", Bench_Adaptive15, NULL },
+  { "histogram", Bench_Histogram, NULL },
+  { "hough 180", Bench_HoughFull, Bench_ToEdges },
+  { "hough lanes", Bench_HoughLanes, Bench_ToEdges },
+  { "hough ppht", Bench_HoughPpht, Bench_ToEdges },
+  { "lane window", Bench_LaneWindow, Bench_ToBinary },
+  { "lane around", Bench_LaneAround, Bench_ToBinary },
+  { "lane fit", Bench_LaneFit, Bench_ToBinary },
+  { "erode bytes", Bench_ErodeBytes, Bench_ToBinary },
+  { "mask pack", Bench_MaskPack, Bench_ToBinary },
+  { "mask erode", Bench_MaskErode, Bench_ToMask },
+  { "mask close", Bench_MaskClose, Bench_ToMask },
+  { "blob runs", Bench_BlobRuns, Bench_ToMask },
+  { "blob label", Bench_BlobLabel, Bench_ToMask },
+};
+
+int main(int argc, char *argv[])
+{
+  uint32_t iterations = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : BENCH_ITERATIONS;
+  uint8_t *work = malloc(BENCH_WORK_BYTES);
+  size_t s;
+  size_t k;
+
+  if ((work == NULL) || (iterations == 0U))
+  {
+    return 1;
+  }
+
+  printf("%-12s %9s %10s %10s\n", "stage", "size", "us/frame", "Mpix/s");
+  for (s = 0; s < (sizeof(bench_stages) / sizeof(bench_stages[0])); s++)
+  {
+    for (k = 0; k < (sizeof(bench_sizes) / sizeof(bench_sizes[0])); k++)
+    {
+      uint32_t width = bench_sizes[k][0];
+      uint32_t height = bench_sizes[k][1];
+      uint8_t *pixels = malloc(width * height);
+      uint8_t *output = malloc(width * height);
+      Vision_Image_t image;
+      Vision_Image_t result;
+      double start;
+      double per_frame;
+      uint32_t i;
+
+      if ((pixels == NULL) || (output == NULL) ||
+          (Vision_ImageInit(&image, pixels, width, height, width) != VISION_OK) ||
+          (Vision_ImageInit(&result, output, width, height, width) != VISION_OK))
+      {
+        return 1;
+      }
+
+      Bench_FillRoad(&image);
+      if (bench_stages[s].prepare != NULL)
+      {
+        bench_stages[s].prepare(&image, work);
+      }
+      bench_stages[s].run(&image, &result, work);  // Warm up caches
+
+      start = Bench_Seconds();
+      for (i = 0; i < iterations; i++)
+      {
+        bench_stages[s].run(&image, &result, work);
+      }
+      per_frame = (Bench_Seconds() - start) / iterations;
+
+      printf("%-12s %4lux%-4lu %10.1f %10.1f\n", bench_stages[s].name, (unsigned long)width,
+             (unsigned long)height, per_frame * 1e6, ((double)width * height) / (per_frame * 1e6));
+      free(pixels);
+      free(output);
+    }
+  }
+
+  free(work);
+  return 0;
+}
+
+static void Bench_Gauss3(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  (void)Vision_GaussBlur(src, dst, VISION_GAUSS_3X3, (uint16_t *)(work + BENCH_WORK_ROWS));
+}
+
+static void Bench_Gauss5(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  (void)Vision_GaussBlur(src, dst, VISION_GAUSS_5X5, (uint16_t *)(work + BENCH_WORK_ROWS));
+}
+
+static void Bench_Sobel(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  (void)Vision_Sobel(src, dst, VISION_SOBEL_SHIFT_DEFAULT, work + BENCH_WORK_ROWS2);
+}
+
+static void Bench_GaussThenSobel(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  (void)Vision_GaussBlur(src, dst, VISION_GAUSS_5X5, (uint16_t *)(work + BENCH_WORK_ROWS));
+  (void)Vision_Sobel(dst, dst, VISION_SOBEL_SHIFT_DEFAULT, work + BENCH_WORK_ROWS2);
+}
+
+static void Bench_Edge(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  (void)Vision_Edge(src, dst, VISION_GAUSS_5X5, VISION_SOBEL_SHIFT_DEFAULT, (uint16_t *)(work + BENCH_WORK_ROWS),
+                    work + BENCH_WORK_ROWS2);
+}
+
+// The firmware loop: each frame row is counted as it is fed to the edge stage
+static void Bench_EdgeHistogram(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  Vision_Histogram_t *hist = (Vision_Histogram_t *)(work + BENCH_WORK_STACK);
+  Vision_HistogramStats_t stats;
+  Vision_Edge_t edge;
+  uint32_t y;
+
+  Vision_HistogramReset(hist);
+  (void)Vision_EdgeInit(&edge, src->width, VISION_GAUSS_5X5, VISION_SOBEL_SHIFT_DEFAULT,
+                        (uint16_t *)(work + BENCH_WORK_ROWS), work + BENCH_WORK_ROWS2);
+  for (y = 0; y < src->height; y++)
+  {
+    Vision_HistogramPushRow(hist, VISION_ROW(src, y), src->width);
+    (void)Vision_EdgePush(&edge, VISION_ROW(src, y), VISION_ROW(dst, edge.sobel.emitted));
+  }
+  while (Vision_EdgeFlush(&edge, VISION_ROW(dst, edge.sobel.emitted)) > 0)
+  {
+  }
+  (void)Vision_HistogramStats(hist, VISION_HISTOGRAM_LOW_DEFAULT, VISION_HISTOGRAM_HIGH_DEFAULT, &stats);
+}
+
+static void Bench_Canny(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  const Vision_CannyParams_t params = { VISION_CANNY_LOW_DEFAULT, VISION_CANNY_HIGH_DEFAULT };
+  Vision_CannyStack_t stack = { (uint32_t *)(work + BENCH_WORK_STACK), BENCH_STACK_DEPTH, 0, 0 };
+  Vision_Image_t grad;
+
+  (void)Vision_ImageInit(&grad, work + BENCH_WORK_MAP, src->width, src->height, src->width);
+  Bench_Edge(src, &grad, work);
+  (void)Vision_Canny(&grad, dst, &params, &stack);
+}
+
+static void Bench_Adaptive3(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  (void)Vision_AdaptiveThreshold(src, dst, 3U, VISION_ADAPTIVE_OFFSET_DEFAULT, (uint32_t *)(work + BENCH_WORK_ACC));
+}
+
+static void Bench_Adaptive15(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  (void)Vision_AdaptiveThreshold(src, dst, 15U, VISION_ADAPTIVE_OFFSET_DEFAULT, (uint32_t *)(work + BENCH_WORK_ACC));
+}
+
+static void Bench_Histogram(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  Vision_Histogram_t *hist = (Vision_Histogram_t *)(work + BENCH_WORK_ROWS);
+  Vision_HistogramStats_t stats;
+
+  (void)dst;
+  Vision_HistogramReset(hist);
+  (void)Vision_HistogramPush(hist, src);
+  (void)Vision_HistogramStats(hist, VISION_HISTOGRAM_LOW_DEFAULT, VISION_HISTOGRAM_HIGH_DEFAULT, &stats);
+}
+
+static void Bench_HoughFull(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  (void)dst;
+  Bench_Hough(src, work, VISION_HOUGH_THETA_MIN, VISION_HOUGH_THETA_MAX);
+}
+
+static void Bench_HoughLanes(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  (void)dst;
+  Bench_Hough(src, work, VISION_HOUGH_LANE_THETA_MIN, VISION_HOUGH_LANE_THETA_MAX);
+}
+
+static void Bench_HoughPpht(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  const Vision_HoughParams_t params = { VISION_HOUGH_LANE_THETA_MIN, VISION_HOUGH_LANE_THETA_MAX, 1U };
+  const Vision_PphtParams_t ppht = { src->height / 8U, src->height / 16U, 3U, 1U };
+  Vision_Hough_t hough;
+  Vision_HoughSegment_t segments[16];
+
+  // The edge map is consumed, so vote a copy (the copy is timed too)
+  (void)Vision_ImageCopy(src, dst);
+  (void)Vision_HoughInit(&hough, src->width, src->height, &params, (uint16_t *)(work + BENCH_WORK_ACC),
+                         BENCH_ACC_WORDS);
+  (void)Vision_HoughProbabilistic(&hough, dst, &ppht, (uint32_t *)(work + BENCH_WORK_MAP),
+                                  (BENCH_WORK_ACC - BENCH_WORK_MAP) / sizeof(uint32_t), segments, 16U);
+}
+
+static void Bench_Hough(const Vision_Image_t *edges, uint8_t *work, int32_t theta_min, int32_t theta_max)
+{
+  const Vision_HoughParams_t params = { theta_min, theta_max, 1U };
+  Vision_Hough_t hough;
+  Vision_HoughLine_t lines[4];
+
+  (void)Vision_HoughInit(&hough, edges->width, edges->height, &params, (uint16_t *)(work + BENCH_WORK_ACC),
+                         BENCH_ACC_WORDS);
+  (void)Vision_HoughVote(&hough, edges);
+  (void)Vision_HoughPeaks(&hough, edges->height / 4U, lines, 4U);
+}
+
+static void Bench_LaneWindow(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  const Vision_LaneSearchParams_t params = { VISION_LANE_WINDOWS_DEFAULT, VISION_LANE_MARGIN_DEFAULT,
+                                             VISION_LANE_RECENTRE_DEFAULT, VISION_LANE_SEED_DEFAULT };
+  uint16_t *store = (uint16_t *)(work + BENCH_WORK_MAP);
+  Vision_LanePixels_t left = { store, store + BENCH_LANE_PIXELS, BENCH_LANE_PIXELS, 0, 0, { 0 } };
+  Vision_LanePixels_t right = { store + (2U * BENCH_LANE_PIXELS), store + (3U * BENCH_LANE_PIXELS),
+                                BENCH_LANE_PIXELS, 0, 0, { 0 } };
+
+  (void)dst;
+  (void)Vision_LaneSlidingWindow(src, &params, (uint16_t *)(work + BENCH_WORK_ROWS), &left, &right);
+}
+
+static void Bench_LaneAround(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  Vision_LanePixels_t left = { NULL, NULL, 0, 0, 0, { 0 } };
+  Vision_LanePixels_t right = { NULL, NULL, 0, 0, 0, { 0 } };
+
+  (void)dst;
+  (void)work;
+  Bench_LaneSearch(src, &left, &right);
+}
+
+static void Bench_LaneFit(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  Vision_LanePixels_t left = { NULL, NULL, 0, 0, 0, { 0 } };
+  Vision_LanePixels_t right = { NULL, NULL, 0, 0, 0, { 0 } };
+  Vision_LaneFit_t left_fit;
+  Vision_LaneFit_t right_fit;
+
+  (void)dst;
+  (void)work;
+  Bench_LaneSearch(src, &left, &right);
+  (void)Vision_LaneFitSolve(&left.sums, &left_fit);
+  (void)Vision_LaneFitSolve(&right.sums, &right_fit);
+}
+
+/**
+  * @brief  Search around the centre lines of the stripes drawn by
+  *         Bench_FillRoad(), keeping the fit sums only.
+  * @param  src: binary road image
+  * @param  left: receives the left lane pixels
+  * @param  right: receives the right lane pixels
+  * @retval None
+  */
+static void Bench_LaneSearch(const Vision_Image_t *src, Vision_LanePixels_t *left, Vision_LanePixels_t *right)
+{
+  float slope = (float)src->width / (4.0f * (float)src->height);
+  float offset = (float)src->width / 4.0f;
+  const Vision_LaneFit_t left_fit = { 0.0f, -slope, offset, 0.0f, 0U, 1U };
+  const Vision_LaneFit_t right_fit = { 0.0f, slope, (float)src->width - offset, 0.0f, 0U, 1U };
+
+  (void)Vision_LaneSearchAround(src, &left_fit, VISION_LANE_MARGIN_DEFAULT, left);
+  (void)Vision_LaneSearchAround(src, &right_fit, VISION_LANE_MARGIN_DEFAULT, right);
+}
+
+/**
+  * @brief  Byte-per-pixel 3x3 erosion of the interior, the baseline of the
+  *         packed mask stages.
+  */
+static void Bench_ErodeBytes(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  uint32_t x;
+  uint32_t y;
+
+  (void)work;
+  for (y = 1U; (y + 1U) < src->height; y++)
+  {
+    const uint8_t *above = VISION_ROW(src, y - 1U);
+    const uint8_t *centre = VISION_ROW(src, y);
+    const uint8_t *below = VISION_ROW(src, y + 1U);
+    uint8_t *out = VISION_ROW(dst, y);
+
+    for (x = 1U; (x + 1U) < src->width; x++)
+    {
+      out[x] = above[x - 1U] & above[x] & above[x + 1U] & centre[x - 1U] & centre[x] & centre[x + 1U] &
+               below[x - 1U] & below[x] & below[x + 1U];
+    }
+  }
+}
+
+static void Bench_MaskPack(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  Vision_Mask_t mask;
+
+  (void)dst;
+  (void)Vision_MaskInit(&mask, (uint32_t *)(work + BENCH_WORK_MAP), src->width, src->height);
+  (void)Vision_MaskPack(src, &mask);
+}
+
+static void Bench_MaskErode(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  Vision_Mask_t mask;
+  Vision_Mask_t eroded;
+
+  (void)dst;
+  (void)Vision_MaskInit(&mask, (uint32_t *)(work + BENCH_WORK_MAP), src->width, src->height);
+  (void)Vision_MaskInit(&eroded, (uint32_t *)(work + BENCH_WORK_ACC), src->width, src->height);
+  (void)Vision_MaskErode(&mask, &eroded, (uint32_t *)(work + BENCH_WORK_ROWS));
+}
+
+static void Bench_MaskClose(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  Vision_Mask_t mask;
+  Vision_Mask_t closed;
+
+  (void)dst;
+  (void)Vision_MaskInit(&mask, (uint32_t *)(work + BENCH_WORK_MAP), src->width, src->height);
+  (void)Vision_MaskInit(&closed, (uint32_t *)(work + BENCH_WORK_ACC), src->width, src->height);
+  (void)Vision_MaskClose(&mask, &closed, (uint32_t *)(work + BENCH_WORK_ROWS));
+}
+
+static void Bench_BlobRuns(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  Vision_Mask_t mask;
+  Vision_Runs_t runs = { (Vision_Run_t *)(work + BENCH_WORK_ACC), BENCH_RUNS, 0, 0 };
+
+  (void)dst;
+  (void)Vision_MaskInit(&mask, (uint32_t *)(work + BENCH_WORK_MAP), src->width, src->height);
+  (void)Vision_RunsFromMask(&mask, &runs);
+}
+
+static void Bench_BlobLabel(const Vision_Image_t *src, Vision_Image_t *dst, uint8_t *work)
+{
+  Vision_Mask_t mask;
+  Vision_Runs_t runs = { (Vision_Run_t *)(work + BENCH_WORK_ACC), BENCH_RUNS, 0, 0 };
+
+  (void)dst;
+  (void)Vision_MaskInit(&mask, (uint32_t *)(work + BENCH_WORK_MAP), src->width, src->height);
+  (void)Vision_RunsFromMask(&mask, &runs);
+  (void)Vision_BlobLabel(&runs, (Vision_Blob_t *)(work + BENCH_WORK_ROWS2), BENCH_BLOBS);
+}
+
+/**
+  * @brief  Replace the road image by its Canny edges.
+  * @param  image: image to convert
+  * @param  work: bench work area
+  * @retval None
+  */
+static void Bench_ToEdges(Vision_Image_t *image, uint8_t *work)
+{
+  Vision_Image_t edges;
+
+  (void)Vision_ImageInit(&edges, work + BENCH_WORK_ACC, image->width, image->height, image->width);
+  Bench_Canny(image, &edges, work);
+  (void)Vision_ImageCopy(&edges, image);
+}
+
+/**
+  * @brief  Keep only the lane stripes of the road image.
+  * @param  image: image to convert
+  * @param  work: bench work area
+  * @retval None
+  */
+static void Bench_ToBinary(Vision_Image_t *image, uint8_t *work)
+{
+  (void)work;
+  (void)Vision_ImageThreshold(image, image, 200U);
+}
+
+/**
+  * @brief  Keep only the lane stripes, packed into a mask in the work area.
+  * @param  image: image to convert
+  * @param  work: bench work area
+  * @retval None
+  */
+static void Bench_ToMask(Vision_Image_t *image, uint8_t *work)
+{
+  Vision_Mask_t mask;
+
+  Bench_ToBinary(image, work);
+  (void)Vision_MaskInit(&mask, (uint32_t *)(work + BENCH_WORK_MAP), image->width, image->height);
+  (void)Vision_MaskPack(image, &mask);
+}
+
+/**
+  * @brief  Draw two converging lane stripes over a noisy background.
+  * @param  image: image to fill
+  * @retval None
+  */
+static void Bench_FillRoad(Vision_Image_t *image)
+{
+  uint32_t x;
+  uint32_t y;
+  uint32_t seed = 1U;
+
+  for (y = 0; y < image->height; y++)
+  {
+    uint8_t *row = VISION_ROW(image, y);
+    uint32_t half = (image->width * (image->height + y)) / (4U * image->height);
+    uint32_t stripe = (image->width / 40U) + 1U;
+
+    for (x = 0; x < image->width; x++)
+    {
+      seed = (seed * 1103515245U) + 12345U;
+      row[x] = (uint8_t)(80U + ((seed >> 16) & 0x1FU));
+      if (((x + half) >= (image->width / 2U)) && ((x + half) < ((image->width / 2U) + stripe)))
+      {
+        row[x] = 220U;
+      }
+      if ((x >= ((image->width / 2U) + half - stripe)) && (x < ((image->width / 2U) + half)))
+      {
+        row[x] = 220U;
+      }
+    }
+  }
+}
+
+static double Bench_Seconds(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec + ((double)now.tv_nsec * 1e-9);
+}